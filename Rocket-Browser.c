@@ -2,6 +2,7 @@
 #include <webkit2/webkit2.h>
 #include <stdio.h>
 #include <glib.h>
+#include <glib/gstdio.h>
 #include <netdb.h>
 #include <arpa/inet.h>
 #include <sqlite3.h>
@@ -21,12 +22,18 @@
 #include <openssl/err.h>
 #include <sys/wait.h>
 #include <errno.h>
+#include <unistd.h>
+
+#include "omnibox.h"     // URL-entry classifier and PSL lookups
+#include "theme_css.h"  // Generated by tools/gen_theme_css.py
 
 // At the start of file, after includes, before any structures:
 
 // Forward declare structures to resolve circular dependencies
 typedef struct _BrowserTab BrowserTab;
 typedef struct _VPNConnection VPNConnection;
+typedef struct _BrowserData BrowserData;
+typedef struct _InterceptData InterceptData;
 
 // Define VPN structure
 struct _VPNConnection {
@@ -37,28 +44,263 @@ struct _VPNConnection {
     GPid vpn_pid;         // Process ID for OpenVPN
     char* last_error;
     GtkWidget* config_label;  // Add label to show loaded config
+    guint watch_id;           // Child watch on vpn_pid
+    gboolean orphaned;        // Its tab is gone; on_vpn_exit() frees it
 };
 
+// Storage service: a single SQLite connection (browser.db with the other
+// databases ATTACHed) owned by a dedicated I/O thread. Work functions run on
+// that thread; done callbacks are dispatched back on the GTK main loop.
+typedef void (*StorageWorkFunc)(sqlite3* db, gpointer job_data);
+typedef void (*StorageDoneFunc)(gpointer job_data);
+
+typedef struct {
+    GThread* thread;
+    GAsyncQueue* jobs;
+    gchar* data_dir;      // NULL keeps every database in memory
+    sqlite3* db;          // Only touched from the I/O thread
+} BrowserStorage;
+
+typedef struct {
+    StorageWorkFunc work;
+    StorageDoneFunc done;
+    gpointer job_data;
+    GDestroyNotify destroy;
+    gboolean shutdown;    // Sentinel that stops the I/O thread
+} StorageJob;
+
 // Add structures for history and cookies
 typedef struct {
-    sqlite3* db;
+    BrowserStorage* storage;
     GtkWidget* history_window;
     GtkListStore* history_store;
+    guint prune_source;       // Periodic retention timer
+    gboolean prune_running;   // A batch chain is in flight
 } BrowserHistory;
 
 typedef struct {
-    sqlite3* db;
+    BrowserStorage* storage;
     GtkWidget* cookie_window;
     GtkListStore* cookie_store;
+    WebKitCookieManager* manager;
+    GHashTable* jar;          // Registrable domain -> GPtrArray of JarCookie
+    guint sweep_source;
+    guint reload_source;
+    gboolean incremental;     // cookies.jar_changes is being filled; see cookie_jar_sync()
 } BrowserCookies;
 
+// In-memory settings backed by the settings table
+typedef struct _BrowserSettings BrowserSettings;
+typedef void (*SettingsChangedFunc)(BrowserSettings* settings, const char* key, gpointer user_data);
+
+struct _BrowserSettings {
+    BrowserStorage* storage;
+    GHashTable* values;       // name -> value
+    GHashTable* dirty;        // Names changed since the last flush
+    GPtrArray* watches;       // SettingsWatch
+    guint flush_source;
+    gboolean loaded;
+};
+
+typedef struct {
+    BrowserStorage* storage;
+    GHashTable* urls;         // Normalized URL -> number of bookmarks
+    gboolean loaded;
+} BrowserBookmarks;
+
+#define DNS_POSITIVE_TTL 300        // Seconds a successful lookup is trusted
+#define DNS_NEGATIVE_TTL 30         // Seconds a NXDOMAIN answer is trusted
+#define DNS_CACHE_MAX_ENTRIES 512   // Expired entries are swept past this size
+
+typedef enum {
+    DNS_UNKNOWN,
+    DNS_PENDING,
+    DNS_RESOLVABLE,
+    DNS_NOT_FOUND
+} DnsState;
+
+typedef void (*DnsResultFunc)(const char* host, DnsState state, gpointer user_data);
+
+typedef struct {
+    DnsResultFunc func;
+    gpointer user_data;
+    GDestroyNotify destroy;
+} DnsWaiter;
+
+typedef struct {
+    DnsState state;
+    gint64 expires;           // Monotonic time, unused while pending
+    GSList* waiters;          // DnsWaiter, notified when a lookup completes
+} DnsEntry;
+
+typedef struct {
+    GResolver* resolver;
+    GCancellable* cancellable;
+    GHashTable* entries;      // Host -> DnsEntry
+} DnsCache;
+
+#define PREFETCH_DEBOUNCE 150       // ms after the last keystroke
+#define PREFETCH_WINDOW 60          // Seconds a prefetched host can be credited
+#define PREFETCH_MIN_PREFIX 3       // Shortest entry text looked up in history
+
+typedef struct {
+    GHashTable* hosts;        // Host -> monotonic time it was prefetched
+    guint issued;
+    guint used;               // Navigations to a host prefetched within the window
+} PrefetchStats;
+
+#define SUGGEST_CACHE_SIZE 64       // Prefixes kept in the suggestion LRU
+#define SUGGEST_MAX_RESULTS 8
+#define SUGGEST_TIMEOUT 3           // Seconds per suggestion request
+
+typedef struct {
+    const char* name;
+    const char* search_url;   // {searchTerms} is replaced by the escaped query
+    const char* suggest_url;
+} SearchEngine;
+
+typedef struct {
+    gchar* key;
+    gchar** suggestions;
+} SuggestEntry;
+
+typedef struct {
+    GHashTable* index;        // Key -> GList link in order
+    GQueue order;             // SuggestEntry, most recently used first
+} SuggestCache;
+
+#define PRERENDER_MIN_CONFIDENCE 0.6    // Share of matching visits the top URL needs
+#define PRERENDER_MIN_VISITS 3
+#define PRERENDER_MAX_ACTIVE 1          // Browser-wide
+#define PRERENDER_TTL 15                // Seconds an unused prerender is kept
+#define PRERENDER_MIN_MEM_KB (512 * 1024)   // MemAvailable needed to start one
+#define PRERENDER_MAX_LOAD 0.75         // Load average per CPU above which we skip
+
+typedef struct {
+    guint active;
+    guint started;
+    guint hits;               // Swapped into a tab
+    guint misses;             // Discarded unused
+} PrerenderStats;
+
+typedef struct {
+    GtkWidget* window;        // GtkOffscreenWindow hosting the view
+    WebKitWebView* view;
+    gchar* uri;
+    guint expire_source;
+} Prerender;
+
+#define SESSION_SAVE_DELAY 2000     // ms; coalesces navigations into one write
+
+typedef struct {
+    BrowserData* browser;
+    GtkNotebook* notebook;
+    guint save_source;
+    gint64 next_id;           // Next tab session id
+    gboolean restored;        // The saved session has been loaded into the notebook
+} BrowserSession;
+
+#define HIBERNATE_SWEEP_INTERVAL 30     // seconds
+#define HIBERNATE_MEASURE_DELAY 3       // seconds for web processes to exit
+
+typedef struct {
+    BrowserData* browser;
+    GtkNotebook* notebook;
+    guint sweep_source;
+    guint measure_source;
+    GCancellable* cancellable;   // Busy checks still running in pages
+    gint64 measure_base_kb;   // MemAvailable before the pending measurement
+    guint hibernated;
+    guint woken;              // Hibernated tabs selected again
+    guint busy;               // Idle tabs kept for media or edited forms
+    gint64 reclaimed_kb;
+} TabHibernation;
+
+#define WEBVIEW_POOL_SIZE 2           // Each pooled view holds a web process
+
+typedef struct {
+    BrowserData* browser;
+    GQueue views;             // Owned WebKitWebView references
+    guint refill_source;
+    guint hits;
+    guint misses;
+    guint returned;           // Views given back by closed tabs
+} WebViewPool;
+
+#define MONITOR_SAMPLE_INTERVAL 2     // seconds
+
+typedef struct {
+    gint pid;
+    gchar* name;              // comm, e.g. "WebKitWebProces"
+    guint64 start_ticks;      // Start time since boot, for ordering new processes
+    gint64 rss_kb;
+    gint64 pss_kb;            // -1 when the kernel has no smaps_rollup
+    guint64 cpu_ticks;        // utime + stime
+    gdouble cpu_percent;      // Over the last interval
+} ProcSample;
+
+typedef struct {
+    BrowserData* browser;
+    GThread* thread;
+    GMutex lock;              // Guards stop, pending and deliver_source
+    GCond cond;
+    gboolean stop;
+    GPtrArray* pending;       // Newest snapshot not yet seen by the GTK thread
+    guint deliver_source;
+
+    // GTK thread only
+    GPtrArray* samples;       // Last delivered snapshot
+    GHashTable* pid_tabs;     // pid -> gint64* tab session id
+    GQueue claims;            // gint64* session ids of tabs that committed a load
+    GHashTable* flagged;      // pids already reported over a limit
+    GtkWidget* window;
+    GtkListStore* store;
+} ResourceMonitor;
+
 // Add theme mode enum
 typedef enum {
     MODE_LIGHT,
     MODE_DARK, 
-    MODE_MATRIX
+    MODE_MATRIX,
+    MODE_COUNT
 } BrowserMode;
 
+// Compiled themes. Each mode's GTK provider and page style sheet is built
+// once on first use and kept; switching modes swaps the screen provider and
+// the style sheet in the content manager every tab shares.
+typedef struct {
+    BrowserData* browser;
+    BrowserMode mode;
+    GtkCssProvider* installed;               // On the default screen, or NULL
+    GtkCssProvider* providers[MODE_COUNT];
+    WebKitUserStyleSheet* sheets[MODE_COUNT];
+} ThemeEngine;
+
+// Content blocking through WebKit content-blocker lists; see content_blocker_start()
+typedef struct {
+    WebKitUserContentFilterStore* store;   // Compiled lists, cached on disk; NULL if no directory
+    gchar* temp_dir;          // RAM-only profile: this process's own store, removed on exit
+    WebKitUserContentManager* manager;
+    GCancellable* cancellable;
+    GHashTable* identifiers;  // Store identifiers of the configured lists
+    guint pending;            // Lists still loading or compiling
+    guint loaded;             // Taken from the store as compiled
+    guint compiled;
+} ContentBlocker;
+
+// Bandwidth-saving policies, switchable per host; see site_policy_flags()
+#define POLICY_BLOCK_AUTOPLAY 1   // Media may not start on its own
+#define POLICY_LAZY_MEDIA 2       // Images and iframes not yet loading get loading=lazy
+#define POLICY_BLOCK_IMAGES 4
+#define POLICY_BLOCK_FONTS 8
+
+typedef struct {
+    BrowserStorage* storage;
+    GHashTable* hosts;        // Host -> POLICY_* flags overriding the default
+    guint64 resource_bytes;   // Subresources loaded this session, averaged
+    guint resources;          // to estimate the bytes a page was spared
+} SitePolicies;
+
 // Update BrowserTab structure
 struct _BrowserTab {
     GtkWidget* container;
@@ -67,16 +309,43 @@ struct _BrowserTab {
     WebKitWebView* webview;
     GtkWidget* title_label;
     GtkWidget* progress_bar;
-    GtkWidget* dev_tools_button;  // Add this field
     GtkWidget* menu_button;  // Add this line
+    GtkWidget* bookmark_button;
+    GtkWidget* blocked_label; // Count of requests blocked on the current page
+    guint blocked_requests;
+    guint prefetch_source;    // Debounce for DNS prefetch and suggestions while typing
+    GtkListStore* suggest_store;          // Rows of the entry's completion popup
+    GCancellable* suggest_cancellable;    // In-flight suggestion request
+    Prerender* prerender;     // Offscreen page for the top suggestion, if any
+    InterceptData* intercept;
+    gint ref_count;           // See tab_ref()
+    gint64 session_id;        // Row in session_tabs
+    gboolean session_dirty;   // URI, title or history changed since the last save
+    GtkWidget* placeholder;   // Shown instead of the webview until it is created
+    GBytes* pending_state;    // Saved WebKit session state for the webview to restore
+    gchar* pending_uri;
+    gchar* pending_title;
+    guint64 page_bytes;       // Loaded by the current page, from Content-Length
+    guint64 page_saved;       // Estimate; see tab_report_bandwidth()
+    gint64 last_active;       // Monotonic time the tab was last seen selected
+    gboolean hibernated;      // The webview was released while idle
+    gboolean throttled;       // Hidden; media paused by tab_throttle()
+    gboolean reader;          // Pages are shown as extracted articles; see tab_set_reader()
+    gchar* reader_rendering;  // Page URI while its reader document loads; see reader_load_started()
+    gboolean reader_started;  // ...and that load has started
+    gboolean load_failed;     // The current load failed; see on_tab_load_failed()
+    gdouble visible_cpu;      // CPU seconds and wall seconds while selected...
+    gdouble visible_secs;
+    gdouble hidden_cpu;       // ...and while hidden, from the resource monitor
+    gdouble hidden_secs;
     BrowserHistory* history;
+    BrowserData* browser;     // Shared browser state (settings, storage)
     BrowserMode mode;         // Add theme mode
-    GtkWidget* mode_item;     // Add mode menu item
     VPNConnection* vpn;  // Now VPNConnection is defined before use
 };
 
 // Enhanced InterceptData structure
-typedef struct {
+struct _InterceptData {
     gboolean enabled;
     GtkWidget* window;
     GtkTextBuffer* request_buffer;
@@ -85,8 +354,10 @@ typedef struct {
     GtkTextBuffer* resp_headers_buffer;
     GQueue* pending_requests;  // Queue for intercepted requests
     WebKitWebResource* current_resource;  // Currently displayed resource
+    WebKitWebView* current_view;          // View that loaded current_resource
     gboolean request_modified;  // Flag for modified requests
-} InterceptData;
+    BrowserCookies* cookies;    // Jar used to show the Cookie header WebKit will send
+};
 
 // Update PendingRequest struct
 typedef struct {
@@ -103,11 +374,28 @@ typedef struct {
 } PendingRequest;
 
 // Add to main struct
-typedef struct {
+struct _BrowserData {
     // ... existing fields ...
+    BrowserStorage* storage;
+    BrowserSettings* settings;
     BrowserHistory* history;
     BrowserCookies* cookies;
-} BrowserData;
+    BrowserBookmarks* bookmarks;
+    DnsCache* dns;
+    PrefetchStats* prefetch;
+    SuggestCache* suggest;
+    PrerenderStats* prerender_stats;
+    BrowserSession* session;
+    WebKitWebContext* web_context;   // Shared by every tab; see browser_web_context()
+    TabHibernation* hibernation;
+    GMenuModel* menu_model;          // Tab menu, see browser_menu_model()
+    WebViewPool* view_pool;
+    ResourceMonitor* monitor;
+    ThemeEngine* themes;
+    WebKitUserContentManager* content_manager;   // Shared by every view; see browser_content_manager()
+    ContentBlocker* blocker;
+    SitePolicies* policies;
+};
 
 // Add structure for WebRTC leak checking
 typedef struct {
@@ -117,70 +405,17 @@ typedef struct {
     GtkWidget* result_label;
 } WebRTCLeakCheck;
 
-// Add modern theme constants
-typedef struct {
-    GdkRGBA bg_color;
-    GdkRGBA fg_color;
-    GdkRGBA accent_color;
-    GdkRGBA hover_color;
-    const char* font_family;
-    int font_size;
-} ThemeColors;
-
-static const ThemeColors THEME_LIGHT = {
-    .bg_color = {0.98, 0.98, 0.98, 1.0},
-    .fg_color = {0.2, 0.2, 0.2, 1.0},
-    .accent_color = {0.0, 0.47, 0.84, 1.0},
-    .hover_color = {0.0, 0.52, 0.89, 1.0},
-    .font_family = "Inter, system-ui, -apple-system, sans-serif",
-    .font_size = 14
-};
-
-static const ThemeColors THEME_DARK = {
-    .bg_color = {0.13, 0.13, 0.13, 1.0},
-    .fg_color = {0.9, 0.9, 0.9, 1.0},
-    .accent_color = {0.0, 0.6, 1.0, 1.0},
-    .hover_color = {0.0, 0.7, 1.0, 1.0},
-    .font_family = "Inter, system-ui, -apple-system, sans-serif",
-    .font_size = 14
-};
-
-// Add advanced CSS with variables
-static const char* MODERN_CSS = "";
-
-// Add function to apply theme
-static void apply_theme(GtkWidget* window, const ThemeColors* theme) {
-    char* css = g_strdup_printf(MODERN_CSS,
-        theme->bg_color.red, theme->bg_color.green, theme->bg_color.blue, theme->bg_color.alpha,
-        theme->fg_color.red, theme->fg_color.green, theme->fg_color.blue, theme->fg_color.alpha,
-        theme->accent_color.red, theme->accent_color.green, theme->accent_color.blue, theme->accent_color.alpha,
-        theme->hover_color.red, theme->hover_color.green, theme->hover_color.blue, theme->hover_color.alpha,
-        theme->font_family, theme->font_size);
-
-    GtkCssProvider* provider = gtk_css_provider_new();
-    gtk_css_provider_load_from_data(provider, css, -1, NULL);
-    
-    GtkStyleContext* context = gtk_widget_get_style_context(window);
-    gtk_style_context_add_class(context, "browser-window");
-    
-    GdkScreen* screen = gtk_widget_get_screen(window);
-    gtk_style_context_add_provider_for_screen(screen,
-        GTK_STYLE_PROVIDER(provider),
-        GTK_STYLE_PROVIDER_PRIORITY_APPLICATION);
-    
-    g_free(css);
-    g_object_unref(provider);
-}
-
 // Forward declarations
 static void on_url_entry_activate(GtkEntry* entry, gpointer data);
 static void on_search_button_clicked(GtkButton* button, gpointer data);
 static void on_home_button_clicked(GtkButton* button, gpointer data);
 static void on_load_changed(WebKitWebView* web_view, WebKitLoadEvent load_event, gpointer user_data);
+static gboolean on_tab_load_failed(WebKitWebView* web_view, WebKitLoadEvent load_event, gchar* failing_uri,
+                                   GError* error, gpointer user_data);
 static void on_tab_close_clicked(GtkButton* button, GtkNotebook* notebook);
 static gboolean on_resource_load_started(WebKitWebView* web_view, WebKitWebResource* resource, WebKitURIRequest* request, gpointer user_data);
 static void on_resource_response_received(WebKitWebView* web_view, WebKitWebResource* resource, WebKitURIResponse* response, gpointer user_data);
-static void on_intercept_toggled(GtkToggleButton* button, InterceptData* intercept_data);
+static void intercept_set_enabled(InterceptData* intercept_data, gboolean enabled);
 static GtkWidget* create_tab_label(const gchar* text, GtkNotebook* notebook, BrowserTab* tab);
 static void forward_request(GtkButton* button, InterceptData* data);
 static void drop_request(GtkButton* button, InterceptData* data);
@@ -188,12 +423,49 @@ static void on_request_edit(GtkTextBuffer* buffer, InterceptData* data);
 static void cleanup_pending_request(PendingRequest* req);
 static void on_intercept_window_destroy(GtkWidget* window, InterceptData* data);
 static void on_dev_tools_clicked(GtkButton* button, WebKitWebView* web_view);
+static void on_dev_tools_item_activate(GtkWidget* item, gpointer data);
+static void on_back_button_clicked(GtkButton* button, gpointer data);
+static void on_forward_button_clicked(GtkButton* button, gpointer data);
 static void show_history_window(GtkButton* button, BrowserHistory* history);
 static void add_history_entry(BrowserHistory* history, const char* url, const char* title);
 static void add_cookie(BrowserCookies* cookies, const char* domain, const char* name,
                       const char* value, const char* path, time_t expires, gboolean secure);
 static void show_downloads_window(GtkMenuItem* menuitem, gpointer user_data);
-static void switch_mode(GtkMenuItem* menu_item, gpointer user_data);
+static void theme_engine_select(ThemeEngine* themes, BrowserMode mode);
+static void theme_engine_free(ThemeEngine* themes);
+static WebKitUserContentManager* browser_content_manager(BrowserData* browser);
+static void update_bookmark_button(BrowserTab* tab);
+static void tab_attach_webview(BrowserTab* tab, WebKitWebView* view);
+static const char* tab_current_uri(BrowserTab* tab);
+static void tab_ensure_webview(BrowserTab* tab);
+static GMenuModel* browser_menu_model(BrowserData* browser);
+static void show_task_manager(ResourceMonitor* monitor);
+static void resource_monitor_claim(ResourceMonitor* monitor, BrowserTab* tab);
+static void tab_throttle(BrowserTab* tab);
+static void tab_unthrottle(BrowserTab* tab);
+static void tab_report_cpu_saved(BrowserTab* tab);
+static void reader_view_settings(WebKitWebView* view, gboolean reader);
+static void tab_reader_extract(BrowserTab* tab);
+static void reader_render_clear(BrowserTab* tab);
+static void reader_load_started(BrowserTab* tab);
+static BrowserTab* create_browser_tab(InterceptData* intercept_data, BrowserData* browser);
+static BrowserTab* create_restored_tab(InterceptData* intercept_data, BrowserData* browser, gint64 id,
+                                       const char* uri, const char* title, GBytes* state);
+static GtkWidget* create_tab_label(const gchar* text, GtkNotebook* notebook, BrowserTab* tab);
+static void session_mark_dirty(BrowserTab* tab);
+static void history_vacuum_schedule(BrowserData* browser);
+static BrowserTab* tab_ref(BrowserTab* tab);
+static void tab_unref(gpointer data);
+static void intercept_forget_view(InterceptData* data, WebKitWebView* view);
+static void session_schedule_save(BrowserSession* session);
+static void on_title_changed(WebKitWebView* web_view, GParamSpec* pspec, gpointer user_data);
+static gboolean on_decide_policy(WebKitWebView* web_view, WebKitPolicyDecision* decision,
+                                 WebKitPolicyDecisionType type, gpointer user_data);
+static void on_bookmark_button_clicked(GtkButton* button, gpointer data);
+static void on_import_bookmarks(GtkMenuItem* menuitem, gpointer user_data);
+static void on_export_bookmarks(GtkMenuItem* menuitem, gpointer user_data);
+static void on_search_engine_changed(GtkComboBox* combo, gpointer data);
+static void on_search_engine_setting_changed(BrowserSettings* settings, const char* key, gpointer user_data);
 static void check_webrtc_leaks(GtkMenuItem* menuitem, gpointer user_data);
 static size_t write_callback(void* contents, size_t size, size_t nmemb, void* userp);
 static char* get_public_ip(void);
@@ -210,506 +482,4981 @@ static void load_vpn_config(GtkMenuItem* menuitem, VPNConnection* vpn);
 static gboolean init_vpn_connection(VPNConnection* vpn);
 static void cleanup_vpn(VPNConnection* vpn);
 static void show_vpn_status(GtkMenuItem* menuitem, gpointer user_data);
-static void create_vpn_menu(BrowserTab* tab, GtkWidget* popup_menu);
-
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wunused-function"
-static void add_cookie(BrowserCookies* cookies, const char* domain, const char* name,
-                      const char* value, const char* path, time_t expires, gboolean secure) {
-    sqlite3_stmt* stmt;
-    const char* sql = "INSERT INTO cookies (domain, name, value, path, expires, secure) "
-                     "VALUES (?, ?, ?, ?, datetime(?), ?)";
-
-    int rc = sqlite3_prepare_v2(cookies->db, sql, -1, &stmt, 0);
-    if (rc != SQLITE_OK) {
-        fprintf(stderr, "Failed to prepare statement: %s\n", sqlite3_errmsg(cookies->db));
-        return;
-    }
-
-    sqlite3_bind_text(stmt, 1, domain, -1, SQLITE_STATIC);
-    sqlite3_bind_text(stmt, 2, name, -1, SQLITE_STATIC);
-    sqlite3_bind_text(stmt, 3, value, -1, SQLITE_STATIC);
-    sqlite3_bind_text(stmt, 4, path, -1, SQLITE_STATIC);
-    sqlite3_bind_int64(stmt, 5, expires);
-    sqlite3_bind_int(stmt, 6, secure);
+static void vpn_free(VPNConnection* vpn);
+
+// Storage function declarations
+static BrowserStorage* storage_new(const char* data_dir);
+static void storage_submit(BrowserStorage* storage, StorageWorkFunc work, StorageDoneFunc done,
+                           gpointer job_data, GDestroyNotify destroy);
+static void storage_free(BrowserStorage* storage);
+static void init_databases(BrowserStorage* storage);
+
+// Databases ATTACHed to the browser.db connection: schema name, file name.
+// history.db is the older per-URL history store and is attached as "archive"
+// so it does not shadow the live history table in browser.db.
+static const char* const STORAGE_ATTACHED_DBS[][2] = {
+    { "cookies",   "cookies.db" },
+    { "archive",   "history.db" },
+    { "bookmarks", "bookmarks.db" },
+    { "passwords", "passwords.db" },
+};
 
-    rc = sqlite3_step(stmt);
-    if (rc != SQLITE_DONE) {
-        fprintf(stderr, "Failed to add cookie: %s\n", sqlite3_errmsg(cookies->db));
-    }
+#define STORAGE_MMAP_SIZE (64 * 1024 * 1024)
 
-    sqlite3_finalize(stmt);
+// RAM-only profile: nothing is read from or written to disk
+static gboolean storage_in_memory(BrowserStorage* storage) {
+    return storage->data_dir == NULL;
 }
-#pragma GCC diagnostic pop
 
-// URL validation functions
-static gboolean is_valid_url(const gchar* url) {
-    return g_str_has_prefix(url, "http://") || g_str_has_prefix(url, "https://");
+// Path of one of the profile's database files, or ":memory:"
+static gchar* storage_db_path(BrowserStorage* storage, const char* file) {
+    if (storage_in_memory(storage)) return g_strdup(":memory:");
+    return g_build_filename(storage->data_dir, file, NULL);
 }
 
-static gboolean is_localhost(const gchar* input) {
-    return g_str_has_prefix(input, "localhost:") || g_str_has_prefix(input, "127.0.0.1:");
+static void storage_job_free(StorageJob* job) {
+    if (job->destroy && job->job_data) {
+        job->destroy(job->job_data);
+    }
+    g_free(job);
 }
 
-static gboolean is_domain(const gchar* input) {
-    return g_str_has_suffix(input, ".com") || g_str_has_suffix(input, ".org") ||
-           g_str_has_suffix(input, ".net") || g_str_has_suffix(input, ".edu") ||
-           g_str_has_suffix(input, ".gov") || g_str_has_suffix(input, ".co") ||
-           g_str_has_suffix(input, ".io");
+static gboolean storage_job_complete(gpointer user_data) {
+    StorageJob* job = (StorageJob*)user_data;
+    job->done(job->job_data);
+    storage_job_free(job);
+    return G_SOURCE_REMOVE;
 }
 
-// Add domain validation function
-static gboolean is_resolvable_domain(const gchar* domain) {
-    struct addrinfo hints, *result;
-    memset(&hints, 0, sizeof(hints));
-    hints.ai_family = AF_UNSPEC;
-    hints.ai_socktype = SOCK_STREAM;
-    
-    // Try to resolve domain
-    int status = getaddrinfo(domain, NULL, &hints, &result);
-    if (status == 0) {
-        freeaddrinfo(result);
-        return TRUE;
+// Apply the same PRAGMAs to browser.db and every attached database
+static void storage_apply_pragmas(BrowserStorage* storage, const char* schema) {
+    sqlite3* db = storage->db;
+    gchar* sql;
+    if (storage_in_memory(storage)) {
+        sql = g_strdup_printf("PRAGMA %s.journal_mode=MEMORY;"
+                              "PRAGMA %s.synchronous=OFF;",
+                              schema, schema);
+    } else {
+        sql = g_strdup_printf("PRAGMA %s.journal_mode=WAL;"
+                              "PRAGMA %s.synchronous=NORMAL;"
+                              "PRAGMA %s.mmap_size=%d;",
+                              schema, schema, schema, STORAGE_MMAP_SIZE);
     }
-    return FALSE;
-}
+    char* err_msg = NULL;
 
-// Function to update tab title based on webpage title
-static void on_title_changed(WebKitWebView* web_view, GParamSpec* pspec, gpointer user_data) {
-    BrowserTab* tab = (BrowserTab*)user_data;
-    const gchar* title = webkit_web_view_get_title(web_view);
-    if (title != NULL && tab->title_label != NULL) {
-        gtk_label_set_text(GTK_LABEL(tab->title_label), title);
+    if (sqlite3_exec(db, sql, 0, 0, &err_msg) != SQLITE_OK) {
+        fprintf(stderr, "Failed to apply pragmas to %s: %s\n", schema, err_msg);
+        sqlite3_free(err_msg);
     }
+    g_free(sql);
 }
 
-// Function to create intercept window
-static GtkWidget* create_intercept_window(InterceptData* intercept_data) {
-    if (intercept_data->window && GTK_IS_WIDGET(intercept_data->window)) {
-        return intercept_data->window;  // Return existing window if valid
-    }
-    
-    GtkWidget* window = gtk_window_new(GTK_WINDOW_TOPLEVEL);
-    gtk_window_set_title(GTK_WINDOW(window), "Request/Response Interceptor");
-    gtk_window_set_default_size(GTK_WINDOW(window), 1000, 800);
+static gpointer storage_thread_main(gpointer user_data) {
+    BrowserStorage* storage = (BrowserStorage*)user_data;
 
-    GtkWidget* main_box = gtk_box_new(GTK_ORIENTATION_VERTICAL, 5);
-    gtk_container_add(GTK_CONTAINER(window), main_box);
+    // Open the databases here rather than in main() so startup never
+    // blocks on file I/O
+    init_databases(storage);
 
-    // Request pane
-    GtkWidget* req_pane = gtk_box_new(GTK_ORIENTATION_VERTICAL, 5);
-    gtk_box_pack_start(GTK_BOX(main_box), req_pane, TRUE, TRUE, 5);
-    
-    GtkWidget* req_label = gtk_label_new("Request:");
-    gtk_box_pack_start(GTK_BOX(req_pane), req_label, FALSE, FALSE, 5);
-    
-    GtkWidget* req_scroll = gtk_scrolled_window_new(NULL, NULL);
-    GtkWidget* req_view = gtk_text_view_new();
-    gtk_container_add(GTK_CONTAINER(req_scroll), req_view);
-    gtk_box_pack_start(GTK_BOX(req_pane), req_scroll, TRUE, TRUE, 5);
-    
-    // Request Headers
-    GtkWidget* req_headers_label = gtk_label_new("Request Headers:");
-    gtk_box_pack_start(GTK_BOX(req_pane), req_headers_label, FALSE, FALSE, 5);
-    
-    GtkWidget* req_headers_scroll = gtk_scrolled_window_new(NULL, NULL);
-    GtkWidget* req_headers_view = gtk_text_view_new();
-    gtk_container_add(GTK_CONTAINER(req_headers_scroll), req_headers_view);
-    gtk_box_pack_start(GTK_BOX(req_pane), req_headers_scroll, TRUE, TRUE, 5);
+    for (;;) {
+        StorageJob* job = g_async_queue_pop(storage->jobs);
+        if (job->shutdown) {
+            g_free(job);
+            break;
+        }
 
-    // Response pane
-    GtkWidget* resp_pane = gtk_box_new(GTK_ORIENTATION_VERTICAL, 5);
-    gtk_box_pack_start(GTK_BOX(main_box), resp_pane, TRUE, TRUE, 5);
-    
-    GtkWidget* resp_label = gtk_label_new("Response:");
-    gtk_box_pack_start(GTK_BOX(resp_pane), resp_label, FALSE, FALSE, 5);
-    
-    GtkWidget* resp_scroll = gtk_scrolled_window_new(NULL, NULL);
-    GtkWidget* resp_view = gtk_text_view_new();
-    gtk_container_add(GTK_CONTAINER(resp_scroll), resp_view);
-    gtk_box_pack_start(GTK_BOX(resp_pane), resp_scroll, TRUE, TRUE, 5);
+        if (job->work && storage->db) {
+            job->work(storage->db, job->job_data);
+        }
 
-    // Response Headers
-    GtkWidget* resp_headers_label = gtk_label_new("Response Headers:");
-    gtk_box_pack_start(GTK_BOX(resp_pane), resp_headers_label, FALSE, FALSE, 5);
-    
-    GtkWidget* resp_headers_scroll = gtk_scrolled_window_new(NULL, NULL);
-    GtkWidget* resp_headers_view = gtk_text_view_new();
-    gtk_container_add(GTK_CONTAINER(resp_headers_scroll), resp_headers_view);
-    gtk_box_pack_start(GTK_BOX(resp_pane), resp_headers_scroll, TRUE, TRUE, 5);
+        if (job->done) {
+            g_idle_add(storage_job_complete, job);
+        } else {
+            storage_job_free(job);
+        }
+    }
 
-    // Store buffers
-    intercept_data->request_buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(req_view));
-    intercept_data->response_buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(resp_view));
-    intercept_data->req_headers_buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(req_headers_view));
-    intercept_data->resp_headers_buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(resp_headers_view));
+    if (storage->db) {
+        sqlite3_close(storage->db);
+        storage->db = NULL;
+    }
+    return NULL;
+}
 
-    // Add control buttons
-    GtkWidget* controls_box = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 5);
-    gtk_box_pack_start(GTK_BOX(main_box), controls_box, FALSE, FALSE, 5);
+static BrowserStorage* storage_new(const char* data_dir) {
+    BrowserStorage* storage = g_new0(BrowserStorage, 1);
+    storage->data_dir = g_strdup(data_dir);
+    storage->jobs = g_async_queue_new();
+    storage->thread = g_thread_new("storage-io", storage_thread_main, storage);
+    return storage;
+}
 
-    GtkWidget* forward_button = gtk_button_new_with_label("Forward");
-    GtkWidget* drop_button = gtk_button_new_with_label("Drop");
-    
-    gtk_box_pack_start(GTK_BOX(controls_box), forward_button, TRUE, TRUE, 5);
-    gtk_box_pack_start(GTK_BOX(controls_box), drop_button, TRUE, TRUE, 5);
+// Queue work for the I/O thread. work runs there with the shared connection,
+// done (optional) runs afterwards on the GTK thread, then destroy frees job_data.
+static void storage_submit(BrowserStorage* storage, StorageWorkFunc work, StorageDoneFunc done,
+                           gpointer job_data, GDestroyNotify destroy) {
+    if (!storage) {
+        if (destroy && job_data) destroy(job_data);
+        return;
+    }
 
-    g_signal_connect(forward_button, "clicked", G_CALLBACK(forward_request), intercept_data);
-    g_signal_connect(drop_button, "clicked", G_CALLBACK(drop_request), intercept_data);
+    StorageJob* job = g_new0(StorageJob, 1);
+    job->work = work;
+    job->done = done;
+    job->job_data = job_data;
+    job->destroy = destroy;
+    g_async_queue_push(storage->jobs, job);
+}
 
-    // Make text views editable
-    gtk_text_view_set_editable(GTK_TEXT_VIEW(req_view), TRUE);
-    gtk_text_view_set_editable(GTK_TEXT_VIEW(req_headers_view), TRUE);
+// Drain the queue, close the connection and join the I/O thread
+static void storage_free(BrowserStorage* storage) {
+    if (!storage) return;
 
-    // Connect edit signals
-    g_signal_connect(intercept_data->request_buffer, "changed", 
-                    G_CALLBACK(on_request_edit), intercept_data);
-    g_signal_connect(intercept_data->req_headers_buffer, "changed",
-                    G_CALLBACK(on_request_edit), intercept_data);
+    StorageJob* stop = g_new0(StorageJob, 1);
+    stop->shutdown = TRUE;
+    g_async_queue_push(storage->jobs, stop);
+    g_thread_join(storage->thread);
 
-    // Initialize request queue if not already initialized
-    if (!intercept_data->pending_requests) {
-        intercept_data->pending_requests = g_queue_new();
-    }
-    
-    // Initialize current resource
-    intercept_data->current_resource = NULL;
-    intercept_data->request_modified = FALSE;
+    g_async_queue_unref(storage->jobs);
+    g_free(storage->data_dir);
+    g_free(storage);
+}
 
-    gtk_widget_show_all(window);
-    return window;
+// Cookie jar. WebKit's cookie manager persists cookies into cookies.db
+// (libsoup's moz_cookies table), which is the single source of truth. The jar
+// mirrors it in memory, bucketed by registrable domain, so per-request lookups
+// only scan the cookies of one site. After the first full load, triggers on
+// moz_cookies log every row libsoup inserts or deletes into jar_changes, and
+// "changed" only replays that log.
+#define COOKIE_JAR_SWEEP_INTERVAL 60    // seconds
+#define COOKIE_JAR_RELOAD_DELAY 500     // ms, coalesces bursts of "changed"
+
+typedef struct {
+    gchar* domain;        // Host, or ".domain" for domain cookies
+    gchar* name;
+    gchar* value;
+    gchar* path;
+    gint64 expires;       // Unix time, 0 for session cookies
+    gboolean secure;
+    gboolean http_only;
+    gboolean removed;     // Only in jar_changes replays: the row was deleted
+} JarCookie;
+
+static void jar_cookie_free(gpointer data) {
+    JarCookie* cookie = (JarCookie*)data;
+    g_free(cookie->domain);
+    g_free(cookie->name);
+    g_free(cookie->value);
+    g_free(cookie->path);
+    g_free(cookie);
 }
 
-// Update create_browser_tab function
-static BrowserTab* create_browser_tab(InterceptData* intercept_data, BrowserHistory* history) {
-    BrowserTab* tab = g_new0(BrowserTab, 1); // Initialize all fields to 0
-    
-    // Create WebView first so it's available for button callbacks
-    tab->webview = WEBKIT_WEB_VIEW(webkit_web_view_new());
-    
-    // Create container and controls
-    tab->container = gtk_box_new(GTK_ORIENTATION_VERTICAL, 5);
-    GtkWidget* hbox = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 5);
-    gtk_box_pack_start(GTK_BOX(tab->container), hbox, FALSE, FALSE, 0);
-    
-    // Create search engine combo
-    tab->search_engine_combo = GTK_COMBO_BOX_TEXT(gtk_combo_box_text_new());
-    gtk_combo_box_text_append_text(tab->search_engine_combo, "Google");
-    gtk_combo_box_text_append_text(tab->search_engine_combo, "Bing");
-    gtk_combo_box_text_append_text(tab->search_engine_combo, "DuckDuckGo");
-    gtk_combo_box_text_append_text(tab->search_engine_combo, "Yahoo");
-    gtk_combo_box_set_active(GTK_COMBO_BOX(tab->search_engine_combo), 0);
-    gtk_box_pack_start(GTK_BOX(hbox), GTK_WIDGET(tab->search_engine_combo), FALSE, FALSE, 0);
-    
-    // Create URL entry
-    tab->url_entry = gtk_entry_new();
-    gtk_box_pack_start(GTK_BOX(hbox), tab->url_entry, TRUE, TRUE, 0);
-    
-    // Create navigation buttons
-    GtkWidget* back_button = gtk_button_new_with_label("Back");
-    GtkWidget* forward_button = gtk_button_new_with_label("Forward");
-    GtkWidget* home_button = gtk_button_new_with_label("Home");
-    GtkWidget* search_button = gtk_button_new_with_label("Search");
-    tab->dev_tools_button = gtk_button_new_with_label("Dev Tools");  // Add dev tools button
-    
-    gtk_box_pack_start(GTK_BOX(hbox), back_button, FALSE, FALSE, 0);
-    gtk_box_pack_start(GTK_BOX(hbox), forward_button, FALSE, FALSE, 0);
-    gtk_box_pack_start(GTK_BOX(hbox), home_button, FALSE, FALSE, 0);
-    gtk_box_pack_start(GTK_BOX(hbox), search_button, FALSE, FALSE, 0);
-    gtk_box_pack_start(GTK_BOX(hbox), tab->dev_tools_button, FALSE, FALSE, 0);  // Add to layout
+static GHashTable* cookie_jar_new_table(void) {
+    return g_hash_table_new_full(g_str_hash, g_str_equal, g_free,
+                                 (GDestroyNotify)g_ptr_array_unref);
+}
 
-    // Store references for callbacks
-    g_object_set_data(G_OBJECT(tab->url_entry), "webview", tab->webview);
-    g_object_set_data(G_OBJECT(tab->url_entry), "search_engine_combo", tab->search_engine_combo);
+// Insert or replace the cookie with the same (domain, name, path).
+// Takes ownership of cookie.
+static void cookie_jar_upsert(GHashTable* jar, JarCookie* cookie) {
+    const char* key = psl_registrable_domain(cookie->domain);
+    GPtrArray* bucket = g_hash_table_lookup(jar, key);
 
-    // Connect button signals
-    g_signal_connect_swapped(back_button, "clicked", G_CALLBACK(webkit_web_view_go_back), tab->webview);
-    g_signal_connect_swapped(forward_button, "clicked", G_CALLBACK(webkit_web_view_go_forward), tab->webview);
-    g_signal_connect(home_button, "clicked", G_CALLBACK(on_home_button_clicked), tab->webview);
-    g_signal_connect(search_button, "clicked", G_CALLBACK(on_search_button_clicked), tab->url_entry);
-    g_signal_connect(tab->url_entry, "activate", G_CALLBACK(on_url_entry_activate), tab->webview);
+    if (!bucket) {
+        bucket = g_ptr_array_new_with_free_func(jar_cookie_free);
+        g_hash_table_insert(jar, g_strdup(key), bucket);
+    }
 
-    // Add webview to container
-    gtk_box_pack_start(GTK_BOX(tab->container), GTK_WIDGET(tab->webview), TRUE, TRUE, 0);
-    
-    // Connect WebKit signals 
-    g_signal_connect(tab->webview, "load-changed", G_CALLBACK(on_load_changed), tab);
-    g_signal_connect(tab->webview, "resource-load-started", G_CALLBACK(on_resource_load_started), intercept_data);
-    g_signal_connect(tab->webview, "resource-response-received", G_CALLBACK(on_resource_response_received), intercept_data);
+    for (guint i = 0; i < bucket->len; i++) {
+        JarCookie* existing = g_ptr_array_index(bucket, i);
+        if (g_strcmp0(existing->domain, cookie->domain) == 0 &&
+            g_strcmp0(existing->name, cookie->name) == 0 &&
+            g_strcmp0(existing->path, cookie->path) == 0) {
+            jar_cookie_free(existing);
+            bucket->pdata[i] = cookie;
+            return;
+        }
+    }
+    g_ptr_array_add(bucket, cookie);
+}
 
-    // Load default page
-    webkit_web_view_load_uri(tab->webview, "https://www.google.com");
+static void cookie_jar_remove(GHashTable* jar, const JarCookie* cookie) {
+    GPtrArray* bucket = g_hash_table_lookup(jar, psl_registrable_domain(cookie->domain));
+    if (!bucket) return;
+
+    for (guint i = 0; i < bucket->len; i++) {
+        JarCookie* existing = g_ptr_array_index(bucket, i);
+        if (g_strcmp0(existing->domain, cookie->domain) == 0 &&
+            g_strcmp0(existing->name, cookie->name) == 0 &&
+            g_strcmp0(existing->path, cookie->path) == 0) {
+            g_ptr_array_remove_index_fast(bucket, i);
+            return;
+        }
+    }
+}
 
-    // Enable developer extras
-    WebKitSettings* settings = webkit_web_view_get_settings(tab->webview);
-    webkit_settings_set_enable_developer_extras(settings, TRUE);
+static gboolean cookie_domain_matches(const char* cookie_domain, const char* host) {
+    if (cookie_domain[0] != '.') {
+        return g_ascii_strcasecmp(cookie_domain, host) == 0;
+    }
 
-    // Connect dev tools button signal
-    g_signal_connect(tab->dev_tools_button, "clicked", G_CALLBACK(on_dev_tools_clicked), tab->webview);
+    size_t host_len = strlen(host);
+    size_t domain_len = strlen(cookie_domain + 1);
+    if (host_len == domain_len) {
+        return g_ascii_strcasecmp(cookie_domain + 1, host) == 0;
+    }
+    return host_len > domain_len &&
+           host[host_len - domain_len - 1] == '.' &&
+           g_ascii_strcasecmp(host + host_len - domain_len, cookie_domain + 1) == 0;
+}
 
-    // Inside create_browser_tab function, after creating other buttons:
+static gboolean cookie_path_matches(const char* cookie_path, const char* path) {
+    if (!cookie_path || !*cookie_path) return TRUE;
+    if (!path || !*path) path = "/";
 
-    // Create menu button (three dots)
-    tab->menu_button = gtk_menu_button_new();
-    GtkWidget* menu_image = gtk_image_new_from_icon_name("view-more-symbolic", GTK_ICON_SIZE_BUTTON);
-    gtk_button_set_image(GTK_BUTTON(tab->menu_button), menu_image);
+    size_t len = strlen(cookie_path);
+    if (strncmp(cookie_path, path, len) != 0) return FALSE;
+    return cookie_path[len - 1] == '/' || path[len] == '\0' || path[len] == '/';
+}
 
-    // Create popup menu
-    GtkWidget* popup_menu = gtk_menu_new();
+// Append a Cookie header value for host/path to out
+static void cookie_jar_build_header(BrowserCookies* cookies, const char* host, const char* path,
+                                    gboolean secure, GString* out) {
+    if (!cookies || !cookies->jar || !host) return;
 
-    // Add VPN menu first (before other menu items)
-    GtkWidget* vpn_menu = gtk_menu_new();
-    GtkWidget* vpn_item = gtk_menu_item_new_with_label("VPN");
-    gtk_menu_item_set_submenu(GTK_MENU_ITEM(vpn_item), vpn_menu);
+    GPtrArray* bucket = g_hash_table_lookup(cookies->jar, psl_registrable_domain(host));
+    if (!bucket) return;
 
-    // VPN menu items
-    GtkWidget* vpn_connect = gtk_menu_item_new_with_label("Connect VPN");
-    GtkWidget* vpn_disconnect = gtk_menu_item_new_with_label("Disconnect VPN");
-    GtkWidget* vpn_status = gtk_menu_item_new_with_label("VPN Status");
-    GtkWidget* vpn_settings = gtk_menu_item_new_with_label("VPN Settings");
+    gint64 now = g_get_real_time() / G_USEC_PER_SEC;
+    for (guint i = 0; i < bucket->len; i++) {
+        JarCookie* cookie = g_ptr_array_index(bucket, i);
+        if (cookie->expires && cookie->expires <= now) continue;
+        if (cookie->secure && !secure) continue;
+        if (!cookie_domain_matches(cookie->domain, host)) continue;
+        if (!cookie_path_matches(cookie->path, path)) continue;
 
-    // Add items to VPN submenu
-    gtk_menu_shell_append(GTK_MENU_SHELL(vpn_menu), vpn_connect);
-    gtk_menu_shell_append(GTK_MENU_SHELL(vpn_menu), vpn_disconnect);
-    gtk_menu_shell_append(GTK_MENU_SHELL(vpn_menu), gtk_separator_menu_item_new());
-    gtk_menu_shell_append(GTK_MENU_SHELL(vpn_menu), vpn_status);
-    gtk_menu_shell_append(GTK_MENU_SHELL(vpn_menu), vpn_settings);
+        if (out->len) g_string_append(out, "; ");
+        g_string_append_printf(out, "%s=%s", cookie->name, cookie->value ? cookie->value : "");
+    }
+}
 
-    // Initialize VPN connection structure
-    tab->vpn = g_new0(VPNConnection, 1);
-    tab->vpn->connected = FALSE;
-    tab->vpn->config_file = NULL;
-    tab->vpn->last_error = NULL;
-
-    // Add VPN menu item to main popup menu (before other items)
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), vpn_item);
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), gtk_separator_menu_item_new());
-
-    // Connect VPN signals
-    g_signal_connect(vpn_connect, "activate", G_CALLBACK(init_vpn_connection), tab->vpn);
-    g_signal_connect(vpn_disconnect, "activate", G_CALLBACK(cleanup_vpn), tab->vpn);
-    g_signal_connect(vpn_status, "activate", G_CALLBACK(show_vpn_status), tab->vpn);
-
-    // Add menu items
-    GtkWidget* dev_tools_item = gtk_menu_item_new_with_label("Developer Tools");
-    GtkWidget* history_item = gtk_menu_item_new_with_label("History");
-    GtkWidget* downloads_item = gtk_menu_item_new_with_label("Downloads");  // Add downloads item
-    GtkWidget* intercept_item = gtk_menu_item_new_with_label("Intercept");
-    GtkWidget* light_mode_item = gtk_menu_item_new_with_label("Light Mode");
-    GtkWidget* dark_mode_item = gtk_menu_item_new_with_label("Dark Mode");
-    GtkWidget* matrix_mode_item = gtk_menu_item_new_with_label("Matrix Mode");
-    GtkWidget* webrtc_leak_item = gtk_menu_item_new_with_label("WebRTC Leak Check");
-    GtkWidget* ip_rotator_item = gtk_menu_item_new_with_label("IP Rotator");
-
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), dev_tools_item);
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), history_item);
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), downloads_item);  // Add to menu
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), intercept_item);
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), light_mode_item);
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), dark_mode_item);
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), matrix_mode_item);
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), webrtc_leak_item);
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), ip_rotator_item);
+typedef struct {
+    BrowserCookies* cookies;
+    GHashTable* jar;          // Built on the I/O thread, swapped in on completion
+    GPtrArray* legacy;        // Rows from the old cookies table, to hand to WebKit
+    GPtrArray* changes;       // Replayed jar_changes rows, in order
+    gboolean incremental;     // The change triggers are installed
+} CookieLoadJob;
+
+static void cookie_load_job_free(gpointer data) {
+    CookieLoadJob* job = (CookieLoadJob*)data;
+    if (job->jar) g_hash_table_unref(job->jar);
+    if (job->legacy) g_ptr_array_unref(job->legacy);
+    if (job->changes) g_ptr_array_unref(job->changes);
+    g_free(job);
+}
+
+// libsoup replaces a cookie by deleting its row and inserting a new one, so
+// the two row triggers see every change
+static const char* COOKIE_JAR_TRIGGERS_SQL =
+    "CREATE TABLE IF NOT EXISTS cookies.jar_changes ("
+    "  seq INTEGER PRIMARY KEY, removed INTEGER, host TEXT, name TEXT, value TEXT,"
+    "  path TEXT, expiry INTEGER, isSecure INTEGER, isHttpOnly INTEGER);"
+    "CREATE TRIGGER IF NOT EXISTS cookies.jar_cookie_inserted AFTER INSERT ON moz_cookies BEGIN"
+    "  INSERT INTO jar_changes (removed, host, name, value, path, expiry, isSecure, isHttpOnly)"
+    "  VALUES (0, new.host, new.name, new.value, new.path, new.expiry, new.isSecure, new.isHttpOnly);"
+    "END;"
+    "CREATE TRIGGER IF NOT EXISTS cookies.jar_cookie_deleted AFTER DELETE ON moz_cookies BEGIN"
+    "  INSERT INTO jar_changes (removed, host, name, path) VALUES (1, old.host, old.name, old.path);"
+    "END;"
+    "DELETE FROM cookies.jar_changes;";
+
+static JarCookie* jar_cookie_from_row(sqlite3_stmt* stmt) {
+    JarCookie* cookie = g_new0(JarCookie, 1);
+    cookie->domain = g_strdup((const char*)sqlite3_column_text(stmt, 0));
+    cookie->name = g_strdup((const char*)sqlite3_column_text(stmt, 1));
+    cookie->value = g_strdup((const char*)sqlite3_column_text(stmt, 2));
+    cookie->path = g_strdup((const char*)sqlite3_column_text(stmt, 3));
+    cookie->expires = sqlite3_column_int64(stmt, 4);
+    cookie->secure = sqlite3_column_int(stmt, 5);
+    cookie->http_only = sqlite3_column_int(stmt, 6);
+    return cookie;
+}
+
+static void load_cookies_work(sqlite3* db, gpointer data) {
+    CookieLoadJob* job = (CookieLoadJob*)data;
+    sqlite3_stmt* stmt;
+    gint64 now = g_get_real_time() / G_USEC_PER_SEC;
+
+    // moz_cookies is created by WebKit's network process and may not exist
+    // yet; the triggers go in once it does. Installing them and reading the
+    // table in one transaction means no change is missed in between.
+    sqlite3_exec(db, "BEGIN", 0, 0, NULL);
+    job->incremental = sqlite3_exec(db, COOKIE_JAR_TRIGGERS_SQL, 0, 0, NULL) == SQLITE_OK;
+
+    const char* sql = "SELECT host, name, value, path, expiry, isSecure, isHttpOnly "
+                      "FROM cookies.moz_cookies WHERE expiry = 0 OR expiry > ?";
+    if (sqlite3_prepare_v2(db, sql, -1, &stmt, 0) == SQLITE_OK) {
+        sqlite3_bind_int64(stmt, 1, now);
+        while (sqlite3_step(stmt) == SQLITE_ROW) {
+            JarCookie* cookie = jar_cookie_from_row(stmt);
+            if (cookie->domain && cookie->name) {
+                cookie_jar_upsert(job->jar, cookie);
+            } else {
+                jar_cookie_free(cookie);
+            }
+        }
+    }
+    sqlite3_finalize(stmt);
+    sqlite3_exec(db, "COMMIT", 0, 0, NULL);
+
+    // Rows written by the old add_cookie piled up duplicates; keep the newest
+    // row of each (domain, name, path)
+    const char* legacy_sql = "SELECT domain, name, value, path, "
+                             "CAST(strftime('%s', expires) AS INTEGER), secure, 0 "
+                             "FROM cookies.cookies WHERE id IN "
+                             "(SELECT MAX(id) FROM cookies.cookies GROUP BY domain, name, path)";
+    if (sqlite3_prepare_v2(db, legacy_sql, -1, &stmt, 0) == SQLITE_OK) {
+        while (sqlite3_step(stmt) == SQLITE_ROW) {
+            JarCookie* cookie = jar_cookie_from_row(stmt);
+            if (cookie->expires && cookie->expires <= now) {
+                jar_cookie_free(cookie);
+            } else {
+                g_ptr_array_add(job->legacy, cookie);
+            }
+        }
+    }
+    sqlite3_finalize(stmt);
+}
+
+static void clear_legacy_cookies_work(sqlite3* db, gpointer data) {
+    char* err_msg = NULL;
+    if (sqlite3_exec(db, "DELETE FROM cookies.cookies", 0, 0, &err_msg) != SQLITE_OK) {
+        fprintf(stderr, "Failed to clear legacy cookies: %s\n", err_msg);
+        sqlite3_free(err_msg);
+    }
+}
+
+static void cookie_manager_add(BrowserCookies* cookies, const JarCookie* cookie) {
+    int max_age = -1;
+    if (cookie->expires) {
+        gint64 remaining = cookie->expires - g_get_real_time() / G_USEC_PER_SEC;
+        max_age = (int)MAX(remaining, 0);
+    }
+
+    SoupCookie* soup_cookie = soup_cookie_new(cookie->name, cookie->value ? cookie->value : "",
+                                              cookie->domain, cookie->path ? cookie->path : "/",
+                                              max_age);
+    soup_cookie_set_secure(soup_cookie, cookie->secure);
+    soup_cookie_set_http_only(soup_cookie, cookie->http_only);
+    webkit_cookie_manager_add_cookie(cookies->manager, soup_cookie, NULL, NULL, NULL);
+    soup_cookie_free(soup_cookie);
+}
+
+static void load_cookies_done(gpointer data) {
+    CookieLoadJob* job = (CookieLoadJob*)data;
+    BrowserCookies* cookies = job->cookies;
+
+    if (cookies->jar) g_hash_table_unref(cookies->jar);
+    cookies->jar = job->jar;
+    job->jar = NULL;
+    cookies->incremental = job->incremental;
+
+    if (job->legacy->len > 0) {
+        for (guint i = 0; i < job->legacy->len; i++) {
+            JarCookie* cookie = g_ptr_array_index(job->legacy, i);
+            cookie_manager_add(cookies, cookie);
+        }
+        // WebKit now owns these; the next reload picks them up from moz_cookies
+        storage_submit(cookies->storage, clear_legacy_cookies_work, NULL, NULL, NULL);
+    }
+}
+
+static void cookie_jar_reload(BrowserCookies* cookies) {
+    CookieLoadJob* job = g_new0(CookieLoadJob, 1);
+    job->cookies = cookies;
+    job->jar = cookie_jar_new_table();
+    job->legacy = g_ptr_array_new_with_free_func(jar_cookie_free);
+    storage_submit(cookies->storage, load_cookies_work, load_cookies_done, job, cookie_load_job_free);
+}
+
+// Read and clear the change log; only rows written since the last sync
+static void cookie_changes_work(sqlite3* db, gpointer data) {
+    CookieLoadJob* job = (CookieLoadJob*)data;
+    sqlite3_stmt* stmt;
+
+    sqlite3_exec(db, "BEGIN", 0, 0, NULL);
+    const char* sql = "SELECT host, name, value, path, expiry, isSecure, isHttpOnly, removed "
+                      "FROM cookies.jar_changes ORDER BY seq";
+    if (sqlite3_prepare_v2(db, sql, -1, &stmt, 0) == SQLITE_OK) {
+        while (sqlite3_step(stmt) == SQLITE_ROW) {
+            JarCookie* cookie = jar_cookie_from_row(stmt);
+            cookie->removed = sqlite3_column_int(stmt, 7);
+            g_ptr_array_add(job->changes, cookie);
+        }
+    } else {
+        // The profile's cookies.db was replaced; fall back to a full load
+        job->incremental = FALSE;
+    }
+    sqlite3_finalize(stmt);
+    sqlite3_exec(db, "DELETE FROM cookies.jar_changes", 0, 0, NULL);
+    sqlite3_exec(db, "COMMIT", 0, 0, NULL);
+}
+
+static void cookie_changes_done(gpointer data) {
+    CookieLoadJob* job = (CookieLoadJob*)data;
+    BrowserCookies* cookies = job->cookies;
+
+    if (!job->incremental) {
+        cookies->incremental = FALSE;
+        cookie_jar_reload(cookies);
+        return;
+    }
+
+    // The jar takes the inserted cookies; removed ones are only keys
+    for (guint i = 0; i < job->changes->len; i++) {
+        JarCookie* cookie = g_ptr_array_index(job->changes, i);
+        if (cookie->removed) {
+            cookie_jar_remove(cookies->jar, cookie);
+            jar_cookie_free(cookie);
+        } else if (cookie->domain && cookie->name) {
+            cookie_jar_upsert(cookies->jar, cookie);
+        } else {
+            jar_cookie_free(cookie);
+        }
+    }
+    g_ptr_array_set_free_func(job->changes, NULL);
+}
+
+static void cookie_jar_sync(BrowserCookies* cookies) {
+    CookieLoadJob* job = g_new0(CookieLoadJob, 1);
+    job->cookies = cookies;
+    job->changes = g_ptr_array_new_with_free_func(jar_cookie_free);
+    job->incremental = TRUE;
+    storage_submit(cookies->storage, cookie_changes_work, cookie_changes_done, job, cookie_load_job_free);
+}
+
+static gboolean cookie_jar_reload_timeout(gpointer user_data) {
+    BrowserCookies* cookies = (BrowserCookies*)user_data;
+    cookies->reload_source = 0;
+    if (cookies->incremental && cookies->jar) {
+        cookie_jar_sync(cookies);
+    } else {
+        cookie_jar_reload(cookies);
+    }
+    return G_SOURCE_REMOVE;
+}
+
+static void on_cookies_changed(WebKitCookieManager* manager, gpointer user_data) {
+    BrowserCookies* cookies = (BrowserCookies*)user_data;
+    if (!cookies->reload_source) {
+        cookies->reload_source = g_timeout_add(COOKIE_JAR_RELOAD_DELAY, cookie_jar_reload_timeout, cookies);
+    }
+}
+
+// Drop expired cookies and empty buckets from the in-memory jar
+static gboolean cookie_jar_sweep(gpointer user_data) {
+    BrowserCookies* cookies = (BrowserCookies*)user_data;
+    if (!cookies->jar) return G_SOURCE_CONTINUE;
+
+    gint64 now = g_get_real_time() / G_USEC_PER_SEC;
+    GHashTableIter iter;
+    gpointer key, value;
+    g_hash_table_iter_init(&iter, cookies->jar);
+    while (g_hash_table_iter_next(&iter, &key, &value)) {
+        GPtrArray* bucket = (GPtrArray*)value;
+        for (guint i = bucket->len; i > 0; i--) {
+            JarCookie* cookie = g_ptr_array_index(bucket, i - 1);
+            if (cookie->expires && cookie->expires <= now) {
+                g_ptr_array_remove_index_fast(bucket, i - 1);
+            }
+        }
+        if (bucket->len == 0) {
+            g_hash_table_iter_remove(&iter);
+        }
+    }
+    return G_SOURCE_CONTINUE;
+}
+
+// Point WebKit's cookie persistence at cookies.db and start mirroring it
+static void cookie_jar_init(BrowserCookies* cookies, WebKitWebContext* context) {
+    cookies->manager = webkit_web_context_get_cookie_manager(context);
+
+    // An ephemeral context keeps its cookies to itself; the jar then only
+    // holds what add_cookie() puts in it
+    if (storage_in_memory(cookies->storage)) {
+        cookies->jar = cookie_jar_new_table();
+        cookies->sweep_source = g_timeout_add_seconds(COOKIE_JAR_SWEEP_INTERVAL, cookie_jar_sweep, cookies);
+        return;
+    }
+
+    gchar* path = g_build_filename(cookies->storage->data_dir, "cookies.db", NULL);
+    webkit_cookie_manager_set_persistent_storage(cookies->manager, path,
+                                                 WEBKIT_COOKIE_PERSISTENT_STORAGE_SQLITE);
+    g_free(path);
+
+    g_signal_connect(cookies->manager, "changed", G_CALLBACK(on_cookies_changed), cookies);
+    cookies->sweep_source = g_timeout_add_seconds(COOKIE_JAR_SWEEP_INTERVAL, cookie_jar_sweep, cookies);
+    cookie_jar_reload(cookies);
+}
+
+static void cookie_jar_cleanup(BrowserCookies* cookies) {
+    if (cookies->manager) {
+        g_signal_handlers_disconnect_by_data(cookies->manager, cookies);
+    }
+    if (cookies->sweep_source) g_source_remove(cookies->sweep_source);
+    if (cookies->reload_source) g_source_remove(cookies->reload_source);
+    if (cookies->jar) g_hash_table_unref(cookies->jar);
+    cookies->jar = NULL;
+}
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+// Set a cookie through WebKit, which persists it with upsert semantics
+// on (domain, name, path); the jar is updated immediately
+static void add_cookie(BrowserCookies* cookies, const char* domain, const char* name,
+                      const char* value, const char* path, time_t expires, gboolean secure) {
+    JarCookie* cookie = g_new0(JarCookie, 1);
+    cookie->domain = g_strdup(domain);
+    cookie->name = g_strdup(name);
+    cookie->value = g_strdup(value);
+    cookie->path = g_strdup(path ? path : "/");
+    cookie->expires = expires;
+    cookie->secure = secure;
+
+    if (cookies->manager) {
+        cookie_manager_add(cookies, cookie);
+    }
+    if (!cookies->jar) {
+        cookies->jar = cookie_jar_new_table();
+    }
+    cookie_jar_upsert(cookies->jar, cookie);
+}
+#pragma GCC diagnostic pop
+
+// Settings cache. Every row of the settings table is loaded into memory once
+// at startup; getters never touch SQL. Changes notify watchers immediately and
+// are written back in one transaction after SETTINGS_FLUSH_DELAY.
+#define SETTINGS_FLUSH_DELAY 1000     // ms
+
+// Setting keys and their defaults
+#define SETTING_HOME_PAGE "home_page"
+#define SETTING_SEARCH_ENGINE "search_engine"
+#define SETTING_MODE "mode"
+#define DEFAULT_HOME_PAGE "https://www.google.com"
+#define DEFAULT_SEARCH_ENGINE "Google"
+#define SETTING_SUGGEST_URL "suggest_url"   // Overrides the engine's suggestion endpoint
+#define SETTING_SESSION_ACTIVE "session_active_tab"
+#define SETTING_HIBERNATE_MINUTES "tab_hibernate_minutes"   // 0 disables hibernation
+#define DEFAULT_HIBERNATE_MINUTES 10
+#define SETTING_MONITOR_RSS_LIMIT "monitor_rss_limit_mb"   // Per process; 0 = no limit
+#define SETTING_MONITOR_CPU_LIMIT "monitor_cpu_limit_pct"  // 0 = no limit
+#define SETTING_MONITOR_ACTION "monitor_action"            // "warn" (default) or "hibernate"
+#define SETTING_THROTTLE_MEDIA "throttle_pause_media"      // Pause media in hidden tabs; default on
+#define SETTING_THROTTLE_TIMERS "throttle_timers"          // Clamp timers in hidden pages; default off
+#define SETTING_CONTENT_FILTERS "content_filter_lists"     // ':'-separated content-blocker JSON files
+#define SETTING_SITE_POLICY "site_policy_default"          // POLICY_* flags for hosts without their own
+#define SETTING_VACUUM_FAILED "history_vacuum_failed_at"   // Unix time the auto_vacuum switch last failed
+#define DEFAULT_SITE_POLICY (POLICY_BLOCK_AUTOPLAY | POLICY_LAZY_MEDIA)
+
+// Web process tuning, read when the shared web context is created (see
+// browser_web_context()). Only the cache model applies without a restart.
+#define SETTING_PROCESS_MODEL "web_process_model"         // "multiple" (default) or "shared"
+#define SETTING_PROCESS_LIMIT "web_process_limit"         // 0 = unlimited
+#define SETTING_CACHE_MODEL "web_cache_model"             // "browser" (default), "document-browser", "viewer"
+#define SETTING_MEMORY_LIMIT "web_memory_limit_mb"        // Per web process; 0 = WebKit's default
+#define SETTING_MEMORY_CONSERVATIVE "web_memory_conservative_pct"  // % of the limit
+#define SETTING_MEMORY_STRICT "web_memory_strict_pct"
+#define SETTING_MEMORY_KILL "web_memory_kill_pct"         // 0 = never kill
+#define SETTING_MEMORY_POLL "web_memory_poll_seconds"
+#define MEMORY_DEFAULT_CONSERVATIVE 33                    // WebKit's defaults, in %
+#define MEMORY_DEFAULT_STRICT 50
+
+typedef struct {
+    gchar* key;                   // NULL watches every key
+    SettingsChangedFunc callback;
+    gpointer user_data;
+} SettingsWatch;
+
+static void settings_watch_free(gpointer data) {
+    SettingsWatch* watch = (SettingsWatch*)data;
+    g_free(watch->key);
+    g_free(watch);
+}
+
+static void settings_notify(BrowserSettings* settings, const char* key) {
+    // Callbacks may unwatch, so iterate over a snapshot
+    GPtrArray* matches = g_ptr_array_new();
+    for (guint i = 0; i < settings->watches->len; i++) {
+        SettingsWatch* watch = g_ptr_array_index(settings->watches, i);
+        if (!watch->key || g_strcmp0(watch->key, key) == 0) {
+            g_ptr_array_add(matches, watch);
+        }
+    }
+    for (guint i = 0; i < matches->len; i++) {
+        SettingsWatch* watch = g_ptr_array_index(matches, i);
+        watch->callback(settings, key, watch->user_data);
+    }
+    g_ptr_array_free(matches, TRUE);
+}
+
+static void settings_watch(BrowserSettings* settings, const char* key,
+                           SettingsChangedFunc callback, gpointer user_data) {
+    SettingsWatch* watch = g_new0(SettingsWatch, 1);
+    watch->key = g_strdup(key);
+    watch->callback = callback;
+    watch->user_data = user_data;
+    g_ptr_array_add(settings->watches, watch);
+}
+
+static void settings_unwatch_by_data(BrowserSettings* settings, gpointer user_data) {
+    for (guint i = settings->watches->len; i > 0; i--) {
+        SettingsWatch* watch = g_ptr_array_index(settings->watches, i - 1);
+        if (watch->user_data == user_data) {
+            g_ptr_array_remove_index(settings->watches, i - 1);
+        }
+    }
+}
+
+static const char* settings_get_string(BrowserSettings* settings, const char* key, const char* fallback) {
+    const char* value = settings ? g_hash_table_lookup(settings->values, key) : NULL;
+    return value ? value : fallback;
+}
+
+static gint64 settings_get_int(BrowserSettings* settings, const char* key, gint64 fallback) {
+    const char* value = settings_get_string(settings, key, NULL);
+    if (!value) return fallback;
+
+    char* end = NULL;
+    gint64 parsed = g_ascii_strtoll(value, &end, 10);
+    return (end && *end == '\0' && end != value) ? parsed : fallback;
+}
+
+static gboolean settings_get_bool(BrowserSettings* settings, const char* key, gboolean fallback) {
+    const char* value = settings_get_string(settings, key, NULL);
+    if (!value) return fallback;
+    return g_strcmp0(value, "1") == 0 || g_ascii_strcasecmp(value, "true") == 0;
+}
+
+typedef struct {
+    GPtrArray* pairs;             // Flat name, value pairs
+} SettingsWriteJob;
+
+static void settings_write_job_free(gpointer data) {
+    SettingsWriteJob* job = (SettingsWriteJob*)data;
+    g_ptr_array_unref(job->pairs);
+    g_free(job);
+}
+
+static void settings_write_work(sqlite3* db, gpointer data) {
+    SettingsWriteJob* job = (SettingsWriteJob*)data;
+    sqlite3_stmt* stmt;
+    const char* sql = "INSERT INTO settings (name, value, updated_at) VALUES (?, ?, CURRENT_TIMESTAMP) "
+                      "ON CONFLICT(name) DO UPDATE SET value = excluded.value, "
+                      "updated_at = excluded.updated_at";
+
+    if (sqlite3_prepare_v2(db, sql, -1, &stmt, 0) != SQLITE_OK) {
+        fprintf(stderr, "Failed to prepare statement: %s\n", sqlite3_errmsg(db));
+        return;
+    }
+
+    sqlite3_exec(db, "BEGIN", 0, 0, NULL);
+    for (guint i = 0; i + 1 < job->pairs->len; i += 2) {
+        sqlite3_bind_text(stmt, 1, g_ptr_array_index(job->pairs, i), -1, SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 2, g_ptr_array_index(job->pairs, i + 1), -1, SQLITE_STATIC);
+        if (sqlite3_step(stmt) != SQLITE_DONE) {
+            fprintf(stderr, "Failed to save setting: %s\n", sqlite3_errmsg(db));
+        }
+        sqlite3_reset(stmt);
+    }
+    sqlite3_exec(db, "COMMIT", 0, 0, NULL);
+
+    sqlite3_finalize(stmt);
+}
+
+static void settings_flush(BrowserSettings* settings) {
+    if (settings->flush_source) {
+        g_source_remove(settings->flush_source);
+        settings->flush_source = 0;
+    }
+    if (g_hash_table_size(settings->dirty) == 0) return;
+
+    SettingsWriteJob* job = g_new0(SettingsWriteJob, 1);
+    job->pairs = g_ptr_array_new_with_free_func(g_free);
+
+    GHashTableIter iter;
+    gpointer key;
+    g_hash_table_iter_init(&iter, settings->dirty);
+    while (g_hash_table_iter_next(&iter, &key, NULL)) {
+        g_ptr_array_add(job->pairs, g_strdup(key));
+        g_ptr_array_add(job->pairs, g_strdup(g_hash_table_lookup(settings->values, key)));
+    }
+    g_hash_table_remove_all(settings->dirty);
+
+    storage_submit(settings->storage, settings_write_work, NULL, job, settings_write_job_free);
+}
+
+static gboolean settings_flush_timeout(gpointer user_data) {
+    BrowserSettings* settings = (BrowserSettings*)user_data;
+    settings->flush_source = 0;
+    settings_flush(settings);
+    return G_SOURCE_REMOVE;
+}
+
+static void settings_set_string(BrowserSettings* settings, const char* key, const char* value) {
+    if (!settings) return;
+    if (g_strcmp0(g_hash_table_lookup(settings->values, key), value) == 0) return;
+
+    g_hash_table_insert(settings->values, g_strdup(key), g_strdup(value));
+    g_hash_table_add(settings->dirty, g_strdup(key));
+
+    // Restart the debounce window on every change
+    if (settings->flush_source) g_source_remove(settings->flush_source);
+    settings->flush_source = g_timeout_add(SETTINGS_FLUSH_DELAY, settings_flush_timeout, settings);
+
+    settings_notify(settings, key);
+}
+
+static void settings_set_int(BrowserSettings* settings, const char* key, gint64 value) {
+    gchar* str = g_strdup_printf("%" G_GINT64_FORMAT, value);
+    settings_set_string(settings, key, str);
+    g_free(str);
+}
+
+typedef struct {
+    BrowserSettings* settings;
+    GPtrArray* pairs;             // Flat name, value pairs
+} SettingsLoadJob;
+
+static void settings_load_job_free(gpointer data) {
+    SettingsLoadJob* job = (SettingsLoadJob*)data;
+    g_ptr_array_unref(job->pairs);
+    g_free(job);
+}
+
+static void settings_load_work(sqlite3* db, gpointer data) {
+    SettingsLoadJob* job = (SettingsLoadJob*)data;
+    sqlite3_stmt* stmt;
+
+    if (sqlite3_prepare_v2(db, "SELECT name, value FROM settings", -1, &stmt, 0) == SQLITE_OK) {
+        while (sqlite3_step(stmt) == SQLITE_ROW) {
+            g_ptr_array_add(job->pairs, g_strdup((const char*)sqlite3_column_text(stmt, 0)));
+            g_ptr_array_add(job->pairs, g_strdup((const char*)sqlite3_column_text(stmt, 1)));
+        }
+    }
+    sqlite3_finalize(stmt);
+}
+
+static void settings_load_done(gpointer data) {
+    SettingsLoadJob* job = (SettingsLoadJob*)data;
+    BrowserSettings* settings = job->settings;
+
+    for (guint i = 0; i + 1 < job->pairs->len; i += 2) {
+        const char* key = g_ptr_array_index(job->pairs, i);
+        const char* value = g_ptr_array_index(job->pairs, i + 1);
+
+        // Values changed before the load finished are newer than the table
+        if (!key || g_hash_table_contains(settings->dirty, key)) continue;
+        if (g_strcmp0(g_hash_table_lookup(settings->values, key), value) == 0) continue;
+
+        g_hash_table_insert(settings->values, g_strdup(key), g_strdup(value));
+        settings_notify(settings, key);
+    }
+    settings->loaded = TRUE;
+}
+
+static BrowserSettings* settings_new(BrowserStorage* storage) {
+    BrowserSettings* settings = g_new0(BrowserSettings, 1);
+    settings->storage = storage;
+    settings->values = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, g_free);
+    settings->dirty = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+    settings->watches = g_ptr_array_new_with_free_func(settings_watch_free);
+
+    SettingsLoadJob* job = g_new0(SettingsLoadJob, 1);
+    job->settings = settings;
+    job->pairs = g_ptr_array_new_with_free_func(g_free);
+    storage_submit(storage, settings_load_work, settings_load_done, job, settings_load_job_free);
+
+    return settings;
+}
+
+// Queue unsaved changes; they are written before the storage thread stops
+static void settings_free(BrowserSettings* settings) {
+    if (!settings) return;
+
+    settings_flush(settings);
+    g_hash_table_unref(settings->values);
+    g_hash_table_unref(settings->dirty);
+    g_ptr_array_unref(settings->watches);
+    g_free(settings);
+}
+
+// All tabs share one web context owned by BrowserData. It is created on first
+// use, after the settings have loaded, because the process model and the
+// memory-pressure limits cannot change once a web process has started.
+static WebKitCacheModel cache_model_from_name(const char* name) {
+    if (g_strcmp0(name, "viewer") == 0) return WEBKIT_CACHE_MODEL_DOCUMENT_VIEWER;
+    if (g_strcmp0(name, "document-browser") == 0) return WEBKIT_CACHE_MODEL_DOCUMENT_BROWSER;
+    return WEBKIT_CACHE_MODEL_WEB_BROWSER;
+}
+
+// The cache model is the one knob that applies to a running context
+static void on_cache_model_setting_changed(BrowserSettings* settings, const char* key, gpointer user_data) {
+    webkit_web_context_set_cache_model(WEBKIT_WEB_CONTEXT(user_data),
+                                       cache_model_from_name(settings_get_string(settings, key, NULL)));
+}
+
+#if WEBKIT_CHECK_VERSION(2, 34, 0)
+// NULL when nothing is configured, leaving WebKit's own defaults
+static WebKitMemoryPressureSettings* memory_pressure_settings_new(BrowserSettings* settings) {
+    gint64 limit = settings_get_int(settings, SETTING_MEMORY_LIMIT, 0);
+    gint64 conservative = settings_get_int(settings, SETTING_MEMORY_CONSERVATIVE, 0);
+    gint64 strict = settings_get_int(settings, SETTING_MEMORY_STRICT, 0);
+    gint64 kill = settings_get_int(settings, SETTING_MEMORY_KILL, 0);
+    gint64 poll = settings_get_int(settings, SETTING_MEMORY_POLL, 0);
+
+    if (limit <= 0 && conservative <= 0 && strict <= 0 && kill <= 0 && poll <= 0) {
+        return NULL;
+    }
+
+    WebKitMemoryPressureSettings* pressure = webkit_memory_pressure_settings_new();
+    if (limit > 0) {
+        webkit_memory_pressure_settings_set_memory_limit(pressure, (guint)limit);
+    }
+
+    if (conservative > 0 || strict > 0) {
+        if (conservative <= 0) conservative = MEMORY_DEFAULT_CONSERVATIVE;
+        if (strict <= 0) strict = MEMORY_DEFAULT_STRICT;
+        if (conservative < strict && strict < 100) {
+            // WebKit rejects a conservative threshold at or above the strict
+            // one, so move whichever keeps that true at every step first
+            if (strict > MEMORY_DEFAULT_CONSERVATIVE) {
+                webkit_memory_pressure_settings_set_strict_threshold(pressure, strict / 100.0);
+                webkit_memory_pressure_settings_set_conservative_threshold(pressure, conservative / 100.0);
+            } else {
+                webkit_memory_pressure_settings_set_conservative_threshold(pressure, conservative / 100.0);
+                webkit_memory_pressure_settings_set_strict_threshold(pressure, strict / 100.0);
+            }
+        } else {
+            fprintf(stderr, "Ignoring memory thresholds: need 0 < %s < %s < 100\n",
+                    SETTING_MEMORY_CONSERVATIVE, SETTING_MEMORY_STRICT);
+        }
+    }
+
+    if (kill > 0) {
+        webkit_memory_pressure_settings_set_kill_threshold(pressure, kill / 100.0);
+    }
+    if (poll > 0) {
+        webkit_memory_pressure_settings_set_poll_interval(pressure, (gdouble)poll);
+    }
+    return pressure;
+}
+#endif
+
+static WebKitWebContext* browser_web_context(BrowserData* browser) {
+    if (browser->web_context) return browser->web_context;
+
+    BrowserSettings* settings = browser->settings;
+    WebKitWebContext* context = NULL;
+
+    // A RAM-only profile gets an ephemeral data manager: no disk cache,
+    // local storage, IndexedDB or cookie file
+    WebKitWebsiteDataManager* data_manager = NULL;
+    if (storage_in_memory(browser->storage)) {
+        data_manager = webkit_website_data_manager_new_ephemeral();
+    }
+
+#if WEBKIT_CHECK_VERSION(2, 34, 0)
+    WebKitMemoryPressureSettings* pressure = memory_pressure_settings_new(settings);
+    if (pressure) {
+        // The network process takes its limits from the data manager
+        webkit_website_data_manager_set_memory_pressure_settings(pressure);
+        if (data_manager) {
+            context = WEBKIT_WEB_CONTEXT(g_object_new(WEBKIT_TYPE_WEB_CONTEXT,
+                                                      "memory-pressure-settings", pressure,
+                                                      "website-data-manager", data_manager,
+                                                      NULL));
+        } else {
+            context = WEBKIT_WEB_CONTEXT(g_object_new(WEBKIT_TYPE_WEB_CONTEXT,
+                                                      "memory-pressure-settings", pressure,
+                                                      NULL));
+        }
+        webkit_memory_pressure_settings_free(pressure);
+    }
+#endif
+    if (!context) {
+        context = data_manager ? webkit_web_context_new_with_website_data_manager(data_manager)
+                               : webkit_web_context_new();
+    }
+    if (data_manager) {
+        g_object_unref(data_manager);
+    }
+
+    // Both are no-ops on WebKitGTK releases that always isolate per site
+    G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+    const char* model = settings_get_string(settings, SETTING_PROCESS_MODEL, "multiple");
+    webkit_web_context_set_process_model(context,
+        g_strcmp0(model, "shared") == 0 ? WEBKIT_PROCESS_MODEL_SHARED_SECONDARY_PROCESS
+                                        : WEBKIT_PROCESS_MODEL_MULTIPLE_SECONDARY_PROCESSES);
+    gint64 limit = settings_get_int(settings, SETTING_PROCESS_LIMIT, 0);
+    if (limit > 0) {
+        webkit_web_context_set_web_process_count_limit(context, (guint)limit);
+    }
+    G_GNUC_END_IGNORE_DEPRECATIONS
+
+    webkit_web_context_set_cache_model(context,
+        cache_model_from_name(settings_get_string(settings, SETTING_CACHE_MODEL, NULL)));
+    settings_watch(settings, SETTING_CACHE_MODEL, on_cache_model_setting_changed, context);
+
+    cookie_jar_init(browser->cookies, context);
+    browser->web_context = context;
+    return context;
+}
+
+// Content blocking. Each file in content_filter_lists is a WebKit
+// content-blocker list (JSON). Lists are compiled once into the
+// WebKitUserContentFilterStore, keyed by path, size and mtime. Later startups
+// load the compiled bytecode; a changed list gets a new key and is recompiled.
+// Compiled lists that are no longer configured are removed from the store.
+// The RAM-only profile compiles into a private temporary directory instead,
+// so concurrent sessions neither share nor prune each other's lists.
+#define CONTENT_FILTER_DIR "content-filters"
+#define CONTENT_FILTER_TEMP_DIR "rocket-browser-filters-XXXXXX"
+// WebKit's FrameLoadBlockedByContentBlocker, which WebKitPolicyError lacks
+#define POLICY_ERROR_BLOCKED_BY_CONTENT_BLOCKER 104
+
+typedef struct {
+    ContentBlocker* blocker;   // Only touched while cancellable is not cancelled
+    GCancellable* cancellable;
+    gchar* path;
+    gchar* identifier;
+} FilterListJob;
+
+static FilterListJob* filter_list_job_new(ContentBlocker* blocker, const char* path, const char* identifier) {
+    FilterListJob* job = g_new0(FilterListJob, 1);
+    job->blocker = blocker;
+    job->cancellable = g_object_ref(blocker->cancellable);
+    job->path = g_strdup(path);
+    job->identifier = g_strdup(identifier);
+    return job;
+}
+
+static void filter_list_job_free(FilterListJob* job) {
+    g_object_unref(job->cancellable);
+    g_free(job->path);
+    g_free(job->identifier);
+    g_free(job);
+}
+
+// Prefer the runtime directory, normally a tmpfs, over the system temp dir
+static gchar* content_blocker_make_temp_dir(void) {
+    gchar* path = g_build_filename(g_get_user_runtime_dir(), CONTENT_FILTER_TEMP_DIR, NULL);
+    if (g_mkdtemp(path)) return path;
+    g_free(path);
+
+    GError* error = NULL;
+    path = g_dir_make_tmp(CONTENT_FILTER_TEMP_DIR, &error);
+    if (!path) {
+        fprintf(stderr, "Failed to create a content filter directory: %s\n", error->message);
+        g_error_free(error);
+    }
+    return path;
+}
+
+static ContentBlocker* content_blocker_new(BrowserStorage* storage) {
+    ContentBlocker* blocker = g_new0(ContentBlocker, 1);
+    if (storage_in_memory(storage)) {
+        blocker->temp_dir = content_blocker_make_temp_dir();
+        if (blocker->temp_dir) {
+            blocker->store = webkit_user_content_filter_store_new(blocker->temp_dir);
+        }
+    } else {
+        gchar* path = g_build_filename(storage->data_dir, CONTENT_FILTER_DIR, NULL);
+        blocker->store = webkit_user_content_filter_store_new(path);
+        g_free(path);
+    }
+    blocker->cancellable = g_cancellable_new();
+    blocker->identifiers = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+    return blocker;
+}
+
+// The store keeps one file per compiled list, directly in the directory
+static void content_blocker_remove_temp_dir(const char* path) {
+    GDir* dir = g_dir_open(path, 0, NULL);
+    if (dir) {
+        const char* name;
+        while ((name = g_dir_read_name(dir))) {
+            gchar* file = g_build_filename(path, name, NULL);
+            g_remove(file);
+            g_free(file);
+        }
+        g_dir_close(dir);
+    }
+    if (g_rmdir(path) != 0) {
+        fprintf(stderr, "Failed to remove %s: %s\n", path, g_strerror(errno));
+    }
+}
+
+// The list's store identifier, which changes whenever the file does
+static gchar* content_filter_identifier(const char* path) {
+    GStatBuf st;
+    if (g_stat(path, &st) != 0) return NULL;
+
+    gchar* key = g_strdup_printf("%s\n%" G_GINT64_FORMAT "\n%" G_GINT64_FORMAT,
+                                 path, (gint64)st.st_size, (gint64)st.st_mtime);
+    gchar* identifier = g_compute_checksum_for_string(G_CHECKSUM_SHA1, key, -1);
+    g_free(key);
+    return identifier;
+}
+
+static void on_filter_identifiers_fetched(GObject* source, GAsyncResult* result, gpointer data) {
+    FilterListJob* job = (FilterListJob*)data;
+    gchar** identifiers = webkit_user_content_filter_store_fetch_identifiers_finish(
+        WEBKIT_USER_CONTENT_FILTER_STORE(source), result);
+
+    if (identifiers && !g_cancellable_is_cancelled(job->cancellable)) {
+        for (gchar** id = identifiers; *id; id++) {
+            if (!g_hash_table_contains(job->blocker->identifiers, *id)) {
+                webkit_user_content_filter_store_remove(job->blocker->store, *id, NULL, NULL, NULL);
+            }
+        }
+    }
+    g_strfreev(identifiers);
+    filter_list_job_free(job);
+}
+
+// Drop compiled lists that are no longer configured. A private store goes
+// away as a whole at exit.
+static void content_blocker_prune(ContentBlocker* blocker) {
+    g_debug("Content filters: %u loaded, %u compiled", blocker->loaded, blocker->compiled);
+    if (blocker->temp_dir) return;
+    webkit_user_content_filter_store_fetch_identifiers(blocker->store, blocker->cancellable,
+                                                       on_filter_identifiers_fetched,
+                                                       filter_list_job_new(blocker, NULL, NULL));
+}
+
+// Install a loaded or freshly compiled list (filter may be NULL on failure)
+static void content_blocker_finish_list(FilterListJob* job, WebKitUserContentFilter* filter) {
+    ContentBlocker* blocker = job->blocker;
+    if (filter) {
+        webkit_user_content_manager_add_filter(blocker->manager, filter);
+        webkit_user_content_filter_unref(filter);
+    }
+    if (--blocker->pending == 0) {
+        content_blocker_prune(blocker);
+    }
+    filter_list_job_free(job);
+}
+
+static void on_filter_list_saved(GObject* source, GAsyncResult* result, gpointer data) {
+    FilterListJob* job = (FilterListJob*)data;
+    GError* error = NULL;
+    WebKitUserContentFilter* filter = webkit_user_content_filter_store_save_finish(
+        WEBKIT_USER_CONTENT_FILTER_STORE(source), result, &error);
+
+    if (g_cancellable_is_cancelled(job->cancellable)) {
+        if (filter) webkit_user_content_filter_unref(filter);
+        g_clear_error(&error);
+        filter_list_job_free(job);
+        return;
+    }
+    if (filter) {
+        job->blocker->compiled++;
+    } else {
+        fprintf(stderr, "Failed to compile content filter %s: %s\n", job->path, error->message);
+        g_error_free(error);
+    }
+    content_blocker_finish_list(job, filter);
+}
+
+static void on_filter_list_read(GObject* source, GAsyncResult* result, gpointer data) {
+    FilterListJob* job = (FilterListJob*)data;
+    GError* error = NULL;
+    GBytes* bytes = g_file_load_bytes_finish(G_FILE(source), result, NULL, &error);
+
+    if (g_cancellable_is_cancelled(job->cancellable)) {
+        if (bytes) g_bytes_unref(bytes);
+        g_clear_error(&error);
+        filter_list_job_free(job);
+        return;
+    }
+    if (!bytes) {
+        fprintf(stderr, "Failed to read content filter %s: %s\n", job->path, error->message);
+        g_error_free(error);
+        content_blocker_finish_list(job, NULL);
+        return;
+    }
+
+    webkit_user_content_filter_store_save(job->blocker->store, job->identifier, bytes,
+                                          job->cancellable, on_filter_list_saved, job);
+    g_bytes_unref(bytes);
+}
+
+static void on_filter_list_loaded(GObject* source, GAsyncResult* result, gpointer data) {
+    FilterListJob* job = (FilterListJob*)data;
+    WebKitUserContentFilter* filter = webkit_user_content_filter_store_load_finish(
+        WEBKIT_USER_CONTENT_FILTER_STORE(source), result, NULL);
+
+    if (g_cancellable_is_cancelled(job->cancellable)) {
+        if (filter) webkit_user_content_filter_unref(filter);
+        filter_list_job_free(job);
+        return;
+    }
+    if (filter) {
+        job->blocker->loaded++;
+        content_blocker_finish_list(job, filter);
+        return;
+    }
+
+    // Not compiled yet, or the list changed since
+    GFile* file = g_file_new_for_path(job->path);
+    g_file_load_bytes_async(file, job->cancellable, on_filter_list_read, job);
+    g_object_unref(file);
+}
+
+// Load (or compile) every configured list into manager, which every view shares
+static void content_blocker_start(ContentBlocker* blocker, WebKitUserContentManager* manager,
+                                  BrowserSettings* settings) {
+    blocker->manager = manager;
+    if (!blocker->store) return;
+
+    gchar** paths = g_strsplit(settings_get_string(settings, SETTING_CONTENT_FILTERS, ""), ":", -1);
+    for (gchar** path = paths; *path; path++) {
+        if (!**path) continue;
+
+        gchar* identifier = content_filter_identifier(*path);
+        if (!identifier) {
+            fprintf(stderr, "Content filter %s not found\n", *path);
+            continue;
+        }
+        if (g_hash_table_contains(blocker->identifiers, identifier)) {
+            g_free(identifier);
+            continue;
+        }
+        g_hash_table_add(blocker->identifiers, identifier);
+
+        blocker->pending++;
+        webkit_user_content_filter_store_load(blocker->store, identifier, blocker->cancellable,
+                                              on_filter_list_loaded,
+                                              filter_list_job_new(blocker, *path, identifier));
+    }
+    g_strfreev(paths);
+
+    if (blocker->pending == 0) {
+        content_blocker_prune(blocker);
+    }
+}
+
+static void content_blocker_free(ContentBlocker* blocker) {
+    if (!blocker) return;
+
+    g_cancellable_cancel(blocker->cancellable);
+    g_object_unref(blocker->cancellable);
+    g_clear_object(&blocker->store);
+    g_hash_table_unref(blocker->identifiers);
+    if (blocker->temp_dir) {
+        content_blocker_remove_temp_dir(blocker->temp_dir);
+        g_free(blocker->temp_dir);
+    }
+    g_free(blocker);
+}
+
+// Compile rules built at runtime and swap them in under identifier; NULL
+// json removes them
+static void on_filter_rules_saved(GObject* source, GAsyncResult* result, gpointer data) {
+    FilterListJob* job = (FilterListJob*)data;
+    GError* error = NULL;
+    WebKitUserContentFilter* filter = webkit_user_content_filter_store_save_finish(
+        WEBKIT_USER_CONTENT_FILTER_STORE(source), result, &error);
+
+    if (g_cancellable_is_cancelled(job->cancellable)) {
+        if (filter) webkit_user_content_filter_unref(filter);
+        g_clear_error(&error);
+    } else if (filter) {
+        webkit_user_content_manager_remove_filter_by_id(job->blocker->manager, job->identifier);
+        webkit_user_content_manager_add_filter(job->blocker->manager, filter);
+        webkit_user_content_filter_unref(filter);
+    } else {
+        fprintf(stderr, "Failed to compile %s rules: %s\n", job->identifier, error->message);
+        g_error_free(error);
+    }
+    filter_list_job_free(job);
+}
+
+static void content_blocker_set_rules(ContentBlocker* blocker, const char* identifier, const char* json) {
+    if (!json) {
+        g_hash_table_remove(blocker->identifiers, identifier);
+        webkit_user_content_manager_remove_filter_by_id(blocker->manager, identifier);
+        return;
+    }
+    if (!blocker->store) return;
+
+    g_hash_table_add(blocker->identifiers, g_strdup(identifier));   // Keep it from being pruned
+    GBytes* bytes = g_bytes_new(json, strlen(json));
+    webkit_user_content_filter_store_save(blocker->store, identifier, bytes, blocker->cancellable,
+                                          on_filter_rules_saved, filter_list_job_new(blocker, NULL, identifier));
+    g_bytes_unref(bytes);
+}
+
+// Site policies. A default set of POLICY_* flags (site_policy_default) can be
+// overridden per host; overrides live in the site_policies table and in
+// memory. Autoplay is decided per navigation through WebKitWebsitePolicies,
+// lazy loading is a user script carrying the overrides, and image and font
+// blocking are content-blocker rules compiled like the filter lists. Both
+// resolve a host like site_policy_flags(): its nearest override wins.
+#define SITE_POLICY_FILTER_ID "site-policies"
+
+// Marks added images and iframes loading=lazy. WebKit starts fetching a
+// parsed <img src> before the observer runs and does not cancel that fetch
+// when the attribute changes, so this only defers elements that get their
+// source after insertion (as script-driven lazy loaders do). Nothing is
+// counted as saved for it.
+// A format: the overrides as a JSON object of host -> lazy, then the default
+static const char* LAZY_MEDIA_SCRIPT =
+    "(function() {"
+    "  const overrides = %s;"
+    "  let lazy = %s;"
+    "  for (let host = location.hostname; host; ) {"
+    "    if (Object.prototype.hasOwnProperty.call(overrides, host)) { lazy = overrides[host]; break; }"
+    "    const dot = host.indexOf('.');"
+    "    host = dot < 0 ? '' : host.slice(dot + 1);"
+    "  }"
+    "  if (!lazy) return;"
+    "  const defer = function(node) {"
+    "    if ((node.tagName === 'IMG' || node.tagName === 'IFRAME') && !node.hasAttribute('loading')) {"
+    "      node.setAttribute('loading', 'lazy');"
+    "    }"
+    "  };"
+    "  const observer = new MutationObserver(function(mutations) {"
+    "    mutations.forEach(function(m) { m.addedNodes.forEach(defer); });"
+    "  });"
+    "  observer.observe(document, { childList: true, subtree: true });"
+    "  window.addEventListener('load', function() { observer.disconnect(); });"
+    "})();";
+
+typedef struct {
+    SitePolicies* policies;
+    BrowserData* browser;
+    GHashTable* hosts;        // Loaded overrides
+    gchar* host;
+    guint flags;
+    gboolean remove;          // Host goes back to the default
+} SitePolicyJob;
+
+static void content_manager_sync_scripts(BrowserData* browser);
+
+static void site_policy_job_free(gpointer data) {
+    SitePolicyJob* job = (SitePolicyJob*)data;
+    if (job->hosts) g_hash_table_unref(job->hosts);
+    g_free(job->host);
+    g_free(job);
+}
+
+static guint site_policy_default(BrowserSettings* settings) {
+    return (guint)settings_get_int(settings, SETTING_SITE_POLICY, DEFAULT_SITE_POLICY);
+}
+
+// Flags for host: its own override, else its nearest parent's, else the default
+static guint site_policy_flags(BrowserData* browser, const char* host) {
+    for (const char* name = host; name && *name; ) {
+        gpointer flags;
+        if (g_hash_table_lookup_extended(browser->policies->hosts, name, NULL, &flags)) {
+            return GPOINTER_TO_UINT(flags);
+        }
+        name = strchr(name, '.');
+        if (name) name++;
+    }
+    return site_policy_default(browser->settings);
+}
+
+// Flags host would have without its own override
+static guint site_policy_inherited(BrowserData* browser, const char* host) {
+    const char* parent = strchr(host, '.');
+    return parent ? site_policy_flags(browser, parent + 1) : site_policy_default(browser->settings);
+}
+
+static gchar* site_policy_json(JsonBuilder* builder) {
+    JsonGenerator* generator = json_generator_new();
+    JsonNode* root = json_builder_get_root(builder);
+    json_generator_set_root(generator, root);
+    gchar* json = json_generator_to_data(generator, NULL);
+    json_node_unref(root);
+    g_object_unref(generator);
+    return json;
+}
+
+// The lazy-loading user script, or NULL if no host loads lazily. It runs
+// everywhere and picks the host's nearest override itself; URL-pattern
+// allow and block lists cannot express an override inside an override.
+static WebKitUserScript* site_policy_lazy_script(BrowserData* browser) {
+    gboolean lazy = (site_policy_default(browser->settings) & POLICY_LAZY_MEDIA) != 0;
+    gboolean any = lazy;
+    JsonBuilder* builder = json_builder_new();
+    GHashTableIter iter;
+    gpointer key, value;
+
+    json_builder_begin_object(builder);
+    g_hash_table_iter_init(&iter, browser->policies->hosts);
+    while (g_hash_table_iter_next(&iter, &key, &value)) {
+        gboolean host_lazy = (GPOINTER_TO_UINT(value) & POLICY_LAZY_MEDIA) != 0;
+        json_builder_set_member_name(builder, key);
+        json_builder_add_boolean_value(builder, host_lazy);
+        any |= host_lazy;
+    }
+    json_builder_end_object(builder);
+    if (!any) {
+        g_object_unref(builder);
+        return NULL;
+    }
+
+    gchar* overrides = site_policy_json(builder);
+    gchar* source = g_strdup_printf(LAZY_MEDIA_SCRIPT, overrides, lazy ? "true" : "false");
+    WebKitUserScript* script = webkit_user_script_new(source,
+        WEBKIT_USER_CONTENT_INJECT_ALL_FRAMES, WEBKIT_USER_SCRIPT_INJECT_AT_DOCUMENT_START, NULL, NULL);
+    g_free(source);
+    g_free(overrides);
+    g_object_unref(builder);
+    return script;
+}
+
+static guint host_label_count(const char* host) {
+    guint labels = 1;
+    for (const char* p = host; *p; p++) {
+        if (*p == '.') labels++;
+    }
+    return labels;
+}
+
+static gint site_policy_compare_depth(gconstpointer a, gconstpointer b) {
+    return (gint)host_label_count(*(const char**)a) - (gint)host_label_count(*(const char**)b);
+}
+
+// One rule for resources of type, on pages of host and its subdomains (or
+// on every page if host is NULL)
+static void site_policy_add_rule(JsonBuilder* builder, const char* type, const char* host, const char* action) {
+    json_builder_begin_object(builder);
+    json_builder_set_member_name(builder, "trigger");
+    json_builder_begin_object(builder);
+    json_builder_set_member_name(builder, "url-filter");
+    json_builder_add_string_value(builder, ".*");
+    json_builder_set_member_name(builder, "resource-type");
+    json_builder_begin_array(builder);
+    json_builder_add_string_value(builder, type);
+    json_builder_end_array(builder);
+    if (host) {
+        gchar* domain = g_strconcat("*", host, NULL);
+        json_builder_set_member_name(builder, "if-domain");
+        json_builder_begin_array(builder);
+        json_builder_add_string_value(builder, domain);
+        json_builder_end_array(builder);
+        g_free(domain);
+    }
+    json_builder_end_object(builder);
+    json_builder_set_member_name(builder, "action");
+    json_builder_begin_object(builder);
+    json_builder_set_member_name(builder, "type");
+    json_builder_add_string_value(builder, action);
+    json_builder_end_object(builder);
+    json_builder_end_object(builder);
+}
+
+// Content-blocker rules for image and font blocking, or NULL if none apply.
+// Rules run in order, so the default comes first and overrides follow from
+// the least to the most specific host. Each override that changes what its
+// host inherits either blocks or, with ignore-previous-rules, unblocks.
+static gchar* site_policy_filter_json(BrowserData* browser) {
+    static const struct { guint flag; const char* type; } KINDS[] = {
+        { POLICY_BLOCK_IMAGES, "image" },
+        { POLICY_BLOCK_FONTS, "font" },
+    };
+    guint defaults = site_policy_default(browser->settings);
+    JsonBuilder* builder = json_builder_new();
+    guint rules = 0;
+
+    GPtrArray* hosts = g_ptr_array_new();
+    GHashTableIter iter;
+    gpointer key;
+    g_hash_table_iter_init(&iter, browser->policies->hosts);
+    while (g_hash_table_iter_next(&iter, &key, NULL)) {
+        g_ptr_array_add(hosts, key);
+    }
+    g_ptr_array_sort(hosts, site_policy_compare_depth);
+
+    json_builder_begin_array(builder);
+    for (gsize k = 0; k < G_N_ELEMENTS(KINDS); k++) {
+        if (defaults & KINDS[k].flag) {
+            site_policy_add_rule(builder, KINDS[k].type, NULL, "block");
+            rules++;
+        }
+        for (guint i = 0; i < hosts->len; i++) {
+            const char* host = g_ptr_array_index(hosts, i);
+            guint own = site_policy_flags(browser, host) & KINDS[k].flag;
+            if (own == (site_policy_inherited(browser, host) & KINDS[k].flag)) continue;
+
+            site_policy_add_rule(builder, KINDS[k].type, host, own ? "block" : "ignore-previous-rules");
+            rules++;
+        }
+    }
+    json_builder_end_array(builder);
+    g_ptr_array_unref(hosts);
+
+    gchar* json = rules ? site_policy_json(builder) : NULL;
+    g_object_unref(builder);
+    return json;
+}
+
+// Bring the shared content manager in line with the current policies.
+// Autoplay needs nothing here; it is looked up on every navigation.
+static void site_policies_apply(BrowserData* browser) {
+    if (!browser->content_manager) return;
+
+    content_manager_sync_scripts(browser);
+    gchar* json = site_policy_filter_json(browser);
+    content_blocker_set_rules(browser->blocker, SITE_POLICY_FILTER_ID, json);
+    g_free(json);
+}
+
+static void site_policies_load_work(sqlite3* db, gpointer data) {
+    SitePolicyJob* job = (SitePolicyJob*)data;
+    sqlite3_stmt* stmt;
+
+    if (sqlite3_prepare_v2(db, "SELECT host, flags FROM site_policies", -1, &stmt, 0) == SQLITE_OK) {
+        while (sqlite3_step(stmt) == SQLITE_ROW) {
+            g_hash_table_insert(job->hosts, g_strdup((const char*)sqlite3_column_text(stmt, 0)),
+                                GUINT_TO_POINTER((guint)sqlite3_column_int(stmt, 1)));
+        }
+    }
+    sqlite3_finalize(stmt);
+}
+
+static void site_policies_load_done(gpointer data) {
+    SitePolicyJob* job = (SitePolicyJob*)data;
+    GHashTableIter iter;
+    gpointer key, value;
+
+    // Overrides set before the load finished win
+    g_hash_table_iter_init(&iter, job->hosts);
+    while (g_hash_table_iter_next(&iter, &key, &value)) {
+        if (!g_hash_table_contains(job->policies->hosts, key)) {
+            g_hash_table_insert(job->policies->hosts, g_strdup(key), value);
+        }
+    }
+    site_policies_apply(job->browser);
+}
+
+static void site_policies_save_work(sqlite3* db, gpointer data) {
+    SitePolicyJob* job = (SitePolicyJob*)data;
+    sqlite3_stmt* stmt;
+    const char* sql = job->remove
+        ? "DELETE FROM site_policies WHERE host = ?"
+        : "INSERT INTO site_policies (host, flags) VALUES (?, ?) "
+          "ON CONFLICT(host) DO UPDATE SET flags = excluded.flags";
+
+    if (sqlite3_prepare_v2(db, sql, -1, &stmt, 0) == SQLITE_OK) {
+        sqlite3_bind_text(stmt, 1, job->host, -1, SQLITE_STATIC);
+        if (!job->remove) sqlite3_bind_int(stmt, 2, (int)job->flags);
+        if (sqlite3_step(stmt) != SQLITE_DONE) {
+            fprintf(stderr, "Failed to save site policy for %s: %s\n", job->host, sqlite3_errmsg(db));
+        }
+    }
+    sqlite3_finalize(stmt);
+}
+
+static SitePolicies* site_policies_new(BrowserData* browser) {
+    SitePolicies* policies = g_new0(SitePolicies, 1);
+    policies->storage = browser->storage;
+    policies->hosts = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+
+    SitePolicyJob* job = g_new0(SitePolicyJob, 1);
+    job->policies = policies;
+    job->browser = browser;
+    job->hosts = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+    storage_submit(browser->storage, site_policies_load_work, site_policies_load_done, job, site_policy_job_free);
+    return policies;
+}
+
+// Give host its own flags. The override is dropped only when host would get
+// the same flags without it, from a parent's override or the default.
+static void site_policy_set(BrowserData* browser, const char* host, guint flags) {
+    SitePolicies* policies = browser->policies;
+    SitePolicyJob* job = g_new0(SitePolicyJob, 1);
+    job->host = g_strdup(host);
+    job->flags = flags;
+    job->remove = flags == site_policy_inherited(browser, host);
+
+    if (job->remove) {
+        g_hash_table_remove(policies->hosts, host);
+    } else {
+        g_hash_table_insert(policies->hosts, g_strdup(host), GUINT_TO_POINTER(flags));
+    }
+    storage_submit(policies->storage, site_policies_save_work, NULL, job, site_policy_job_free);
+    site_policies_apply(browser);
+}
+
+static void on_site_policy_setting_changed(BrowserSettings* settings, const char* key, gpointer user_data) {
+    site_policies_apply((BrowserData*)user_data);
+}
+
+static void site_policies_free(SitePolicies* policies) {
+    if (!policies) return;
+    g_hash_table_unref(policies->hosts);
+    g_free(policies);
+}
+
+// Per-page counters next to the bookmark button: requests blocked by the
+// filters and site policies, and an estimate of the bytes that spared
+static void tab_update_blocked_label(BrowserTab* tab) {
+    if (tab->blocked_requests == 0 && tab->page_saved == 0) {
+        gtk_widget_hide(tab->blocked_label);
+        return;
+    }
+    gchar* saved = g_format_size(tab->page_saved);
+    gchar* text = tab->page_saved
+        ? g_strdup_printf("%u blocked · ~%s saved", tab->blocked_requests, saved)
+        : g_strdup_printf("%u blocked", tab->blocked_requests);
+    gtk_label_set_text(GTK_LABEL(tab->blocked_label), text);
+    gtk_widget_show(tab->blocked_label);
+    g_free(text);
+    g_free(saved);
+}
+
+// Each blocked request is counted at the average size of the subresources
+// loaded this session
+static void tab_report_bandwidth(BrowserTab* tab) {
+    SitePolicies* policies = tab->browser->policies;
+    guint64 average = policies->resources ? policies->resource_bytes / policies->resources : 0;
+    tab->page_saved = (guint64)tab->blocked_requests * average;
+    tab_update_blocked_label(tab);
+
+    g_debug("%s: %" G_GUINT64_FORMAT " KB loaded, about %" G_GUINT64_FORMAT " KB saved "
+            "(%u blocked)", tab_current_uri(tab), tab->page_bytes / 1024,
+            tab->page_saved / 1024, tab->blocked_requests);
+}
+
+static void on_resource_failed(WebKitWebResource* resource, GError* error, gpointer user_data) {
+    BrowserTab* tab = (BrowserTab*)user_data;
+    if (!tab->webview || !g_error_matches(error, WEBKIT_POLICY_ERROR, POLICY_ERROR_BLOCKED_BY_CONTENT_BLOCKER)) {
+        return;
+    }
+    tab->blocked_requests++;
+    tab_update_blocked_label(tab);
+}
+
+// Responses without a Content-Length (chunked, compressed) are not counted
+static void on_resource_finished(WebKitWebResource* resource, gpointer user_data) {
+    BrowserTab* tab = (BrowserTab*)user_data;
+    WebKitURIResponse* response = webkit_web_resource_get_response(resource);
+    guint64 length = response ? webkit_uri_response_get_content_length(response) : 0;
+    if (!tab->webview || length == 0) return;
+
+    tab->page_bytes += length;
+    tab->browser->policies->resource_bytes += length;
+    tab->browser->policies->resources++;
+}
+
+// Watch each resource the page starts loading for its size and for a
+// content-blocker failure. The resource can outlive the tab, so each handler
+// holds a tab reference.
+static void on_tab_resource_load_started(WebKitWebView* web_view, WebKitWebResource* resource,
+                                         WebKitURIRequest* request, gpointer user_data) {
+    BrowserTab* tab = (BrowserTab*)user_data;
+    g_signal_connect_data(resource, "failed", G_CALLBACK(on_resource_failed), tab_ref(tab),
+                          (GClosureNotify)tab_unref, 0);
+    g_signal_connect_data(resource, "finished", G_CALLBACK(on_resource_finished), tab_ref(tab),
+                          (GClosureNotify)tab_unref, 0);
+}
+
+// Timers scheduled while the page is hidden wait at least TIMER_CLAMP_MS
+#define TIMER_CLAMP_MS 1000
+static const char* TIMER_CLAMP_SCRIPT =
+    "(function() {"
+    "  const setTimeout = window.setTimeout, setInterval = window.setInterval;"
+    "  const clamp = function(delay) {"
+    "    return document.hidden ? Math.max(delay || 0, " G_STRINGIFY(TIMER_CLAMP_MS) ") : delay;"
+    "  };"
+    "  window.setTimeout = function(fn, delay, ...args) {"
+    "    return setTimeout.call(window, fn, clamp(delay), ...args);"
+    "  };"
+    "  window.setInterval = function(fn, delay, ...args) {"
+    "    return setInterval.call(window, fn, clamp(delay), ...args);"
+    "  };"
+    "})();";
+
+// Scripts are injected when a document starts, so changes reach new pages only
+static void content_manager_sync_scripts(BrowserData* browser) {
+    WebKitUserContentManager* manager = browser->content_manager;
+    webkit_user_content_manager_remove_all_scripts(manager);
+
+    if (settings_get_bool(browser->settings, SETTING_THROTTLE_TIMERS, FALSE)) {
+        WebKitUserScript* script = webkit_user_script_new(TIMER_CLAMP_SCRIPT,
+            WEBKIT_USER_CONTENT_INJECT_ALL_FRAMES, WEBKIT_USER_SCRIPT_INJECT_AT_DOCUMENT_START, NULL, NULL);
+        webkit_user_content_manager_add_script(manager, script);
+        webkit_user_script_unref(script);
+    }
+
+    WebKitUserScript* lazy = site_policy_lazy_script(browser);
+    if (lazy) {
+        webkit_user_content_manager_add_script(manager, lazy);
+        webkit_user_script_unref(lazy);
+    }
+}
+
+static void on_content_script_setting_changed(BrowserSettings* settings, const char* key, gpointer user_data) {
+    content_manager_sync_scripts((BrowserData*)user_data);
+}
+
+// One user content manager for every view, so scripts, style sheets and
+// content filters are installed once instead of per tab
+static WebKitUserContentManager* browser_content_manager(BrowserData* browser) {
+    if (browser->content_manager) return browser->content_manager;
+
+    browser->content_manager = webkit_user_content_manager_new();
+    content_manager_sync_scripts(browser);
+    settings_watch(browser->settings, SETTING_THROTTLE_TIMERS, on_content_script_setting_changed, browser);
+    settings_watch(browser->settings, SETTING_SITE_POLICY, on_site_policy_setting_changed, browser);
+    content_blocker_start(browser->blocker, browser->content_manager, browser->settings);
+    site_policies_apply(browser);
+    return browser->content_manager;
+}
+
+// A (floating) view on the shared context and content manager. It starts
+// with the default autoplay policy; on_decide_policy() applies each host's own.
+static WebKitWebView* browser_webview_new(BrowserData* browser) {
+    gboolean autoplay = !(site_policy_default(browser->settings) & POLICY_BLOCK_AUTOPLAY);
+    WebKitWebsitePolicies* policies = webkit_website_policies_new_with_policies(
+        "autoplay", autoplay ? WEBKIT_AUTOPLAY_ALLOW : WEBKIT_AUTOPLAY_DENY, NULL);
+    WebKitWebView* view = WEBKIT_WEB_VIEW(g_object_new(WEBKIT_TYPE_WEB_VIEW,
+        "web-context", browser_web_context(browser),
+        "user-content-manager", browser_content_manager(browser),
+        "website-policies", policies,
+        NULL));
+    g_object_unref(policies);
+    return view;
+}
+
+// Pre-warmed webviews. A few views are created at idle priority and pointed
+// at about:blank so their web process is already running; new tabs take one
+// instead of paying for view and process start-up on the click.
+static WebKitWebView* webview_pool_create(BrowserData* browser) {
+    WebKitWebView* view = browser_webview_new(browser);
+    webkit_settings_set_enable_developer_extras(webkit_web_view_get_settings(view), TRUE);
+    return g_object_ref_sink(view);
+}
+
+static gboolean webview_pool_refill(gpointer data) {
+    WebViewPool* pool = (WebViewPool*)data;
+
+    // One view per idle callback keeps each step short
+    if (g_queue_get_length(&pool->views) >= WEBVIEW_POOL_SIZE) {
+        pool->refill_source = 0;
+        return G_SOURCE_REMOVE;
+    }
+    WebKitWebView* view = webview_pool_create(pool->browser);
+    webkit_web_view_load_uri(view, "about:blank");
+    g_queue_push_tail(&pool->views, view);
+    return G_SOURCE_CONTINUE;
+}
+
+static void webview_pool_schedule_refill(WebViewPool* pool) {
+    if (!pool->refill_source) {
+        pool->refill_source = g_idle_add_full(G_PRIORITY_LOW, webview_pool_refill, pool, NULL);
+    }
+}
+
+static WebViewPool* webview_pool_new(BrowserData* browser) {
+    WebViewPool* pool = g_new0(WebViewPool, 1);
+    pool->browser = browser;
+    g_queue_init(&pool->views);
+    return pool;
+}
+
+static void webview_pool_free(WebViewPool* pool) {
+    if (!pool) return;
+    if (pool->refill_source) {
+        g_source_remove(pool->refill_source);
+    }
+    WebKitWebView* view;
+    while ((view = g_queue_pop_head(&pool->views))) {
+        gtk_widget_destroy(GTK_WIDGET(view));
+        g_object_unref(view);
+    }
+    if (pool->hits + pool->misses > 0) {
+        fprintf(stderr, "Webview pool: %u hits, %u misses, %u returned\n",
+                pool->hits, pool->misses, pool->returned);
+    }
+    g_free(pool);
+}
+
+// Returns a new reference to a view with no page loaded beyond about:blank
+static WebKitWebView* webview_pool_take(WebViewPool* pool) {
+    WebKitWebView* view = g_queue_pop_head(&pool->views);
+    if (view) {
+        pool->hits++;
+    } else {
+        pool->misses++;
+        view = webview_pool_create(pool->browser);
+    }
+    webview_pool_schedule_refill(pool);
+    return view;
+}
+
+// Only a view that never left about:blank is safe to hand to another tab;
+// anything else would carry its back/forward list along.
+static gboolean webview_pool_give(WebViewPool* pool, WebKitWebView* view) {
+    const char* uri = webkit_web_view_get_uri(view);
+    WebKitBackForwardList* list = webkit_web_view_get_back_forward_list(view);
+
+    if (g_queue_get_length(&pool->views) >= WEBVIEW_POOL_SIZE) return FALSE;
+    if (uri && g_strcmp0(uri, "about:blank") != 0) return FALSE;
+    if (webkit_back_forward_list_get_length(list) > 1) return FALSE;
+
+    // Unparent it so the closing tab's container does not destroy it
+    g_queue_push_tail(&pool->views, g_object_ref(view));
+    GtkWidget* parent = gtk_widget_get_parent(GTK_WIDGET(view));
+    if (parent) {
+        gtk_container_remove(GTK_CONTAINER(parent), GTK_WIDGET(view));
+    }
+    pool->returned++;
+    return TRUE;
+}
+
+static const char* browser_mode_name(BrowserMode mode) {
+    switch (mode) {
+        case MODE_DARK: return "dark";
+        case MODE_MATRIX: return "matrix";
+        default: return "light";
+    }
+}
+
+static BrowserMode browser_mode_from_name(const char* name) {
+    if (g_strcmp0(name, "dark") == 0) return MODE_DARK;
+    if (g_strcmp0(name, "matrix") == 0) return MODE_MATRIX;
+    return MODE_LIGHT;
+}
+
+// Bookmarks live in bookmarks.db with folders as a parent_id tree. Each row
+// keeps its normalized URL in the indexed url_key column. The set of
+// bookmarked URLs is mirrored in memory (normalized URL -> bookmark count) so
+// the per-navigation "is this bookmarked?" check is a single hash lookup.
+
+// Lowercase scheme and host, drop default ports, fragments and a bare "/" path
+static gchar* bookmark_normalize_url(const char* url) {
+    if (!url) return NULL;
+
+    GUri* uri = g_uri_parse(url, G_URI_FLAGS_NONE, NULL);
+    if (!uri || !g_uri_get_host(uri)) {
+        if (uri) g_uri_unref(uri);
+        return g_strdup(url);
+    }
+
+    gchar* scheme = g_ascii_strdown(g_uri_get_scheme(uri), -1);
+    gchar* host = g_ascii_strdown(g_uri_get_host(uri), -1);
+    gint port = g_uri_get_port(uri);
+    if ((port == 80 && g_strcmp0(scheme, "http") == 0) ||
+        (port == 443 && g_strcmp0(scheme, "https") == 0)) {
+        port = -1;
+    }
+
+    const char* path = g_uri_get_path(uri);
+    const char* query = g_uri_get_query(uri);
+    GString* normalized = g_string_new(NULL);
+    g_string_append_printf(normalized, "%s://%s", scheme, host);
+    if (port > 0) g_string_append_printf(normalized, ":%d", port);
+    if (path && *path && g_strcmp0(path, "/") != 0) g_string_append(normalized, path);
+    if (query) g_string_append_printf(normalized, "?%s", query);
+
+    g_free(scheme);
+    g_free(host);
+    g_uri_unref(uri);
+    return g_string_free(normalized, FALSE);
+}
+
+// Takes ownership of key, a normalized URL
+static void bookmarks_index_add_key(GHashTable* urls, gchar* key) {
+    if (!key) return;
+    guint count = GPOINTER_TO_UINT(g_hash_table_lookup(urls, key));
+    g_hash_table_insert(urls, key, GUINT_TO_POINTER(count + 1));
+}
+
+static void bookmarks_index_add(GHashTable* urls, const char* url) {
+    bookmarks_index_add_key(urls, bookmark_normalize_url(url));
+}
+
+static gboolean bookmarks_contains(BrowserBookmarks* bookmarks, const char* url) {
+    if (!bookmarks || !url) return FALSE;
+    gchar* key = bookmark_normalize_url(url);
+    gboolean found = g_hash_table_contains(bookmarks->urls, key);
+    g_free(key);
+    return found;
+}
+
+// Folder id for name under parent (0 is the root), creating it if needed.
+// Runs on the storage thread.
+static gint64 bookmark_folder_id(sqlite3* db, gint64 parent_id, const char* name) {
+    sqlite3_stmt* stmt;
+    gint64 id = 0;
+
+    if (sqlite3_prepare_v2(db, "SELECT id FROM bookmarks.folders WHERE parent_id = ? AND name = ?",
+                           -1, &stmt, 0) == SQLITE_OK) {
+        sqlite3_bind_int64(stmt, 1, parent_id);
+        sqlite3_bind_text(stmt, 2, name, -1, SQLITE_STATIC);
+        if (sqlite3_step(stmt) == SQLITE_ROW) {
+            id = sqlite3_column_int64(stmt, 0);
+        }
+    }
+    sqlite3_finalize(stmt);
+    if (id) return id;
+
+    if (sqlite3_prepare_v2(db, "INSERT INTO bookmarks.folders (parent_id, name) VALUES (?, ?)",
+                           -1, &stmt, 0) == SQLITE_OK) {
+        sqlite3_bind_int64(stmt, 1, parent_id);
+        sqlite3_bind_text(stmt, 2, name, -1, SQLITE_STATIC);
+        if (sqlite3_step(stmt) == SQLITE_DONE) {
+            id = sqlite3_last_insert_rowid(db);
+        } else {
+            fprintf(stderr, "Failed to create bookmark folder: %s\n", sqlite3_errmsg(db));
+        }
+    }
+    sqlite3_finalize(stmt);
+    return id;
+}
+
+static void bookmark_insert(sqlite3* db, const char* url, const char* key, const char* title,
+                            gint64 folder_id) {
+    sqlite3_stmt* stmt;
+    const char* sql = "INSERT INTO bookmarks.bookmarks (url, url_key, title, folder_id) VALUES (?, ?, ?, ?)";
+
+    if (sqlite3_prepare_v2(db, sql, -1, &stmt, 0) != SQLITE_OK) {
+        fprintf(stderr, "Failed to prepare statement: %s\n", sqlite3_errmsg(db));
+        return;
+    }
+    sqlite3_bind_text(stmt, 1, url, -1, SQLITE_STATIC);
+    sqlite3_bind_text(stmt, 2, key, -1, SQLITE_STATIC);
+    sqlite3_bind_text(stmt, 3, title, -1, SQLITE_STATIC);
+    sqlite3_bind_int64(stmt, 4, folder_id);
+    if (sqlite3_step(stmt) != SQLITE_DONE) {
+        fprintf(stderr, "Failed to add bookmark: %s\n", sqlite3_errmsg(db));
+    }
+    sqlite3_finalize(stmt);
+}
+
+typedef struct {
+    BrowserBookmarks* bookmarks;
+    gchar* url;
+    gchar* title;
+    gchar* path;              // Import/export file
+    GHashTable* urls;         // Normalized URLs found by load/import
+    gboolean ok;
+} BookmarkJob;
+
+static void bookmark_job_free(gpointer data) {
+    BookmarkJob* job = (BookmarkJob*)data;
+    g_free(job->url);
+    g_free(job->title);
+    g_free(job->path);
+    if (job->urls) g_hash_table_unref(job->urls);
+    g_free(job);
+}
+
+static BookmarkJob* bookmark_job_new(BrowserBookmarks* bookmarks) {
+    BookmarkJob* job = g_new0(BookmarkJob, 1);
+    job->bookmarks = bookmarks;
+    job->urls = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+    return job;
+}
+
+// Fold URLs collected on the storage thread into the in-memory set
+static void bookmarks_merge_done(gpointer data) {
+    BookmarkJob* job = (BookmarkJob*)data;
+    GHashTableIter iter;
+    gpointer key, value;
+
+    g_hash_table_iter_init(&iter, job->urls);
+    while (g_hash_table_iter_next(&iter, &key, &value)) {
+        guint count = GPOINTER_TO_UINT(g_hash_table_lookup(job->bookmarks->urls, key));
+        g_hash_table_insert(job->bookmarks->urls, g_strdup(key),
+                            GUINT_TO_POINTER(count + GPOINTER_TO_UINT(value)));
+    }
+    job->bookmarks->loaded = TRUE;
+}
+
+// Rows from before url_key existed get it filled in on the way
+static void bookmarks_load_work(sqlite3* db, gpointer data) {
+    BookmarkJob* job = (BookmarkJob*)data;
+    sqlite3_stmt* stmt;
+    GArray* missing = g_array_new(FALSE, FALSE, sizeof(gint64));
+    GPtrArray* missing_keys = g_ptr_array_new_with_free_func(g_free);
+
+    sqlite3_exec(db, "BEGIN", 0, 0, NULL);
+    if (sqlite3_prepare_v2(db, "SELECT id, url, url_key FROM bookmarks.bookmarks", -1, &stmt, 0) == SQLITE_OK) {
+        while (sqlite3_step(stmt) == SQLITE_ROW) {
+            const char* key = (const char*)sqlite3_column_text(stmt, 2);
+            if (key) {
+                bookmarks_index_add_key(job->urls, g_strdup(key));
+                continue;
+            }
+            gchar* normalized = bookmark_normalize_url((const char*)sqlite3_column_text(stmt, 1));
+            if (!normalized) continue;
+            gint64 id = sqlite3_column_int64(stmt, 0);
+            g_array_append_val(missing, id);
+            g_ptr_array_add(missing_keys, g_strdup(normalized));
+            bookmarks_index_add_key(job->urls, normalized);
+        }
+    }
+    sqlite3_finalize(stmt);
+
+    if (missing->len &&
+        sqlite3_prepare_v2(db, "UPDATE bookmarks.bookmarks SET url_key = ? WHERE id = ?", -1, &stmt, 0) == SQLITE_OK) {
+        for (guint i = 0; i < missing->len; i++) {
+            sqlite3_bind_text(stmt, 1, g_ptr_array_index(missing_keys, i), -1, SQLITE_STATIC);
+            sqlite3_bind_int64(stmt, 2, g_array_index(missing, gint64, i));
+            sqlite3_step(stmt);
+            sqlite3_reset(stmt);
+        }
+        sqlite3_finalize(stmt);
+    }
+    sqlite3_exec(db, "COMMIT", 0, 0, NULL);
+
+    g_array_free(missing, TRUE);
+    g_ptr_array_unref(missing_keys);
+}
+
+static void bookmarks_add_work(sqlite3* db, gpointer data) {
+    BookmarkJob* job = (BookmarkJob*)data;
+    gchar* key = bookmark_normalize_url(job->url);
+    bookmark_insert(db, job->url, key, job->title, 0);
+    g_free(key);
+}
+
+// job->url is already normalized
+static void bookmarks_remove_work(sqlite3* db, gpointer data) {
+    BookmarkJob* job = (BookmarkJob*)data;
+    sqlite3_stmt* stmt;
+
+    if (sqlite3_prepare_v2(db, "DELETE FROM bookmarks.bookmarks WHERE url_key = ?", -1, &stmt, 0) != SQLITE_OK) {
+        fprintf(stderr, "Failed to prepare statement: %s\n", sqlite3_errmsg(db));
+        return;
+    }
+    sqlite3_bind_text(stmt, 1, job->url, -1, SQLITE_STATIC);
+    if (sqlite3_step(stmt) != SQLITE_DONE) {
+        fprintf(stderr, "Failed to remove bookmark: %s\n", sqlite3_errmsg(db));
+    }
+    sqlite3_finalize(stmt);
+}
+
+static void bookmarks_add(BrowserBookmarks* bookmarks, const char* url, const char* title) {
+    bookmarks_index_add(bookmarks->urls, url);
+
+    BookmarkJob* job = bookmark_job_new(bookmarks);
+    job->url = g_strdup(url);
+    job->title = g_strdup(title);
+    storage_submit(bookmarks->storage, bookmarks_add_work, NULL, job, bookmark_job_free);
+}
+
+// Remove every bookmark of url, in any folder
+static void bookmarks_remove(BrowserBookmarks* bookmarks, const char* url) {
+    BookmarkJob* job = bookmark_job_new(bookmarks);
+    job->url = bookmark_normalize_url(url);
+    g_hash_table_remove(bookmarks->urls, job->url);
+    storage_submit(bookmarks->storage, bookmarks_remove_work, NULL, job, bookmark_job_free);
+}
+
+// Import format: {"name": ..., "children": [{"title", "url"} | {"name", "children"}]}
+static void bookmarks_import_node(sqlite3* db, JsonObject* folder, gint64 folder_id, GHashTable* urls) {
+    if (!json_object_has_member(folder, "children")) return;
+
+    JsonArray* children = json_object_get_array_member(folder, "children");
+    guint n = children ? json_array_get_length(children) : 0;
+    for (guint i = 0; i < n; i++) {
+        JsonNode* node = json_array_get_element(children, i);
+        if (!JSON_NODE_HOLDS_OBJECT(node)) continue;
+
+        JsonObject* child = json_node_get_object(node);
+        if (json_object_has_member(child, "url")) {
+            const char* url = json_object_get_string_member(child, "url");
+            const char* title = json_object_has_member(child, "title") ?
+                json_object_get_string_member(child, "title") : NULL;
+            if (url) {
+                gchar* key = bookmark_normalize_url(url);
+                bookmark_insert(db, url, key, title, folder_id);
+                bookmarks_index_add_key(urls, key);
+            }
+        } else if (json_object_has_member(child, "name")) {
+            gint64 child_id = bookmark_folder_id(db, folder_id,
+                                                 json_object_get_string_member(child, "name"));
+            if (child_id) {
+                bookmarks_import_node(db, child, child_id, urls);
+            }
+        }
+    }
+}
+
+static void bookmarks_import_work(sqlite3* db, gpointer data) {
+    BookmarkJob* job = (BookmarkJob*)data;
+    GError* error = NULL;
+    JsonParser* parser = json_parser_new();
+
+    if (!json_parser_load_from_file(parser, job->path, &error)) {
+        fprintf(stderr, "Failed to read bookmarks from %s: %s\n", job->path, error->message);
+        g_error_free(error);
+        g_object_unref(parser);
+        return;
+    }
+
+    JsonNode* root = json_parser_get_root(parser);
+    if (root && JSON_NODE_HOLDS_OBJECT(root)) {
+        // One transaction for the whole file
+        sqlite3_exec(db, "BEGIN", 0, 0, NULL);
+        bookmarks_import_node(db, json_node_get_object(root), 0, job->urls);
+        job->ok = sqlite3_exec(db, "COMMIT", 0, 0, NULL) == SQLITE_OK;
+        if (!job->ok) {
+            sqlite3_exec(db, "ROLLBACK", 0, 0, NULL);
+            g_hash_table_remove_all(job->urls);
+        }
+    }
+    g_object_unref(parser);
+}
+
+static void bookmarks_export_folder(sqlite3* db, JsonBuilder* builder, gint64 folder_id) {
+    sqlite3_stmt* stmt;
+
+    json_builder_set_member_name(builder, "children");
+    json_builder_begin_array(builder);
+
+    if (sqlite3_prepare_v2(db, "SELECT id, name FROM bookmarks.folders WHERE parent_id = ? ORDER BY name",
+                           -1, &stmt, 0) == SQLITE_OK) {
+        sqlite3_bind_int64(stmt, 1, folder_id);
+        while (sqlite3_step(stmt) == SQLITE_ROW) {
+            json_builder_begin_object(builder);
+            json_builder_set_member_name(builder, "name");
+            json_builder_add_string_value(builder, (const char*)sqlite3_column_text(stmt, 1));
+            bookmarks_export_folder(db, builder, sqlite3_column_int64(stmt, 0));
+            json_builder_end_object(builder);
+        }
+    }
+    sqlite3_finalize(stmt);
+
+    if (sqlite3_prepare_v2(db, "SELECT url, title, add_date FROM bookmarks.bookmarks "
+                               "WHERE IFNULL(folder_id, 0) = ? ORDER BY add_date",
+                           -1, &stmt, 0) == SQLITE_OK) {
+        sqlite3_bind_int64(stmt, 1, folder_id);
+        while (sqlite3_step(stmt) == SQLITE_ROW) {
+            json_builder_begin_object(builder);
+            json_builder_set_member_name(builder, "url");
+            json_builder_add_string_value(builder, (const char*)sqlite3_column_text(stmt, 0));
+            json_builder_set_member_name(builder, "title");
+            json_builder_add_string_value(builder, (const char*)sqlite3_column_text(stmt, 1));
+            json_builder_set_member_name(builder, "add_date");
+            json_builder_add_string_value(builder, (const char*)sqlite3_column_text(stmt, 2));
+            json_builder_end_object(builder);
+        }
+    }
+    sqlite3_finalize(stmt);
+
+    json_builder_end_array(builder);
+}
+
+static void bookmarks_export_work(sqlite3* db, gpointer data) {
+    BookmarkJob* job = (BookmarkJob*)data;
+    JsonBuilder* builder = json_builder_new();
+
+    // Read the whole tree from one snapshot
+    sqlite3_exec(db, "BEGIN", 0, 0, NULL);
+    json_builder_begin_object(builder);
+    json_builder_set_member_name(builder, "name");
+    json_builder_add_string_value(builder, "Bookmarks");
+    bookmarks_export_folder(db, builder, 0);
+    json_builder_end_object(builder);
+    sqlite3_exec(db, "COMMIT", 0, 0, NULL);
+
+    JsonGenerator* generator = json_generator_new();
+    JsonNode* root = json_builder_get_root(builder);
+    json_generator_set_root(generator, root);
+    json_generator_set_pretty(generator, TRUE);
+
+    GError* error = NULL;
+    job->ok = json_generator_to_file(generator, job->path, &error);
+    if (!job->ok) {
+        fprintf(stderr, "Failed to write bookmarks to %s: %s\n", job->path, error->message);
+        g_error_free(error);
+    }
+
+    json_node_unref(root);
+    g_object_unref(generator);
+    g_object_unref(builder);
+}
+
+static void bookmarks_import(BrowserBookmarks* bookmarks, const char* path) {
+    BookmarkJob* job = bookmark_job_new(bookmarks);
+    job->path = g_strdup(path);
+    storage_submit(bookmarks->storage, bookmarks_import_work, bookmarks_merge_done, job, bookmark_job_free);
+}
+
+static void bookmarks_export(BrowserBookmarks* bookmarks, const char* path) {
+    BookmarkJob* job = bookmark_job_new(bookmarks);
+    job->path = g_strdup(path);
+    storage_submit(bookmarks->storage, bookmarks_export_work, NULL, job, bookmark_job_free);
+}
+
+static BrowserBookmarks* bookmarks_new(BrowserStorage* storage) {
+    BrowserBookmarks* bookmarks = g_new0(BrowserBookmarks, 1);
+    bookmarks->storage = storage;
+    bookmarks->urls = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+
+    BookmarkJob* job = bookmark_job_new(bookmarks);
+    storage_submit(storage, bookmarks_load_work, bookmarks_merge_done, job, bookmark_job_free);
+    return bookmarks;
+}
+
+static void bookmarks_free(BrowserBookmarks* bookmarks) {
+    if (!bookmarks) return;
+    g_hash_table_unref(bookmarks->urls);
+    g_free(bookmarks);
+}
+
+// Asynchronous domain check for URL entry. Lookups go through GResolver so the
+// main loop never blocks; results are cached per host. GResolver does not expose
+// record TTLs, so positive and negative answers get fixed lifetimes.
+static DnsCache* dns_cache_new(void) {
+    DnsCache* cache = g_new0(DnsCache, 1);
+    cache->resolver = g_resolver_get_default();
+    cache->cancellable = g_cancellable_new();
+    cache->entries = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, g_free);
+    return cache;
+}
+
+static void dns_waiter_free(gpointer data) {
+    DnsWaiter* waiter = (DnsWaiter*)data;
+    if (waiter->destroy) waiter->destroy(waiter->user_data);
+    g_free(waiter);
+}
+
+// Cached state for host, dropping the entry if it has expired
+static DnsState dns_cache_peek(DnsCache* cache, const char* host) {
+    DnsEntry* entry = g_hash_table_lookup(cache->entries, host);
+    if (!entry) return DNS_UNKNOWN;
+    if (entry->state != DNS_PENDING && entry->expires <= g_get_monotonic_time()) {
+        g_hash_table_remove(cache->entries, host);
+        return DNS_UNKNOWN;
+    }
+    return entry->state;
+}
+
+static void dns_cache_evict_expired(DnsCache* cache) {
+    GHashTableIter iter;
+    gpointer value;
+    gint64 now = g_get_monotonic_time();
+
+    g_hash_table_iter_init(&iter, cache->entries);
+    while (g_hash_table_iter_next(&iter, NULL, &value)) {
+        DnsEntry* entry = (DnsEntry*)value;
+        if (entry->state != DNS_PENDING && entry->expires <= now) {
+            g_hash_table_iter_remove(&iter);
+        }
+    }
+}
+
+typedef struct {
+    DnsCache* cache;
+    gchar* host;
+} DnsLookup;
+
+static void on_dns_resolved(GObject* source, GAsyncResult* result, gpointer data) {
+    DnsLookup* lookup = (DnsLookup*)data;
+    DnsCache* cache = lookup->cache;
+    const gchar* host = lookup->host;
+    GError* error = NULL;
+    GList* addresses = g_resolver_lookup_by_name_finish(G_RESOLVER(source), result, &error);
+
+    // Cancelled only on shutdown, after the cache is gone
+    if (g_error_matches(error, G_IO_ERROR, G_IO_ERROR_CANCELLED)) {
+        g_error_free(error);
+        g_free(lookup->host);
+        g_free(lookup);
+        return;
+    }
+
+    DnsEntry* entry = g_hash_table_lookup(cache->entries, host);
+    GSList* waiters = entry ? entry->waiters : NULL;
+    DnsState state;
+
+    if (addresses) {
+        state = DNS_RESOLVABLE;
+        g_resolver_free_addresses(addresses);
+    } else if (g_error_matches(error, G_RESOLVER_ERROR, G_RESOLVER_ERROR_NOT_FOUND)) {
+        state = DNS_NOT_FOUND;
+    } else {
+        // Temporary resolver trouble is not a verdict on the host; don't cache it
+        state = DNS_UNKNOWN;
+    }
+
+    if (entry) {
+        entry->waiters = NULL;
+        if (state == DNS_UNKNOWN) {
+            g_hash_table_remove(cache->entries, host);
+        } else {
+            entry->state = state;
+            entry->expires = g_get_monotonic_time() +
+                (state == DNS_RESOLVABLE ? DNS_POSITIVE_TTL : DNS_NEGATIVE_TTL) * G_USEC_PER_SEC;
+        }
+    }
+
+    for (GSList* l = waiters; l; l = l->next) {
+        DnsWaiter* waiter = (DnsWaiter*)l->data;
+        if (waiter->func) waiter->func(host, state, waiter->user_data);
+    }
+    g_slist_free_full(waiters, dns_waiter_free);
+
+    if (error) g_error_free(error);
+    g_free(lookup->host);
+    g_free(lookup);
+}
+
+// Resolve host in the background. func runs once with the outcome: right away
+// for a cached answer, otherwise when the lookup completes. func may be NULL
+// to only warm the cache.
+static void dns_cache_resolve(DnsCache* cache, const char* host,
+                              DnsResultFunc func, gpointer user_data, GDestroyNotify destroy) {
+    DnsState state = dns_cache_peek(cache, host);
+    if (state == DNS_RESOLVABLE || state == DNS_NOT_FOUND) {
+        if (func) func(host, state, user_data);
+        if (destroy) destroy(user_data);
+        return;
+    }
+
+    DnsEntry* entry = g_hash_table_lookup(cache->entries, host);
+    if (!entry) {
+        if (g_hash_table_size(cache->entries) >= DNS_CACHE_MAX_ENTRIES) {
+            dns_cache_evict_expired(cache);
+        }
+        entry = g_new0(DnsEntry, 1);
+        entry->state = DNS_PENDING;
+        g_hash_table_insert(cache->entries, g_strdup(host), entry);
+
+        DnsLookup* lookup = g_new0(DnsLookup, 1);
+        lookup->cache = cache;
+        lookup->host = g_strdup(host);
+        g_resolver_lookup_by_name_async(cache->resolver, host, cache->cancellable,
+                                        on_dns_resolved, lookup);
+    }
+
+    if (func || destroy) {
+        DnsWaiter* waiter = g_new0(DnsWaiter, 1);
+        waiter->func = func;
+        waiter->user_data = user_data;
+        waiter->destroy = destroy;
+        entry->waiters = g_slist_prepend(entry->waiters, waiter);
+    }
+}
+
+static void dns_entry_free_waiters(gpointer key, gpointer value, gpointer user_data) {
+    DnsEntry* entry = (DnsEntry*)value;
+    g_slist_free_full(entry->waiters, dns_waiter_free);
+    entry->waiters = NULL;
+}
+
+static void dns_cache_free(DnsCache* cache) {
+    if (!cache) return;
+    g_cancellable_cancel(cache->cancellable);
+    g_hash_table_foreach(cache->entries, dns_entry_free_waiters, NULL);
+    g_hash_table_unref(cache->entries);
+    g_object_unref(cache->cancellable);
+    g_object_unref(cache->resolver);
+    g_free(cache);
+}
+
+// Search engines. URL templates use the OpenSearch {searchTerms} placeholder;
+// suggestion endpoints answer with OpenSearch JSON: ["query", ["a", "b", ...]].
+static const SearchEngine SEARCH_ENGINES[] = {
+    { "Google", "https://www.google.com/search?q={searchTerms}",
+      "https://suggestqueries.google.com/complete/search?client=firefox&q={searchTerms}" },
+    { "Bing", "https://www.bing.com/search?q={searchTerms}",
+      "https://api.bing.com/osjson.aspx?query={searchTerms}" },
+    { "DuckDuckGo", "https://www.duckduckgo.com/?q={searchTerms}",
+      "https://duckduckgo.com/ac/?type=list&q={searchTerms}" },
+    { "Yahoo", "https://search.yahoo.com/search?p={searchTerms}",
+      "https://search.yahoo.com/sugg/os?output=fxjson&command={searchTerms}" },
+};
+
+// Engine by name, falling back to the first one
+static const SearchEngine* search_engine_find(const char* name) {
+    for (gsize i = 0; i < G_N_ELEMENTS(SEARCH_ENGINES); i++) {
+        if (g_strcmp0(SEARCH_ENGINES[i].name, name) == 0) {
+            return &SEARCH_ENGINES[i];
+        }
+    }
+    return &SEARCH_ENGINES[0];
+}
+
+static gchar* search_template_expand(const char* url_template, const char* query) {
+    gchar* escaped = g_uri_escape_string(query, NULL, TRUE);
+    gchar** parts = g_strsplit(url_template, "{searchTerms}", -1);
+    gchar* url = g_strjoinv(escaped, parts);
+    g_strfreev(parts);
+    g_free(escaped);
+    return url;
+}
+
+// LRU of suggestion lists keyed by "endpoint\ttext", where endpoint is the
+// suggest_url setting or else the engine's own; shared by all tabs
+static SuggestCache* suggest_cache_new(void) {
+    SuggestCache* cache = g_new0(SuggestCache, 1);
+    cache->index = g_hash_table_new(g_str_hash, g_str_equal);
+    g_queue_init(&cache->order);
+    return cache;
+}
+
+static void suggest_entry_free(gpointer data) {
+    SuggestEntry* entry = (SuggestEntry*)data;
+    g_free(entry->key);
+    g_strfreev(entry->suggestions);
+    g_free(entry);
+}
+
+static void suggest_cache_free(SuggestCache* cache) {
+    if (!cache) return;
+    g_hash_table_unref(cache->index);
+    g_queue_clear_full(&cache->order, suggest_entry_free);
+    g_free(cache);
+}
+
+static gchar** suggest_cache_lookup(SuggestCache* cache, const char* key) {
+    GList* link = g_hash_table_lookup(cache->index, key);
+    if (!link) return NULL;
+
+    g_queue_unlink(&cache->order, link);
+    g_queue_push_head_link(&cache->order, link);
+    return ((SuggestEntry*)link->data)->suggestions;
+}
+
+// Takes ownership of suggestions
+static void suggest_cache_insert(SuggestCache* cache, const char* key, gchar** suggestions) {
+    GList* link = g_hash_table_lookup(cache->index, key);
+    if (link) {
+        SuggestEntry* entry = (SuggestEntry*)link->data;
+        g_strfreev(entry->suggestions);
+        entry->suggestions = suggestions;
+        g_queue_unlink(&cache->order, link);
+        g_queue_push_head_link(&cache->order, link);
+        return;
+    }
+
+    if (cache->order.length >= SUGGEST_CACHE_SIZE) {
+        SuggestEntry* oldest = g_queue_pop_tail(&cache->order);
+        g_hash_table_remove(cache->index, oldest->key);
+        suggest_entry_free(oldest);
+    }
+
+    SuggestEntry* entry = g_new0(SuggestEntry, 1);
+    entry->key = g_strdup(key);
+    entry->suggestions = suggestions;
+    g_queue_push_head(&cache->order, entry);
+    g_hash_table_insert(cache->index, entry->key, cache->order.head);
+}
+
+typedef struct {
+    gchar* url;
+    gchar* key;
+} SuggestRequest;
+
+static void suggest_request_free(gpointer data) {
+    SuggestRequest* request = (SuggestRequest*)data;
+    g_free(request->url);
+    g_free(request->key);
+    g_free(request);
+}
+
+// Aborts the transfer as soon as the request is cancelled
+static int suggest_progress(void* clientp, curl_off_t dltotal, curl_off_t dlnow,
+                            curl_off_t ultotal, curl_off_t ulnow) {
+    return g_cancellable_is_cancelled(G_CANCELLABLE(clientp)) ? 1 : 0;
+}
+
+static gchar** suggest_parse(const char* body) {
+    JsonParser* parser = json_parser_new();
+    GPtrArray* suggestions = g_ptr_array_new();
+
+    if (json_parser_load_from_data(parser, body, -1, NULL)) {
+        JsonNode* root = json_parser_get_root(parser);
+        if (JSON_NODE_HOLDS_ARRAY(root)) {
+            JsonArray* array = json_node_get_array(root);
+            JsonNode* list = json_array_get_length(array) > 1 ? json_array_get_element(array, 1) : NULL;
+            if (list && JSON_NODE_HOLDS_ARRAY(list)) {
+                JsonArray* items = json_node_get_array(list);
+                guint n = MIN(json_array_get_length(items), SUGGEST_MAX_RESULTS);
+                for (guint i = 0; i < n; i++) {
+                    const char* item = json_array_get_string_element(items, i);
+                    if (item) g_ptr_array_add(suggestions, g_strdup(item));
+                }
+            }
+        }
+    }
+    g_object_unref(parser);
+
+    g_ptr_array_add(suggestions, NULL);
+    return (gchar**)g_ptr_array_free(suggestions, FALSE);
+}
+
+// Runs on a GTask worker thread
+static void suggest_fetch_thread(GTask* task, gpointer source, gpointer task_data, GCancellable* cancellable) {
+    SuggestRequest* request = (SuggestRequest*)task_data;
+    GString* body = g_string_new(NULL);
+    CURL* curl = curl_easy_init();
+    CURLcode res = CURLE_FAILED_INIT;
+
+    if (curl) {
+        curl_easy_setopt(curl, CURLOPT_URL, request->url);
+        curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write_callback);
+        curl_easy_setopt(curl, CURLOPT_WRITEDATA, body);
+        curl_easy_setopt(curl, CURLOPT_TIMEOUT, SUGGEST_TIMEOUT);
+        curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+        curl_easy_setopt(curl, CURLOPT_NOPROGRESS, 0L);
+        curl_easy_setopt(curl, CURLOPT_XFERINFOFUNCTION, suggest_progress);
+        curl_easy_setopt(curl, CURLOPT_XFERINFODATA, cancellable);
+        res = curl_easy_perform(curl);
+        curl_easy_cleanup(curl);
+    }
+
+    if (g_task_return_error_if_cancelled(task)) {
+        g_string_free(body, TRUE);
+        return;
+    }
+    if (res != CURLE_OK) {
+        g_task_return_new_error(task, G_IO_ERROR, G_IO_ERROR_FAILED,
+                                "Suggestion request failed: %s", curl_easy_strerror(res));
+    } else {
+        g_task_return_pointer(task, suggest_parse(body->str), (GDestroyNotify)g_strfreev);
+    }
+    g_string_free(body, TRUE);
+}
+
+static void tab_show_suggestions(BrowserTab* tab, gchar** suggestions) {
+    GtkTreeIter iter;
+
+    gtk_list_store_clear(tab->suggest_store);
+    for (gchar** s = suggestions; s && *s; s++) {
+        gtk_list_store_append(tab->suggest_store, &iter);
+        gtk_list_store_set(tab->suggest_store, &iter, 0, *s, -1);
+    }
+    gtk_entry_completion_complete(gtk_entry_get_completion(GTK_ENTRY(tab->url_entry)));
+}
+
+static void on_suggestions_fetched(GObject* source, GAsyncResult* result, gpointer user_data) {
+    GError* error = NULL;
+    gchar** suggestions = g_task_propagate_pointer(G_TASK(result), &error);
+
+    // Cancelled requests may belong to a closed tab; don't touch it
+    if (!suggestions) {
+        if (!g_error_matches(error, G_IO_ERROR, G_IO_ERROR_CANCELLED)) {
+            fprintf(stderr, "%s\n", error->message);
+        }
+        g_error_free(error);
+        return;
+    }
+
+    BrowserTab* tab = (BrowserTab*)user_data;
+    SuggestRequest* request = g_task_get_task_data(G_TASK(result));
+    tab_show_suggestions(tab, suggestions);
+    suggest_cache_insert(tab->browser->suggest, request->key, suggestions);
+    g_clear_object(&tab->suggest_cancellable);
+}
+
+static void suggest_cancel(BrowserTab* tab) {
+    if (tab->suggest_cancellable) {
+        g_cancellable_cancel(tab->suggest_cancellable);
+        g_clear_object(&tab->suggest_cancellable);
+    }
+}
+
+// Fill the entry's completion popup with suggestions for text, from the
+// cache when possible
+static void suggest_request(BrowserTab* tab, const char* text) {
+    BrowserSettings* settings = tab->browser->settings;
+    const SearchEngine* engine = search_engine_find(
+        settings_get_string(settings, SETTING_SEARCH_ENGINE, DEFAULT_SEARCH_ENGINE));
+    const char* endpoint = settings_get_string(settings, SETTING_SUGGEST_URL, NULL);
+    if (!endpoint || !*endpoint) endpoint = engine->suggest_url;
+
+    suggest_cancel(tab);
+
+    gchar* key = g_strdup_printf("%s\t%s", endpoint, text);
+    gchar** cached = suggest_cache_lookup(tab->browser->suggest, key);
+    if (cached) {
+        tab_show_suggestions(tab, cached);
+        g_free(key);
+        return;
+    }
+
+    SuggestRequest* request = g_new0(SuggestRequest, 1);
+    request->url = search_template_expand(endpoint, text);
+    request->key = key;
+
+    tab->suggest_cancellable = g_cancellable_new();
+    GTask* task = g_task_new(tab->url_entry, tab->suggest_cancellable, on_suggestions_fetched, tab);
+    g_task_set_task_data(task, request, suggest_request_free);
+    g_task_run_in_thread(task, suggest_fetch_thread);
+    g_object_unref(task);
+}
+
+// Server suggestions need not share a prefix with the text; show them all
+static gboolean suggest_match_all(GtkEntryCompletion* completion, const gchar* key,
+                                  GtkTreeIter* iter, gpointer user_data) {
+    return TRUE;
+}
+
+static gboolean on_suggestion_selected(GtkEntryCompletion* completion, GtkTreeModel* model,
+                                       GtkTreeIter* iter, gpointer user_data) {
+    BrowserTab* tab = (BrowserTab*)user_data;
+    gchar* suggestion = NULL;
+
+    gtk_tree_model_get(model, iter, 0, &suggestion, -1);
+    gtk_entry_set_text(GTK_ENTRY(tab->url_entry), suggestion);
+    g_free(suggestion);
+
+    if (tab->prefetch_source) {
+        g_source_remove(tab->prefetch_source);
+        tab->prefetch_source = 0;
+    }
+    suggest_cancel(tab);
+    on_url_entry_activate(GTK_ENTRY(tab->url_entry), tab);
+    return TRUE;
+}
+
+// Speculative prerender of the top history suggestion. The page loads in a
+// WebKitWebView inside an offscreen window; if the user then navigates to it,
+// that view replaces the tab's view instead of loading from scratch. At most
+// PRERENDER_MAX_ACTIVE run at once, and none start when memory or CPU is short.
+// The swapped-in view has its own back/forward list and WebKit offers no way
+// to carry the old one over, so only tabs with nothing to lose prerender.
+static PrerenderStats* prerender_stats_new(void) {
+    return g_new0(PrerenderStats, 1);
+}
+
+static void prerender_stats_free(PrerenderStats* stats) {
+    if (!stats) return;
+    if (stats->started > 0) {
+        fprintf(stderr, "Prerender: %u started, %u hits, %u misses\n",
+                stats->started, stats->hits, stats->misses);
+    }
+    g_free(stats);
+}
+
+// Value of a "Key: <n> kB" line in /proc/meminfo, or -1
+static gint64 read_meminfo_kb(const char* key) {
+    gchar* contents = NULL;
+    gint64 value = -1;
+
+    if (!g_file_get_contents("/proc/meminfo", &contents, NULL, NULL)) return -1;
+    const char* line = strstr(contents, key);
+    if (line) {
+        value = g_ascii_strtoll(line + strlen(key), NULL, 10);
+    }
+    g_free(contents);
+    return value;
+}
+
+static gboolean prerender_budget_ok(void) {
+    gint64 available = read_meminfo_kb("MemAvailable:");
+    if (available >= 0 && available < PRERENDER_MIN_MEM_KB) return FALSE;
+
+    gchar* contents = NULL;
+    if (g_file_get_contents("/proc/loadavg", &contents, NULL, NULL)) {
+        gdouble load = g_ascii_strtod(contents, NULL);
+        g_free(contents);
+        if (load / g_get_num_processors() > PRERENDER_MAX_LOAD) return FALSE;
+    }
+    return TRUE;
+}
+
+// Skip the scheme and a leading "www." so typed text and URLs compare
+static const char* url_skip_scheme_www(const char* url) {
+    const char* p = strstr(url, "://");
+    p = p ? p + 3 : url;
+    return g_str_has_prefix(p, "www.") ? p + 4 : p;
+}
+
+// history.address: the URL without scheme or "www.", lowercased, so typed
+// prefixes can be matched with an index range scan
+static gchar* history_address(const char* url) {
+    return g_ascii_strdown(url_skip_scheme_www(url), -1);
+}
+
+static gboolean prerender_matches(const char* prerendered, const char* target) {
+    gchar* a = bookmark_normalize_url(prerendered);
+    gchar* b = bookmark_normalize_url(target);
+    gboolean same = g_strcmp0(url_skip_scheme_www(a), url_skip_scheme_www(b)) == 0;
+    g_free(a);
+    g_free(b);
+    return same;
+}
+
+static void prerender_discard(BrowserTab* tab) {
+    Prerender* prerender = tab->prerender;
+    if (!prerender) return;
+
+    tab->prerender = NULL;
+    tab->browser->prerender_stats->active--;
+    tab->browser->prerender_stats->misses++;
+    if (prerender->expire_source) {
+        g_source_remove(prerender->expire_source);
+    }
+    gtk_widget_destroy(prerender->window);
+    g_free(prerender->uri);
+    g_free(prerender);
+}
+
+static gboolean prerender_expire(gpointer data) {
+    BrowserTab* tab = (BrowserTab*)data;
+    tab->prerender->expire_source = 0;
+    prerender_discard(tab);
+    return G_SOURCE_REMOVE;
+}
+
+static void prerender_start(BrowserTab* tab, const char* uri) {
+    Prerender* prerender = g_new0(Prerender, 1);
+    prerender->uri = g_strdup(uri);
+
+    // Share the context, content manager (mode style sheets) and settings,
+    // and take the target host's autoplay policy so an offscreen page stays
+    // silent where a tab would
+    prerender->view = browser_webview_new(tab->browser);
+    webkit_web_view_set_settings(prerender->view, webkit_web_view_get_settings(tab->webview));
+    g_signal_connect(prerender->view, "decide-policy", G_CALLBACK(on_decide_policy), tab);
+
+    // Lay it out at the tab's size so the swap needs no relayout
+    prerender->window = gtk_offscreen_window_new();
+    gtk_window_set_default_size(GTK_WINDOW(prerender->window),
+                                gtk_widget_get_allocated_width(GTK_WIDGET(tab->webview)),
+                                gtk_widget_get_allocated_height(GTK_WIDGET(tab->webview)));
+    gtk_container_add(GTK_CONTAINER(prerender->window), GTK_WIDGET(prerender->view));
+    gtk_widget_show_all(prerender->window);
+
+    webkit_web_view_load_uri(prerender->view, uri);
+    prerender->expire_source = g_timeout_add_seconds(PRERENDER_TTL, prerender_expire, tab);
+
+    tab->prerender = prerender;
+    tab->browser->prerender_stats->active++;
+    tab->browser->prerender_stats->started++;
+}
+
+// No back/forward items, and nothing or about:blank showing
+static gboolean prerender_allowed(BrowserTab* tab) {
+    WebKitBackForwardList* list = webkit_web_view_get_back_forward_list(tab->webview);
+    guint length = webkit_back_forward_list_get_length(list);
+    const char* uri = webkit_web_view_get_uri(tab->webview);
+    return length == 0 || (length == 1 && (!uri || g_str_equal(uri, "about:blank")));
+}
+
+// Top history match for the typed prefix: visits is its visit count and
+// total the visits of every match, so visits / total is our confidence
+static void prerender_consider(BrowserTab* tab, const char* uri, gint visits, gint total) {
+    if (!prerender_allowed(tab)) return;
+    if (tab->prerender && g_strcmp0(tab->prerender->uri, uri) == 0) return;
+    if (visits < PRERENDER_MIN_VISITS || total <= 0 ||
+        (gdouble)visits / total < PRERENDER_MIN_CONFIDENCE) {
+        return;
+    }
+
+    prerender_discard(tab);
+    if (tab->browser->prerender_stats->active >= PRERENDER_MAX_ACTIVE || !prerender_budget_ok()) {
+        return;
+    }
+    prerender_start(tab, uri);
+}
+
+// Drop the prerender once the entry text no longer leads to it
+static void prerender_check_input(BrowserTab* tab, const char* text) {
+    if (tab->prerender &&
+        !g_str_has_prefix(url_skip_scheme_www(tab->prerender->uri), url_skip_scheme_www(text))) {
+        prerender_discard(tab);
+    }
+}
+
+// Navigate the tab to uri, swapping in the prerendered view when it matches
+// and the tab still has no history to lose
+static gboolean prerender_take(BrowserTab* tab, const char* uri) {
+    Prerender* prerender = tab->prerender;
+    if (!prerender) return FALSE;
+    if (!prerender_allowed(tab) || !prerender_matches(prerender->uri, uri)) {
+        prerender_discard(tab);
+        return FALSE;
+    }
+
+    tab->prerender = NULL;
+    tab->browser->prerender_stats->active--;
+    tab->browser->prerender_stats->hits++;
+    if (prerender->expire_source) {
+        g_source_remove(prerender->expire_source);
+    }
+
+    WebKitWebView* view = g_object_ref(prerender->view);
+    g_signal_handlers_disconnect_by_func(view, on_decide_policy, tab);   // tab_attach_webview() connects it
+    gtk_container_remove(GTK_CONTAINER(prerender->window), GTK_WIDGET(view));
+    gtk_widget_destroy(prerender->window);
+    intercept_forget_view(tab->intercept, tab->webview);
+    gtk_widget_destroy(GTK_WIDGET(tab->webview));
+
+    tab_attach_webview(tab, view);
+    gtk_widget_show(GTK_WIDGET(view));
+    g_object_unref(view);
+
+    // The load may already be over, so catch up on what load-changed would do
+    on_title_changed(view, NULL, tab);
+    update_bookmark_button(tab);
+    if (!webkit_web_view_is_loading(view)) {
+        add_history_entry(tab->history, webkit_web_view_get_uri(view), webkit_web_view_get_title(view));
+    }
+
+    g_free(prerender->uri);
+    g_free(prerender);
+    return TRUE;
+}
+
+// A DNS check started from the URL entry (see on_domain_checked) only
+// applies to the load it was started with. The view's "domain_check" serial
+// is cleared by any other navigation: the first LOAD_STARTED after arming is
+// the checked load itself, a second one is something else.
+static void domain_check_clear(WebKitWebView* view) {
+    g_object_set_data(G_OBJECT(view), "domain_check", NULL);
+    g_object_set_data(G_OBJECT(view), "domain_check_started", NULL);
+}
+
+static void domain_check_load_started(WebKitWebView* view) {
+    if (!g_object_get_data(G_OBJECT(view), "domain_check")) return;
+    if (g_object_get_data(G_OBJECT(view), "domain_check_started")) {
+        domain_check_clear(view);
+    } else {
+        g_object_set_data(G_OBJECT(view), "domain_check_started", GINT_TO_POINTER(TRUE));
+    }
+}
+
+static void tab_load_uri(BrowserTab* tab, const char* uri) {
+    domain_check_clear(tab->webview);
+    if (!prerender_take(tab, uri)) {
+        webkit_web_view_load_uri(tab->webview, uri);
+    }
+}
+
+// Warm DNS for where the user is probably going while they type: the host in
+// the entry when it already looks like a URL or domain, and the host of the
+// most recent history match. Hosts are remembered for PREFETCH_WINDOW seconds
+// so a navigation to one of them counts as a prefetch hit.
+static PrefetchStats* prefetch_stats_new(void) {
+    PrefetchStats* stats = g_new0(PrefetchStats, 1);
+    stats->hosts = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+    return stats;
+}
+
+static void prefetch_stats_free(PrefetchStats* stats) {
+    if (!stats) return;
+    if (stats->issued > 0) {
+        fprintf(stderr, "DNS prefetch: %u issued, %u used by a navigation (%.0f%%)\n",
+                stats->issued, stats->used, 100.0 * stats->used / stats->issued);
+    }
+    g_hash_table_unref(stats->hosts);
+    g_free(stats);
+}
+
+static gchar* uri_host(const gchar* uri) {
+    GUri* parsed = g_uri_parse(uri, G_URI_FLAGS_NONE, NULL);
+    if (!parsed) return NULL;
+    gchar* host = g_strdup(g_uri_get_host(parsed));
+    g_uri_unref(parsed);
+    return host;
+}
+
+// Host the URL entry would navigate to, or NULL for searches, IP literals
+// and local hosts that need no lookup
+static gchar* url_entry_host(const gchar* text) {
+    OmniboxInput input;
+
+    switch (omnibox_classify(text, &input)) {
+        case OMNIBOX_URL:
+            return g_str_has_prefix(text, "http") ? uri_host(text) : NULL;
+        case OMNIBOX_HOST:
+            return g_strndup(input.host, input.host_len);
+        default:
+            return NULL;
+    }
+}
+
+static gboolean prefetch_host_expired(gpointer key, gpointer value, gpointer user_data) {
+    gint64 now = *(gint64*)user_data;
+    return now - (gint64)GPOINTER_TO_SIZE(value) >= PREFETCH_WINDOW * G_USEC_PER_SEC;
+}
+
+static void prefetch_host(BrowserData* browser, WebKitWebContext* context, const gchar* host) {
+    if (!host || !*host) return;
+
+    gint64 now = g_get_monotonic_time();
+    g_hash_table_foreach_remove(browser->prefetch->hosts, prefetch_host_expired, &now);
+    if (g_hash_table_contains(browser->prefetch->hosts, host)) return;
+
+    // WebKit warms its network process; our cache answers the entry's own check
+    webkit_web_context_prefetch_dns(context, host);
+    dns_cache_resolve(browser->dns, host, NULL, NULL, NULL);
+    g_hash_table_insert(browser->prefetch->hosts, g_strdup(host), GSIZE_TO_POINTER(now));
+    browser->prefetch->issued++;
+}
+
+// Credit a navigation to host against an earlier prefetch, once
+static void prefetch_record_navigation(PrefetchStats* stats, const gchar* host) {
+    if (!host) return;
+    gint64 last = GPOINTER_TO_SIZE(g_hash_table_lookup(stats->hosts, host));
+    if (last && g_get_monotonic_time() - last < PREFETCH_WINDOW * G_USEC_PER_SEC) {
+        stats->used++;
+        g_hash_table_remove(stats->hosts, host);
+    }
+}
+
+typedef struct {
+    BrowserData* browser;
+    WebKitWebContext* context;
+    GtkWidget* entry;         // Weak; the tab is gone if this is cleared
+    gchar* prefix;
+    gchar* url;               // Most visited history match, filled by the worker
+    gint visits;              // Visits to url
+    gint total;               // Visits to every match
+} HistorySuggestJob;
+
+static void history_suggest_job_free(gpointer data) {
+    HistorySuggestJob* job = (HistorySuggestJob*)data;
+    if (job->entry) {
+        g_object_remove_weak_pointer(G_OBJECT(job->entry), (gpointer*)&job->entry);
+    }
+    g_free(job->prefix);
+    g_free(job->url);
+    g_free(job);
+}
+
+// Addresses starting with the prefix sort in [prefix, prefix + U+10FFFF),
+// which the history_address index answers without a table scan
+static void history_suggest_work(sqlite3* db, gpointer data) {
+    HistorySuggestJob* job = (HistorySuggestJob*)data;
+    sqlite3_stmt* stmt;
+    const char* sql =
+        "SELECT url, COUNT(*), SUM(COUNT(*)) OVER () FROM history "
+        "WHERE address >= ?1 AND address < ?2 "
+        "GROUP BY url "
+        "ORDER BY COUNT(*) DESC, MAX(visit_time) DESC LIMIT 1";
+
+    if (sqlite3_prepare_v2(db, sql, -1, &stmt, 0) != SQLITE_OK) {
+        fprintf(stderr, "Failed to prepare statement: %s\n", sqlite3_errmsg(db));
+        return;
+    }
+
+    gchar* low = history_address(job->prefix);
+    gchar* high = g_strconcat(low, "\xf4\x8f\xbf\xbf", NULL);
+    sqlite3_bind_text(stmt, 1, low, -1, SQLITE_STATIC);
+    sqlite3_bind_text(stmt, 2, high, -1, SQLITE_STATIC);
+    if (sqlite3_step(stmt) == SQLITE_ROW) {
+        job->url = g_strdup((const char*)sqlite3_column_text(stmt, 0));
+        job->visits = sqlite3_column_int(stmt, 1);
+        job->total = sqlite3_column_int(stmt, 2);
+    }
+    sqlite3_finalize(stmt);
+    g_free(low);
+    g_free(high);
+}
+
+static void history_suggest_done(gpointer data) {
+    HistorySuggestJob* job = (HistorySuggestJob*)data;
+    if (!job->url) return;
+
+    gchar* host = uri_host(job->url);
+    prefetch_host(job->browser, job->context, host);
+    g_free(host);
+
+    // Only prerender if the entry still shows the text we looked up
+    if (job->entry && g_strcmp0(url_skip_scheme_www(gtk_entry_get_text(GTK_ENTRY(job->entry))),
+                                url_skip_scheme_www(job->prefix)) == 0) {
+        BrowserTab* tab = g_object_get_data(G_OBJECT(job->entry), "tab");
+        prerender_consider(tab, job->url, job->visits, job->total);
+    }
+}
+
+static gboolean url_entry_prefetch(gpointer data) {
+    BrowserTab* tab = (BrowserTab*)data;
+    const gchar* text = gtk_entry_get_text(GTK_ENTRY(tab->url_entry));
+    WebKitWebContext* context = webkit_web_view_get_context(tab->webview);
+
+    tab->prefetch_source = 0;
+
+    gchar* host = url_entry_host(text);
+    prefetch_host(tab->browser, context, host);
+    g_free(host);
+
+    OmniboxInput input;
+    if (omnibox_classify(text, &input) == OMNIBOX_SEARCH && *text) {
+        suggest_request(tab, text);
+    }
+
+    // Search queries won't match a URL; skip them and very short prefixes
+    if (strlen(text) >= PREFETCH_MIN_PREFIX && !strchr(text, ' ')) {
+        HistorySuggestJob* job = g_new0(HistorySuggestJob, 1);
+        job->browser = tab->browser;
+        job->context = context;
+        job->entry = tab->url_entry;
+        g_object_add_weak_pointer(G_OBJECT(job->entry), (gpointer*)&job->entry);
+        job->prefix = g_strdup(text);
+        storage_submit(tab->browser->storage, history_suggest_work, history_suggest_done,
+                       job, history_suggest_job_free);
+    }
+    return G_SOURCE_REMOVE;
+}
+
+static void on_url_entry_changed(GtkEditable* editable, gpointer data) {
+    BrowserTab* tab = (BrowserTab*)data;
+
+    // Programmatic updates (e.g. the current URI) aren't typing
+    if (!gtk_widget_has_focus(tab->url_entry)) return;
+
+    // Results for the old text are useless now
+    suggest_cancel(tab);
+    prerender_check_input(tab, gtk_entry_get_text(GTK_ENTRY(tab->url_entry)));
+    if (tab->prefetch_source) {
+        g_source_remove(tab->prefetch_source);
+    }
+    tab->prefetch_source = g_timeout_add(PREFETCH_DEBOUNCE, url_entry_prefetch, tab);
+}
+
+// Function to update tab title based on webpage title
+static void on_title_changed(WebKitWebView* web_view, GParamSpec* pspec, gpointer user_data) {
+    BrowserTab* tab = (BrowserTab*)user_data;
+    const gchar* title = webkit_web_view_get_title(web_view);
+    if (title != NULL && tab->title_label != NULL) {
+        gtk_label_set_text(GTK_LABEL(tab->title_label), title);
+    }
+    session_mark_dirty(tab);
+}
+
+// Function to create intercept window
+static GtkWidget* create_intercept_window(InterceptData* intercept_data) {
+    if (intercept_data->window && GTK_IS_WIDGET(intercept_data->window)) {
+        return intercept_data->window;  // Return existing window if valid
+    }
+    
+    GtkWidget* window = gtk_window_new(GTK_WINDOW_TOPLEVEL);
+    gtk_window_set_title(GTK_WINDOW(window), "Request/Response Interceptor");
+    gtk_window_set_default_size(GTK_WINDOW(window), 1000, 800);
+
+    GtkWidget* main_box = gtk_box_new(GTK_ORIENTATION_VERTICAL, 5);
+    gtk_container_add(GTK_CONTAINER(window), main_box);
+
+    // Request pane
+    GtkWidget* req_pane = gtk_box_new(GTK_ORIENTATION_VERTICAL, 5);
+    gtk_box_pack_start(GTK_BOX(main_box), req_pane, TRUE, TRUE, 5);
+    
+    GtkWidget* req_label = gtk_label_new("Request:");
+    gtk_box_pack_start(GTK_BOX(req_pane), req_label, FALSE, FALSE, 5);
+    
+    GtkWidget* req_scroll = gtk_scrolled_window_new(NULL, NULL);
+    GtkWidget* req_view = gtk_text_view_new();
+    gtk_container_add(GTK_CONTAINER(req_scroll), req_view);
+    gtk_box_pack_start(GTK_BOX(req_pane), req_scroll, TRUE, TRUE, 5);
+    
+    // Request Headers
+    GtkWidget* req_headers_label = gtk_label_new("Request Headers:");
+    gtk_box_pack_start(GTK_BOX(req_pane), req_headers_label, FALSE, FALSE, 5);
+    
+    GtkWidget* req_headers_scroll = gtk_scrolled_window_new(NULL, NULL);
+    GtkWidget* req_headers_view = gtk_text_view_new();
+    gtk_container_add(GTK_CONTAINER(req_headers_scroll), req_headers_view);
+    gtk_box_pack_start(GTK_BOX(req_pane), req_headers_scroll, TRUE, TRUE, 5);
+
+    // Response pane
+    GtkWidget* resp_pane = gtk_box_new(GTK_ORIENTATION_VERTICAL, 5);
+    gtk_box_pack_start(GTK_BOX(main_box), resp_pane, TRUE, TRUE, 5);
+    
+    GtkWidget* resp_label = gtk_label_new("Response:");
+    gtk_box_pack_start(GTK_BOX(resp_pane), resp_label, FALSE, FALSE, 5);
+    
+    GtkWidget* resp_scroll = gtk_scrolled_window_new(NULL, NULL);
+    GtkWidget* resp_view = gtk_text_view_new();
+    gtk_container_add(GTK_CONTAINER(resp_scroll), resp_view);
+    gtk_box_pack_start(GTK_BOX(resp_pane), resp_scroll, TRUE, TRUE, 5);
+
+    // Response Headers
+    GtkWidget* resp_headers_label = gtk_label_new("Response Headers:");
+    gtk_box_pack_start(GTK_BOX(resp_pane), resp_headers_label, FALSE, FALSE, 5);
+    
+    GtkWidget* resp_headers_scroll = gtk_scrolled_window_new(NULL, NULL);
+    GtkWidget* resp_headers_view = gtk_text_view_new();
+    gtk_container_add(GTK_CONTAINER(resp_headers_scroll), resp_headers_view);
+    gtk_box_pack_start(GTK_BOX(resp_pane), resp_headers_scroll, TRUE, TRUE, 5);
+
+    // Store buffers
+    intercept_data->request_buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(req_view));
+    intercept_data->response_buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(resp_view));
+    intercept_data->req_headers_buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(req_headers_view));
+    intercept_data->resp_headers_buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(resp_headers_view));
+
+    // Add control buttons
+    GtkWidget* controls_box = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 5);
+    gtk_box_pack_start(GTK_BOX(main_box), controls_box, FALSE, FALSE, 5);
+
+    GtkWidget* forward_button = gtk_button_new_with_label("Forward");
+    GtkWidget* drop_button = gtk_button_new_with_label("Drop");
+    
+    gtk_box_pack_start(GTK_BOX(controls_box), forward_button, TRUE, TRUE, 5);
+    gtk_box_pack_start(GTK_BOX(controls_box), drop_button, TRUE, TRUE, 5);
+
+    g_signal_connect(forward_button, "clicked", G_CALLBACK(forward_request), intercept_data);
+    g_signal_connect(drop_button, "clicked", G_CALLBACK(drop_request), intercept_data);
+
+    // Make text views editable
+    gtk_text_view_set_editable(GTK_TEXT_VIEW(req_view), TRUE);
+    gtk_text_view_set_editable(GTK_TEXT_VIEW(req_headers_view), TRUE);
+
+    // Connect edit signals
+    g_signal_connect(intercept_data->request_buffer, "changed", 
+                    G_CALLBACK(on_request_edit), intercept_data);
+    g_signal_connect(intercept_data->req_headers_buffer, "changed",
+                    G_CALLBACK(on_request_edit), intercept_data);
+
+    // Initialize request queue if not already initialized
+    if (!intercept_data->pending_requests) {
+        intercept_data->pending_requests = g_queue_new();
+    }
+    
+    // Initialize current resource
+    intercept_data->current_resource = NULL;
+    intercept_data->request_modified = FALSE;
+
+    gtk_widget_show_all(window);
+    return window;
+}
+
+// Update create_browser_tab function
+// URI and title of a tab, whether or not its webview exists yet
+static const char* tab_current_uri(BrowserTab* tab) {
+    return tab->webview ? webkit_web_view_get_uri(tab->webview) : tab->pending_uri;
+}
+
+static const char* tab_current_title(BrowserTab* tab) {
+    return tab->webview ? webkit_web_view_get_title(tab->webview) : tab->pending_title;
+}
+
+// Navigations take the autoplay policy of the host they lead to
+static gboolean on_decide_policy(WebKitWebView* web_view, WebKitPolicyDecision* decision,
+                                 WebKitPolicyDecisionType type, gpointer user_data) {
+    BrowserTab* tab = (BrowserTab*)user_data;
+    if (type != WEBKIT_POLICY_DECISION_TYPE_NAVIGATION_ACTION) return FALSE;
+
+    WebKitNavigationAction* action = webkit_navigation_policy_decision_get_navigation_action(
+        WEBKIT_NAVIGATION_POLICY_DECISION(decision));
+    gchar* host = uri_host(webkit_uri_request_get_uri(webkit_navigation_action_get_request(action)));
+    guint flags = site_policy_flags(tab->browser, host);
+    g_free(host);
+
+    WebKitWebsitePolicies* policies = webkit_website_policies_new_with_policies(
+        "autoplay", (flags & POLICY_BLOCK_AUTOPLAY) ? WEBKIT_AUTOPLAY_DENY : WEBKIT_AUTOPLAY_ALLOW, NULL);
+    webkit_policy_decision_use_with_policies(decision, policies);
+    g_object_unref(policies);
+    return TRUE;
+}
+
+// Make view the tab's page: pack it and route its signals to the tab
+static void tab_attach_webview(BrowserTab* tab, WebKitWebView* view) {
+    tab->webview = view;
+    gtk_box_pack_start(GTK_BOX(tab->container), GTK_WIDGET(view), TRUE, TRUE, 0);
+
+    g_signal_connect(view, "load-changed", G_CALLBACK(on_load_changed), tab);
+    g_signal_connect(view, "load-failed", G_CALLBACK(on_tab_load_failed), tab);
+    g_signal_connect(view, "resource-load-started", G_CALLBACK(on_resource_load_started), tab->intercept);
+    g_signal_connect(view, "resource-load-started", G_CALLBACK(on_tab_resource_load_started), tab);
+    g_signal_connect(view, "resource-response-received", G_CALLBACK(on_resource_response_received), tab->intercept);
+    g_signal_connect(view, "notify::title", G_CALLBACK(on_title_changed), tab);
+    g_signal_connect(view, "decide-policy", G_CALLBACK(on_decide_policy), tab);
+    if (tab->reader) reader_view_settings(view, TRUE);
+    reader_render_clear(tab);
+}
+
+// Build a tab's toolbar and menus. The page area holds a placeholder until
+// tab_ensure_webview() gives the tab its WebKitWebView.
+static BrowserTab* create_tab_shell(InterceptData* intercept_data, BrowserData* browser) {
+    BrowserTab* tab = g_new0(BrowserTab, 1); // Initialize all fields to 0
+    tab->ref_count = 1;       // Owned by the container below
+    BrowserHistory* history = browser->history;
+    BrowserSettings* browser_settings = browser->settings;
+    tab->browser = browser;
+    tab->intercept = intercept_data;
+    tab->session_id = browser->session->next_id++;
+    tab->last_active = g_get_monotonic_time();
+    
+    // Create container and controls
+    tab->container = gtk_box_new(GTK_ORIENTATION_VERTICAL, 5);
+    g_object_set_data_full(G_OBJECT(tab->container), "tab", tab, tab_unref);
+    GtkWidget* hbox = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 5);
+    gtk_box_pack_start(GTK_BOX(tab->container), hbox, FALSE, FALSE, 0);
+    
+    // Create search engine combo
+    tab->search_engine_combo = GTK_COMBO_BOX_TEXT(gtk_combo_box_text_new());
+    for (gsize i = 0; i < G_N_ELEMENTS(SEARCH_ENGINES); i++) {
+        gtk_combo_box_text_append(tab->search_engine_combo, SEARCH_ENGINES[i].name, SEARCH_ENGINES[i].name);
+    }
+    if (!gtk_combo_box_set_active_id(GTK_COMBO_BOX(tab->search_engine_combo),
+            settings_get_string(browser_settings, SETTING_SEARCH_ENGINE, DEFAULT_SEARCH_ENGINE))) {
+        gtk_combo_box_set_active(GTK_COMBO_BOX(tab->search_engine_combo), 0);
+    }
+    g_signal_connect(tab->search_engine_combo, "changed", G_CALLBACK(on_search_engine_changed), tab);
+    settings_watch(browser_settings, SETTING_SEARCH_ENGINE, on_search_engine_setting_changed, tab);
+    gtk_box_pack_start(GTK_BOX(hbox), GTK_WIDGET(tab->search_engine_combo), FALSE, FALSE, 0);
+    
+    // Create URL entry
+    tab->url_entry = gtk_entry_new();
+    gtk_box_pack_start(GTK_BOX(hbox), tab->url_entry, TRUE, TRUE, 0);
+    
+    // Create navigation buttons
+    GtkWidget* back_button = gtk_button_new_with_label("Back");
+    GtkWidget* forward_button = gtk_button_new_with_label("Forward");
+    GtkWidget* home_button = gtk_button_new_with_label("Home");
+    GtkWidget* search_button = gtk_button_new_with_label("Search");
+    
+    gtk_box_pack_start(GTK_BOX(hbox), back_button, FALSE, FALSE, 0);
+    gtk_box_pack_start(GTK_BOX(hbox), forward_button, FALSE, FALSE, 0);
+    gtk_box_pack_start(GTK_BOX(hbox), home_button, FALSE, FALSE, 0);
+    gtk_box_pack_start(GTK_BOX(hbox), search_button, FALSE, FALSE, 0);
+
+    // Bookmark toggle; its label is refreshed on every committed navigation
+    tab->bookmark_button = gtk_button_new_with_label("\u2606");
+    gtk_widget_set_tooltip_text(tab->bookmark_button, "Bookmark this page");
+    gtk_box_pack_start(GTK_BOX(hbox), tab->bookmark_button, FALSE, FALSE, 0);
+    g_signal_connect(tab->bookmark_button, "clicked", G_CALLBACK(on_bookmark_button_clicked), tab);
+
+    tab->blocked_label = gtk_label_new(NULL);
+    gtk_widget_set_tooltip_text(tab->blocked_label, "Requests blocked on this page by content filters and "
+                                "site policies, and the bytes that saved");
+    gtk_widget_set_no_show_all(tab->blocked_label, TRUE);
+    gtk_box_pack_start(GTK_BOX(hbox), tab->blocked_label, FALSE, FALSE, 0);
+
+    // Store references for callbacks. The tab's webview can be swapped for a
+    // prerendered one, so callbacks look it up through the tab.
+    g_object_set_data(G_OBJECT(tab->url_entry), "tab", tab);
+    g_object_set_data(G_OBJECT(tab->url_entry), "search_engine_combo", tab->search_engine_combo);
+
+    // Connect button signals
+    g_signal_connect(back_button, "clicked", G_CALLBACK(on_back_button_clicked), tab);
+    g_signal_connect(forward_button, "clicked", G_CALLBACK(on_forward_button_clicked), tab);
+    g_signal_connect(home_button, "clicked", G_CALLBACK(on_home_button_clicked), tab);
+    g_signal_connect(search_button, "clicked", G_CALLBACK(on_search_button_clicked), tab->url_entry);
+    g_signal_connect(tab->url_entry, "activate", G_CALLBACK(on_url_entry_activate), tab);
+    g_signal_connect(tab->url_entry, "changed", G_CALLBACK(on_url_entry_changed), tab);
+
+    // Search suggestions, filled asynchronously as the user types
+    tab->suggest_store = gtk_list_store_new(1, G_TYPE_STRING);
+    GtkEntryCompletion* completion = gtk_entry_completion_new();
+    gtk_entry_completion_set_model(completion, GTK_TREE_MODEL(tab->suggest_store));
+    gtk_entry_completion_set_text_column(completion, 0);
+    gtk_entry_completion_set_match_func(completion, suggest_match_all, NULL, NULL);
+    gtk_entry_set_completion(GTK_ENTRY(tab->url_entry), completion);
+    g_signal_connect(completion, "match-selected", G_CALLBACK(on_suggestion_selected), tab);
+    g_object_unref(completion);
+    g_object_unref(tab->suggest_store);   // Owned by the completion
+
+    tab->placeholder = gtk_label_new(NULL);
+    gtk_box_pack_start(GTK_BOX(tab->container), tab->placeholder, TRUE, TRUE, 0);
+
+    // Menu button (three dots); the menu and its actions are shared by all tabs
+    tab->menu_button = gtk_menu_button_new();
+    GtkWidget* menu_image = gtk_image_new_from_icon_name("view-more-symbolic", GTK_ICON_SIZE_BUTTON);
+    gtk_button_set_image(GTK_BUTTON(tab->menu_button), menu_image);
+    gtk_menu_button_set_menu_model(GTK_MENU_BUTTON(tab->menu_button), browser_menu_model(browser));
+    gtk_box_pack_end(GTK_BOX(hbox), tab->menu_button, FALSE, FALSE, 0);
+
+    tab->history = history;
+    tab->mode = MODE_LIGHT;   // The saved mode is applied with the webview
+    tab->vpn = g_new0(VPNConnection, 1);
+
+    return tab;
+}
+
+// Give the tab its WebKitWebView, restoring any saved session state
+static void tab_ensure_webview(BrowserTab* tab) {
+    if (tab->webview) return;
+
+    if (tab->hibernated) {
+        tab->hibernated = FALSE;
+        tab->browser->hibernation->woken++;
+    }
+
+    if (tab->placeholder) {
+        gtk_widget_destroy(tab->placeholder);
+        tab->placeholder = NULL;
+    }
+
+    WebKitWebView* view = webview_pool_take(tab->browser->view_pool);
+    tab_attach_webview(tab, view);
+    g_object_unref(view);   // The container holds it now
+    gtk_widget_show(GTK_WIDGET(view));
+
+    ThemeEngine* themes = tab->browser->themes;
+    theme_engine_select(themes, browser_mode_from_name(
+        settings_get_string(tab->browser->settings, SETTING_MODE, NULL)));
+    tab->mode = themes->mode;
+
+    WebKitWebViewSessionState* state =
+        tab->pending_state ? webkit_web_view_session_state_new(tab->pending_state) : NULL;
+    if (state) {
+        webkit_web_view_restore_session_state(view, state);
+        webkit_web_view_session_state_unref(state);
+        WebKitBackForwardListItem* item =
+            webkit_back_forward_list_get_current_item(webkit_web_view_get_back_forward_list(view));
+        if (item) {
+            webkit_web_view_go_to_back_forward_list_item(view, item);
+        } else if (tab->pending_uri) {
+            webkit_web_view_load_uri(view, tab->pending_uri);
+        }
+    } else if (tab->pending_uri) {
+        webkit_web_view_load_uri(view, tab->pending_uri);
+    }
+
+    g_clear_pointer(&tab->pending_state, g_bytes_unref);
+    g_clear_pointer(&tab->pending_uri, g_free);
+    g_clear_pointer(&tab->pending_title, g_free);
+}
+
+static BrowserTab* create_browser_tab(InterceptData* intercept_data, BrowserData* browser) {
+    BrowserTab* tab = create_tab_shell(intercept_data, browser);
+    tab->pending_uri = g_strdup(settings_get_string(browser->settings, SETTING_HOME_PAGE, DEFAULT_HOME_PAGE));
+    tab_ensure_webview(tab);
+    return tab;
+}
+
+// A tab from a saved session; its webview is created on first selection
+static BrowserTab* create_restored_tab(InterceptData* intercept_data, BrowserData* browser, gint64 id,
+                                       const char* uri, const char* title, GBytes* state) {
+    BrowserTab* tab = create_tab_shell(intercept_data, browser);
+    tab->session_id = id;
+    tab->pending_uri = g_strdup(uri);
+    tab->pending_title = g_strdup(title);
+    tab->pending_state = state ? g_bytes_ref(state) : NULL;
+    gtk_label_set_text(GTK_LABEL(tab->placeholder), title && *title ? title : uri);
+    return tab;
+}
+
+// Function to create new tab label with close button
+static GtkWidget* create_tab_label(const gchar* text, GtkNotebook* notebook, BrowserTab* tab) {
+    GtkWidget* hbox = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 5);
+    tab->title_label = gtk_label_new(text);
+    GtkWidget* close_button = gtk_button_new_from_icon_name("window-close", GTK_ICON_SIZE_MENU);
+    
+    gtk_box_pack_start(GTK_BOX(hbox), tab->title_label, TRUE, TRUE, 0);
+    gtk_box_pack_start(GTK_BOX(hbox), close_button, FALSE, FALSE, 0);
+    
+    g_signal_connect(close_button, "clicked", G_CALLBACK(on_tab_close_clicked), notebook);
+    g_object_set_data_full(G_OBJECT(close_button), "tab", tab_ref(tab), tab_unref);
+    
+    gtk_widget_show_all(hbox);
+    return hbox;
+}
+
+static void show_domain_error(GtkWidget* widget, const gchar* text) {
+    GtkWidget* dialog = gtk_message_dialog_new(GTK_WINDOW(gtk_widget_get_toplevel(widget)),
+        GTK_DIALOG_MODAL,
+        GTK_MESSAGE_ERROR,
+        GTK_BUTTONS_OK,
+        "Error resolving domain '%s'.\nPlease check your internet connection and domain name.",
+        text);
+    gtk_dialog_run(GTK_DIALOG(dialog));
+    gtk_widget_destroy(dialog);
+}
+
+// A navigation started from the URL entry while its domain is being resolved
+typedef struct {
+    WebKitWebView* webview;   // Weak; cleared if the tab closes first
+    gchar* text;
+    guint serial;
+} DomainCheck;
+
+static guint domain_check_serial = 0;
+
+static void domain_check_free(gpointer data) {
+    DomainCheck* check = (DomainCheck*)data;
+    if (check->webview) {
+        g_object_remove_weak_pointer(G_OBJECT(check->webview), (gpointer*)&check->webview);
+    }
+    g_free(check->text);
+    g_free(check);
+}
+
+static void on_domain_checked(const char* host, DnsState state, gpointer data) {
+    DomainCheck* check = (DomainCheck*)data;
+    if (state != DNS_NOT_FOUND || !check->webview) return;
+
+    // Ignore the verdict if the view has navigated anywhere else since
+    if (GPOINTER_TO_UINT(g_object_get_data(G_OBJECT(check->webview), "domain_check")) != check->serial) {
+        return;
+    }
+    webkit_web_view_stop_loading(check->webview);
+    show_domain_error(GTK_WIDGET(check->webview), check->text);
+}
+
+// Navigation and URL handling callbacks remain the same
+static void on_url_entry_activate(GtkEntry* entry, gpointer data) {
+    gchar* text = g_strstrip(g_strdup(gtk_entry_get_text(entry)));
+    BrowserTab* tab = (BrowserTab*)data;
+    WebKitWebView* webview = tab->webview;
+    OmniboxInput input;
+
+    switch (omnibox_classify(text, &input)) {
+        case OMNIBOX_URL:
+            tab_load_uri(tab, text);
+            break;
+
+        case OMNIBOX_HOST_PORT:
+        case OMNIBOX_IP: {
+            gchar* url_with_prefix = g_strdup_printf("http://%s", text);
+            tab_load_uri(tab, url_with_prefix);
+            g_free(url_with_prefix);
+            break;
+        }
+
+        case OMNIBOX_LOCAL_PATH: {
+            gchar* path = text[0] == '~' ? g_build_filename(g_get_home_dir(), text + 1, NULL)
+                                         : g_strdup(text);
+            gchar* file_uri = g_filename_to_uri(path, NULL, NULL);
+            if (file_uri) {
+                tab_load_uri(tab, file_uri);
+                g_free(file_uri);
+            }
+            g_free(path);
+            break;
+        }
+
+        case OMNIBOX_HOST: {
+            // Resolve the bare domain, without any "www." prefix
+            gchar* domain = g_strndup(input.host, input.host_len);
+            const gchar* lookup = g_str_has_prefix(domain, "www.") ? domain + 4 : domain;
+            gchar* url_with_prefix = g_strdup_printf("http://%s", text);
+            DnsCache* dns = tab->browser->dns;
+
+            // Only a cached NXDOMAIN stops us up front; otherwise start loading
+            // and let the lookup catch a bad domain while the page is pending.
+            // A prerendered page has already resolved.
+            if (prerender_take(tab, url_with_prefix)) {
+                // Swapped in
+            } else if (dns_cache_peek(dns, lookup) == DNS_NOT_FOUND) {
+                show_domain_error(GTK_WIDGET(entry), text);
+            } else {
+                DomainCheck* check = g_new0(DomainCheck, 1);
+                check->webview = webview;
+                check->text = g_strdup(text);
+                check->serial = ++domain_check_serial;
+                g_object_add_weak_pointer(G_OBJECT(webview), (gpointer*)&check->webview);
+                domain_check_clear(webview);
+                g_object_set_data(G_OBJECT(webview), "domain_check", GUINT_TO_POINTER(check->serial));
+
+                webkit_web_view_load_uri(webview, url_with_prefix);
+                dns_cache_resolve(dns, lookup, on_domain_checked, check, domain_check_free);
+            }
+            g_free(url_with_prefix);
+            g_free(domain);
+            break;
+        }
+
+        case OMNIBOX_SEARCH: {
+            GtkComboBox* search_engine_combo = GTK_COMBO_BOX(g_object_get_data(G_OBJECT(entry), "search_engine_combo"));
+            const SearchEngine* engine = search_engine_find(gtk_combo_box_get_active_id(search_engine_combo));
+            gchar* search_url = search_template_expand(engine->search_url, text);
+
+            tab_load_uri(tab, search_url);
+            g_free(search_url);
+            break;
+        }
+    }
+    g_free(text);
+}
+
+static void on_search_button_clicked(GtkButton* button, gpointer data) {
+    GtkWidget* entry = GTK_WIDGET(data);
+    on_url_entry_activate(GTK_ENTRY(entry), g_object_get_data(G_OBJECT(entry), "tab"));
+}
+
+static void on_back_button_clicked(GtkButton* button, gpointer data) {
+    BrowserTab* tab = (BrowserTab*)data;
+    webkit_web_view_go_back(tab->webview);
+}
+
+static void on_forward_button_clicked(GtkButton* button, gpointer data) {
+    BrowserTab* tab = (BrowserTab*)data;
+    webkit_web_view_go_forward(tab->webview);
+}
+
+static void on_home_button_clicked(GtkButton* button, gpointer data) {
+    BrowserTab* tab = (BrowserTab*)data;
+    webkit_web_view_load_uri(tab->webview,
+        settings_get_string(tab->browser->settings, SETTING_HOME_PAGE, DEFAULT_HOME_PAGE));
+}
+
+static void update_bookmark_button(BrowserTab* tab) {
+    gboolean bookmarked = bookmarks_contains(tab->browser->bookmarks,
+                                             webkit_web_view_get_uri(tab->webview));
+    gtk_button_set_label(GTK_BUTTON(tab->bookmark_button), bookmarked ? "\u2605" : "\u2606");
+}
+
+static void on_bookmark_button_clicked(GtkButton* button, gpointer data) {
+    BrowserTab* tab = (BrowserTab*)data;
+    BrowserBookmarks* bookmarks = tab->browser->bookmarks;
+    const gchar* uri = webkit_web_view_get_uri(tab->webview);
+    if (!uri) return;
+
+    if (bookmarks_contains(bookmarks, uri)) {
+        bookmarks_remove(bookmarks, uri);
+    } else {
+        bookmarks_add(bookmarks, uri, webkit_web_view_get_title(tab->webview));
+    }
+    update_bookmark_button(tab);
+}
+
+static gchar* choose_bookmarks_file(BrowserTab* tab, GtkFileChooserAction action, const char* title) {
+    GtkWidget* dialog = gtk_file_chooser_dialog_new(
+        title,
+        GTK_WINDOW(gtk_widget_get_toplevel(tab->container)),
+        action,
+        "Cancel", GTK_RESPONSE_CANCEL,
+        action == GTK_FILE_CHOOSER_ACTION_SAVE ? "Save" : "Open", GTK_RESPONSE_ACCEPT,
+        NULL
+    );
+
+    GtkFileFilter* filter = gtk_file_filter_new();
+    gtk_file_filter_add_pattern(filter, "*.json");
+    gtk_file_filter_set_name(filter, "Bookmark Files (*.json)");
+    gtk_file_chooser_add_filter(GTK_FILE_CHOOSER(dialog), filter);
+    if (action == GTK_FILE_CHOOSER_ACTION_SAVE) {
+        gtk_file_chooser_set_current_name(GTK_FILE_CHOOSER(dialog), "bookmarks.json");
+        gtk_file_chooser_set_do_overwrite_confirmation(GTK_FILE_CHOOSER(dialog), TRUE);
+    }
+
+    gchar* filename = NULL;
+    if (gtk_dialog_run(GTK_DIALOG(dialog)) == GTK_RESPONSE_ACCEPT) {
+        filename = gtk_file_chooser_get_filename(GTK_FILE_CHOOSER(dialog));
+    }
+    gtk_widget_destroy(dialog);
+    return filename;
+}
+
+static void on_import_bookmarks(GtkMenuItem* menuitem, gpointer user_data) {
+    BrowserTab* tab = (BrowserTab*)user_data;
+    gchar* filename = choose_bookmarks_file(tab, GTK_FILE_CHOOSER_ACTION_OPEN, "Import Bookmarks");
+    if (filename) {
+        bookmarks_import(tab->browser->bookmarks, filename);
+        g_free(filename);
+    }
+}
+
+static void on_export_bookmarks(GtkMenuItem* menuitem, gpointer user_data) {
+    BrowserTab* tab = (BrowserTab*)user_data;
+    gchar* filename = choose_bookmarks_file(tab, GTK_FILE_CHOOSER_ACTION_SAVE, "Export Bookmarks");
+    if (filename) {
+        bookmarks_export(tab->browser->bookmarks, filename);
+        g_free(filename);
+    }
+}
+
+// Remember the chosen engine; other tabs follow through the settings watch
+static void on_search_engine_changed(GtkComboBox* combo, gpointer data) {
+    BrowserTab* tab = (BrowserTab*)data;
+    const gchar* engine = gtk_combo_box_get_active_id(combo);
+    if (engine) {
+        settings_set_string(tab->browser->settings, SETTING_SEARCH_ENGINE, engine);
+    }
+}
+
+static void on_search_engine_setting_changed(BrowserSettings* settings, const char* key, gpointer user_data) {
+    BrowserTab* tab = (BrowserTab*)user_data;
+    const char* engine = settings_get_string(settings, key, DEFAULT_SEARCH_ENGINE);
+    if (g_strcmp0(gtk_combo_box_get_active_id(GTK_COMBO_BOX(tab->search_engine_combo)), engine) != 0) {
+        gtk_combo_box_set_active_id(GTK_COMBO_BOX(tab->search_engine_combo), engine);
+    }
+}
+
+static void on_load_changed(WebKitWebView* web_view, WebKitLoadEvent load_event, gpointer user_data) {
+    BrowserTab* tab = (BrowserTab*)user_data;
+    
+    switch (load_event) {
+        case WEBKIT_LOAD_STARTED: {
+            tab->load_failed = FALSE;
+            domain_check_load_started(web_view);
+            reader_load_started(tab);
+            gchar* host = uri_host(webkit_web_view_get_uri(web_view));
+            prefetch_record_navigation(tab->browser->prefetch, host);
+            g_free(host);
+            break;
+        }
+        case WEBKIT_LOAD_COMMITTED:
+            tab->blocked_requests = 0;
+            tab->page_bytes = 0;
+            tab->page_saved = 0;
+            tab_update_blocked_label(tab);
+            update_bookmark_button(tab);
+            session_mark_dirty(tab);
+            resource_monitor_claim(tab->browser->monitor, tab);
+            break;
+        case WEBKIT_LOAD_FINISHED:
+            if (tab->reader_rendering && tab->reader_started) {
+                // Our reader document; the page behind it was already recorded
+                reader_render_clear(tab);
+                break;
+            }
+            session_mark_dirty(tab);
+            tab_report_bandwidth(tab);
+            if (tab && tab->history) {
+                const gchar* uri = webkit_web_view_get_uri(web_view);
+                const gchar* title = webkit_web_view_get_title(web_view);
+                add_history_entry(tab->history, uri, title);
+            }
+            if (tab->reader && !tab->load_failed) tab_reader_extract(tab);
+            break;
+        default:
+            break;
+    }
+}
+
+// Always followed by WEBKIT_LOAD_FINISHED for the same load
+static gboolean on_tab_load_failed(WebKitWebView* web_view, WebKitLoadEvent load_event, gchar* failing_uri,
+                                   GError* error, gpointer user_data) {
+    BrowserTab* tab = (BrowserTab*)user_data;
+    tab->load_failed = TRUE;
+    // The reader document failed or was stopped: stop tracking it. The
+    // FINISHED that follows is handled like any failed load's, without
+    // extracting the broken document.
+    if (tab->reader_started) reader_render_clear(tab);
+    return FALSE;
+}
+
+// Tab management callbacks
+// Tabs are reference counted. The notebook page (the tab's container) and
+// the close button in its label each hold a reference, so signal handlers on
+// either can use the tab until both widgets are finalized. tab_close() does
+// the teardown that needs the browser; tab_free() only releases what the tab
+// itself owns, since at exit it runs after the BrowserData is gone.
+static BrowserTab* tab_ref(BrowserTab* tab) {
+    g_atomic_int_inc(&tab->ref_count);
+    return tab;
+}
+
+static void tab_free(BrowserTab* tab) {
+    if (tab->pending_state) g_bytes_unref(tab->pending_state);
+    g_free(tab->pending_uri);
+    g_free(tab->pending_title);
+    g_free(tab->reader_rendering);
+    vpn_free(tab->vpn);
+    g_free(tab);
+}
+
+static void tab_unref(gpointer data) {
+    BrowserTab* tab = (BrowserTab*)data;
+    if (g_atomic_int_dec_and_test(&tab->ref_count)) {
+        tab_free(tab);
+    }
+}
+
+// Drop captured requests from a view that is going away
+static void intercept_forget_view(InterceptData* data, WebKitWebView* view) {
+    if (!data) return;
+
+    if (data->pending_requests) {
+        GList* link = data->pending_requests->head;
+        while (link) {
+            GList* next = link->next;
+            PendingRequest* req = (PendingRequest*)link->data;
+            if (req->web_view == view) {
+                cleanup_pending_request(req);
+                g_queue_delete_link(data->pending_requests, link);
+            }
+            link = next;
+        }
+    }
+
+    if (data->current_view == view) {
+        data->current_view = NULL;
+        data->current_resource = NULL;
+        data->request_modified = FALSE;
+        if (data->window) {
+            gtk_text_buffer_set_text(data->request_buffer, "", -1);
+            gtk_text_buffer_set_text(data->response_buffer, "", -1);
+            gtk_text_buffer_set_text(data->req_headers_buffer, "", -1);
+            gtk_text_buffer_set_text(data->resp_headers_buffer, "", -1);
+        }
+    }
+}
+
+// Detach the tab from everything shared, release its webview and remove its
+// page. The BrowserTab itself goes when the last widget reference does.
+static void tab_close(BrowserTab* tab) {
+    BrowserData* browser = tab->browser;
+    GtkNotebook* notebook = browser->session->notebook;
+
+    settings_unwatch_by_data(browser->settings, tab);
+    if (tab->prefetch_source) {
+        g_source_remove(tab->prefetch_source);
+        tab->prefetch_source = 0;
+    }
+    suggest_cancel(tab);
+    prerender_discard(tab);
+    tab_report_cpu_saved(tab);
+
+    if (tab->webview) {
+        WebKitWebView* view = tab->webview;
+        tab->webview = NULL;
+        g_signal_handlers_disconnect_by_data(view, tab);
+        g_signal_handlers_disconnect_by_data(view, tab->intercept);
+        intercept_forget_view(tab->intercept, view);
+        if (tab->reader) reader_view_settings(view, FALSE);
+
+        // Not terminated here: with a process limit or related views the web
+        // process is shared, and WebKit ends it once its last page is gone
+        webview_pool_give(browser->view_pool, view);
+    }
+
+    gtk_notebook_remove_page(notebook, gtk_notebook_page_num(notebook, tab->container));
+    session_schedule_save(browser->session);
+}
+
+static void on_tab_close_clicked(GtkButton* button, GtkNotebook* notebook) {
+    BrowserTab* tab = g_object_get_data(G_OBJECT(button), "tab");
+
+    // Don't close if it's the last tab
+    if (gtk_notebook_get_n_pages(notebook) > 1) {
+        tab_close(tab);
+    }
+}
+
+static void on_new_tab_clicked(GtkButton* button, GtkNotebook* notebook) {
+    InterceptData* intercept_data = g_object_get_data(G_OBJECT(notebook), "intercept_data");
+    BrowserData* browser_data = g_object_get_data(G_OBJECT(notebook), "browser_data");
+    BrowserTab* tab = create_browser_tab(intercept_data, browser_data);
+    gint page_num = gtk_notebook_append_page(notebook, tab->container,
+                                           create_tab_label("New Tab", notebook, tab));
+    gtk_widget_show_all(tab->container);
+    gtk_notebook_set_current_page(notebook, page_num);
+    session_mark_dirty(tab);
+}
+
+// Session persistence. Each tab has a stable id and a row in session_tabs
+// holding its position, URI, title and serialized WebKit session state. Tabs
+// are marked dirty as they navigate; a debounced save rewrites only the dirty
+// rows (and positions) on the storage thread.
+//
+// On startup only the active tab gets a WebKitWebView. The others keep their
+// saved state and show a placeholder until they are first selected.
+static BrowserSession* session_new(BrowserData* browser, GtkNotebook* notebook) {
+    BrowserSession* session = g_new0(BrowserSession, 1);
+    session->browser = browser;
+    session->notebook = notebook;
+    session->next_id = 1;
+    return session;
+}
+
+static void session_free(BrowserSession* session) {
+    if (!session) return;
+    if (session->save_source) {
+        g_source_remove(session->save_source);
+    }
+    g_free(session);
+}
+
+static BrowserTab* notebook_page_tab(GtkNotebook* notebook, gint page_num) {
+    GtkWidget* page = gtk_notebook_get_nth_page(notebook, page_num);
+    return page ? g_object_get_data(G_OBJECT(page), "tab") : NULL;
+}
+
+typedef struct {
+    gint64 id;
+    gint position;
+    gboolean full;            // Write everything, not just the position
+    gchar* uri;
+    gchar* title;
+    GBytes* state;
+} SessionRow;
+
+static void session_row_free(gpointer data) {
+    SessionRow* row = (SessionRow*)data;
+    g_free(row->uri);
+    g_free(row->title);
+    if (row->state) g_bytes_unref(row->state);
+    g_free(row);
+}
+
+typedef struct {
+    BrowserSession* session;
+    GPtrArray* rows;          // SessionRow, in tab order
+    gint64 max_id;
+} SessionJob;
+
+static void session_job_free(gpointer data) {
+    SessionJob* job = (SessionJob*)data;
+    g_ptr_array_unref(job->rows);
+    g_free(job);
+}
+
+static SessionJob* session_job_new(BrowserSession* session) {
+    SessionJob* job = g_new0(SessionJob, 1);
+    job->session = session;
+    job->rows = g_ptr_array_new_with_free_func(session_row_free);
+    return job;
+}
+
+static GBytes* tab_session_state(BrowserTab* tab) {
+    if (!tab->webview) {
+        return tab->pending_state ? g_bytes_ref(tab->pending_state) : NULL;
+    }
+    WebKitWebViewSessionState* state = webkit_web_view_get_session_state(tab->webview);
+    GBytes* bytes = webkit_web_view_session_state_serialize(state);
+    webkit_web_view_session_state_unref(state);
+    return bytes;
+}
+
+static void session_save_work(sqlite3* db, gpointer data) {
+    SessionJob* job = (SessionJob*)data;
+    sqlite3_stmt* upsert = NULL;
+    sqlite3_stmt* move = NULL;
+    GString* live = g_string_new("DELETE FROM session_tabs WHERE id NOT IN (0");
+
+    sqlite3_exec(db, "BEGIN", 0, 0, NULL);
+    sqlite3_prepare_v2(db, "INSERT INTO session_tabs (id, position, uri, title, state) "
+                           "VALUES (?, ?, ?, ?, ?) "
+                           "ON CONFLICT(id) DO UPDATE SET position = excluded.position, "
+                           "uri = excluded.uri, title = excluded.title, state = excluded.state",
+                       -1, &upsert, 0);
+    sqlite3_prepare_v2(db, "UPDATE session_tabs SET position = ? WHERE id = ?", -1, &move, 0);
+
+    for (guint i = 0; i < job->rows->len; i++) {
+        SessionRow* row = g_ptr_array_index(job->rows, i);
+        g_string_append_printf(live, ", %" G_GINT64_FORMAT, row->id);
+
+        if (row->full && upsert) {
+            gsize size = 0;
+            const void* state = row->state ? g_bytes_get_data(row->state, &size) : NULL;
+            sqlite3_bind_int64(upsert, 1, row->id);
+            sqlite3_bind_int(upsert, 2, row->position);
+            sqlite3_bind_text(upsert, 3, row->uri, -1, SQLITE_STATIC);
+            sqlite3_bind_text(upsert, 4, row->title, -1, SQLITE_STATIC);
+            if (state) {
+                sqlite3_bind_blob(upsert, 5, state, size, SQLITE_STATIC);
+            } else {
+                sqlite3_bind_null(upsert, 5);
+            }
+            if (sqlite3_step(upsert) != SQLITE_DONE) {
+                fprintf(stderr, "Failed to save session tab: %s\n", sqlite3_errmsg(db));
+            }
+            sqlite3_reset(upsert);
+        } else if (move) {
+            sqlite3_bind_int(move, 1, row->position);
+            sqlite3_bind_int64(move, 2, row->id);
+            sqlite3_step(move);
+            sqlite3_reset(move);
+        }
+    }
+    sqlite3_finalize(upsert);
+    sqlite3_finalize(move);
+
+    // Rows of closed tabs
+    g_string_append_c(live, ')');
+    sqlite3_exec(db, live->str, 0, 0, NULL);
+    g_string_free(live, TRUE);
+
+    if (sqlite3_exec(db, "COMMIT", 0, 0, NULL) != SQLITE_OK) {
+        fprintf(stderr, "Failed to save session: %s\n", sqlite3_errmsg(db));
+        sqlite3_exec(db, "ROLLBACK", 0, 0, NULL);
+    }
+}
+
+static gboolean session_save(gpointer data) {
+    BrowserSession* session = (BrowserSession*)data;
+    session->save_source = 0;
+
+    // Saving before the restore has run would drop the previous session
+    if (!session->restored) return G_SOURCE_REMOVE;
+
+    SessionJob* job = session_job_new(session);
+    gint n_pages = gtk_notebook_get_n_pages(session->notebook);
+    for (gint i = 0; i < n_pages; i++) {
+        BrowserTab* tab = notebook_page_tab(session->notebook, i);
+        if (!tab) continue;
+
+        SessionRow* row = g_new0(SessionRow, 1);
+        row->id = tab->session_id;
+        row->position = i;
+        if (tab->session_dirty) {
+            row->full = TRUE;
+            row->uri = g_strdup(tab_current_uri(tab));
+            row->title = g_strdup(tab_current_title(tab));
+            row->state = tab_session_state(tab);
+            tab->session_dirty = FALSE;
+        }
+        g_ptr_array_add(job->rows, row);
+    }
+
+    settings_set_int(session->browser->settings, SETTING_SESSION_ACTIVE,
+                     gtk_notebook_get_current_page(session->notebook));
+    storage_submit(session->browser->storage, session_save_work, NULL, job, session_job_free);
+    return G_SOURCE_REMOVE;
+}
+
+static void session_schedule_save(BrowserSession* session) {
+    if (!session->save_source) {
+        session->save_source = g_timeout_add(SESSION_SAVE_DELAY, session_save, session);
+    }
+}
+
+// Write anything pending now, e.g. before the window goes away
+static void session_flush(BrowserSession* session) {
+    if (session->save_source) {
+        g_source_remove(session->save_source);
+        session->save_source = 0;
+        session_save(session);
+    }
+}
+
+static void session_mark_dirty(BrowserTab* tab) {
+    tab->session_dirty = TRUE;
+    session_schedule_save(tab->browser->session);
+}
+
+static void session_load_work(sqlite3* db, gpointer data) {
+    SessionJob* job = (SessionJob*)data;
+    sqlite3_stmt* stmt;
+
+    if (sqlite3_prepare_v2(db, "SELECT id, uri, title, state FROM session_tabs ORDER BY position",
+                           -1, &stmt, 0) != SQLITE_OK) {
+        fprintf(stderr, "Failed to prepare statement: %s\n", sqlite3_errmsg(db));
+        return;
+    }
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        SessionRow* row = g_new0(SessionRow, 1);
+        row->id = sqlite3_column_int64(stmt, 0);
+        row->uri = g_strdup((const char*)sqlite3_column_text(stmt, 1));
+        row->title = g_strdup((const char*)sqlite3_column_text(stmt, 2));
+        if (sqlite3_column_type(stmt, 3) == SQLITE_BLOB) {
+            row->state = g_bytes_new(sqlite3_column_blob(stmt, 3), sqlite3_column_bytes(stmt, 3));
+        }
+        job->max_id = MAX(job->max_id, row->id);
+        g_ptr_array_add(job->rows, row);
+    }
+    sqlite3_finalize(stmt);
+}
+
+static void session_load_done(gpointer data) {
+    SessionJob* job = (SessionJob*)data;
+    BrowserSession* session = job->session;
+    BrowserData* browser = session->browser;
+    GtkNotebook* notebook = session->notebook;
+    InterceptData* intercept_data = g_object_get_data(G_OBJECT(notebook), "intercept_data");
+
+    session->next_id = job->max_id + 1;
+    history_vacuum_schedule(browser);
+
+    if (job->rows->len == 0) {
+        BrowserTab* tab = create_browser_tab(intercept_data, browser);
+        gtk_notebook_append_page(notebook, tab->container, create_tab_label("New Tab", notebook, tab));
+        gtk_widget_show_all(tab->container);
+        session->restored = TRUE;
+        session_mark_dirty(tab);
+        return;
+    }
+
+    for (guint i = 0; i < job->rows->len; i++) {
+        SessionRow* row = g_ptr_array_index(job->rows, i);
+        BrowserTab* tab = create_restored_tab(intercept_data, browser, row->id,
+                                              row->uri, row->title, row->state);
+        const char* label = row->title && *row->title ? row->title :
+                            row->uri ? row->uri : "New Tab";
+        gtk_notebook_append_page(notebook, tab->container, create_tab_label(label, notebook, tab));
+        gtk_widget_show_all(tab->container);
+    }
+
+    // Only now may switch-page create webviews, so just the active tab loads
+    gint active = settings_get_int(browser->settings, SETTING_SESSION_ACTIVE, 0);
+    if (active < 0 || active >= (gint)job->rows->len) active = 0;
+    session->restored = TRUE;
+    gtk_notebook_set_current_page(notebook, active);
+    tab_ensure_webview(notebook_page_tab(notebook, active));
+}
+
+static void session_restore(BrowserSession* session) {
+    storage_submit(session->browser->storage, session_load_work, session_load_done,
+                   session_job_new(session), session_job_free);
+}
+
+static void on_notebook_switch_page(GtkNotebook* notebook, GtkWidget* page, guint page_num, gpointer data) {
+    BrowserData* browser = (BrowserData*)data;
+    BrowserTab* tab = g_object_get_data(G_OBJECT(page), "tab");
+
+    if (!browser->session->restored || !tab) return;
+
+    // The notebook still reports the page being left
+    BrowserTab* previous = notebook_page_tab(notebook, gtk_notebook_get_current_page(notebook));
+    if (previous && previous != tab) {
+        tab_throttle(previous);
+    }
+
+    tab->last_active = g_get_monotonic_time();
+    tab_ensure_webview(tab);
+    tab_unthrottle(tab);
+    session_schedule_save(browser->session);
+}
+
+static gboolean on_main_window_delete(GtkWidget* window, GdkEvent* event, gpointer data) {
+    BrowserData* browser = (BrowserData*)data;
+    session_flush(browser->session);
+    return FALSE;
+}
+
+// Run one of our scripts in a page. webkit_web_view_run_javascript() and
+// WebKitJavascriptResult are deprecated since WebKitGTK 2.40.
+static void webview_run_script(WebKitWebView* view, const char* script, GCancellable* cancellable,
+                               GAsyncReadyCallback callback, gpointer data) {
+#if WEBKIT_CHECK_VERSION(2, 40, 0)
+    webkit_web_view_evaluate_javascript(view, script, -1, NULL, NULL, cancellable, callback, data);
+#else
+    webkit_web_view_run_javascript(view, script, cancellable, callback, data);
+#endif
+}
+
+// The script's value, or NULL with error set
+static JSCValue* webview_run_script_finish(WebKitWebView* view, GAsyncResult* result, GError** error) {
+#if WEBKIT_CHECK_VERSION(2, 40, 0)
+    return webkit_web_view_evaluate_javascript_finish(view, result, error);
+#else
+    WebKitJavascriptResult* js = webkit_web_view_run_javascript_finish(view, result, error);
+    if (!js) return NULL;
+    JSCValue* value = g_object_ref(webkit_javascript_result_get_js_value(js));
+    webkit_javascript_result_unref(js);
+    return value;
+#endif
+}
+
+// Idle tab hibernation. A sweep looks for tabs that have been hidden longer
+// than SETTING_HIBERNATE_MINUTES, saves their session state like a restored
+// tab's, and destroys the webview. Selecting the tab rebuilds it through
+// tab_ensure_webview().
+
+// True while media plays or a form field differs from its initial value
+static const char* HIBERNATE_BUSY_SCRIPT =
+    "(function() {"
+    "  for (const m of document.querySelectorAll('audio, video'))"
+    "    if ((!m.paused && !m.ended) || m.dataset.rocketThrottled) return true;"
+    "  for (const e of document.querySelectorAll('input, textarea, select')) {"
+    "    if (e.type === 'checkbox' || e.type === 'radio') {"
+    "      if (e.checked !== e.defaultChecked) return true;"
+    "    } else if (e.tagName === 'SELECT') {"
+    "      for (const o of e.options) if (o.selected !== o.defaultSelected) return true;"
+    "    } else if (e.type !== 'hidden' && e.value !== e.defaultValue) {"
+    "      return true;"
+    "    }"
+    "  }"
+    "  return false;"
+    "})()";
+
+static TabHibernation* hibernation_new(BrowserData* browser, GtkNotebook* notebook) {
+    TabHibernation* hibernation = g_new0(TabHibernation, 1);
+    hibernation->browser = browser;
+    hibernation->notebook = notebook;
+    hibernation->cancellable = g_cancellable_new();
+    return hibernation;
+}
+
+static void hibernation_free(TabHibernation* hibernation) {
+    if (!hibernation) return;
+    if (hibernation->sweep_source) {
+        g_source_remove(hibernation->sweep_source);
+    }
+    if (hibernation->measure_source) {
+        g_source_remove(hibernation->measure_source);
+    }
+    // Busy-check callbacks still in flight must not see the freed struct
+    g_cancellable_cancel(hibernation->cancellable);
+    g_object_unref(hibernation->cancellable);
+    if (hibernation->hibernated > 0) {
+        fprintf(stderr, "Hibernation: %u tabs hibernated, %u restored, %u kept busy, %" G_GINT64_FORMAT " MB reclaimed\n",
+                hibernation->hibernated, hibernation->woken, hibernation->busy,
+                hibernation->reclaimed_kb / 1024);
+    }
+    g_free(hibernation);
+}
+
+// Web processes exit asynchronously, so compare MemAvailable a little later
+static gboolean hibernation_measure(gpointer data) {
+    TabHibernation* hibernation = (TabHibernation*)data;
+    hibernation->measure_source = 0;
+
+    gint64 available = read_meminfo_kb("MemAvailable:");
+    if (available >= 0 && hibernation->measure_base_kb >= 0) {
+        gint64 reclaimed = MAX(available - hibernation->measure_base_kb, 0);
+        hibernation->reclaimed_kb += reclaimed;
+        g_debug("Hibernation reclaimed %" G_GINT64_FORMAT " kB", reclaimed);
+    }
+    return G_SOURCE_REMOVE;
+}
+
+static void tab_hibernate(TabHibernation* hibernation, BrowserTab* tab) {
+    if (!hibernation->measure_source) {
+        hibernation->measure_base_kb = read_meminfo_kb("MemAvailable:");
+        hibernation->measure_source = g_timeout_add_seconds(HIBERNATE_MEASURE_DELAY,
+                                                            hibernation_measure, hibernation);
+    }
+
+    // Keep what a restored tab would have
+    g_clear_pointer(&tab->pending_state, g_bytes_unref);
+    g_free(tab->pending_uri);
+    g_free(tab->pending_title);
+    tab->pending_state = tab_session_state(tab);
+    tab->pending_uri = g_strdup(webkit_web_view_get_uri(tab->webview));
+    tab->pending_title = g_strdup(webkit_web_view_get_title(tab->webview));
+
+    prerender_discard(tab);
+    if (tab->prefetch_source) {
+        g_source_remove(tab->prefetch_source);
+        tab->prefetch_source = 0;
+    }
+    intercept_forget_view(tab->intercept, tab->webview);
+    gtk_widget_destroy(GTK_WIDGET(tab->webview));
+    tab->webview = NULL;
+
+    const char* label = tab->pending_title && *tab->pending_title ? tab->pending_title : tab->pending_uri;
+    tab->placeholder = gtk_label_new(label);
+    gtk_box_pack_start(GTK_BOX(tab->container), tab->placeholder, TRUE, TRUE, 0);
+    gtk_widget_show(tab->placeholder);
+
+    tab->hibernated = TRUE;
+    hibernation->hibernated++;
+}
+
+static void on_hibernate_check_finished(GObject* source, GAsyncResult* result, gpointer data) {
+    TabHibernation* hibernation = (TabHibernation*)data;
+    WebKitWebView* view = WEBKIT_WEB_VIEW(source);
+    GError* error = NULL;
+    gboolean busy = TRUE;
+
+    JSCValue* value = webview_run_script_finish(view, result, &error);
+    if (value) {
+        busy = jsc_value_to_boolean(value);
+        g_object_unref(value);
+    } else {
+        // Cancelled by hibernation_free(): data is gone
+        gboolean cancelled = g_error_matches(error, G_IO_ERROR, G_IO_ERROR_CANCELLED);
+        g_error_free(error);
+        if (cancelled) return;
+    }
+
+    // The view's parent is the tab's container until the tab is closed
+    GtkWidget* container = gtk_widget_get_parent(GTK_WIDGET(view));
+    BrowserTab* tab = container ? g_object_get_data(G_OBJECT(container), "tab") : NULL;
+    if (tab && tab->webview == view &&
+        gtk_notebook_get_current_page(hibernation->notebook) != gtk_notebook_page_num(hibernation->notebook, container)) {
+        if (busy) {
+            hibernation->busy++;
+            tab->last_active = g_get_monotonic_time();
+        } else {
+            tab_hibernate(hibernation, tab);
+        }
+    }
+}
+
+// Hibernates the tab once HIBERNATE_BUSY_SCRIPT says nothing would be lost
+static void hibernation_check(TabHibernation* hibernation, BrowserTab* tab) {
+    webview_run_script(tab->webview, HIBERNATE_BUSY_SCRIPT, hibernation->cancellable,
+                       on_hibernate_check_finished, hibernation);
+}
+
+static gboolean hibernation_sweep(gpointer data) {
+    TabHibernation* hibernation = (TabHibernation*)data;
+    gint64 minutes = settings_get_int(hibernation->browser->settings, SETTING_HIBERNATE_MINUTES,
+                                      DEFAULT_HIBERNATE_MINUTES);
+    if (minutes <= 0) return G_SOURCE_CONTINUE;
+
+    gint64 now = g_get_monotonic_time();
+    gint current = gtk_notebook_get_current_page(hibernation->notebook);
+    gint n_pages = gtk_notebook_get_n_pages(hibernation->notebook);
+
+    for (gint i = 0; i < n_pages; i++) {
+        BrowserTab* tab = notebook_page_tab(hibernation->notebook, i);
+        if (!tab || !tab->webview) continue;
+
+        if (i == current) {
+            tab->last_active = now;
+            continue;
+        }
+        if (now - tab->last_active < minutes * 60 * G_USEC_PER_SEC) continue;
+        if (webkit_web_view_is_loading(tab->webview) || webkit_web_view_is_playing_audio(tab->webview)) {
+            continue;
+        }
+
+        hibernation_check(hibernation, tab);
+    }
+    return G_SOURCE_CONTINUE;
+}
+
+static void hibernation_start(TabHibernation* hibernation) {
+    hibernation->sweep_source = g_timeout_add_seconds(HIBERNATE_SWEEP_INTERVAL, hibernation_sweep, hibernation);
+}
+
+// Background tab throttling. GtkNotebook already unmaps hidden pages, which
+// makes WebKit mark them hidden and stop painting them; on top of that a tab
+// that loses the selection has its playing media paused (and resumed when it
+// is selected again) and, optionally, its timers clamped by TIMER_CLAMP_SCRIPT
+// (see content_manager_sync_scripts()).
+static const char* THROTTLE_PAUSE_SCRIPT =
+    "document.querySelectorAll('audio, video').forEach(function(m) {"
+    "  if (!m.paused) { m.pause(); m.dataset.rocketThrottled = '1'; }"
+    "});";
+
+static const char* THROTTLE_RESUME_SCRIPT =
+    "document.querySelectorAll('[data-rocket-throttled]').forEach(function(m) {"
+    "  delete m.dataset.rocketThrottled;"
+    "  m.play().catch(function() {});"
+    "});";
+
+static void tab_throttle(BrowserTab* tab) {
+    if (!tab->webview || tab->throttled) return;
+    tab->throttled = TRUE;
+    if (settings_get_bool(tab->browser->settings, SETTING_THROTTLE_MEDIA, TRUE)) {
+        webview_run_script(tab->webview, THROTTLE_PAUSE_SCRIPT, NULL, NULL, NULL);
+    }
+}
+
+static void tab_unthrottle(BrowserTab* tab) {
+    if (!tab->throttled) return;
+    tab->throttled = FALSE;
+    if (tab->webview) {
+        webview_run_script(tab->webview, THROTTLE_RESUME_SCRIPT, NULL, NULL, NULL);
+    }
+}
+
+// Estimated CPU seconds not spent because the tab was hidden: its visible CPU
+// rate minus its hidden rate, over the time it spent hidden
+static gdouble tab_cpu_saved(BrowserTab* tab) {
+    if (tab->visible_secs <= 0 || tab->hidden_secs <= 0) return 0;
+    gdouble visible_rate = tab->visible_cpu / tab->visible_secs;
+    gdouble hidden_rate = tab->hidden_cpu / tab->hidden_secs;
+    return MAX(visible_rate - hidden_rate, 0) * tab->hidden_secs;
+}
+
+static void tab_report_cpu_saved(BrowserTab* tab) {
+    if (tab->hidden_secs <= 0) return;
+    const char* title = tab_current_title(tab);
+    fprintf(stderr, "Throttling saved ~%.1f s CPU in \"%s\" (hidden %.0f s)\n",
+            tab_cpu_saved(tab), title ? title : "", tab->hidden_secs);
+}
+
+// Reader mode. While a tab is in reader mode its pages load without running
+// their own scripts; once a page finishes, READER_EXTRACT_SCRIPT picks the
+// element holding most of the paragraph text and copies only text, links,
+// headings, lists and images out of it. The result replaces the page in the
+// same view, so the page's DOM, layout and (with the page cache off) its
+// memory are released.
+#define READER_MIN_TEXT 250   // Characters; shorter extractions keep the page
+
+static const char* READER_EXTRACT_SCRIPT =
+    "(function() {"
+    "  const KEEP = { P: 1, H1: 1, H2: 1, H3: 1, H4: 1, H5: 1, H6: 1, UL: 1, OL: 1, LI: 1,"
+    "                 BLOCKQUOTE: 1, PRE: 1, CODE: 1, EM: 1, STRONG: 1, B: 1, I: 1, A: 1,"
+    "                 IMG: 1, FIGURE: 1, FIGCAPTION: 1, BR: 1 };"
+    "  const SKIP = { SCRIPT: 1, STYLE: 1, NOSCRIPT: 1, NAV: 1, ASIDE: 1, FOOTER: 1, HEADER: 1,"
+    "                 FORM: 1, IFRAME: 1, SVG: 1, BUTTON: 1, TEMPLATE: 1 };"
+    "  let best = document.querySelector('article, main, [role=main]');"
+    "  if (!best) {"
+    "    const scores = new Map();"
+    "    let top = 0;"
+    "    document.querySelectorAll('p').forEach(function(p) {"
+    "      const parent = p.parentElement;"
+    "      const score = (scores.get(parent) || 0) + p.textContent.trim().length;"
+    "      scores.set(parent, score);"
+    "      if (score > top) { top = score; best = parent; }"
+    "    });"
+    "  }"
+    "  if (!best) best = document.body;"
+    "  const out = document.implementation.createHTMLDocument('');"
+    "  const copy = function(node, into) {"
+    "    node.childNodes.forEach(function(child) {"
+    "      if (child.nodeType === Node.TEXT_NODE) {"
+    "        into.appendChild(out.createTextNode(child.textContent));"
+    "        return;"
+    "      }"
+    "      if (child.nodeType !== Node.ELEMENT_NODE || SKIP[child.tagName]) return;"
+    "      if (!KEEP[child.tagName]) { copy(child, into); return; }"
+    "      const el = out.createElement(child.tagName);"
+    "      if (child.tagName === 'A' && /^https?:/.test(child.href)) el.setAttribute('href', child.href);"
+    "      if (child.tagName === 'IMG') {"
+    "        const lazy = child.getAttribute('data-src');"
+    "        const src = child.currentSrc || child.src || (lazy ? new URL(lazy, document.baseURI).href : '');"
+    "        if (!/^https?:/.test(src)) return;"
+    "        el.setAttribute('src', src);"
+    "        el.setAttribute('alt', child.alt || '');"
+    "      }"
+    "      into.appendChild(el);"
+    "      copy(child, el);"
+    "    });"
+    "  };"
+    "  if (best) copy(best, out.body);"
+    "  return JSON.stringify({ title: document.title, html: out.body.innerHTML,"
+    "                          text: out.body.textContent.trim().length });"
+    "})();";
+
+static const char* READER_CSS =
+    "body { max-width: 40em; margin: 2em auto; padding: 0 1em; font: 18px/1.6 serif;"
+    "       color: #222; background: #fdfdf8; }"
+    "img { max-width: 100%; height: auto; }"
+    "pre { overflow-x: auto; }"
+    "a { color: #1a5fb4; }";
+
+// Page scripts off (our own webview_run_script() calls still work) and no page
+// cache, so the original page is not kept alive behind the reader document
+static void reader_view_settings(WebKitWebView* view, gboolean reader) {
+    WebKitSettings* settings = webkit_web_view_get_settings(view);
+    webkit_settings_set_enable_javascript_markup(settings, !reader);
+    webkit_settings_set_enable_page_cache(settings, !reader);
+}
+
+static gchar* reader_document(const char* title, const char* body) {
+    gchar* escaped = g_markup_escape_text(title ? title : "", -1);
+    gchar* html = g_strdup_printf(
+        "<!DOCTYPE html><html><head><meta charset=\"utf-8\">"
+        "<meta http-equiv=\"Content-Security-Policy\" content=\"script-src 'none'\">"
+        "<title>%s</title><style>%s</style></head>"
+        "<body><h1>%s</h1>%s</body></html>",
+        escaped, READER_CSS, escaped, body);
+    g_free(escaped);
+    return html;
+}
+
+static void on_reader_extracted(GObject* source, GAsyncResult* result, gpointer data) {
+    BrowserTab* tab = (BrowserTab*)data;
+    WebKitWebView* view = WEBKIT_WEB_VIEW(source);
+    GError* error = NULL;
+    JSCValue* value = webview_run_script_finish(view, result, &error);
+
+    if (!value) {
+        fprintf(stderr, "Reader mode: extraction failed: %s\n", error->message);
+        g_error_free(error);
+        tab_unref(tab);
+        return;
+    }
+
+    gchar* json = jsc_value_to_string(value);
+    g_object_unref(value);
+
+    JsonParser* parser = json_parser_new();
+    JsonNode* root = NULL;
+    // A navigation that started meanwhile wins over the reader document
+    if (tab->reader && tab->webview == view && !webkit_web_view_is_loading(view) &&
+        json_parser_load_from_data(parser, json, -1, NULL)) {
+        root = json_parser_get_root(parser);
+    }
+    if (root && JSON_NODE_HOLDS_OBJECT(root)) {
+        JsonObject* article = json_node_get_object(root);
+        const char* title = json_object_get_string_member_with_default(article, "title", "");
+        const char* body = json_object_get_string_member_with_default(article, "html", "");
+
+        if (json_object_get_int_member_with_default(article, "text", 0) < READER_MIN_TEXT) {
+            g_debug("Reader mode: no article found on %s", webkit_web_view_get_uri(view));
+        } else {
+            gchar* html = reader_document(title, body);
+            reader_render_clear(tab);
+            tab->reader_rendering = g_strdup(webkit_web_view_get_uri(view));
+            webkit_web_view_load_alternate_html(view, html, tab->reader_rendering, tab->reader_rendering);
+            g_free(html);
+        }
+    }
+    g_object_unref(parser);
+    g_free(json);
+    tab_unref(tab);
+}
+
+static void reader_render_clear(BrowserTab* tab) {
+    g_clear_pointer(&tab->reader_rendering, g_free);
+    tab->reader_started = FALSE;
+}
+
+// The reader document loads under its page's URI, and its LOAD_STARTED is the
+// first one after load_alternate_html(). Any other start (a link, back,
+// reload, a typed URL) means the document was replaced, so its FINISHED must
+// not be mistaken for ours.
+static void reader_load_started(BrowserTab* tab) {
+    if (!tab->reader_rendering) return;
+    if (tab->reader_started ||
+        g_strcmp0(webkit_web_view_get_uri(tab->webview), tab->reader_rendering) != 0) {
+        reader_render_clear(tab);
+    } else {
+        tab->reader_started = TRUE;
+    }
+}
+
+static void tab_reader_extract(BrowserTab* tab) {
+    webview_run_script(tab->webview, READER_EXTRACT_SCRIPT, NULL, on_reader_extracted, tab_ref(tab));
+}
+
+// Entering reloads the page without its scripts and extracts it when the load
+// finishes; leaving reloads the original page with scripts back on
+static void tab_set_reader(BrowserTab* tab, gboolean reader) {
+    if (tab->reader == reader) return;
+    tab->reader = reader;
+    reader_render_clear(tab);
+    if (!tab->webview) return;
+
+    reader_view_settings(tab->webview, reader);
+    const char* uri = webkit_web_view_get_uri(tab->webview);
+    if (uri && !g_str_equal(uri, "about:blank")) {
+        gchar* copy = g_strdup(uri);
+        webkit_web_view_load_uri(tab->webview, copy);
+        g_free(copy);
+    }
+}
+
+// The tab menu. One GMenuModel is shared by every tab's menu button; its
+// items name "win." actions that act on the notebook's current tab, which is
+// the tab whose button opened the menu.
+static GMenuModel* browser_menu_model(BrowserData* browser) {
+    if (browser->menu_model) return browser->menu_model;
+
+    GMenu* menu = g_menu_new();
+
+    GMenu* mode_menu = g_menu_new();
+    g_menu_append(mode_menu, "Light Mode", "win.mode::light");
+    g_menu_append(mode_menu, "Dark Mode", "win.mode::dark");
+    g_menu_append(mode_menu, "Matrix Mode", "win.mode::matrix");
+
+    GMenu* vpn_menu = g_menu_new();
+    GMenu* vpn_connect = g_menu_new();
+    g_menu_append(vpn_connect, "Load Config File", "win.vpn-load-config");
+    g_menu_append(vpn_connect, "Start Connection", "win.vpn-connect");
+    g_menu_append(vpn_connect, "Disconnect VPN", "win.vpn-disconnect");
+    g_menu_append_section(vpn_menu, NULL, G_MENU_MODEL(vpn_connect));
+    g_menu_append(vpn_menu, "VPN Status", "win.vpn-status");
+
+    GMenu* submenus = g_menu_new();
+    g_menu_append_submenu(submenus, "Mode", G_MENU_MODEL(mode_menu));
+    g_menu_append_submenu(submenus, "VPN", G_MENU_MODEL(vpn_menu));
+    g_menu_append_section(menu, NULL, G_MENU_MODEL(submenus));
+
+    GMenu* tools = g_menu_new();
+    g_menu_append(tools, "Reader Mode", "win.reader-mode");
+    g_menu_append(tools, "Developer Tools", "win.dev-tools");
+    g_menu_append(tools, "History", "win.history");
+    g_menu_append(tools, "Downloads", "win.downloads");
+    g_menu_append(tools, "Intercept", "win.intercept");
+    g_menu_append(tools, "WebRTC Leak Check", "win.webrtc-check");
+    g_menu_append(tools, "IP Rotator", "win.ip-rotator");
+    g_menu_append(tools, "Task Manager", "win.task-manager");
+    g_menu_append(tools, "Site Policies", "win.site-policies");
+    g_menu_append_section(menu, NULL, G_MENU_MODEL(tools));
+
+    GMenu* bookmarks = g_menu_new();
+    g_menu_append(bookmarks, "Import Bookmarks...", "win.import-bookmarks");
+    g_menu_append(bookmarks, "Export Bookmarks...", "win.export-bookmarks");
+    g_menu_append_section(menu, NULL, G_MENU_MODEL(bookmarks));
+
+    GMenu* tabs = g_menu_new();
+    g_menu_append(tabs, "New Tab", "win.new-tab");
+    g_menu_append_section(menu, NULL, G_MENU_MODEL(tabs));
+
+    g_object_unref(mode_menu);
+    g_object_unref(vpn_connect);
+    g_object_unref(vpn_menu);
+    g_object_unref(submenus);
+    g_object_unref(tools);
+    g_object_unref(bookmarks);
+    g_object_unref(tabs);
+
+    browser->menu_model = G_MENU_MODEL(menu);
+    return browser->menu_model;
+}
+
+static BrowserTab* action_current_tab(gpointer data) {
+    GtkNotebook* notebook = GTK_NOTEBOOK(data);
+    return notebook_page_tab(notebook, gtk_notebook_get_current_page(notebook));
+}
+
+static void on_mode_action(GSimpleAction* action, GVariant* parameter, gpointer data) {
+    BrowserData* browser = g_object_get_data(G_OBJECT(data), "browser_data");
+    if (!browser) return;
+
+    BrowserMode mode = browser_mode_from_name(g_variant_get_string(parameter, NULL));
+    theme_engine_select(browser->themes, mode);
+    // New tabs and the next start use the last chosen mode
+    settings_set_string(browser->settings, SETTING_MODE, browser_mode_name(mode));
+}
+
+static void on_vpn_load_config_action(GSimpleAction* action, GVariant* parameter, gpointer data) {
+    BrowserTab* tab = action_current_tab(data);
+    if (tab) load_vpn_config(NULL, tab->vpn);
+}
+
+static void on_vpn_connect_action(GSimpleAction* action, GVariant* parameter, gpointer data) {
+    BrowserTab* tab = action_current_tab(data);
+    if (tab) init_vpn_connection(tab->vpn);
+}
+
+static void on_vpn_disconnect_action(GSimpleAction* action, GVariant* parameter, gpointer data) {
+    BrowserTab* tab = action_current_tab(data);
+    if (tab) cleanup_vpn(tab->vpn);
+}
+
+static void on_vpn_status_action(GSimpleAction* action, GVariant* parameter, gpointer data) {
+    BrowserTab* tab = action_current_tab(data);
+    if (tab) show_vpn_status(NULL, tab->vpn);
+}
+
+static void on_dev_tools_action(GSimpleAction* action, GVariant* parameter, gpointer data) {
+    BrowserTab* tab = action_current_tab(data);
+    if (tab && tab->webview) on_dev_tools_item_activate(NULL, tab);
+}
+
+static void on_history_action(GSimpleAction* action, GVariant* parameter, gpointer data) {
+    BrowserTab* tab = action_current_tab(data);
+    if (tab) show_history_window(NULL, tab->history);
+}
+
+static void on_downloads_action(GSimpleAction* action, GVariant* parameter, gpointer data) {
+    show_downloads_window(NULL, NULL);
+}
+
+static void on_intercept_action(GSimpleAction* action, GVariant* parameter, gpointer data) {
+    InterceptData* intercept_data = g_object_get_data(G_OBJECT(data), "intercept_data");
+    if (intercept_data) intercept_set_enabled(intercept_data, !intercept_data->enabled);
+}
+
+static void on_webrtc_check_action(GSimpleAction* action, GVariant* parameter, gpointer data) {
+    check_webrtc_leaks(NULL, NULL);
+}
+
+static void on_ip_rotator_action(GSimpleAction* action, GVariant* parameter, gpointer data) {
+    BrowserTab* tab = action_current_tab(data);
+    if (tab && tab->webview) show_ip_rotator(NULL, tab);
+}
+
+static void on_import_bookmarks_action(GSimpleAction* action, GVariant* parameter, gpointer data) {
+    BrowserTab* tab = action_current_tab(data);
+    if (tab) on_import_bookmarks(NULL, tab);
+}
+
+static void on_export_bookmarks_action(GSimpleAction* action, GVariant* parameter, gpointer data) {
+    BrowserTab* tab = action_current_tab(data);
+    if (tab) on_export_bookmarks(NULL, tab);
+}
+
+static void on_task_manager_action(GSimpleAction* action, GVariant* parameter, gpointer data) {
+    BrowserData* browser = g_object_get_data(G_OBJECT(data), "browser_data");
+    if (browser) show_task_manager(browser->monitor);
+}
+
+// Site policy checkboxes for one host; each toggle saves the host's flags
+static const struct { guint flag; const char* label; } SITE_POLICY_OPTIONS[] = {
+    { POLICY_BLOCK_AUTOPLAY, "Block media autoplay" },
+    { POLICY_LAZY_MEDIA, "Load images and frames lazily where possible" },
+    { POLICY_BLOCK_IMAGES, "Block images" },
+    { POLICY_BLOCK_FONTS, "Block web fonts" },
+};
+
+static void on_site_policy_toggled(GtkToggleButton* button, gpointer data) {
+    GtkWidget* box = GTK_WIDGET(data);
+    BrowserData* browser = g_object_get_data(G_OBJECT(box), "browser_data");
+    const char* host = g_object_get_data(G_OBJECT(box), "host");
+    guint flags = 0;
+
+    GList* children = gtk_container_get_children(GTK_CONTAINER(box));
+    for (GList* l = children; l; l = l->next) {
+        if (GTK_IS_CHECK_BUTTON(l->data) && gtk_toggle_button_get_active(GTK_TOGGLE_BUTTON(l->data))) {
+            flags |= GPOINTER_TO_UINT(g_object_get_data(G_OBJECT(l->data), "flag"));
+        }
+    }
+    g_list_free(children);
+    site_policy_set(browser, host, flags);
+}
+
+static void show_site_policies(BrowserTab* tab) {
+    gchar* host = uri_host(tab_current_uri(tab));
+    if (!host || !*host) {
+        g_free(host);
+        return;
+    }
+    guint flags = site_policy_flags(tab->browser, host);
+
+    GtkWidget* window = gtk_window_new(GTK_WINDOW_TOPLEVEL);
+    gchar* title = g_strdup_printf("Site Policies: %s", host);
+    gtk_window_set_title(GTK_WINDOW(window), title);
+    g_free(title);
+    gtk_container_set_border_width(GTK_CONTAINER(window), 10);
+
+    GtkWidget* box = gtk_box_new(GTK_ORIENTATION_VERTICAL, 5);
+    g_object_set_data(G_OBJECT(box), "browser_data", tab->browser);
+    g_object_set_data_full(G_OBJECT(box), "host", host, g_free);
+    gtk_container_add(GTK_CONTAINER(window), box);
+
+    for (gsize i = 0; i < G_N_ELEMENTS(SITE_POLICY_OPTIONS); i++) {
+        GtkWidget* check = gtk_check_button_new_with_label(SITE_POLICY_OPTIONS[i].label);
+        gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(check), (flags & SITE_POLICY_OPTIONS[i].flag) != 0);
+        g_object_set_data(G_OBJECT(check), "flag", GUINT_TO_POINTER(SITE_POLICY_OPTIONS[i].flag));
+        g_signal_connect(check, "toggled", G_CALLBACK(on_site_policy_toggled), box);
+        gtk_box_pack_start(GTK_BOX(box), check, FALSE, FALSE, 0);
+    }
+    gtk_box_pack_start(GTK_BOX(box),
+                       gtk_label_new("Changes apply to pages loaded from now on."), FALSE, FALSE, 0);
+
+    gtk_widget_show_all(window);
+}
+
+static void on_site_policies_action(GSimpleAction* action, GVariant* parameter, gpointer data) {
+    BrowserTab* tab = action_current_tab(data);
+    if (tab) show_site_policies(tab);
+}
+
+static void on_reader_mode_action(GSimpleAction* action, GVariant* parameter, gpointer data) {
+    BrowserTab* tab = action_current_tab(data);
+    if (tab) tab_set_reader(tab, !tab->reader);
+}
+
+static void on_new_tab_action(GSimpleAction* action, GVariant* parameter, gpointer data) {
+    on_new_tab_clicked(NULL, GTK_NOTEBOOK(data));
+}
+
+static const GActionEntry BROWSER_ACTIONS[] = {
+    { "mode", on_mode_action, "s", NULL, NULL },
+    { "vpn-load-config", on_vpn_load_config_action, NULL, NULL, NULL },
+    { "vpn-connect", on_vpn_connect_action, NULL, NULL, NULL },
+    { "vpn-disconnect", on_vpn_disconnect_action, NULL, NULL, NULL },
+    { "vpn-status", on_vpn_status_action, NULL, NULL, NULL },
+    { "dev-tools", on_dev_tools_action, NULL, NULL, NULL },
+    { "history", on_history_action, NULL, NULL, NULL },
+    { "downloads", on_downloads_action, NULL, NULL, NULL },
+    { "intercept", on_intercept_action, NULL, NULL, NULL },
+    { "webrtc-check", on_webrtc_check_action, NULL, NULL, NULL },
+    { "ip-rotator", on_ip_rotator_action, NULL, NULL, NULL },
+    { "import-bookmarks", on_import_bookmarks_action, NULL, NULL, NULL },
+    { "export-bookmarks", on_export_bookmarks_action, NULL, NULL, NULL },
+    { "task-manager", on_task_manager_action, NULL, NULL, NULL },
+    { "site-policies", on_site_policies_action, NULL, NULL, NULL },
+    { "reader-mode", on_reader_mode_action, NULL, NULL, NULL },
+    { "new-tab", on_new_tab_action, NULL, NULL, NULL },
+};
+
+// Register the "win." actions once per window
+static void browser_install_actions(GtkWidget* window, GtkNotebook* notebook) {
+    GSimpleActionGroup* group = g_simple_action_group_new();
+    g_action_map_add_action_entries(G_ACTION_MAP(group), BROWSER_ACTIONS,
+                                    G_N_ELEMENTS(BROWSER_ACTIONS), notebook);
+    gtk_widget_insert_action_group(window, "win", G_ACTION_GROUP(group));
+    g_object_unref(group);
+}
+
+// Resource monitor. A worker thread samples the browser's child processes
+// from /proc every MONITOR_SAMPLE_INTERVAL and hands each snapshot to the GTK
+// thread, which attributes processes to tabs, applies the optional limits and
+// refreshes the task manager.
+
+static void proc_sample_free(gpointer data) {
+    ProcSample* sample = (ProcSample*)data;
+    g_free(sample->name);
+    g_free(sample);
+}
+
+// Fields of /proc/<pid>/stat; comm may contain spaces, so parse after ')'
+static gboolean proc_read_stat(gint pid, gint* ppid, guint64* cpu_ticks, guint64* start_ticks, gchar** name) {
+    gchar path[64];
+    gchar* contents = NULL;
+    g_snprintf(path, sizeof(path), "/proc/%d/stat", pid);
+    if (!g_file_get_contents(path, &contents, NULL, NULL)) return FALSE;
+
+    const char* open = strchr(contents, '(');
+    const char* close = strrchr(contents, ')');
+    if (!open || !close || close < open) {
+        g_free(contents);
+        return FALSE;
+    }
+
+    // Fields 3.. follow the comm: state ppid ... utime(14) stime(15) ... starttime(22)
+    gchar** fields = g_strsplit(close + 2, " ", 21);
+    gboolean ok = g_strv_length(fields) >= 20;
+    if (ok) {
+        *ppid = atoi(fields[1]);
+        *cpu_ticks = g_ascii_strtoull(fields[11], NULL, 10) + g_ascii_strtoull(fields[12], NULL, 10);
+        *start_ticks = g_ascii_strtoull(fields[19], NULL, 10);
+        *name = g_strndup(open + 1, close - open - 1);
+    }
+    g_strfreev(fields);
+    g_free(contents);
+    return ok;
+}
+
+static gint64 proc_field_kb(const char* contents, const char* key) {
+    const char* line = contents ? strstr(contents, key) : NULL;
+    return line ? g_ascii_strtoll(line + strlen(key), NULL, 10) : -1;
+}
+
+static void proc_read_memory(gint pid, gint64* rss_kb, gint64* pss_kb) {
+    gchar path[64];
+    gchar* contents = NULL;
+
+    // smaps_rollup (Linux 4.14+) has PSS; fall back to status for RSS only
+    g_snprintf(path, sizeof(path), "/proc/%d/smaps_rollup", pid);
+    if (g_file_get_contents(path, &contents, NULL, NULL)) {
+        *rss_kb = proc_field_kb(contents, "\nRss:");
+        *pss_kb = proc_field_kb(contents, "\nPss:");
+        g_free(contents);
+        return;
+    }
+    g_snprintf(path, sizeof(path), "/proc/%d/status", pid);
+    if (g_file_get_contents(path, &contents, NULL, NULL)) {
+        *rss_kb = proc_field_kb(contents, "VmRSS:");
+        g_free(contents);
+    }
+    *pss_kb = -1;
+}
+
+// One pass over /proc for our direct children (web and network processes)
+static GPtrArray* resource_monitor_sample(GHashTable* last_ticks, gdouble elapsed, long hz) {
+    GPtrArray* samples = g_ptr_array_new_with_free_func(proc_sample_free);
+    GDir* dir = g_dir_open("/proc", 0, NULL);
+    if (!dir) return samples;
+
+    gint self = getpid();
+    const char* entry;
+    while ((entry = g_dir_read_name(dir))) {
+        if (!g_ascii_isdigit(entry[0])) continue;
+
+        gint pid = atoi(entry);
+        gint ppid = 0;
+        guint64 ticks = 0, start = 0;
+        gchar* name = NULL;
+        if (!proc_read_stat(pid, &ppid, &ticks, &start, &name)) continue;
+        if (ppid != self) {
+            g_free(name);
+            continue;
+        }
+
+        ProcSample* sample = g_new0(ProcSample, 1);
+        sample->pid = pid;
+        sample->name = name;
+        sample->cpu_ticks = ticks;
+        sample->start_ticks = start;
+        sample->rss_kb = sample->pss_kb = -1;
+        proc_read_memory(pid, &sample->rss_kb, &sample->pss_kb);
+
+        guint64* last = g_hash_table_lookup(last_ticks, GINT_TO_POINTER(pid));
+        if (last && elapsed > 0 && ticks >= *last) {
+            sample->cpu_percent = 100.0 * (ticks - *last) / hz / elapsed;
+        }
+        g_ptr_array_add(samples, sample);
+    }
+    g_dir_close(dir);
+    return samples;
+}
+
+static gboolean resource_monitor_deliver(gpointer data);
+
+static gpointer resource_monitor_thread(gpointer data) {
+    ResourceMonitor* monitor = (ResourceMonitor*)data;
+    GHashTable* last_ticks = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, g_free);
+    long hz = sysconf(_SC_CLK_TCK);
+    gint64 last_time = 0;
+
+    g_mutex_lock(&monitor->lock);
+    while (!monitor->stop) {
+        g_mutex_unlock(&monitor->lock);
+
+        gint64 now = g_get_monotonic_time();
+        gdouble elapsed = last_time ? (now - last_time) / (gdouble)G_USEC_PER_SEC : 0;
+        GPtrArray* samples = resource_monitor_sample(last_ticks, elapsed, hz > 0 ? hz : 100);
+        last_time = now;
+
+        g_hash_table_remove_all(last_ticks);
+        for (guint i = 0; i < samples->len; i++) {
+            ProcSample* sample = g_ptr_array_index(samples, i);
+            guint64* ticks = g_new(guint64, 1);
+            *ticks = sample->cpu_ticks;
+            g_hash_table_insert(last_ticks, GINT_TO_POINTER(sample->pid), ticks);
+        }
+
+        g_mutex_lock(&monitor->lock);
+        // An undelivered snapshot is simply replaced by the newer one
+        if (monitor->pending) g_ptr_array_unref(monitor->pending);
+        monitor->pending = samples;
+        if (!monitor->deliver_source) {
+            monitor->deliver_source = g_idle_add(resource_monitor_deliver, monitor);
+        }
+
+        gint64 wake = g_get_monotonic_time() + MONITOR_SAMPLE_INTERVAL * G_USEC_PER_SEC;
+        while (!monitor->stop && g_cond_wait_until(&monitor->cond, &monitor->lock, wake)) {
+        }
+    }
+    g_mutex_unlock(&monitor->lock);
 
-    // Connect signals
-    g_signal_connect(dev_tools_item, "activate", G_CALLBACK(on_dev_tools_clicked), tab->webview);
-    g_signal_connect(history_item, "activate", G_CALLBACK(show_history_window), history);
-    g_signal_connect(downloads_item, "activate", G_CALLBACK(show_downloads_window), NULL);  // Add callback
-    g_signal_connect(intercept_item, "activate", G_CALLBACK(on_intercept_toggled), intercept_data);
-    g_signal_connect(light_mode_item, "activate", G_CALLBACK(switch_mode), tab);
-    g_signal_connect(dark_mode_item, "activate", G_CALLBACK(switch_mode), tab);
-    g_signal_connect(matrix_mode_item, "activate", G_CALLBACK(switch_mode), tab);
-    g_signal_connect(webrtc_leak_item, "activate", G_CALLBACK(check_webrtc_leaks), NULL);
-    g_signal_connect(ip_rotator_item, "activate", G_CALLBACK(show_ip_rotator), tab);
-
-    // Set popup menu for menu button
-    gtk_menu_button_set_popup(GTK_MENU_BUTTON(tab->menu_button), popup_menu);
-
-    // Add menu button to hbox
-    gtk_box_pack_end(GTK_BOX(hbox), tab->menu_button, FALSE, FALSE, 0);
+    g_hash_table_unref(last_ticks);
+    return NULL;
+}
 
-    // Remove the old buttons we're replacing
-    gtk_widget_destroy(tab->dev_tools_button);
-    tab->dev_tools_button = NULL;
+static BrowserTab* browser_find_tab(BrowserData* browser, gint64 session_id) {
+    GtkNotebook* notebook = browser->session->notebook;
+    gint n_pages = gtk_notebook_get_n_pages(notebook);
+    for (gint i = 0; i < n_pages; i++) {
+        BrowserTab* tab = notebook_page_tab(notebook, i);
+        if (tab && tab->session_id == session_id) return tab;
+    }
+    return NULL;
+}
 
-    gtk_widget_show_all(popup_menu);
+// Record that a tab committed a load, which is when a new web process for it
+// shows up. Called on the GTK thread.
+static void resource_monitor_claim(ResourceMonitor* monitor, BrowserTab* tab) {
+    if (!monitor) return;
+    gint64* id = g_new(gint64, 1);
+    *id = tab->session_id;
+    g_queue_push_tail(&monitor->claims, id);
+}
 
-    // Store history reference
-    tab->history = history;
+static gint proc_sample_compare_start(gconstpointer a, gconstpointer b) {
+    const ProcSample* x = *(ProcSample* const*)a;
+    const ProcSample* y = *(ProcSample* const*)b;
+    return x->start_ticks < y->start_ticks ? -1 : x->start_ticks > y->start_ticks;
+}
 
-    // Create mode submenu
-    GtkWidget* mode_menu = gtk_menu_new();
-    GtkWidget* mode_item = gtk_menu_item_new_with_label("Mode");
-    gtk_menu_item_set_submenu(GTK_MENU_ITEM(mode_item), mode_menu);
+static gboolean remove_tab_pid(gpointer key, gpointer value, gpointer data) {
+    return *(gint64*)value == *(gint64*)data;
+}
 
-    GtkWidget* light_item = gtk_menu_item_new_with_label("Light Mode");
-    GtkWidget* dark_item = gtk_menu_item_new_with_label("Dark Mode");
-    GtkWidget* matrix_item = gtk_menu_item_new_with_label("Matrix Mode");
+// WebKit does not say which process serves a view. Web processes that appeared
+// since the last sample are matched, oldest first, to the tabs that committed
+// a load in that time; a tab keeps only its newest process.
+static void resource_monitor_attribute(ResourceMonitor* monitor, GPtrArray* samples) {
+    GHashTable* alive = g_hash_table_new(g_direct_hash, g_direct_equal);
+    GPtrArray* fresh = g_ptr_array_new();
+
+    for (guint i = 0; i < samples->len; i++) {
+        ProcSample* sample = g_ptr_array_index(samples, i);
+        g_hash_table_add(alive, GINT_TO_POINTER(sample->pid));
+        if (g_str_has_prefix(sample->name, "WebKitWebProc") &&
+            !g_hash_table_contains(monitor->pid_tabs, GINT_TO_POINTER(sample->pid))) {
+            g_ptr_array_add(fresh, sample);
+        }
+    }
+    g_ptr_array_sort(fresh, proc_sample_compare_start);
+
+    for (guint i = 0; i < fresh->len; i++) {
+        gint64* id = g_queue_pop_head(&monitor->claims);
+        if (!id) break;
+        ProcSample* sample = g_ptr_array_index(fresh, i);
+        g_hash_table_foreach_remove(monitor->pid_tabs, remove_tab_pid, id);
+        g_hash_table_insert(monitor->pid_tabs, GINT_TO_POINTER(sample->pid), id);
+    }
+    // Claims without a new process were loads in an existing one
+    g_queue_clear_full(&monitor->claims, g_free);
+
+    GHashTableIter iter;
+    gpointer pid;
+    g_hash_table_iter_init(&iter, monitor->pid_tabs);
+    while (g_hash_table_iter_next(&iter, &pid, NULL)) {
+        if (!g_hash_table_contains(alive, pid)) g_hash_table_iter_remove(&iter);
+    }
 
-    gtk_menu_shell_append(GTK_MENU_SHELL(mode_menu), light_item);
-    gtk_menu_shell_append(GTK_MENU_SHELL(mode_menu), dark_item);
-    gtk_menu_shell_append(GTK_MENU_SHELL(mode_menu), matrix_item);
+    g_ptr_array_unref(fresh);
+    g_hash_table_unref(alive);
+}
 
-    g_signal_connect(light_item, "activate", G_CALLBACK(switch_mode), tab);
-    g_signal_connect(dark_item, "activate", G_CALLBACK(switch_mode), tab);
-    g_signal_connect(matrix_item, "activate", G_CALLBACK(switch_mode), tab);
+static BrowserTab* resource_monitor_tab(ResourceMonitor* monitor, gint pid) {
+    gint64* id = g_hash_table_lookup(monitor->pid_tabs, GINT_TO_POINTER(pid));
+    return id ? browser_find_tab(monitor->browser, *id) : NULL;
+}
 
-    // Add mode menu to popup menu (add before other items)
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), mode_item);
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), gtk_separator_menu_item_new());
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), dev_tools_item);
-    // ... rest of menu items
+// Split each tab's CPU use into time selected and time hidden
+static void resource_monitor_account(ResourceMonitor* monitor) {
+    for (guint i = 0; i < monitor->samples->len; i++) {
+        ProcSample* sample = g_ptr_array_index(monitor->samples, i);
+        BrowserTab* tab = resource_monitor_tab(monitor, sample->pid);
+        if (!tab) continue;
+
+        gdouble cpu = sample->cpu_percent / 100.0 * MONITOR_SAMPLE_INTERVAL;
+        if (tab->throttled) {
+            tab->hidden_cpu += cpu;
+            tab->hidden_secs += MONITOR_SAMPLE_INTERVAL;
+        } else {
+            tab->visible_cpu += cpu;
+            tab->visible_secs += MONITOR_SAMPLE_INTERVAL;
+        }
+    }
+}
 
-    // Store mode menu reference and set default mode
-    tab->mode_item = mode_item;
-    tab->mode = MODE_LIGHT;
+static void resource_monitor_check_limits(ResourceMonitor* monitor) {
+    BrowserSettings* settings = monitor->browser->settings;
+    gint64 rss_limit_kb = settings_get_int(settings, SETTING_MONITOR_RSS_LIMIT, 0) * 1024;
+    gint64 cpu_limit = settings_get_int(settings, SETTING_MONITOR_CPU_LIMIT, 0);
+    gboolean hibernate = g_strcmp0(settings_get_string(settings, SETTING_MONITOR_ACTION, NULL), "hibernate") == 0;
+    if (rss_limit_kb <= 0 && cpu_limit <= 0) return;
+
+    GtkNotebook* notebook = monitor->browser->session->notebook;
+    for (guint i = 0; i < monitor->samples->len; i++) {
+        ProcSample* sample = g_ptr_array_index(monitor->samples, i);
+        gboolean over = (rss_limit_kb > 0 && sample->rss_kb > rss_limit_kb) ||
+                        (cpu_limit > 0 && sample->cpu_percent > cpu_limit);
+        if (!over) {
+            g_hash_table_remove(monitor->flagged, GINT_TO_POINTER(sample->pid));
+            continue;
+        }
+        // Act once per excursion over the limit
+        if (!g_hash_table_add(monitor->flagged, GINT_TO_POINTER(sample->pid))) continue;
+
+        BrowserTab* tab = resource_monitor_tab(monitor, sample->pid);
+        const char* title = tab ? tab_current_title(tab) : NULL;
+        if (hibernate && tab && tab->webview &&
+            gtk_notebook_page_num(notebook, tab->container) != gtk_notebook_get_current_page(notebook) &&
+            !webkit_web_view_is_playing_audio(tab->webview)) {
+            // Same busy check as the idle sweep, so unsaved form input and
+            // playing media are not thrown away
+            fprintf(stderr, "Hibernating \"%s\" unless busy: pid %d at %" G_GINT64_FORMAT " MB, %.0f%% CPU\n",
+                    title ? title : "", sample->pid, sample->rss_kb / 1024, sample->cpu_percent);
+            hibernation_check(monitor->browser->hibernation, tab);
+        } else {
+            fprintf(stderr, "Warning: %s%s%s pid %d at %" G_GINT64_FORMAT " MB, %.0f%% CPU\n",
+                    title ? "\"" : "", title ? title : sample->name, title ? "\"" : "",
+                    sample->pid, sample->rss_kb / 1024, sample->cpu_percent);
+        }
+    }
+}
 
-    // Add after other menu items
-    GtkWidget* webrtc_check_item = gtk_menu_item_new_with_label("Check WebRTC Leaks");
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), webrtc_check_item);
-    g_signal_connect(webrtc_check_item, "activate", G_CALLBACK(check_webrtc_leaks), NULL);
+enum {
+    MONITOR_COL_TAB,
+    MONITOR_COL_PID,
+    MONITOR_COL_RSS,
+    MONITOR_COL_PSS,
+    MONITOR_COL_CPU,
+    MONITOR_COL_SAVED,        // CPU seconds saved by throttling the tab
+    MONITOR_N_COLS
+};
 
-    // Add new tab menu item
-    GtkWidget* new_tab_item = gtk_menu_item_new_with_label("New Tab");
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), gtk_separator_menu_item_new());
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), new_tab_item);
+static void resource_monitor_update_view(ResourceMonitor* monitor) {
+    gtk_list_store_clear(monitor->store);
+    for (guint i = 0; i < monitor->samples->len; i++) {
+        ProcSample* sample = g_ptr_array_index(monitor->samples, i);
+        BrowserTab* tab = resource_monitor_tab(monitor, sample->pid);
+        const char* title = tab ? tab_current_title(tab) : NULL;
+        gchar* label = title ? g_strdup(title) : g_strdup_printf("[%s]", sample->name);
+
+        GtkTreeIter iter;
+        gtk_list_store_append(monitor->store, &iter);
+        gtk_list_store_set(monitor->store, &iter,
+                           MONITOR_COL_TAB, label,
+                           MONITOR_COL_PID, sample->pid,
+                           MONITOR_COL_RSS, (gint)(sample->rss_kb / 1024),
+                           MONITOR_COL_PSS, (gint)(sample->pss_kb / 1024),
+                           MONITOR_COL_CPU, sample->cpu_percent,
+                           MONITOR_COL_SAVED, tab ? tab_cpu_saved(tab) : 0.0,
+                           -1);
+        g_free(label);
+    }
+}
 
-    // Connect new tab signal
-    g_signal_connect(new_tab_item, "activate", G_CALLBACK(on_new_tab_clicked), gtk_widget_get_ancestor(tab->container, GTK_TYPE_NOTEBOOK));
+static gboolean resource_monitor_deliver(gpointer data) {
+    ResourceMonitor* monitor = (ResourceMonitor*)data;
 
-    // Initialize VPN structure
-    tab->vpn = g_new0(VPNConnection, 1);
-    tab->vpn->connected = FALSE;
-    tab->vpn->config_file = NULL;
-    tab->vpn->last_error = NULL;
-    tab->vpn->config_label = gtk_label_new("No config loaded");
+    g_mutex_lock(&monitor->lock);
+    GPtrArray* samples = monitor->pending;
+    monitor->pending = NULL;
+    monitor->deliver_source = 0;
+    g_mutex_unlock(&monitor->lock);
+    if (!samples) return G_SOURCE_REMOVE;
 
-    // Create and setup VPN menu
-    create_vpn_menu(tab, popup_menu);
+    resource_monitor_attribute(monitor, samples);
+    if (monitor->samples) g_ptr_array_unref(monitor->samples);
+    monitor->samples = samples;
+    resource_monitor_account(monitor);
 
-    return tab;
+    resource_monitor_check_limits(monitor);
+    if (monitor->window) {
+        resource_monitor_update_view(monitor);
+    }
+    return G_SOURCE_REMOVE;
 }
 
-// Function to create new tab label with close button
-static GtkWidget* create_tab_label(const gchar* text, GtkNotebook* notebook, BrowserTab* tab) {
-    GtkWidget* hbox = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 5);
-    tab->title_label = gtk_label_new(text);
-    GtkWidget* close_button = gtk_button_new_from_icon_name("window-close", GTK_ICON_SIZE_MENU);
-    
-    gtk_box_pack_start(GTK_BOX(hbox), tab->title_label, TRUE, TRUE, 0);
-    gtk_box_pack_start(GTK_BOX(hbox), close_button, FALSE, FALSE, 0);
-    
-    g_signal_connect(close_button, "clicked", G_CALLBACK(on_tab_close_clicked), notebook);
-    g_object_set_data(G_OBJECT(close_button), "tab", tab);
-    
-    // Connect title changed signal
-    g_signal_connect(tab->webview, "notify::title", G_CALLBACK(on_title_changed), tab);
-    
-    gtk_widget_show_all(hbox);
-    return hbox;
+static ResourceMonitor* resource_monitor_new(BrowserData* browser) {
+    ResourceMonitor* monitor = g_new0(ResourceMonitor, 1);
+    monitor->browser = browser;
+    g_mutex_init(&monitor->lock);
+    g_cond_init(&monitor->cond);
+    monitor->pid_tabs = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, g_free);
+    monitor->flagged = g_hash_table_new(g_direct_hash, g_direct_equal);
+    g_queue_init(&monitor->claims);
+    monitor->thread = g_thread_new("resource-monitor", resource_monitor_thread, monitor);
+    return monitor;
 }
 
-// Navigation and URL handling callbacks remain the same
-static void on_url_entry_activate(GtkEntry* entry, gpointer data) {
-    const gchar* text = gtk_entry_get_text(entry);
-    WebKitWebView* webview = WEBKIT_WEB_VIEW(data);
-
-    if (is_valid_url(text)) {
-        webkit_web_view_load_uri(webview, text);
-    } else if (is_localhost(text)) {
-        gchar* url_with_prefix = g_strdup_printf("http://%s", text);
-        webkit_web_view_load_uri(webview, url_with_prefix);
-        g_free(url_with_prefix);
-    } else if (is_domain(text)) {
-        // Extract domain part
-        const gchar* domain = text;
-        if (g_str_has_prefix(text, "www.")) {
-            domain = text + 4;
-        }
-        
-        if (is_resolvable_domain(domain)) {
-            gchar* url_with_prefix = g_strdup_printf("http://%s", text);
-            webkit_web_view_load_uri(webview, url_with_prefix);
-        } else {
-            // Show error dialog
-            GtkWidget* dialog = gtk_message_dialog_new(GTK_WINDOW(gtk_widget_get_toplevel(GTK_WIDGET(entry))),
-                GTK_DIALOG_MODAL,
-                GTK_MESSAGE_ERROR,
-                GTK_BUTTONS_OK,
-                "Error resolving domain '%s'.\nPlease check your internet connection and domain name.",
-                text);
-            gtk_dialog_run(GTK_DIALOG(dialog));
-            gtk_widget_destroy(dialog);
-        }
-    } else {
-        GtkComboBoxText* search_engine_combo = GTK_COMBO_BOX_TEXT(g_object_get_data(G_OBJECT(entry), "search_engine_combo"));
-        const gchar* selected_engine = gtk_combo_box_text_get_active_text(search_engine_combo);
-        gchar* search_url = NULL;
-
-        if (g_strcmp0(selected_engine, "Google") == 0) {
-            search_url = g_strdup_printf("https://www.google.com/search?q=%s", text);
-        } else if (g_strcmp0(selected_engine, "Bing") == 0) {
-            search_url = g_strdup_printf("https://www.bing.com/search?q=%s", text);
-        } else if (g_strcmp0(selected_engine, "DuckDuckGo") == 0) {
-            search_url = g_strdup_printf("https://www.duckduckgo.com/?q=%s", text);
-        } else if (g_strcmp0(selected_engine, "Yahoo") == 0) {
-            search_url = g_strdup_printf("https://search.yahoo.com/search?p=%s", text);
-        }
-
-        if (search_url) {
-            webkit_web_view_load_uri(webview, search_url);
-            g_free(search_url);
-        }
-    }
+static void resource_monitor_free(ResourceMonitor* monitor) {
+    if (!monitor) return;
+
+    g_mutex_lock(&monitor->lock);
+    monitor->stop = TRUE;
+    g_cond_signal(&monitor->cond);
+    g_mutex_unlock(&monitor->lock);
+    g_thread_join(monitor->thread);
+
+    if (monitor->deliver_source) g_source_remove(monitor->deliver_source);
+    if (monitor->pending) g_ptr_array_unref(monitor->pending);
+    if (monitor->samples) g_ptr_array_unref(monitor->samples);
+    if (monitor->window) gtk_widget_destroy(monitor->window);
+    g_hash_table_unref(monitor->pid_tabs);
+    g_hash_table_unref(monitor->flagged);
+    g_queue_clear_full(&monitor->claims, g_free);
+    g_mutex_clear(&monitor->lock);
+    g_cond_clear(&monitor->cond);
+    g_free(monitor);
 }
 
-static void on_search_button_clicked(GtkButton* button, gpointer data) {
-    GtkWidget* entry = GTK_WIDGET(data);
-    WebKitWebView* webview = g_object_get_data(G_OBJECT(entry), "webview");
-    on_url_entry_activate(GTK_ENTRY(entry), webview);
+static void on_monitor_double_cell(GtkTreeViewColumn* column, GtkCellRenderer* cell, GtkTreeModel* model,
+                                   GtkTreeIter* iter, gpointer data) {
+    gdouble value = 0;
+    gtk_tree_model_get(model, iter, GPOINTER_TO_INT(data), &value, -1);
+    gchar text[16];
+    g_snprintf(text, sizeof(text), "%.1f", value);
+    g_object_set(cell, "text", text, NULL);
 }
 
-static void on_home_button_clicked(GtkButton* button, gpointer data) {
-    WebKitWebView* webview = WEBKIT_WEB_VIEW(data);
-    webkit_web_view_load_uri(webview, "https://www.google.com");
+static void on_monitor_window_destroy(GtkWidget* window, gpointer data) {
+    ResourceMonitor* monitor = (ResourceMonitor*)data;
+    monitor->window = NULL;
+    monitor->store = NULL;
 }
 
-static void on_load_changed(WebKitWebView* web_view, WebKitLoadEvent load_event, gpointer user_data) {
-    BrowserTab* tab = (BrowserTab*)user_data;
-    
-    switch (load_event) {
-        case WEBKIT_LOAD_FINISHED:
-            if (tab && tab->history) {
-                const gchar* uri = webkit_web_view_get_uri(web_view);
-                const gchar* title = webkit_web_view_get_title(web_view);
-                add_history_entry(tab->history, uri, title);
-            }
-            break;
-        default:
-            break;
+static void show_task_manager(ResourceMonitor* monitor) {
+    if (monitor->window) {
+        gtk_window_present(GTK_WINDOW(monitor->window));
+        return;
     }
-}
 
-// Tab management callbacks
-static void on_tab_close_clicked(GtkButton* button, GtkNotebook* notebook) {
-    BrowserTab* tab = g_object_get_data(G_OBJECT(button), "tab");
-    gint page_num = gtk_notebook_page_num(notebook, tab->container);
-    
-    // Don't close if it's the last tab
-    if (gtk_notebook_get_n_pages(notebook) > 1) {
-        gtk_notebook_remove_page(notebook, page_num);
-        g_free(tab);
+    monitor->window = gtk_window_new(GTK_WINDOW_TOPLEVEL);
+    gtk_window_set_title(GTK_WINDOW(monitor->window), "Task Manager");
+    gtk_window_set_default_size(GTK_WINDOW(monitor->window), 600, 400);
+    g_signal_connect(monitor->window, "destroy", G_CALLBACK(on_monitor_window_destroy), monitor);
+
+    monitor->store = gtk_list_store_new(MONITOR_N_COLS, G_TYPE_STRING, G_TYPE_INT, G_TYPE_INT,
+                                        G_TYPE_INT, G_TYPE_DOUBLE, G_TYPE_DOUBLE);
+    gtk_tree_sortable_set_sort_column_id(GTK_TREE_SORTABLE(monitor->store), MONITOR_COL_RSS,
+                                         GTK_SORT_DESCENDING);
+    GtkWidget* view = gtk_tree_view_new_with_model(GTK_TREE_MODEL(monitor->store));
+    g_object_unref(monitor->store);   // Owned by the view
+
+    static const char* const titles[] = { "Tab", "PID", "RSS (MB)", "PSS (MB)", "CPU %", "CPU saved (s)" };
+    for (gint col = 0; col < MONITOR_N_COLS; col++) {
+        GtkCellRenderer* renderer = gtk_cell_renderer_text_new();
+        GtkTreeViewColumn* column = gtk_tree_view_column_new_with_attributes(titles[col], renderer,
+                                                                              "text", col, NULL);
+        if (col == MONITOR_COL_CPU || col == MONITOR_COL_SAVED) {
+            gtk_tree_view_column_set_cell_data_func(column, renderer, on_monitor_double_cell,
+                                                    GINT_TO_POINTER(col), NULL);
+        }
+        gtk_tree_view_column_set_sort_column_id(column, col);
+        gtk_tree_view_column_set_resizable(column, TRUE);
+        gtk_tree_view_column_set_expand(column, col == MONITOR_COL_TAB);
+        gtk_tree_view_append_column(GTK_TREE_VIEW(view), column);
     }
-}
 
-static void on_new_tab_clicked(GtkButton* button, GtkNotebook* notebook) {
-    InterceptData* intercept_data = g_object_get_data(G_OBJECT(notebook), "intercept_data");
-    BrowserHistory* history = g_object_get_data(G_OBJECT(notebook), "history");
-    BrowserTab* tab = create_browser_tab(intercept_data, history);
-    gint page_num = gtk_notebook_append_page(notebook, tab->container,
-                                           create_tab_label("New Tab", notebook, tab));
-    gtk_widget_show_all(tab->container);
-    gtk_notebook_set_current_page(notebook, page_num);
+    GtkWidget* scroll = gtk_scrolled_window_new(NULL, NULL);
+    gtk_container_add(GTK_CONTAINER(scroll), view);
+    gtk_container_add(GTK_CONTAINER(monitor->window), scroll);
+
+    if (monitor->samples) {
+        resource_monitor_update_view(monitor);
+    }
+    gtk_widget_show_all(monitor->window);
 }
 
 // Update on_resource_load_started
@@ -745,9 +5492,27 @@ static gboolean on_resource_load_started(WebKitWebView* web_view,
         }
     }
 
+    // WebKit attaches cookies in the network process, so show them from the jar
+    if (!g_hash_table_contains(pending->headers, "Cookie")) {
+        GUri* parsed = g_uri_parse(pending->uri, G_URI_FLAGS_NONE, NULL);
+        if (parsed) {
+            GString* cookie_header = g_string_new(NULL);
+            cookie_jar_build_header(intercept_data->cookies, g_uri_get_host(parsed),
+                                    g_uri_get_path(parsed),
+                                    g_strcmp0(g_uri_get_scheme(parsed), "https") == 0,
+                                    cookie_header);
+            if (cookie_header->len) {
+                g_hash_table_insert(pending->headers, g_strdup("Cookie"), g_strdup(cookie_header->str));
+            }
+            g_string_free(cookie_header, TRUE);
+            g_uri_unref(parsed);
+        }
+    }
+
     // Add to queue if not current request
     if (!intercept_data->current_resource) {
         intercept_data->current_resource = resource;
+        intercept_data->current_view = web_view;
         // Display current request
         gchar* request_text = g_strdup_printf("Method: %s\nURI: %s\n", 
                                             pending->method, pending->uri);
@@ -845,10 +5610,10 @@ static void on_resource_response_received(WebKitWebView* web_view,
 }
 
 // Update intercept toggle callback
-static void on_intercept_toggled(GtkToggleButton* button, InterceptData* intercept_data) {
+static void intercept_set_enabled(InterceptData* intercept_data, gboolean enabled) {
     if (!intercept_data) return;
     
-    intercept_data->enabled = gtk_toggle_button_get_active(button);
+    intercept_data->enabled = enabled;
     
     if (intercept_data->enabled) {
         // Create window if it doesn't exist
@@ -866,11 +5631,6 @@ static void on_intercept_toggled(GtkToggleButton* button, InterceptData* interce
             gtk_widget_hide(intercept_data->window);
         }
     }
-    
-    // Update toggle button state to match window state
-    if (!intercept_data->window) {
-        gtk_toggle_button_set_active(button, FALSE);
-    }
 }
 
 // Update forward_request function
@@ -899,6 +5659,7 @@ static void forward_request(GtkButton* button, InterceptData* data) {
         PendingRequest* next = g_queue_pop_head(data->pending_requests);
         if (next) {
             data->current_resource = next->resource;
+            data->current_view = next->web_view;
             
             // Update display
             gchar* request_text = g_strdup_printf("Method: %s\nURI: %s\n", 
@@ -1021,8 +5782,49 @@ static void on_dev_tools_clicked(GtkButton* button, WebKitWebView* web_view) {
     webkit_web_inspector_show(inspector);
 }
 
-// Initialize database tables
-static void init_databases(BrowserData* data) {
+static void on_dev_tools_item_activate(GtkWidget* item, gpointer data) {
+    BrowserTab* tab = (BrowserTab*)data;
+    on_dev_tools_clicked(NULL, tab->webview);
+}
+
+// Initialize database tables. Runs on the storage I/O thread.
+// Rows written before history.address existed; a no-op once filled
+static void history_backfill_addresses(sqlite3* db) {
+    sqlite3_stmt* stmt;
+    GArray* ids = g_array_new(FALSE, FALSE, sizeof(gint64));
+    GPtrArray* addresses = g_ptr_array_new_with_free_func(g_free);
+
+    // Collect first; updating rows under a running SELECT of the same index
+    // could visit them again
+    if (sqlite3_prepare_v2(db, "SELECT id, url FROM history WHERE address IS NULL", -1, &stmt, 0) == SQLITE_OK) {
+        while (sqlite3_step(stmt) == SQLITE_ROW) {
+            const char* url = (const char*)sqlite3_column_text(stmt, 1);
+            if (!url) continue;
+            gint64 id = sqlite3_column_int64(stmt, 0);
+            g_array_append_val(ids, id);
+            g_ptr_array_add(addresses, history_address(url));
+        }
+    }
+    sqlite3_finalize(stmt);
+
+    if (ids->len &&
+        sqlite3_prepare_v2(db, "UPDATE history SET address = ? WHERE id = ?", -1, &stmt, 0) == SQLITE_OK) {
+        sqlite3_exec(db, "BEGIN", 0, 0, NULL);
+        for (guint i = 0; i < ids->len; i++) {
+            sqlite3_bind_text(stmt, 1, g_ptr_array_index(addresses, i), -1, SQLITE_STATIC);
+            sqlite3_bind_int64(stmt, 2, g_array_index(ids, gint64, i));
+            sqlite3_step(stmt);
+            sqlite3_reset(stmt);
+        }
+        sqlite3_exec(db, "COMMIT", 0, 0, NULL);
+        sqlite3_finalize(stmt);
+    }
+
+    g_array_free(ids, TRUE);
+    g_ptr_array_unref(addresses);
+}
+
+static void init_databases(BrowserStorage* storage) {
     const char* history_sql = 
         "CREATE TABLE IF NOT EXISTS history ("
         "id INTEGER PRIMARY KEY AUTOINCREMENT,"
@@ -1031,7 +5833,7 @@ static void init_databases(BrowserData* data) {
         "visit_time DATETIME DEFAULT CURRENT_TIMESTAMP)";
 
     const char* cookies_sql = 
-        "CREATE TABLE IF NOT EXISTS cookies ("
+        "CREATE TABLE IF NOT EXISTS cookies.cookies ("
         "id INTEGER PRIMARY KEY AUTOINCREMENT,"
         "domain TEXT NOT NULL,"
         "name TEXT NOT NULL,"
@@ -1050,57 +5852,377 @@ static void init_databases(BrowserData* data) {
     char* err_msg = 0;
     int rc;
 
-    rc = sqlite3_open("browser.db", &data->history->db);
+    gchar* path = storage_db_path(storage, "browser.db");
+    rc = sqlite3_open(path, &storage->db);
+    g_free(path);
     if (rc != SQLITE_OK) {
-        fprintf(stderr, "Cannot open history database: %s\n", sqlite3_errmsg(data->history->db));
+        fprintf(stderr, "Cannot open browser database: %s\n", sqlite3_errmsg(storage->db));
+        sqlite3_close(storage->db);
+        storage->db = NULL;
         return;
     }
 
-    rc = sqlite3_exec(data->history->db, history_sql, 0, 0, &err_msg);
+    sqlite3_busy_timeout(storage->db, 5000);
+    storage_apply_pragmas(storage, "main");
+
+    for (gsize i = 0; i < G_N_ELEMENTS(STORAGE_ATTACHED_DBS); i++) {
+        gchar* file = storage_db_path(storage, STORAGE_ATTACHED_DBS[i][1]);
+        gchar* sql = sqlite3_mprintf("ATTACH DATABASE %Q AS %s", file, STORAGE_ATTACHED_DBS[i][0]);
+
+        rc = sqlite3_exec(storage->db, sql, 0, 0, &err_msg);
+        if (rc != SQLITE_OK) {
+            fprintf(stderr, "Cannot attach %s: %s\n", file, err_msg);
+            sqlite3_free(err_msg);
+        } else {
+            storage_apply_pragmas(storage, STORAGE_ATTACHED_DBS[i][0]);
+        }
+
+        sqlite3_free(sql);
+        g_free(file);
+    }
+
+    rc = sqlite3_exec(storage->db, history_sql, 0, 0, &err_msg);
     if (rc != SQLITE_OK) {
         fprintf(stderr, "SQL error: %s\n", err_msg);
         sqlite3_free(err_msg);
     }
 
-    rc = sqlite3_open("cookies.db", &data->cookies->db);
+    rc = sqlite3_exec(storage->db, cookies_sql, 0, 0, &err_msg);
     if (rc != SQLITE_OK) {
-        fprintf(stderr, "Cannot open cookies database: %s\n", sqlite3_errmsg(data->cookies->db));
-        return;
+        fprintf(stderr, "SQL error: %s\n", err_msg);
+        sqlite3_free(err_msg);
+    }
+
+    rc = sqlite3_exec(storage->db, settings_sql, 0, 0, &err_msg);
+    if (rc != SQLITE_OK) {
+        fprintf(stderr, "SQL error: %s\n", err_msg);
+        sqlite3_free(err_msg);
+    }
+
+    // Older builds never read settings back and could insert the same name
+    // twice; keep the newest row so the name can be made unique
+    rc = sqlite3_exec(storage->db,
+                      "DELETE FROM settings WHERE id NOT IN "
+                      "(SELECT MAX(id) FROM settings GROUP BY name);"
+                      "CREATE UNIQUE INDEX IF NOT EXISTS settings_name ON settings (name);",
+                      0, 0, &err_msg);
+    if (rc != SQLITE_OK) {
+        fprintf(stderr, "SQL error: %s\n", err_msg);
+        sqlite3_free(err_msg);
+    }
+
+    // Bookmark folders form a tree through parent_id; 0 is the root
+    rc = sqlite3_exec(storage->db,
+                      "CREATE TABLE IF NOT EXISTS bookmarks.bookmarks ("
+                      "id INTEGER PRIMARY KEY AUTOINCREMENT,"
+                      "url TEXT NOT NULL,"
+                      "title TEXT,"
+                      "folder TEXT,"
+                      "add_date DATETIME DEFAULT CURRENT_TIMESTAMP);"
+                      "CREATE TABLE IF NOT EXISTS bookmarks.folders ("
+                      "id INTEGER PRIMARY KEY AUTOINCREMENT,"
+                      "parent_id INTEGER NOT NULL DEFAULT 0,"
+                      "name TEXT NOT NULL,"
+                      "UNIQUE (parent_id, name));",
+                      0, 0, &err_msg);
+    if (rc != SQLITE_OK) {
+        fprintf(stderr, "SQL error: %s\n", err_msg);
+        sqlite3_free(err_msg);
+    }
+
+    // folder_id was added after the original table; ignore "duplicate column"
+    sqlite3_exec(storage->db, "ALTER TABLE bookmarks.bookmarks ADD COLUMN folder_id INTEGER DEFAULT 0",
+                 0, 0, NULL);
+    sqlite3_exec(storage->db, "CREATE INDEX IF NOT EXISTS bookmarks.bookmarks_folder "
+                              "ON bookmarks (folder_id)", 0, 0, NULL);
+
+    // Normalized URL, so removal by URL is an index lookup
+    sqlite3_exec(storage->db, "ALTER TABLE bookmarks.bookmarks ADD COLUMN url_key TEXT", 0, 0, NULL);
+    sqlite3_exec(storage->db, "CREATE INDEX IF NOT EXISTS bookmarks.bookmarks_url_key "
+                              "ON bookmarks (url_key)", 0, 0, NULL);
+
+    // Per-host overrides of the default site policy
+    rc = sqlite3_exec(storage->db,
+                      "CREATE TABLE IF NOT EXISTS site_policies ("
+                      "host TEXT PRIMARY KEY,"
+                      "flags INTEGER NOT NULL)",
+                      0, 0, &err_msg);
+    if (rc != SQLITE_OK) {
+        fprintf(stderr, "SQL error: %s\n", err_msg);
+        sqlite3_free(err_msg);
     }
 
-    rc = sqlite3_exec(data->cookies->db, cookies_sql, 0, 0, &err_msg);
+    // One row per open tab; see session_save_work()
+    rc = sqlite3_exec(storage->db,
+                      "CREATE TABLE IF NOT EXISTS session_tabs ("
+                      "id INTEGER PRIMARY KEY,"
+                      "position INTEGER NOT NULL,"
+                      "uri TEXT,"
+                      "title TEXT,"
+                      "state BLOB)",
+                      0, 0, &err_msg);
     if (rc != SQLITE_OK) {
         fprintf(stderr, "SQL error: %s\n", err_msg);
         sqlite3_free(err_msg);
     }
 
-    rc = sqlite3_exec(data->history->db, settings_sql, 0, 0, &err_msg);
+    // Retention deletes by age, the history window sorts by it
+    rc = sqlite3_exec(storage->db,
+                      "CREATE INDEX IF NOT EXISTS history_visit_time ON history (visit_time)",
+                      0, 0, &err_msg);
     if (rc != SQLITE_OK) {
         fprintf(stderr, "SQL error: %s\n", err_msg);
         sqlite3_free(err_msg);
     }
+
+    // URL-entry suggestions match typed prefixes against address; see
+    // history_address(). Ignore "duplicate column" on existing files.
+    sqlite3_exec(storage->db, "ALTER TABLE history ADD COLUMN address TEXT", 0, 0, NULL);
+    sqlite3_exec(storage->db, "CREATE INDEX IF NOT EXISTS history_address ON history (address)",
+                 0, 0, NULL);
+    history_backfill_addresses(storage->db);
 }
 
-// Add history entry
-static void add_history_entry(BrowserHistory* history, const char* url, const char* title) {
+typedef struct {
+    gchar* url;
+    gchar* title;
+} HistoryEntryJob;
+
+static void history_entry_job_free(gpointer data) {
+    HistoryEntryJob* job = (HistoryEntryJob*)data;
+    g_free(job->url);
+    g_free(job->title);
+    g_free(job);
+}
+
+static void add_history_entry_work(sqlite3* db, gpointer data) {
+    HistoryEntryJob* job = (HistoryEntryJob*)data;
     sqlite3_stmt* stmt;
-    const char* sql = "INSERT INTO history (url, title) VALUES (?, ?)";
+    const char* sql = "INSERT INTO history (url, title, address) VALUES (?, ?, ?)";
 
-    int rc = sqlite3_prepare_v2(history->db, sql, -1, &stmt, 0);
+    int rc = sqlite3_prepare_v2(db, sql, -1, &stmt, 0);
     if (rc != SQLITE_OK) {
-        fprintf(stderr, "Failed to prepare statement: %s\n", sqlite3_errmsg(history->db));
+        fprintf(stderr, "Failed to prepare statement: %s\n", sqlite3_errmsg(db));
         return;
     }
 
-    sqlite3_bind_text(stmt, 1, url, -1, SQLITE_STATIC);
-    sqlite3_bind_text(stmt, 2, title, -1, SQLITE_STATIC);
+    gchar* address = history_address(job->url);
+    sqlite3_bind_text(stmt, 1, job->url, -1, SQLITE_STATIC);
+    sqlite3_bind_text(stmt, 2, job->title, -1, SQLITE_STATIC);
+    sqlite3_bind_text(stmt, 3, address, -1, SQLITE_TRANSIENT);
+    g_free(address);
 
     rc = sqlite3_step(stmt);
     if (rc != SQLITE_DONE) {
-        fprintf(stderr, "Failed to add history entry: %s\n", sqlite3_errmsg(history->db));
+        fprintf(stderr, "Failed to add history entry: %s\n", sqlite3_errmsg(db));
+    }
+
+    sqlite3_finalize(stmt);
+}
+
+// Add history entry
+static void add_history_entry(BrowserHistory* history, const char* url, const char* title) {
+    HistoryEntryJob* job = g_new0(HistoryEntryJob, 1);
+    job->url = g_strdup(url);
+    job->title = g_strdup(title);
+
+    storage_submit(history->storage, add_history_entry_work, NULL, job, history_entry_job_free);
+}
+
+// Rows are stored flat as title, url, date triples
+typedef struct {
+    BrowserHistory* history;
+    GPtrArray* rows;
+} HistoryLoadJob;
+
+static void history_load_job_free(gpointer data) {
+    HistoryLoadJob* job = (HistoryLoadJob*)data;
+    g_ptr_array_unref(job->rows);
+    g_free(job);
+}
+
+static void load_history_work(sqlite3* db, gpointer data) {
+    HistoryLoadJob* job = (HistoryLoadJob*)data;
+    sqlite3_stmt* stmt;
+    const char* sql = "SELECT title, url, datetime(visit_time) FROM history ORDER BY visit_time DESC";
+
+    int rc = sqlite3_prepare_v2(db, sql, -1, &stmt, 0);
+    if (rc == SQLITE_OK) {
+        while (sqlite3_step(stmt) == SQLITE_ROW) {
+            for (int col = 0; col < 3; col++) {
+                g_ptr_array_add(job->rows, g_strdup((const char*)sqlite3_column_text(stmt, col)));
+            }
+        }
+    }
+    sqlite3_finalize(stmt);
+}
+
+static void load_history_done(gpointer data) {
+    HistoryLoadJob* job = (HistoryLoadJob*)data;
+    BrowserHistory* history = job->history;
+
+    gtk_list_store_clear(history->history_store);
+    for (guint i = 0; i + 2 < job->rows->len; i += 3) {
+        GtkTreeIter iter;
+        gtk_list_store_append(history->history_store, &iter);
+        gtk_list_store_set(history->history_store, &iter,
+                         0, g_ptr_array_index(job->rows, i),
+                         1, g_ptr_array_index(job->rows, i + 1),
+                         2, g_ptr_array_index(job->rows, i + 2),
+                         -1);
+    }
+}
+
+// History retention: entries older than HISTORY_MAX_AGE_DAYS, or beyond the
+// newest HISTORY_MAX_ENTRIES, are deleted in small batches so the write lock
+// is only ever held briefly and other storage jobs interleave between them.
+#define HISTORY_MAX_AGE_DAYS 90
+#define HISTORY_MAX_ENTRIES 20000
+#define HISTORY_PRUNE_BATCH 200
+#define HISTORY_PRUNE_INTERVAL 600    // seconds
+#define HISTORY_VACUUM_PAGES 128
+
+typedef struct {
+    BrowserHistory* history;
+    int deleted;
+} HistoryPruneJob;
+
+static void prune_history_work(sqlite3* db, gpointer data) {
+    HistoryPruneJob* job = (HistoryPruneJob*)data;
+    sqlite3_stmt* stmt;
+
+    const char* age_sql =
+        "DELETE FROM history WHERE id IN ("
+        "SELECT id FROM history WHERE visit_time < datetime('now', ?) "
+        "ORDER BY visit_time LIMIT ?)";
+    if (sqlite3_prepare_v2(db, age_sql, -1, &stmt, 0) == SQLITE_OK) {
+        gchar* modifier = g_strdup_printf("-%d days", HISTORY_MAX_AGE_DAYS);
+        sqlite3_bind_text(stmt, 1, modifier, -1, SQLITE_TRANSIENT);
+        sqlite3_bind_int(stmt, 2, HISTORY_PRUNE_BATCH);
+        if (sqlite3_step(stmt) == SQLITE_DONE) {
+            job->deleted += sqlite3_changes(db);
+        }
+        g_free(modifier);
+    }
+    sqlite3_finalize(stmt);
+
+    if (job->deleted < HISTORY_PRUNE_BATCH) {
+        const char* size_sql =
+            "DELETE FROM history WHERE id IN ("
+            "SELECT id FROM history ORDER BY visit_time "
+            "LIMIT MAX(0, MIN(?, (SELECT COUNT(*) FROM history) - ?)))";
+        if (sqlite3_prepare_v2(db, size_sql, -1, &stmt, 0) == SQLITE_OK) {
+            sqlite3_bind_int(stmt, 1, HISTORY_PRUNE_BATCH - job->deleted);
+            sqlite3_bind_int(stmt, 2, HISTORY_MAX_ENTRIES);
+            if (sqlite3_step(stmt) == SQLITE_DONE) {
+                job->deleted += sqlite3_changes(db);
+            }
+        }
+        sqlite3_finalize(stmt);
+    }
+
+    // Return a bounded number of free pages to the filesystem per pass
+    char* err_msg = NULL;
+    gchar* vacuum_sql = g_strdup_printf("PRAGMA main.incremental_vacuum(%d)", HISTORY_VACUUM_PAGES);
+    if (sqlite3_exec(db, vacuum_sql, 0, 0, &err_msg) != SQLITE_OK) {
+        fprintf(stderr, "Incremental vacuum failed: %s\n", err_msg);
+        sqlite3_free(err_msg);
+    }
+    g_free(vacuum_sql);
+}
+
+static gboolean prune_history_next(gpointer user_data);
+
+static void prune_history_done(gpointer data) {
+    HistoryPruneJob* job = (HistoryPruneJob*)data;
+
+    // A full batch means there may be more to delete; keep going when idle
+    if (job->deleted >= HISTORY_PRUNE_BATCH) {
+        g_idle_add_full(G_PRIORITY_LOW, prune_history_next, job->history, NULL);
+    } else {
+        job->history->prune_running = FALSE;
+    }
+}
+
+static gboolean prune_history_next(gpointer user_data) {
+    BrowserHistory* history = (BrowserHistory*)user_data;
+    HistoryPruneJob* job = g_new0(HistoryPruneJob, 1);
+    job->history = history;
+    storage_submit(history->storage, prune_history_work, prune_history_done, job, g_free);
+    return G_SOURCE_REMOVE;
+}
+
+static gboolean prune_history_timeout(gpointer user_data) {
+    BrowserHistory* history = (BrowserHistory*)user_data;
+    if (!history->prune_running) {
+        history->prune_running = TRUE;
+        prune_history_next(history);
     }
+    return G_SOURCE_CONTINUE;
+}
+
+static void history_retention_start(BrowserHistory* history) {
+    history->prune_source = g_timeout_add_seconds_full(G_PRIORITY_LOW, HISTORY_PRUNE_INTERVAL,
+                                                       prune_history_timeout, history, NULL);
+}
+
+// incremental_vacuum needs auto_vacuum=INCREMENTAL, and switching an existing
+// browser.db over takes one full VACUUM. That holds up every storage job
+// behind it, so it waits until the session is restored and the first pages
+// have loaded. A failure (e.g. a full disk) is recorded and not retried for
+// HISTORY_VACUUM_RETRY_DAYS.
+#define HISTORY_VACUUM_DELAY 30         // seconds after session restore
+#define HISTORY_VACUUM_RETRY_DAYS 30
+
+typedef struct {
+    BrowserSettings* settings;
+    gboolean failed;
+} HistoryVacuumJob;
 
+static void history_vacuum_work(sqlite3* db, gpointer data) {
+    HistoryVacuumJob* job = (HistoryVacuumJob*)data;
+    sqlite3_stmt* stmt;
+    int auto_vacuum = -1;
+
+    if (sqlite3_prepare_v2(db, "PRAGMA main.auto_vacuum", -1, &stmt, 0) == SQLITE_OK) {
+        if (sqlite3_step(stmt) == SQLITE_ROW) {
+            auto_vacuum = sqlite3_column_int(stmt, 0);
+        }
+    }
     sqlite3_finalize(stmt);
+    if (auto_vacuum == 2) return;
+
+    char* err_msg = NULL;
+    if (sqlite3_exec(db, "PRAGMA main.auto_vacuum=INCREMENTAL; VACUUM main;", 0, 0, &err_msg) != SQLITE_OK) {
+        fprintf(stderr, "Failed to enable incremental vacuum: %s\n", err_msg);
+        sqlite3_free(err_msg);
+        job->failed = TRUE;
+    }
+}
+
+static void history_vacuum_done(gpointer data) {
+    HistoryVacuumJob* job = (HistoryVacuumJob*)data;
+    if (job->failed) {
+        settings_set_int(job->settings, SETTING_VACUUM_FAILED, g_get_real_time() / G_USEC_PER_SEC);
+    }
+}
+
+static gboolean history_vacuum_timeout(gpointer user_data) {
+    BrowserData* browser = (BrowserData*)user_data;
+    HistoryVacuumJob* job = g_new0(HistoryVacuumJob, 1);
+    job->settings = browser->settings;
+    storage_submit(browser->storage, history_vacuum_work, history_vacuum_done, job, g_free);
+    return G_SOURCE_REMOVE;
+}
+
+static void history_vacuum_schedule(BrowserData* browser) {
+    if (storage_in_memory(browser->storage)) return;
+
+    gint64 failed_at = settings_get_int(browser->settings, SETTING_VACUUM_FAILED, 0);
+    gint64 now = g_get_real_time() / G_USEC_PER_SEC;
+    if (failed_at && now - failed_at < (gint64)HISTORY_VACUUM_RETRY_DAYS * 24 * 3600) return;
+
+    g_timeout_add_seconds_full(G_PRIORITY_LOW, HISTORY_VACUUM_DELAY, history_vacuum_timeout, browser, NULL);
 }
 
 // Show history window
@@ -1130,25 +6252,11 @@ static void show_history_window(GtkButton* button, BrowserHistory* history) {
         gtk_container_add(GTK_CONTAINER(history->history_window), scroll);
     }
 
-    // Load history data
-    sqlite3_stmt* stmt;
-    const char* sql = "SELECT title, url, datetime(visit_time) FROM history ORDER BY visit_time DESC";
-
-    gtk_list_store_clear(history->history_store);
-
-    int rc = sqlite3_prepare_v2(history->db, sql, -1, &stmt, 0);
-    if (rc == SQLITE_OK) {
-        while (sqlite3_step(stmt) == SQLITE_ROW) {
-            GtkTreeIter iter;
-            gtk_list_store_append(history->history_store, &iter);
-            gtk_list_store_set(history->history_store, &iter,
-                             0, sqlite3_column_text(stmt, 0),
-                             1, sqlite3_column_text(stmt, 1),
-                             2, sqlite3_column_text(stmt, 2),
-                             -1);
-        }
-    }
-    sqlite3_finalize(stmt);
+    // Load history data on the storage thread; the store is filled when it completes
+    HistoryLoadJob* job = g_new0(HistoryLoadJob, 1);
+    job->history = history;
+    job->rows = g_ptr_array_new_with_free_func(g_free);
+    storage_submit(history->storage, load_history_work, load_history_done, job, history_load_job_free);
 
     gtk_widget_show_all(history->history_window);
 }
@@ -1157,8 +6265,8 @@ static void show_history_window(GtkButton* button, BrowserHistory* history) {
 static void cleanup_browser_data(BrowserData* data) {
     if (data) {
         if (data->history) {
-            if (data->history->db) {
-                sqlite3_close(data->history->db);
+            if (data->history->prune_source) {
+                g_source_remove(data->history->prune_source);
             }
             if (data->history->history_window) {
                 gtk_widget_destroy(data->history->history_window);
@@ -1166,14 +6274,34 @@ static void cleanup_browser_data(BrowserData* data) {
             g_free(data->history);
         }
         if (data->cookies) {
-            if (data->cookies->db) {
-                sqlite3_close(data->cookies->db);
-            }
+            cookie_jar_cleanup(data->cookies);
             if (data->cookies->cookie_window) {
                 gtk_widget_destroy(data->cookies->cookie_window);
             }
             g_free(data->cookies);
         }
+        if (data->web_context) {
+            settings_unwatch_by_data(data->settings, data->web_context);
+            g_object_unref(data->web_context);
+        }
+        settings_unwatch_by_data(data->settings, data);
+        g_clear_object(&data->content_manager);
+        content_blocker_free(data->blocker);
+        site_policies_free(data->policies);
+        settings_free(data->settings);
+        bookmarks_free(data->bookmarks);
+        dns_cache_free(data->dns);
+        prefetch_stats_free(data->prefetch);
+        suggest_cache_free(data->suggest);
+        prerender_stats_free(data->prerender_stats);
+        session_free(data->session);
+        hibernation_free(data->hibernation);
+        g_clear_object(&data->menu_model);
+        webview_pool_free(data->view_pool);
+        resource_monitor_free(data->monitor);
+        theme_engine_free(data->themes);
+        // Flushes any queued writes before the connection is closed
+        storage_free(data->storage);
         g_free(data);
     }
 }
@@ -1219,70 +6347,83 @@ static void show_downloads_window(GtkMenuItem* menuitem, gpointer user_data) {
         3, "https://example.com/example.pdf",
         -1);
 
-    g_object_unref(downloads_store);
-    
-    gtk_widget_show_all(downloads_window);
+    g_object_unref(downloads_store);
+    
+    gtk_widget_show_all(downloads_window);
+}
+
+// theme_css.h lists the themes in BrowserMode order
+G_STATIC_ASSERT(THEME_CSS_COUNT == MODE_COUNT);
+
+static ThemeEngine* theme_engine_new(BrowserData* browser) {
+    ThemeEngine* themes = g_new0(ThemeEngine, 1);
+    themes->browser = browser;
+    themes->mode = MODE_LIGHT;    // Light is the unstyled default
+    return themes;
+}
+
+static GtkCssProvider* theme_engine_provider(ThemeEngine* themes, BrowserMode mode) {
+    if (!themes->providers[mode]) {
+        GError* error = NULL;
+        themes->providers[mode] = gtk_css_provider_new();
+        if (!gtk_css_provider_load_from_data(themes->providers[mode], THEME_CSS[mode].gtk_css, -1, &error)) {
+            fprintf(stderr, "Failed to compile %s theme: %s\n", browser_mode_name(mode), error->message);
+            g_error_free(error);
+        }
+    }
+    return themes->providers[mode];
+}
+
+static WebKitUserStyleSheet* theme_engine_sheet(ThemeEngine* themes, BrowserMode mode) {
+    if (!themes->sheets[mode]) {
+        themes->sheets[mode] = webkit_user_style_sheet_new(THEME_CSS[mode].page_css,
+                                                           WEBKIT_USER_CONTENT_INJECT_ALL_FRAMES,
+                                                           WEBKIT_USER_STYLE_LEVEL_USER,
+                                                           NULL, NULL);
+    }
+    return themes->sheets[mode];
 }
 
-static void switch_mode(GtkMenuItem* menu_item, gpointer user_data) {
-    BrowserTab* tab = (BrowserTab*)user_data;
-    const gchar* mode_text = gtk_menu_item_get_label(menu_item);
-    
-    GtkCssProvider* provider = gtk_css_provider_new();
-    const gchar* gtk_css;
-    const gchar* webkit_css;
-
-    if (g_strcmp0(mode_text, "Light Mode") == 0) {
-        tab->mode = MODE_LIGHT;
-        gtk_css = "* { background-color: white !important; }";
-        webkit_css = "body { background-color: white !important; }\n"
-                    "img, video, iframe { filter: none !important; }\n"
-                    "a { color: #0066cc !important; }";
-    }
-    else if (g_strcmp0(mode_text, "Dark Mode") == 0) {
-        tab->mode = MODE_DARK;
-        gtk_css = "* { background-color: #222 !important; }";
-        webkit_css = "body { background-color: #222 !important; }\n"
-                    "img, video, iframe { filter: brightness(0.9) !important; }\n"
-                    "a { color: #66b3ff !important; }";
-    }
-    else if (g_strcmp0(mode_text, "Matrix Mode") == 0) {
-        tab->mode = MODE_MATRIX;
-        gtk_css = "* { background-color: black !important; }";
-        webkit_css = "body { background-color: black !important; }\n"
-                    "img, video, iframe { filter: brightness(1) !important; opacity: 1 !important; }\n"
-                    ".ytp-cued-thumbnail-overlay, .ytp-thumbnail { opacity: 1 !important; }\n"
-                    "a { color: #00ff00 !important; text-decoration: none !important; }\n"
-                    "a:hover { text-shadow: 0 0 8px #00ff00 !important; }\n"
-                    "pre, code { background: #001100 !important; color: #00ff00 !important; }\n"
-                    "input, textarea, select { background: #001100 !important; color: #00ff00 !important; border: 1px solid #00ff00 !important; }\n"
-                    "button { background: #002200 !important; color: #00ff00 !important; border: 1px solid #00ff00 !important; }\n"
-                    "button:hover { background: #003300 !important; }";
-    }
-
-    // Apply styles
-    gtk_css_provider_load_from_data(provider, gtk_css, -1, NULL);
-    gtk_style_context_add_provider_for_screen(
-        gdk_screen_get_default(),
-        GTK_STYLE_PROVIDER(provider),
-        GTK_STYLE_PROVIDER_PRIORITY_APPLICATION
-    );
-    
-    WebKitUserContentManager* manager = webkit_web_view_get_user_content_manager(tab->webview);
+// Switch every window and tab to mode
+static void theme_engine_select(ThemeEngine* themes, BrowserMode mode) {
+    if (mode == themes->mode && (themes->installed || mode == MODE_LIGHT)) return;
+
+    GdkScreen* screen = gdk_screen_get_default();
+    GtkCssProvider* provider = theme_engine_provider(themes, mode);
+    gtk_style_context_add_provider_for_screen(screen, GTK_STYLE_PROVIDER(provider),
+                                              GTK_STYLE_PROVIDER_PRIORITY_APPLICATION);
+    if (themes->installed && themes->installed != provider) {
+        gtk_style_context_remove_provider_for_screen(screen, GTK_STYLE_PROVIDER(themes->installed));
+    }
+    themes->installed = provider;
+    themes->mode = mode;
+
+    // Every view shares the content manager. WebKit applies user style
+    // sheets to loaded documents as well, so no page is reloaded.
+    WebKitUserContentManager* manager = browser_content_manager(themes->browser);
     webkit_user_content_manager_remove_all_style_sheets(manager);
-    
-    WebKitUserStyleSheet* style_sheet = webkit_user_style_sheet_new(
-        webkit_css,
-        WEBKIT_USER_CONTENT_INJECT_ALL_FRAMES,
-        WEBKIT_USER_STYLE_LEVEL_USER,
-        NULL,
-        NULL
-    );
-    
-    webkit_user_content_manager_add_style_sheet(manager, style_sheet);
-    webkit_user_style_sheet_unref(style_sheet);
-    webkit_web_view_reload(tab->webview);
-    g_object_unref(provider);
+    webkit_user_content_manager_add_style_sheet(manager, theme_engine_sheet(themes, mode));
+
+    GtkNotebook* notebook = themes->browser->session->notebook;
+    gint n_pages = gtk_notebook_get_n_pages(notebook);
+    for (gint i = 0; i < n_pages; i++) {
+        BrowserTab* tab = notebook_page_tab(notebook, i);
+        if (tab) tab->mode = mode;
+    }
+}
+
+static void theme_engine_free(ThemeEngine* themes) {
+    if (!themes) return;
+
+    if (themes->installed) {
+        gtk_style_context_remove_provider_for_screen(gdk_screen_get_default(),
+                                                     GTK_STYLE_PROVIDER(themes->installed));
+    }
+    for (gint i = 0; i < MODE_COUNT; i++) {
+        g_clear_object(&themes->providers[i]);
+        if (themes->sheets[i]) webkit_user_style_sheet_unref(themes->sheets[i]);
+    }
+    g_free(themes);
 }
 
 static void check_webrtc_leaks(GtkMenuItem* menuitem, gpointer user_data) {
@@ -1515,309 +6656,6 @@ static gboolean rotate_ip_complete(gpointer user_data) {
     return G_SOURCE_REMOVE;
 }
 
-// Update in main() before showing window
-int main(int argc, char* argv[]) {
-    gtk_init(&argc, &argv);
-    
-    // Create main window with visual effects
-    GtkWidget* window = gtk_window_new(GTK_WINDOW_TOPLEVEL);
-    gtk_window_set_default_size(GTK_WINDOW(window), 1200, 800);
-    gtk_window_set_title(GTK_WINDOW(window), "Rocket Browser");
-    gtk_window_set_position(GTK_WINDOW(window), GTK_WIN_POS_CENTER);
-    
-    // Create main vertical box
-    GtkWidget* main_vbox = gtk_box_new(GTK_ORIENTATION_VERTICAL, 5);
-    gtk_container_add(GTK_CONTAINER(window), main_vbox);
-    
-    // Create notebook for tabs
-    GtkWidget* notebook = gtk_notebook_new();
-    gtk_notebook_set_scrollable(GTK_NOTEBOOK(notebook), TRUE);
-    gtk_notebook_set_tab_pos(GTK_NOTEBOOK(notebook), GTK_POS_TOP);
-    gtk_notebook_set_show_border(GTK_NOTEBOOK(notebook), FALSE);
-    gtk_box_pack_start(GTK_BOX(main_vbox), notebook, TRUE, TRUE, 0);
-
-    // Create new tab button with styling
-    GtkWidget* new_tab_button = gtk_button_new_with_label("+");
-    gtk_widget_set_size_request(new_tab_button, 30, 30);
-
-    // Style the new tab button
-    GtkStyleContext* style_context = gtk_widget_get_style_context(new_tab_button);
-    GtkCssProvider* provider = gtk_css_provider_new();
-    const char* css = 
-        "button { padding: 0 8px; margin: 2px; border: none; background: none; }"
-        "button:hover { background-color: rgba(255,255,255,0.1); border-radius: 3px; }";
-    gtk_css_provider_load_from_data(provider, css, -1, NULL);
-    gtk_style_context_add_provider(style_context, 
-        GTK_STYLE_PROVIDER(provider),
-        GTK_STYLE_PROVIDER_PRIORITY_APPLICATION);
-
-    // Style the + symbol
-    GtkWidget* button_label = gtk_bin_get_child(GTK_BIN(new_tab_button));
-    PangoAttrList* attr_list = pango_attr_list_new();
-    pango_attr_list_insert(attr_list, pango_attr_scale_new(1.5));
-    gtk_label_set_attributes(GTK_LABEL(button_label), attr_list);
-    pango_attr_list_unref(attr_list);
-
-    // Add button to notebook
-    gtk_notebook_set_action_widget(GTK_NOTEBOOK(notebook), new_tab_button, GTK_PACK_END);
-    g_signal_connect(new_tab_button, "clicked", G_CALLBACK(on_new_tab_clicked), notebook);
-    g_object_unref(provider);
-
-    // Show all widgets
-    gtk_widget_show_all(new_tab_button);
-    
-    // Create intercept data// Update create_browser_tab function
-static BrowserTab* create_browser_tab(InterceptData* intercept_data, BrowserHistory* history) {
-    BrowserTab* tab = g_new0(BrowserTab, 1); // Initialize all fields to 0
-    
-    // Create WebView first so it's available for button callbacks
-    tab->webview = WEBKIT_WEB_VIEW(webkit_web_view_new());
-    
-    // Create container and controls
-    tab->container = gtk_box_new(GTK_ORIENTATION_VERTICAL, 5);
-    GtkWidget* hbox = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 5);
-    gtk_box_pack_start(GTK_BOX(tab->container), hbox, FALSE, FALSE, 0);
-    
-    // Create search engine combo
-    tab->search_engine_combo = GTK_COMBO_BOX_TEXT(gtk_combo_box_text_new());
-    gtk_combo_box_text_append_text(tab->search_engine_combo, "Google");
-    gtk_combo_box_text_append_text(tab->search_engine_combo, "Bing");
-    gtk_combo_box_text_append_text(tab->search_engine_combo, "DuckDuckGo");
-    gtk_combo_box_text_append_text(tab->search_engine_combo, "Yahoo");
-    gtk_combo_box_set_active(GTK_COMBO_BOX(tab->search_engine_combo), 0);
-    gtk_box_pack_start(GTK_BOX(hbox), GTK_WIDGET(tab->search_engine_combo), FALSE, FALSE, 0);
-    
-    // Create URL entry
-    tab->url_entry = gtk_entry_new();
-    gtk_box_pack_start(GTK_BOX(hbox), tab->url_entry, TRUE, TRUE, 0);
-    
-    // Create navigation buttons
-    GtkWidget* back_button = gtk_button_new_with_label("Back");
-    GtkWidget* forward_button = gtk_button_new_with_label("Forward");
-    GtkWidget* home_button = gtk_button_new_with_label("Home");
-    GtkWidget* search_button = gtk_button_new_with_label("Search");
-    tab->dev_tools_button = gtk_button_new_with_label("Dev Tools");  // Add dev tools button
-    
-    gtk_box_pack_start(GTK_BOX(hbox), back_button, FALSE, FALSE, 0);
-    gtk_box_pack_start(GTK_BOX(hbox), forward_button, FALSE, FALSE, 0);
-    gtk_box_pack_start(GTK_BOX(hbox), home_button, FALSE, FALSE, 0);
-    gtk_box_pack_start(GTK_BOX(hbox), search_button, FALSE, FALSE, 0);
-    gtk_box_pack_start(GTK_BOX(hbox), tab->dev_tools_button, FALSE, FALSE, 0);  // Add to layout
-
-    // Store references for callbacks
-    g_object_set_data(G_OBJECT(tab->url_entry), "webview", tab->webview);
-    g_object_set_data(G_OBJECT(tab->url_entry), "search_engine_combo", tab->search_engine_combo);
-
-    // Connect button signals
-    g_signal_connect_swapped(back_button, "clicked", G_CALLBACK(webkit_web_view_go_back), tab->webview);
-    g_signal_connect_swapped(forward_button, "clicked", G_CALLBACK(webkit_web_view_go_forward), tab->webview);
-    g_signal_connect(home_button, "clicked", G_CALLBACK(on_home_button_clicked), tab->webview);
-    g_signal_connect(search_button, "clicked", G_CALLBACK(on_search_button_clicked), tab->url_entry);
-    g_signal_connect(tab->url_entry, "activate", G_CALLBACK(on_url_entry_activate), tab->webview);
-
-    // Add webview to container
-    gtk_box_pack_start(GTK_BOX(tab->container), GTK_WIDGET(tab->webview), TRUE, TRUE, 0);
-    
-    // Connect WebKit signals 
-    g_signal_connect(tab->webview, "load-changed", G_CALLBACK(on_load_changed), tab);
-    g_signal_connect(tab->webview, "resource-load-started", G_CALLBACK(on_resource_load_started), intercept_data);
-    g_signal_connect(tab->webview, "resource-response-received", G_CALLBACK(on_resource_response_received), intercept_data);
-
-    // Load default page
-    webkit_web_view_load_uri(tab->webview, "https://www.google.com");
-
-    // Enable developer extras
-    WebKitSettings* settings = webkit_web_view_get_settings(tab->webview);
-    webkit_settings_set_enable_developer_extras(settings, TRUE);
-
-    // Connect dev tools button signal
-    g_signal_connect(tab->dev_tools_button, "clicked", G_CALLBACK(on_dev_tools_clicked), tab->webview);
-
-    // Inside create_browser_tab function, after creating other buttons:
-
-    // Create menu button (three dots)
-    tab->menu_button = gtk_menu_button_new();
-    GtkWidget* menu_image = gtk_image_new_from_icon_name("view-more-symbolic", GTK_ICON_SIZE_BUTTON);
-    gtk_button_set_image(GTK_BUTTON(tab->menu_button), menu_image);
-
-    // Create popup menu
-    GtkWidget* popup_menu = gtk_menu_new();
-
-    // Add VPN menu first (before other menu items)
-    GtkWidget* vpn_menu = gtk_menu_new();
-    GtkWidget* vpn_item = gtk_menu_item_new_with_label("VPN");
-    gtk_menu_item_set_submenu(GTK_MENU_ITEM(vpn_item), vpn_menu);
-
-    // VPN menu items
-    GtkWidget* vpn_connect = gtk_menu_item_new_with_label("Connect VPN");
-    GtkWidget* vpn_disconnect = gtk_menu_item_new_with_label("Disconnect VPN");
-    GtkWidget* vpn_status = gtk_menu_item_new_with_label("VPN Status");
-    GtkWidget* vpn_settings = gtk_menu_item_new_with_label("VPN Settings");
-
-    // Add items to VPN submenu
-    gtk_menu_shell_append(GTK_MENU_SHELL(vpn_menu), vpn_connect);
-    gtk_menu_shell_append(GTK_MENU_SHELL(vpn_menu), vpn_disconnect);
-    gtk_menu_shell_append(GTK_MENU_SHELL(vpn_menu), gtk_separator_menu_item_new());
-    gtk_menu_shell_append(GTK_MENU_SHELL(vpn_menu), vpn_status);
-    gtk_menu_shell_append(GTK_MENU_SHELL(vpn_menu), vpn_settings);
-
-    // Initialize VPN connection structure
-    tab->vpn = g_new0(VPNConnection, 1);
-    tab->vpn->connected = FALSE;
-    tab->vpn->config_file = NULL;
-    tab->vpn->last_error = NULL;
-
-    // Add VPN menu item to main popup menu (before other items)
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), vpn_item);
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), gtk_separator_menu_item_new());
-
-    // Connect VPN signals
-    g_signal_connect(vpn_connect, "activate", G_CALLBACK(init_vpn_connection), tab->vpn);
-    g_signal_connect(vpn_disconnect, "activate", G_CALLBACK(cleanup_vpn), tab->vpn);
-    g_signal_connect(vpn_status, "activate", G_CALLBACK(show_vpn_status), tab->vpn);
-
-    // Add menu items
-    GtkWidget* dev_tools_item = gtk_menu_item_new_with_label("Developer Tools");
-    GtkWidget* history_item = gtk_menu_item_new_with_label("History");
-    GtkWidget* downloads_item = gtk_menu_item_new_with_label("Downloads");  // Add downloads item
-    GtkWidget* intercept_item = gtk_menu_item_new_with_label("Intercept");
-    GtkWidget* light_mode_item = gtk_menu_item_new_with_label("Light Mode");
-    GtkWidget* dark_mode_item = gtk_menu_item_new_with_label("Dark Mode");
-    GtkWidget* matrix_mode_item = gtk_menu_item_new_with_label("Matrix Mode");
-    GtkWidget* webrtc_leak_item = gtk_menu_item_new_with_label("WebRTC Leak Check");
-    GtkWidget* ip_rotator_item = gtk_menu_item_new_with_label("IP Rotator");
-
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), dev_tools_item);
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), history_item);
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), downloads_item);  // Add to menu
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), intercept_item);
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), light_mode_item);
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), dark_mode_item);
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), matrix_mode_item);
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), webrtc_leak_item);
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), ip_rotator_item);
-
-    // Connect signals
-    g_signal_connect(dev_tools_item, "activate", G_CALLBACK(on_dev_tools_clicked), tab->webview);
-    g_signal_connect(history_item, "activate", G_CALLBACK(show_history_window), history);
-    g_signal_connect(downloads_item, "activate", G_CALLBACK(show_downloads_window), NULL);  // Add callback
-    g_signal_connect(intercept_item, "activate", G_CALLBACK(on_intercept_toggled), intercept_data);
-    g_signal_connect(light_mode_item, "activate", G_CALLBACK(switch_mode), tab);
-    g_signal_connect(dark_mode_item, "activate", G_CALLBACK(switch_mode), tab);
-    g_signal_connect(matrix_mode_item, "activate", G_CALLBACK(switch_mode), tab);
-    g_signal_connect(webrtc_leak_item, "activate", G_CALLBACK(check_webrtc_leaks), NULL);
-    g_signal_connect(ip_rotator_item, "activate", G_CALLBACK(show_ip_rotator), tab);
-
-    // Set popup menu for menu button
-    gtk_menu_button_set_popup(GTK_MENU_BUTTON(tab->menu_button), popup_menu);
-
-    // Add menu button to hbox
-    gtk_box_pack_end(GTK_BOX(hbox), tab->menu_button, FALSE, FALSE, 0);
-
-    // Remove the old buttons we're replacing
-    gtk_widget_destroy(tab->dev_tools_button);
-    tab->dev_tools_button = NULL;
-
-    gtk_widget_show_all(popup_menu);
-
-    // Store history reference
-    tab->history = history;
-
-    // Create mode submenu
-    GtkWidget* mode_menu = gtk_menu_new();
-    GtkWidget* mode_item = gtk_menu_item_new_with_label("Mode");
-    gtk_menu_item_set_submenu(GTK_MENU_ITEM(mode_item), mode_menu);
-
-    GtkWidget
-    InterceptData* intercept_data = g_new0(InterceptData, 1);
-    intercept_data->enabled = FALSE;
-    intercept_data->window = NULL;
-    intercept_data->request_buffer = NULL;
-    intercept_data->response_buffer = NULL;
-    intercept_data->req_headers_buffer = NULL;
-    intercept_data->resp_headers_buffer = NULL;
-    intercept_data->pending_requests = NULL;
-    intercept_data->current_resource = NULL;
-    intercept_data->request_modified = FALSE;
-    g_object_set_data(G_OBJECT(notebook), "intercept_data", intercept_data);
-    
-    // Initialize browser data
-    BrowserData* browser_data = g_new0(BrowserData, 1);
-    browser_data->history = g_new0(BrowserHistory, 1);
-    browser_data->cookies = g_new0(BrowserCookies, 1);
-    
-    init_databases(browser_data);
-
-    // Create initial tab
-    BrowserTab* initial_tab = create_browser_tab(intercept_data, browser_data->history);
-    gtk_notebook_append_page(GTK_NOTEBOOK(notebook), initial_tab->container,
-                           create_tab_label("New Tab", GTK_NOTEBOOK(notebook), initial_tab));
-    
-    g_signal_connect_swapped(window, "destroy", G_CALLBACK(cleanup_intercept_data), intercept_data);
-    g_signal_connect_swapped(window, "destroy", G_CALLBACK(cleanup_browser_data), browser_data);
-    
-    gtk_widget_show_all(window);
-    gtk_main();
-    
-    return 0;
-}
-
-// Add after the other function implementations, before main():
-
-static void create_vpn_menu(BrowserTab* tab, GtkWidget* popup_menu) {
-    // Create VPN submenu
-    GtkWidget* vpn_menu = gtk_menu_new();
-    GtkWidget* vpn_item = gtk_menu_item_new_with_label("VPN");
-    gtk_menu_item_set_submenu(GTK_MENU_ITEM(vpn_item), vpn_menu);
-
-    // Initialize VPN connection structure
-    tab->vpn = g_new0(VPNConnection, 1);
-    tab->vpn->connected = FALSE;
-    tab->vpn->config_file = NULL;
-    tab->vpn->last_error = NULL;
-
-    // Create VPN connect submenu
-    GtkWidget* connect_menu = gtk_menu_new();
-    GtkWidget* connect_item = gtk_menu_item_new_with_label("Connect VPN");
-    gtk_menu_item_set_submenu(GTK_MENU_ITEM(connect_item), connect_menu);
-
-    // Add items to connect submenu
-    GtkWidget* load_config = gtk_menu_item_new_with_label("Load Config File");
-    GtkWidget* start_connection = gtk_menu_item_new_with_label("Start Connection");
-    gtk_menu_shell_append(GTK_MENU_SHELL(connect_menu), load_config);
-    gtk_menu_shell_append(GTK_MENU_SHELL(connect_menu), start_connection);
-
-    // Create other menu items
-    GtkWidget* disconnect_item = gtk_menu_item_new_with_label("Disconnect VPN");
-    GtkWidget* status_item = gtk_menu_item_new_with_label("VPN Status");
-
-    // Add config label
-    tab->vpn->config_label = gtk_label_new("No config loaded");
-    GtkWidget* label_item = gtk_menu_item_new();
-    gtk_container_add(GTK_CONTAINER(label_item), tab->vpn->config_label);
-    gtk_widget_set_sensitive(label_item, FALSE);
-
-    // Add all items to VPN menu
-    gtk_menu_shell_append(GTK_MENU_SHELL(vpn_menu), connect_item);
-    gtk_menu_shell_append(GTK_MENU_SHELL(vpn_menu), label_item);
-    gtk_menu_shell_append(GTK_MENU_SHELL(vpn_menu), gtk_separator_menu_item_new());
-    gtk_menu_shell_append(GTK_MENU_SHELL(vpn_menu), disconnect_item);
-    gtk_menu_shell_append(GTK_MENU_SHELL(vpn_menu), gtk_separator_menu_item_new());
-    gtk_menu_shell_append(GTK_MENU_SHELL(vpn_menu), status_item);
-
-    // Connect signals
-    g_signal_connect(load_config, "activate", G_CALLBACK(load_vpn_config), tab->vpn);
-    g_signal_connect(start_connection, "activate", G_CALLBACK(init_vpn_connection), tab->vpn);
-    g_signal_connect(disconnect_item, "activate", G_CALLBACK(cleanup_vpn), tab->vpn);
-    g_signal_connect(status_item, "activate", G_CALLBACK(show_vpn_status), tab->vpn);
-
-    // Add VPN menu to main popup menu
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), vpn_item);
-    gtk_widget_show_all(vpn_menu);
-}
-
-// Add before create_vpn_menu function:
-
 static gboolean check_openvpn_installed(void) {
     return system("which openvpn > /dev/null 2>&1") == 0;
 }
@@ -1826,7 +6664,14 @@ static void on_vpn_exit(GPid pid, gint status, VPNConnection* vpn) {
     vpn->connected = FALSE;
     g_spawn_close_pid(pid);
     vpn->vpn_pid = 0;
+    vpn->watch_id = 0;
     g_free(vpn->last_error);
+    vpn->last_error = NULL;
+
+    if (vpn->orphaned) {
+        g_free(vpn);
+        return;
+    }
     
     if (WIFEXITED(status)) {
         vpn->last_error = g_strdup_printf("VPN process exited with status %d", WEXITSTATUS(status));
@@ -1897,7 +6742,7 @@ static gboolean init_vpn_connection(VPNConnection* vpn) {
         vpn->connected = TRUE;
         g_free(vpn->last_error);
         vpn->last_error = NULL;
-        g_child_watch_add(vpn->vpn_pid, (GChildWatchFunc)on_vpn_exit, vpn);
+        vpn->watch_id = g_child_watch_add(vpn->vpn_pid, (GChildWatchFunc)on_vpn_exit, vpn);
     } else {
         g_free(vpn->last_error);
         vpn->last_error = g_strdup(error->message);
@@ -1921,6 +6766,21 @@ static void cleanup_vpn(VPNConnection* vpn) {
     vpn->config_file = NULL;
 }
 
+// Stop the connection and free it. While OpenVPN is still exiting, the child
+// watch owns the struct and frees it in on_vpn_exit().
+static void vpn_free(VPNConnection* vpn) {
+    if (!vpn) return;
+
+    gboolean exiting = vpn->watch_id != 0;
+    cleanup_vpn(vpn);
+    if (exiting) {
+        vpn->orphaned = TRUE;
+        return;
+    }
+    g_free(vpn->last_error);
+    g_free(vpn);
+}
+
 static void show_vpn_status(GtkMenuItem* menuitem, gpointer user_data) {
     VPNConnection* vpn = (VPNConnection*)user_data;
     
@@ -1943,10 +6803,94 @@ static void load_vpn_config(GtkMenuItem* menuitem, VPNConnection* vpn);
 static gboolean init_vpn_connection(VPNConnection* vpn);
 static void cleanup_vpn(VPNConnection* vpn);
 static void show_vpn_status(GtkMenuItem* menuitem, gpointer user_data);
-static void create_vpn_menu(BrowserTab* tab, GtkWidget* popup_menu);
+
+// Soak run (--soak N). Opens and closes N tabs the way the "+" and close
+// buttons do, printing this process's VmRSS and its children's (web and
+// network processes) every SOAK_REPORT_EVERY tabs, then closes the window.
+// Combine with --ram-only to leave the profile alone.
+#define SOAK_REPORT_EVERY 100
+#define SOAK_CYCLE_MS 50     // between an open and its close, and the next open
+
+typedef struct {
+    GtkNotebook* notebook;
+    guint cycles;
+    guint done;
+    BrowserTab* tab;          // Opened and not yet closed
+    gint64 open_us;           // Total time spent in on_new_tab_clicked()
+    gint64 base_rss_kb;
+} SoakRun;
+
+static void soak_report(SoakRun* soak) {
+    gint64 rss_kb = -1, pss_kb = -1, children_kb = 0;
+    proc_read_memory(getpid(), &rss_kb, &pss_kb);
+
+    GHashTable* no_ticks = g_hash_table_new(g_direct_hash, g_direct_equal);
+    GPtrArray* children = resource_monitor_sample(no_ticks, 0, 100);
+    for (guint i = 0; i < children->len; i++) {
+        ProcSample* sample = g_ptr_array_index(children, i);
+        if (sample->rss_kb > 0) children_kb += sample->rss_kb;
+    }
+
+    if (soak->done == 0) soak->base_rss_kb = rss_kb;
+    fprintf(stderr, "Soak: %u/%u tabs, VmRSS %" G_GINT64_FORMAT " kB (%+" G_GINT64_FORMAT "), "
+            "%u child processes %" G_GINT64_FORMAT " kB, new tab %.2f ms avg\n",
+            soak->done, soak->cycles, rss_kb, rss_kb - soak->base_rss_kb, children->len, children_kb,
+            soak->done ? soak->open_us / 1000.0 / soak->done : 0.0);
+
+    g_ptr_array_unref(children);
+    g_hash_table_unref(no_ticks);
+}
+
+static gboolean soak_step(gpointer data) {
+    SoakRun* soak = (SoakRun*)data;
+
+    if (!soak->tab) {
+        gint64 start = g_get_monotonic_time();
+        on_new_tab_clicked(NULL, soak->notebook);
+        soak->open_us += g_get_monotonic_time() - start;
+        soak->tab = tab_ref(notebook_page_tab(soak->notebook, gtk_notebook_get_current_page(soak->notebook)));
+        return G_SOURCE_CONTINUE;
+    }
+
+    tab_close(soak->tab);
+    tab_unref(soak->tab);
+    soak->tab = NULL;
+    soak->done++;
+    if (soak->done % SOAK_REPORT_EVERY == 0 || soak->done == soak->cycles) {
+        soak_report(soak);
+    }
+    if (soak->done < soak->cycles) return G_SOURCE_CONTINUE;
+
+    gtk_window_close(GTK_WINDOW(gtk_widget_get_toplevel(GTK_WIDGET(soak->notebook))));
+    return G_SOURCE_REMOVE;
+}
+
+static void soak_start(GtkNotebook* notebook, guint cycles) {
+    SoakRun* soak = g_new0(SoakRun, 1);
+    soak->notebook = notebook;
+    soak->cycles = cycles;
+    soak_report(soak);
+    g_timeout_add_full(G_PRIORITY_DEFAULT, SOAK_CYCLE_MS, soak_step, soak, g_free);
+}
 
 int main(int argc, char* argv[]) {
-    gtk_init(&argc, &argv);
+    static gboolean ram_only = FALSE;
+    static gint soak = 0;
+    static const GOptionEntry options[] = {
+        { "ram-only", 0, 0, G_OPTION_ARG_NONE, &ram_only,
+          "Keep the whole profile in memory and write nothing to disk", NULL },
+        { "soak", 0, 0, G_OPTION_ARG_INT, &soak,
+          "Open and close N tabs, printing memory use, then quit", "N" },
+        { NULL }
+    };
+    GError* error = NULL;
+    if (!gtk_init_with_args(&argc, &argv, NULL, options, NULL, &error)) {
+        fprintf(stderr, "%s\n", error->message);
+        g_error_free(error);
+        return 1;
+    }
+    // curl_easy_init() is not thread-safe until this has run; suggestions use worker threads
+    curl_global_init(CURL_GLOBAL_DEFAULT);
     
     // Create and initialize InterceptData
     InterceptData* intercept_data = g_new0(InterceptData, 1);
@@ -2009,198 +6953,50 @@ int main(int argc, char* argv[]) {
     // Show all widgets
     gtk_widget_show_all(new_tab_button);
     
-    // Create intercept data// Update create_browser_tab function
-static BrowserTab* create_browser_tab(InterceptData* intercept_data, BrowserHistory* history) {
-    BrowserTab* tab = g_new0(BrowserTab, 1); // Initialize all fields to 0
-    
-    // Create WebView first so it's available for button callbacks
-    tab->webview = WEBKIT_WEB_VIEW(webkit_web_view_new());
-    
-    // Create container and controls
-    tab->container = gtk_box_new(GTK_ORIENTATION_VERTICAL, 5);
-    GtkWidget* hbox = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 5);
-    gtk_box_pack_start(GTK_BOX(tab->container), hbox, FALSE, FALSE, 0);
-    
-    // Create search engine combo
-    tab->search_engine_combo = GTK_COMBO_BOX_TEXT(gtk_combo_box_text_new());
-    gtk_combo_box_text_append_text(tab->search_engine_combo, "Google");
-    gtk_combo_box_text_append_text(tab->search_engine_combo, "Bing");
-    gtk_combo_box_text_append_text(tab->search_engine_combo, "DuckDuckGo");
-    gtk_combo_box_text_append_text(tab->search_engine_combo, "Yahoo");
-    gtk_combo_box_set_active(GTK_COMBO_BOX(tab->search_engine_combo), 0);
-    gtk_box_pack_start(GTK_BOX(hbox), GTK_WIDGET(tab->search_engine_combo), FALSE, FALSE, 0);
-    
-    // Create URL entry
-    tab->url_entry = gtk_entry_new();
-    gtk_box_pack_start(GTK_BOX(hbox), tab->url_entry, TRUE, TRUE, 0);
-    
-    // Create navigation buttons
-    GtkWidget* back_button = gtk_button_new_with_label("Back");
-    GtkWidget* forward_button = gtk_button_new_with_label("Forward");
-    GtkWidget* home_button = gtk_button_new_with_label("Home");
-    GtkWidget* search_button = gtk_button_new_with_label("Search");
-    tab->dev_tools_button = gtk_button_new_with_label("Dev Tools");  // Add dev tools button
-    
-    gtk_box_pack_start(GTK_BOX(hbox), back_button, FALSE, FALSE, 0);
-    gtk_box_pack_start(GTK_BOX(hbox), forward_button, FALSE, FALSE, 0);
-    gtk_box_pack_start(GTK_BOX(hbox), home_button, FALSE, FALSE, 0);
-    gtk_box_pack_start(GTK_BOX(hbox), search_button, FALSE, FALSE, 0);
-    gtk_box_pack_start(GTK_BOX(hbox), tab->dev_tools_button, FALSE, FALSE, 0);  // Add to layout
-
-    // Store references for callbacks
-    g_object_set_data(G_OBJECT(tab->url_entry), "webview", tab->webview);
-    g_object_set_data(G_OBJECT(tab->url_entry), "search_engine_combo", tab->search_engine_combo);
-
-    // Connect button signals
-    g_signal_connect_swapped(back_button, "clicked", G_CALLBACK(webkit_web_view_go_back), tab->webview);
-    g_signal_connect_swapped(forward_button, "clicked", G_CALLBACK(webkit_web_view_go_forward), tab->webview);
-    g_signal_connect(home_button, "clicked", G_CALLBACK(on_home_button_clicked), tab->webview);
-    g_signal_connect(search_button, "clicked", G_CALLBACK(on_search_button_clicked), tab->url_entry);
-    g_signal_connect(tab->url_entry, "activate", G_CALLBACK(on_url_entry_activate), tab->webview);
-
-    // Add webview to container
-    gtk_box_pack_start(GTK_BOX(tab->container), GTK_WIDGET(tab->webview), TRUE, TRUE, 0);
-    
-    // Connect WebKit signals 
-    g_signal_connect(tab->webview, "load-changed", G_CALLBACK(on_load_changed), tab);
-    g_signal_connect(tab->webview, "resource-load-started", G_CALLBACK(on_resource_load_started), intercept_data);
-    g_signal_connect(tab->webview, "resource-response-received", G_CALLBACK(on_resource_response_received), intercept_data);
-
-    // Load default page
-    webkit_web_view_load_uri(tab->webview, "https://www.google.com");
-
-    // Enable developer extras
-    WebKitSettings* settings = webkit_web_view_get_settings(tab->webview);
-    webkit_settings_set_enable_developer_extras(settings, TRUE);
-
-    // Connect dev tools button signal
-    g_signal_connect(tab->dev_tools_button, "clicked", G_CALLBACK(on_dev_tools_clicked), tab->webview);
-
-    // Inside create_browser_tab function, after creating other buttons:
-
-    // Create menu button (three dots)
-    tab->menu_button = gtk_menu_button_new();
-    GtkWidget* menu_image = gtk_image_new_from_icon_name("view-more-symbolic", GTK_ICON_SIZE_BUTTON);
-    gtk_button_set_image(GTK_BUTTON(tab->menu_button), menu_image);
-
-    // Create popup menu
-    GtkWidget* popup_menu = gtk_menu_new();
-
-    // Add VPN menu first (before other menu items)
-    GtkWidget* vpn_menu = gtk_menu_new();
-    GtkWidget* vpn_item = gtk_menu_item_new_with_label("VPN");
-    gtk_menu_item_set_submenu(GTK_MENU_ITEM(vpn_item), vpn_menu);
-
-    // VPN menu items
-    GtkWidget* vpn_connect = gtk_menu_item_new_with_label("Connect VPN");
-    GtkWidget* vpn_disconnect = gtk_menu_item_new_with_label("Disconnect VPN");
-    GtkWidget* vpn_status = gtk_menu_item_new_with_label("VPN Status");
-    GtkWidget* vpn_settings = gtk_menu_item_new_with_label("VPN Settings");
-
-    // Add items to VPN submenu
-    gtk_menu_shell_append(GTK_MENU_SHELL(vpn_menu), vpn_connect);
-    gtk_menu_shell_append(GTK_MENU_SHELL(vpn_menu), vpn_disconnect);
-    gtk_menu_shell_append(GTK_MENU_SHELL(vpn_menu), gtk_separator_menu_item_new());
-    gtk_menu_shell_append(GTK_MENU_SHELL(vpn_menu), vpn_status);
-    gtk_menu_shell_append(GTK_MENU_SHELL(vpn_menu), vpn_settings);
-
-    // Initialize VPN connection structure
-    tab->vpn = g_new0(VPNConnection, 1);
-    tab->vpn->connected = FALSE;
-    tab->vpn->config_file = NULL;
-    tab->vpn->last_error = NULL;
-
-    // Add VPN menu item to main popup menu (before other items)
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), vpn_item);
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), gtk_separator_menu_item_new());
-
-    // Connect VPN signals
-    g_signal_connect(vpn_connect, "activate", G_CALLBACK(init_vpn_connection), tab->vpn);
-    g_signal_connect(vpn_disconnect, "activate", G_CALLBACK(cleanup_vpn), tab->vpn);
-    g_signal_connect(vpn_status, "activate", G_CALLBACK(show_vpn_status), tab->vpn);
-
-    // Add menu items
-    GtkWidget* dev_tools_item = gtk_menu_item_new_with_label("Developer Tools");
-    GtkWidget* history_item = gtk_menu_item_new_with_label("History");
-    GtkWidget* downloads_item = gtk_menu_item_new_with_label("Downloads");  // Add downloads item
-    GtkWidget* intercept_item = gtk_menu_item_new_with_label("Intercept");
-    GtkWidget* light_mode_item = gtk_menu_item_new_with_label("Light Mode");
-    GtkWidget* dark_mode_item = gtk_menu_item_new_with_label("Dark Mode");
-    GtkWidget* matrix_mode_item = gtk_menu_item_new_with_label("Matrix Mode");
-    GtkWidget* webrtc_leak_item = gtk_menu_item_new_with_label("WebRTC Leak Check");
-    GtkWidget* ip_rotator_item = gtk_menu_item_new_with_label("IP Rotator");
-
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), dev_tools_item);
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), history_item);
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), downloads_item);  // Add to menu
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), intercept_item);
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), light_mode_item);
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), dark_mode_item);
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), matrix_mode_item);
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), webrtc_leak_item);
-    gtk_menu_shell_append(GTK_MENU_SHELL(popup_menu), ip_rotator_item);
-
-    // Connect signals
-    g_signal_connect(dev_tools_item, "activate", G_CALLBACK(on_dev_tools_clicked), tab->webview);
-    g_signal_connect(history_item, "activate", G_CALLBACK(show_history_window), history);
-    g_signal_connect(downloads_item, "activate", G_CALLBACK(show_downloads_window), NULL);  // Add callback
-    g_signal_connect(intercept_item, "activate", G_CALLBACK(on_intercept_toggled), intercept_data);
-    g_signal_connect(light_mode_item, "activate", G_CALLBACK(switch_mode), tab);
-    g_signal_connect(dark_mode_item, "activate", G_CALLBACK(switch_mode), tab);
-    g_signal_connect(matrix_mode_item, "activate", G_CALLBACK(switch_mode), tab);
-    g_signal_connect(webrtc_leak_item, "activate", G_CALLBACK(check_webrtc_leaks), NULL);
-    g_signal_connect(ip_rotator_item, "activate", G_CALLBACK(show_ip_rotator), tab);
-
-    // Set popup menu for menu button
-    gtk_menu_button_set_popup(GTK_MENU_BUTTON(tab->menu_button), popup_menu);
-
-    // Add menu button to hbox
-    gtk_box_pack_end(GTK_BOX(hbox), tab->menu_button, FALSE, FALSE, 0);
-
-    // Remove the old buttons we're replacing
-    gtk_widget_destroy(tab->dev_tools_button);
-    tab->dev_tools_button = NULL;
-
-    gtk_widget_show_all(popup_menu);
-
-    // Store history reference
-    tab->history = history;
-
-    // Create mode submenu
-    GtkWidget* mode_menu = gtk_menu_new();
-    GtkWidget* mode_item = gtk_menu_item_new_with_label("Mode");
-    gtk_menu_item_set_submenu(GTK_MENU_ITEM(mode_item), mode_menu);
-
-    GtkWidget
-    InterceptData* intercept_data = g_new0(InterceptData, 1);
-    intercept_data->enabled = FALSE;
-    intercept_data->window = NULL;
-    intercept_data->request_buffer = NULL;
-    intercept_data->response_buffer = NULL;
-    intercept_data->req_headers_buffer = NULL;
-    intercept_data->resp_headers_buffer = NULL;
-    intercept_data->pending_requests = NULL;
-    intercept_data->current_resource = NULL;
-    intercept_data->request_modified = FALSE;
     g_object_set_data(G_OBJECT(notebook), "intercept_data", intercept_data);
+    browser_install_actions(window, GTK_NOTEBOOK(notebook));
     
-    // Initialize browser data
+    // Initialize browser data. The databases are opened on the storage
+    // I/O thread, so this returns immediately.
     BrowserData* browser_data = g_new0(BrowserData, 1);
+    browser_data->storage = storage_new(ram_only ? NULL : ".");
+    browser_data->settings = settings_new(browser_data->storage);
+    browser_data->bookmarks = bookmarks_new(browser_data->storage);
+    browser_data->dns = dns_cache_new();
+    browser_data->prefetch = prefetch_stats_new();
+    browser_data->suggest = suggest_cache_new();
+    browser_data->prerender_stats = prerender_stats_new();
+    browser_data->view_pool = webview_pool_new(browser_data);
+    browser_data->monitor = resource_monitor_new(browser_data);
+    browser_data->themes = theme_engine_new(browser_data);
+    browser_data->blocker = content_blocker_new(browser_data->storage);
+    browser_data->policies = site_policies_new(browser_data);
     browser_data->history = g_new0(BrowserHistory, 1);
+    browser_data->history->storage = browser_data->storage;
     browser_data->cookies = g_new0(BrowserCookies, 1);
-    
-    init_databases(browser_data);
-
-    // Create initial tab
-    BrowserTab* initial_tab = create_browser_tab(intercept_data, browser_data->history);
-    gtk_notebook_append_page(GTK_NOTEBOOK(notebook), initial_tab->container,
-                           create_tab_label("New Tab", GTK_NOTEBOOK(notebook), initial_tab));
+    browser_data->cookies->storage = browser_data->storage;
+    intercept_data->cookies = browser_data->cookies;
+    g_object_set_data(G_OBJECT(notebook), "browser_data", browser_data);
+    history_retention_start(browser_data->history);
+
+    // Tabs come from the saved session (or a fresh one) once it is loaded
+    browser_data->session = session_new(browser_data, GTK_NOTEBOOK(notebook));
+    g_signal_connect(notebook, "switch-page", G_CALLBACK(on_notebook_switch_page), browser_data);
+    g_signal_connect(window, "delete-event", G_CALLBACK(on_main_window_delete), browser_data);
+    session_restore(browser_data->session);
+    browser_data->hibernation = hibernation_new(browser_data, GTK_NOTEBOOK(notebook));
+    hibernation_start(browser_data->hibernation);
     
     g_signal_connect_swapped(window, "destroy", G_CALLBACK(cleanup_intercept_data), intercept_data);
     g_signal_connect_swapped(window, "destroy", G_CALLBACK(cleanup_browser_data), browser_data);
+    g_signal_connect(window, "destroy", G_CALLBACK(gtk_main_quit), NULL);
     
     gtk_widget_show_all(window);
+    if (soak > 0) {
+        soak_start(GTK_NOTEBOOK(notebook), (guint)soak);
+    }
     gtk_main();
-    
+
+    curl_global_cleanup();
     return 0;
 }
@@ -0,0 +1,218 @@
+// URL-entry input classification and Public Suffix List lookups. These only
+// need GLib, so tests/omnibox_test.c and tests/omnibox_bench.c build them
+// without GTK or WebKit. Everything is static; include this once per program.
+#ifndef ROCKET_OMNIBOX_H
+#define ROCKET_OMNIBOX_H
+
+#include <string.h>
+#include <glib.h>
+
+#include "psl_table.h"  // Generated by tools/gen_psl_table.py
+
+// Public Suffix List lookups over the generated perfect hash in psl_table.h.
+// Hosts are classified by walking their suffixes right to left in one pass;
+// results point into the caller's string, nothing is allocated.
+static guint32 psl_hash(const char* s, gsize len, guint32 seed) {
+    guint32 h = 2166136261u ^ seed;
+    for (gsize i = 0; i < len; i++) {
+        h ^= (guchar)g_ascii_tolower(s[i]);
+        h *= 16777619u;
+    }
+    return h;
+}
+
+// PSL_* flags of the rule for the len bytes at s, or 0 if there is none
+static guint psl_flags(const char* s, gsize len) {
+    guint32 seed = psl_seeds[psl_hash(s, len, 0) % PSL_BUCKETS];
+    const PslSlot* slot = &psl_slots[psl_hash(s, len, seed) % PSL_SLOTS];
+    if (slot->length != len || g_ascii_strncasecmp(psl_strings + slot->offset, s, len) != 0) {
+        return 0;
+    }
+    return slot->flags;
+}
+
+// Public suffix of host (without a trailing dot), as a pointer into host.
+// explicit_rule is set when a listed rule matched rather than the implicit
+// "*" rule that makes any unknown TLD a suffix.
+static const char* psl_public_suffix(const char* host, gsize len, gboolean* explicit_rule) {
+    const char* end = host + len;
+    const char* suffix = end;
+    gboolean parent_wildcard = FALSE;
+    gboolean matched = FALSE;
+
+    // Each iteration extends the candidate by one label to the left
+    for (const char* p = end; p > host; ) {
+        const char* start = p - 1;
+        while (start > host && *(start - 1) != '.') start--;
+        guint flags = psl_flags(start, end - start);
+
+        if (flags & PSL_EXCEPTION) {
+            // "!www.ck": the public suffix is the exception's parent
+            suffix = p < end ? p + 1 : end;
+            matched = TRUE;
+            break;
+        }
+        if ((flags & PSL_RULE) || parent_wildcard || p == end) {
+            suffix = start;
+            matched = matched || (flags & PSL_RULE) || parent_wildcard;
+        }
+        parent_wildcard = (flags & PSL_WILDCARD) != 0;
+        p = start > host ? start - 1 : host;
+    }
+
+    if (explicit_rule) *explicit_rule = matched;
+    return suffix;
+}
+
+// Registrable domain (public suffix plus one label) as a pointer into host.
+// Returns host itself when it is a bare public suffix, an IP literal or has
+// no dots, so it is always usable as a grouping key.
+static const char* psl_registrable_domain(const char* host) {
+    while (*host == '.') host++;
+
+    gsize len = strlen(host);
+    if (len > 0 && host[len - 1] == '.') len--;
+    if (g_hostname_is_ip_address(host)) return host;
+
+    const char* suffix = psl_public_suffix(host, len, NULL);
+    if (suffix <= host + 1) return host;
+
+    const char* p = suffix - 2;   // Skip the dot before the suffix
+    while (p > host && *(p - 1) != '.') p--;
+    return p;
+}
+
+// Whether the len bytes at host name something under a listed public
+// suffix, e.g. "example.co.uk" or "foo.dev" but not "co.uk" or "foo.bar"
+static gboolean psl_is_registrable_host(const char* host, gsize len) {
+    if (len == 0 || host[0] == '.' || !memchr(host, '.', len)) return FALSE;
+
+    gboolean explicit_rule = FALSE;
+    const char* suffix = psl_public_suffix(host, len, &explicit_rule);
+    return explicit_rule && suffix > host + 1;
+}
+
+// Omnibox input classification. A single left-to-right scan of the text
+// decides what was typed; the host span points into the input, nothing is
+// allocated, so this is cheap enough to run on every keystroke.
+typedef enum {
+    OMNIBOX_SEARCH,       // Anything else: handed to the search engine
+    OMNIBOX_URL,          // Has a scheme: http://..., about:blank, file:/...
+    OMNIBOX_HOST,         // Name under a public suffix, optionally port/path
+    OMNIBOX_HOST_PORT,    // localhost or an intranet name with an explicit port
+    OMNIBOX_IP,           // IPv4 or bracketed IPv6 literal
+    OMNIBOX_LOCAL_PATH    // Absolute or ~/ path to a local file
+} OmniboxInputType;
+
+typedef struct {
+    OmniboxInputType type;
+    const char* host;         // Host span for HOST, HOST_PORT and IP
+    gsize host_len;
+} OmniboxInput;
+
+// Schemes that are URLs even without "//"
+static const char* const OMNIBOX_OPAQUE_SCHEMES[] = {
+    "about", "data", "file", "view-source", "blob", "mailto", NULL
+};
+
+static gboolean omnibox_opaque_scheme(const char* scheme, gsize len) {
+    for (int i = 0; OMNIBOX_OPAQUE_SCHEMES[i]; i++) {
+        if (strlen(OMNIBOX_OPAQUE_SCHEMES[i]) == len &&
+            g_ascii_strncasecmp(OMNIBOX_OPAQUE_SCHEMES[i], scheme, len) == 0) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+static OmniboxInputType omnibox_classify(const char* text, OmniboxInput* input) {
+    const char* p = text;
+    input->host = NULL;
+    input->host_len = 0;
+
+    while (g_ascii_isspace(*p)) p++;
+    if (*p == '\0') return input->type = OMNIBOX_SEARCH;
+    if (*p == '/' || (*p == '~' && (p[1] == '/' || p[1] == '\0'))) {
+        return input->type = OMNIBOX_LOCAL_PATH;
+    }
+
+    const char* host = p;
+    gboolean bracketed = *p == '[';
+    gboolean closed = FALSE;
+    gboolean scheme_chars = g_ascii_isalpha(*p);
+    gboolean hostname_chars = TRUE;
+    gboolean ipv4 = TRUE;
+    guint dots = 0, octet = 0, octet_digits = 0;
+
+    // Host (or scheme) part: stops at the first port, path, query or fragment
+    for (p += bracketed; *p; p++) {
+        char c = *p;
+        if (bracketed) {
+            if (c == ']') {
+                closed = TRUE;
+                p++;
+                break;
+            }
+            if (!g_ascii_isxdigit(c) && c != ':' && c != '.') return input->type = OMNIBOX_SEARCH;
+            continue;
+        }
+        if (c == ':' || c == '/' || c == '?' || c == '#') break;
+        if (g_ascii_isspace(c)) return input->type = OMNIBOX_SEARCH;
+
+        if (c == '.') {
+            if (octet_digits == 0 || octet > 255) ipv4 = FALSE;
+            octet = octet_digits = 0;
+            dots++;
+        } else if (g_ascii_isdigit(c)) {
+            octet = octet * 10 + (c - '0');
+            if (++octet_digits > 3) ipv4 = FALSE;
+        } else {
+            ipv4 = FALSE;
+            if (!g_ascii_isalnum(c) && c != '-' && c != '_') hostname_chars = FALSE;
+            if (c != '+' && c != '-' && !g_ascii_isalnum(c)) scheme_chars = FALSE;
+        }
+    }
+    if (bracketed && !closed) return input->type = OMNIBOX_SEARCH;
+
+    gsize host_len = p - host;
+    gboolean has_port = FALSE;
+
+    if (*p == ':') {
+        const char* q = p + 1;
+        guint port = 0, digits = 0;
+        while (g_ascii_isdigit(*q) && digits < 6) port = port * 10 + (*q++ - '0'), digits++;
+
+        if (digits > 0 && digits <= 5 && port <= 65535 &&
+            (*q == '\0' || *q == '/' || *q == '?' || *q == '#')) {
+            has_port = TRUE;
+        } else if (scheme_chars && !bracketed && host_len > 0) {
+            // "scheme://..." or a scheme that needs no authority
+            if ((p[1] == '/' && p[2] == '/') || omnibox_opaque_scheme(host, host_len)) {
+                return input->type = OMNIBOX_URL;
+            }
+            return input->type = OMNIBOX_SEARCH;
+        } else {
+            return input->type = OMNIBOX_SEARCH;
+        }
+    }
+
+    input->host = host;
+    input->host_len = host_len;
+    if (host_len > 0 && host[host_len - 1] == '.') host_len--;
+
+    if (bracketed || (ipv4 && dots == 3 && octet_digits > 0 && octet <= 255)) {
+        return input->type = OMNIBOX_IP;
+    }
+    if (!hostname_chars || host_len == 0) {
+        return input->type = OMNIBOX_SEARCH;
+    }
+    if (psl_is_registrable_host(host, host_len)) {
+        return input->type = OMNIBOX_HOST;
+    }
+    if (has_port || (host_len == 9 && g_ascii_strncasecmp(host, "localhost", 9) == 0)) {
+        return input->type = OMNIBOX_HOST_PORT;
+    }
+    return input->type = OMNIBOX_SEARCH;
+}
+
+#endif
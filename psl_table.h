@@ -0,0 +1,22670 @@
+// Generated by tools/gen_psl_table.py from the Public Suffix List. Do not edit.
+// 9972 rules, 12466 slots, 2494 buckets.
+
+#define PSL_RULE 1
+#define PSL_WILDCARD 2
+#define PSL_EXCEPTION 4
+
+#define PSL_BUCKETS 2494
+#define PSL_SLOTS 12466
+
+typedef struct {
+    unsigned int offset;
+    unsigned char length;   // 0 marks an empty slot
+    unsigned char flags;
+} PslSlot;
+
+static const char psl_strings[] =
+    "0.bg"
+    "001www.com"
+    "0e.vc"
+    "0emm.com"
+    "1.azurestaticapps.net"
+    "1.bg"
+    "123hjemmeside.dk"
+    "123hjemmeside.no"
+    "123homepage.it"
+    "123kotisivu.fi"
+    "123minsida.se"
+    "123miweb.es"
+    "123paginaweb.pt"
+    "123sait.ru"
+    "123siteweb.fr"
+    "123webseite.at"
+    "123webseite.de"
+    "123website.be"
+    "123website.ch"
+    "123website.lu"
+    "123website.nl"
+    "12hp.at"
+    "12hp.ch"
+    "12hp.de"
+    "1337.pictures"
+    "16-b.it"
+    "1kapp.com"
+    "2.azurestaticapps.net"
+    "2.bg"
+    "2000.hu"
+    "2038.io"
+    "2ix.at"
+    "2ix.ch"
+    "2ix.de"
+    "3.bg"
+    "32-b.it"
+    "3utilities.com"
+    "4.bg"
+    "4lima.at"
+    "4lima.ch"
+    "4lima.de"
+    "4u.com"
+    "5.bg"
+    "5g.in"
+    "6.bg"
+    "611.to"
+    "64-b.it"
+    "6g.in"
+    "7.bg"
+    "8.bg"
+    "9.bg"
+    "9guacu.br"
+    "a.bg"
+    "a.prod.fastly.net"
+    "a.run.app"
+    "a.se"
+    "a.ssl.fastly.net"
+    "aa.no"
+    "aaa"
+    "aaa.pro"
+    "aarborte.no"
+    "aarp"
+    "ab.ca"
+    "abarth"
+    "abashiri.hokkaido.jp"
+    "abb"
+    "abbott"
+    "abbvie"
+    "abc"
+    "abc.br"
+    "abeno.osaka.jp"
+    "abiko.chiba.jp"
+    "abira.hokkaido.jp"
+    "abkhazia.su"
+    "able"
+    "abo.pa"
+    "abogado"
+    "abr.it"
+    "abruzzo.it"
+    "abu.yamaguchi.jp"
+    "abudhabi"
+    "ac"
+    "ac.ae"
+    "ac.at"
+    "ac.be"
+    "ac.ci"
+    "ac.cn"
+    "ac.cr"
+    "ac.cy"
+    "ac.fj"
+    "ac.gn"
+    "ac.gov.br"
+    "ac.id"
+    "ac.il"
+    "ac.im"
+    "ac.in"
+    "ac.ir"
+    "ac.jp"
+    "ac.ke"
+    "ac.kr"
+    "ac.leg.br"
+    "ac.lk"
+    "ac.ls"
+    "ac.ma"
+    "ac.me"
+    "ac.mu"
+    "ac.mw"
+    "ac.mz"
+    "ac.ni"
+    "ac.nz"
+    "ac.pa"
+    "ac.pr"
+    "ac.rs"
+    "ac.ru"
+    "ac.rw"
+    "ac.se"
+    "ac.sz"
+    "ac.th"
+    "ac.tj"
+    "ac.tz"
+    "ac.ug"
+    "ac.uk"
+    "ac.vn"
+    "ac.za"
+    "ac.zm"
+    "ac.zw"
+    "aca.pro"
+    "academia.bo"
+    "academy"
+    "academy.museum"
+    "accenture"
+    "accesscam.org"
+    "accident-investigation.aero"
+    "accident-prevention.aero"
+    "accountant"
+    "accountants"
+    "acct.pro"
+    "achi.nagano.jp"
+    "aco"
+    "act.au"
+    "act.edu.au"
+    "activetrail.biz"
+    "actor"
+    "ad"
+    "ad.jp"
+    "adachi.tokyo.jp"
+    "adimo.co.uk"
+    "adm.br"
+    "adobeaemcloud.com"
+    "adobeaemcloud.net"
+    "adobeio-static.net"
+    "adobeioruntime.net"
+    "ads"
+    "adult"
+    "adult.ht"
+    "adv.br"
+    "adv.mz"
+    "advisor.ws"
+    "adygeya.ru"
+    "adygeya.su"
+    "ae"
+    "ae.org"
+    "aeg"
+    "aejrie.no"
+    "aero"
+    "aero.mv"
+    "aero.tt"
+    "aerobatic.aero"
+    "aeroclub.aero"
+    "aerodrome.aero"
+    "aeroport.fr"
+    "aetna"
+    "af"
+    "affinitylottery.org.uk"
+    "afjord.no"
+    "afl"
+    "africa"
+    "africa.bj"
+    "africa.com"
+    "ag"
+    "ag.it"
+    "aga.niigata.jp"
+    "agakhan"
+    "agano.niigata.jp"
+    "agdenes.no"
+    "agematsu.nagano.jp"
+    "agency"
+    "agents.aero"
+    "agr.br"
+    "agrar.hu"
+    "agric.za"
+    "agriculture.museum"
+    "agrigento.it"
+    "agro.bj"
+    "agro.bo"
+    "agro.pl"
+    "aguni.okinawa.jp"
+    "ah.cn"
+    "ah.no"
+    "ai"
+    "ai.in"
+    "aibetsu.hokkaido.jp"
+    "aichi.jp"
+    "aid.pl"
+    "aig"
+    "aikawa.kanagawa.jp"
+    "ainan.ehime.jp"
+    "aioi.hyogo.jp"
+    "aip.ee"
+    "air-surveillance.aero"
+    "air-traffic-control.aero"
+    "air.museum"
+    "airbus"
+    "aircraft.aero"
+    "airforce"
+    "airguard.museum"
+    "airkitapps-au.com"
+    "airkitapps.com"
+    "airkitapps.eu"
+    "airline.aero"
+    "airport.aero"
+    "airtel"
+    "airtraffic.aero"
+    "aisai.aichi.jp"
+    "aisho.shiga.jp"
+    "aivencloud.com"
+    "aizubange.fukushima.jp"
+    "aizumi.tokushima.jp"
+    "aizumisato.fukushima.jp"
+    "aizuwakamatsu.fukushima.jp"
+    "aju.br"
+    "ak.us"
+    "akabira.hokkaido.jp"
+    "akadns.net"
+    "akagi.shimane.jp"
+    "akaiwa.okayama.jp"
+    "akamai-staging.net"
+    "akamai.net"
+    "akamaiedge-staging.net"
+    "akamaiedge.net"
+    "akamaihd-staging.net"
+    "akamaihd.net"
+    "akamaiorigin-staging.net"
+    "akamaiorigin.net"
+    "akamaized-staging.net"
+    "akamaized.net"
+    "akashi.hyogo.jp"
+    "akdn"
+    "aki.kochi.jp"
+    "akiruno.tokyo.jp"
+    "akishima.tokyo.jp"
+    "akita.akita.jp"
+    "akita.jp"
+    "akkeshi.hokkaido.jp"
+    "aknoluokta.no"
+    "ako.hyogo.jp"
+    "akrehamn.no"
+    "aktyubinsk.su"
+    "akune.kagoshima.jp"
+    "al"
+    "al.eu.org"
+    "al.gov.br"
+    "al.it"
+    "al.leg.br"
+    "al.no"
+    "al.us"
+    "alabama.museum"
+    "alaheadju.no"
+    "aland.fi"
+    "alaska.museum"
+    "alces.network"
+    "alessandria.it"
+    "alesund.no"
+    "alfaromeo"
+    "algard.no"
+    "alibaba"
+    "alipay"
+    "allfinanz"
+    "allstate"
+    "ally"
+    "alp1.ae.flow.ch"
+    "alpha-myqnapcloud.com"
+    "alpha.bounty-full.com"
+    "alsace"
+    "alstahaug.no"
+    "alstom"
+    "alt.za"
+    "alta.no"
+    "altervista.org"
+    "alto-adige.it"
+    "altoadige.it"
+    "alvdal.no"
+    "alwaysdata.net"
+    "am"
+    "am.br"
+    "am.gov.br"
+    "am.in"
+    "am.leg.br"
+    "ama.aichi.jp"
+    "ama.shimane.jp"
+    "amagasaki.hyogo.jp"
+    "amakusa.kumamoto.jp"
+    "amami.kagoshima.jp"
+    "amazon"
+    "amber.museum"
+    "ambulance.aero"
+    "ambulance.museum"
+    "american.museum"
+    "americana.museum"
+    "americanantiques.museum"
+    "americanart.museum"
+    "americanexpress"
+    "americanfamily"
+    "amex"
+    "amfam"
+    "ami.ibaraki.jp"
+    "amica"
+    "amli.no"
+    "amot.no"
+    "amscompute.com"
+    "amsterdam"
+    "amsterdam.museum"
+    "amusement.aero"
+    "an.it"
+    "analytics"
+    "anamizu.ishikawa.jp"
+    "anan.nagano.jp"
+    "anan.tokushima.jp"
+    "anani.br"
+    "ancona.it"
+    "and.museum"
+    "andasuolo.no"
+    "andebu.no"
+    "ando.nara.jp"
+    "andoy.no"
+    "andria-barletta-trani.it"
+    "andria-trani-barletta.it"
+    "andriabarlettatrani.it"
+    "andriatranibarletta.it"
+    "android"
+    "and\303\270y.no"
+    "angry.jp"
+    "anjo.aichi.jp"
+    "ann-arbor.mi.us"
+    "annaka.gunma.jp"
+    "annefrank.museum"
+    "anpachi.gifu.jp"
+    "anquan"
+    "anthro.museum"
+    "anthropology.museum"
+    "antiques.museum"
+    "anz"
+    "ao"
+    "ao.it"
+    "aogaki.hyogo.jp"
+    "aogashima.tokyo.jp"
+    "aoki.nagano.jp"
+    "aol"
+    "aomori.aomori.jp"
+    "aomori.jp"
+    "aosta-valley.it"
+    "aosta.it"
+    "aostavalley.it"
+    "aoste.it"
+    "ap-northeast-1.elasticbeanstalk.com"
+    "ap-northeast-2.elasticbeanstalk.com"
+    "ap-northeast-3.elasticbeanstalk.com"
+    "ap-south-1.elasticbeanstalk.com"
+    "ap-southeast-1.elasticbeanstalk.com"
+    "ap-southeast-2.elasticbeanstalk.com"
+    "ap.gov.br"
+    "ap.gov.pl"
+    "ap.it"
+    "ap.leg.br"
+    "aparecida.br"
+    "apartments"
+    "api.gov.uk"
+    "api.stdlib.com"
+    "apigee.io"
+    "app"
+    "app.banzaicloud.io"
+    "app.br"
+    "app.gp"
+    "app.lmpm.com"
+    "app.os.fedoraproject.org"
+    "app.os.stg.fedoraproject.org"
+    "app.render.com"
+    "appchizi.com"
+    "appengine.flow.ch"
+    "apple"
+    "applinzi.com"
+    "apps.fbsbx.com"
+    "apps.lair.io"
+    "appspacehosted.com"
+    "appspaceusercontent.com"
+    "appspot.com"
+    "appudo.net"
+    "aq"
+    "aq.it"
+    "aquarelle"
+    "aquarium.museum"
+    "aquila.it"
+    "ar"
+    "ar.com"
+    "ar.it"
+    "ar.us"
+    "arab"
+    "arai.shizuoka.jp"
+    "arakawa.saitama.jp"
+    "arakawa.tokyo.jp"
+    "aramco"
+    "arao.kumamoto.jp"
+    "arboretum.museum"
+    "archaeological.museum"
+    "archaeology.museum"
+    "archi"
+    "architectes.bj"
+    "architecture.museum"
+    "ardal.no"
+    "aremark.no"
+    "arendal.no"
+    "arezzo.it"
+    "ariake.saga.jp"
+    "arida.wakayama.jp"
+    "aridagawa.wakayama.jp"
+    "arita.saga.jp"
+    "arkhangelsk.su"
+    "armenia.su"
+    "army"
+    "arna.no"
+    "arpa"
+    "arq.br"
+    "art"
+    "art.br"
+    "art.do"
+    "art.dz"
+    "art.ht"
+    "art.museum"
+    "art.pl"
+    "art.sn"
+    "artanddesign.museum"
+    "artcenter.museum"
+    "artdeco.museum"
+    "arte"
+    "arte.bo"
+    "arteducation.museum"
+    "artgallery.museum"
+    "arts.co"
+    "arts.museum"
+    "arts.nf"
+    "arts.ro"
+    "arts.ve"
+    "artsandcrafts.museum"
+    "arvo.network"
+    "as"
+    "as.us"
+    "asago.hyogo.jp"
+    "asahi.chiba.jp"
+    "asahi.ibaraki.jp"
+    "asahi.mie.jp"
+    "asahi.nagano.jp"
+    "asahi.toyama.jp"
+    "asahi.yamagata.jp"
+    "asahikawa.hokkaido.jp"
+    "asaka.saitama.jp"
+    "asakawa.fukushima.jp"
+    "asakuchi.okayama.jp"
+    "asaminami.hiroshima.jp"
+    "ascoli-piceno.it"
+    "ascolipiceno.it"
+    "asda"
+    "aseral.no"
+    "ashgabad.su"
+    "ashibetsu.hokkaido.jp"
+    "ashikaga.tochigi.jp"
+    "ashiya.fukuoka.jp"
+    "ashiya.hyogo.jp"
+    "ashoro.hokkaido.jp"
+    "asia"
+    "asker.no"
+    "askim.no"
+    "askoy.no"
+    "askvoll.no"
+    "ask\303\270y.no"
+    "asmatart.museum"
+    "asn.au"
+    "asn.lv"
+    "asnes.no"
+    "aso.kumamoto.jp"
+    "ass.km"
+    "assabu.hokkaido.jp"
+    "assassination.museum"
+    "assisi.museum"
+    "assn.lk"
+    "asso.ci"
+    "asso.dz"
+    "asso.eu.org"
+    "asso.fr"
+    "asso.gp"
+    "asso.ht"
+    "asso.km"
+    "asso.mc"
+    "asso.nc"
+    "asso.re"
+    "associates"
+    "association.aero"
+    "association.museum"
+    "assur.bj"
+    "asti.it"
+    "astronomy.museum"
+    "asuke.aichi.jp"
+    "at"
+    "at-band-camp.net"
+    "at.eu.org"
+    "at.it"
+    "at.md"
+    "at.vg"
+    "atami.shizuoka.jp"
+    "ath.cx"
+    "athleta"
+    "atl.jelastic.vps-host.net"
+    "atlanta.museum"
+    "atm.pl"
+    "ato.br"
+    "atsugi.kanagawa.jp"
+    "atsuma.hokkaido.jp"
+    "attorney"
+    "au"
+    "au.eu.org"
+    "auction"
+    "audi"
+    "audible"
+    "audio"
+    "audnedaln.no"
+    "augustow.pl"
+    "aukra.no"
+    "aure.no"
+    "aurland.no"
+    "aurskog-holand.no"
+    "aurskog-h\303\270land.no"
+    "aus.basketball"
+    "auspost"
+    "austevoll.no"
+    "austin.museum"
+    "australia.museum"
+    "austrheim.no"
+    "authgear-staging.com"
+    "authgearapps.com"
+    "author"
+    "author.aero"
+    "auto"
+    "auto.pl"
+    "autocode.dev"
+    "automotive.museum"
+    "autos"
+    "av.it"
+    "av.tr"
+    "avellino.it"
+    "averoy.no"
+    "aver\303\270y.no"
+    "avianca"
+    "aviation.museum"
+    "avocat.fr"
+    "avocat.pro"
+    "avocats.bj"
+    "avoues.fr"
+    "aw"
+    "awaji.hyogo.jp"
+    "awdev.ca"
+    "aws"
+    "awsglobalaccelerator.com"
+    "awsmppl.com"
+    "ax"
+    "axa"
+    "axis.museum"
+    "aya.miyazaki.jp"
+    "ayabe.kyoto.jp"
+    "ayagawa.kagawa.jp"
+    "ayase.kanagawa.jp"
+    "az"
+    "az.us"
+    "azerbaijan.su"
+    "azimuth.network"
+    "azumino.nagano.jp"
+    "azure"
+    "azure-mobile.net"
+    "azurecontainer.io"
+    "azurestaticapps.net"
+    "azurewebsites.net"
+    "a\303\251roport.ci"
+    "b-data.io"
+    "b.bg"
+    "b.br"
+    "b.se"
+    "b.ssl.fastly.net"
+    "ba"
+    "ba.gov.br"
+    "ba.it"
+    "ba.leg.br"
+    "babia-gora.pl"
+    "baby"
+    "babyblue.jp"
+    "babymilk.jp"
+    "backdrop.jp"
+    "backplaneapp.io"
+    "backyards.banzaicloud.io"
+    "badaddja.no"
+    "badajoz.museum"
+    "baghdad.museum"
+    "bahcavuotna.no"
+    "bahccavuotna.no"
+    "bahn.museum"
+    "baidar.no"
+    "baidu"
+    "bajddar.no"
+    "balashov.su"
+    "balat.no"
+    "bale.museum"
+    "balena-devices.com"
+    "balestrand.no"
+    "ballangen.no"
+    "ballooning.aero"
+    "balsan-sudtirol.it"
+    "balsan-suedtirol.it"
+    "balsan-s\303\274dtirol.it"
+    "balsan.it"
+    "balsfjord.no"
+    "baltimore.museum"
+    "bambina.jp"
+    "bamble.no"
+    "banamex"
+    "bananarepublic"
+    "band"
+    "bandai.fukushima.jp"
+    "bando.ibaraki.jp"
+    "bank"
+    "banzai.cloud"
+    "bar"
+    "bar.pro"
+    "bar0.net"
+    "bar1.net"
+    "bar2.net"
+    "barcelona"
+    "barcelona.museum"
+    "barclaycard"
+    "barclays"
+    "bardu.no"
+    "barefoot"
+    "bargains"
+    "bari.it"
+    "barletta-trani-andria.it"
+    "barlettatraniandria.it"
+    "barrel-of-knowledge.info"
+    "barrell-of-knowledge.info"
+    "barsy.bg"
+    "barsy.ca"
+    "barsy.club"
+    "barsy.co.uk"
+    "barsy.de"
+    "barsy.eu"
+    "barsy.in"
+    "barsy.info"
+    "barsy.io"
+    "barsy.me"
+    "barsy.menu"
+    "barsy.mobi"
+    "barsy.net"
+    "barsy.online"
+    "barsy.org"
+    "barsy.pro"
+    "barsy.pub"
+    "barsy.ro"
+    "barsy.shop"
+    "barsy.site"
+    "barsy.support"
+    "barsy.uk"
+    "barsycenter.com"
+    "barsyonline.co.uk"
+    "barsyonline.com"
+    "barueri.br"
+    "barum.no"
+    "bas.it"
+    "base.ec"
+    "base.shop"
+    "baseball"
+    "baseball.museum"
+    "basel.museum"
+    "bashkiria.ru"
+    "bashkiria.su"
+    "basicserver.io"
+    "basilicata.it"
+    "basketball"
+    "baths.museum"
+    "bato.tochigi.jp"
+    "batsfjord.no"
+    "bauern.museum"
+    "bauhaus"
+    "bayern"
+    "bb"
+    "bbc"
+    "bbs.tr"
+    "bbt"
+    "bbva"
+    "bc.ca"
+    "bc.platform.sh"
+    "bcg"
+    "bci.dnstrace.pro"
+    "bcn"
+    "bd"
+    "bd.se"
+    "be"
+    "be.ax"
+    "be.eu.org"
+    "be.gy"
+    "beagleboard.io"
+    "bearalvahki.no"
+    "bearalv\303\241hki.no"
+    "beardu.no"
+    "beats"
+    "beauty"
+    "beauxarts.museum"
+    "bedzin.pl"
+    "beeldengeluid.museum"
+    "beep.pl"
+    "beer"
+    "beget.app"
+    "beiarn.no"
+    "bel.tr"
+    "belau.pw"
+    "belem.br"
+    "bellevue.museum"
+    "belluno.it"
+    "benevento.it"
+    "bentley"
+    "beppu.oita.jp"
+    "berg.no"
+    "bergamo.it"
+    "bergbau.museum"
+    "bergen.no"
+    "berkeley.museum"
+    "berlevag.no"
+    "berlev\303\245g.no"
+    "berlin"
+    "berlin.museum"
+    "bern.museum"
+    "beskidy.pl"
+    "best"
+    "bestbuy"
+    "bet"
+    "bet.ar"
+    "beta.bounty-full.com"
+    "beta.tailscale.net"
+    "betainabox.com"
+    "better-than.tv"
+    "bf"
+    "bg"
+    "bg.eu.org"
+    "bg.it"
+    "bh"
+    "bharti"
+    "bhz.br"
+    "bi"
+    "bi.it"
+    "bialowieza.pl"
+    "bialystok.pl"
+    "bib.br"
+    "bib.ve"
+    "bibai.hokkaido.jp"
+    "bible"
+    "bible.museum"
+    "bid"
+    "biei.hokkaido.jp"
+    "bielawa.pl"
+    "biella.it"
+    "bieszczady.pl"
+    "bievat.no"
+    "biev\303\241t.no"
+    "bifuka.hokkaido.jp"
+    "bihar.in"
+    "bihoro.hokkaido.jp"
+    "bike"
+    "bilbao.museum"
+    "bill.museum"
+    "bindal.no"
+    "bing"
+    "bingo"
+    "bio"
+    "bio.br"
+    "bip.sh"
+    "bir.ru"
+    "biratori.hokkaido.jp"
+    "birdart.museum"
+    "birkenes.no"
+    "birthplace.museum"
+    "bitbridge.net"
+    "bitbucket.io"
+    "bitter.jp"
+    "biz"
+    "biz.at"
+    "biz.az"
+    "biz.bb"
+    "biz.cy"
+    "biz.dk"
+    "biz.et"
+    "biz.fj"
+    "biz.gl"
+    "biz.id"
+    "biz.in"
+    "biz.ki"
+    "biz.ls"
+    "biz.mv"
+    "biz.mw"
+    "biz.my"
+    "biz.ni"
+    "biz.nr"
+    "biz.pk"
+    "biz.pl"
+    "biz.pr"
+    "biz.ss"
+    "biz.tj"
+    "biz.tr"
+    "biz.tt"
+    "biz.ua"
+    "biz.vn"
+    "biz.wf"
+    "biz.zm"
+    "bizen.okayama.jp"
+    "bj"
+    "bj.cn"
+    "bjarkoy.no"
+    "bjark\303\270y.no"
+    "bjerkreim.no"
+    "bjugn.no"
+    "bl.it"
+    "black"
+    "blackbaudcdn.net"
+    "blackfriday"
+    "blockbuster"
+    "blog"
+    "blog.bo"
+    "blog.br"
+    "blog.gt"
+    "blog.kg"
+    "blog.vu"
+    "blogdns.com"
+    "blogdns.net"
+    "blogdns.org"
+    "blogsite.org"
+    "blogsite.xyz"
+    "blogspot.ae"
+    "blogspot.al"
+    "blogspot.am"
+    "blogspot.ba"
+    "blogspot.be"
+    "blogspot.bg"
+    "blogspot.bj"
+    "blogspot.ca"
+    "blogspot.cf"
+    "blogspot.ch"
+    "blogspot.cl"
+    "blogspot.co.at"
+    "blogspot.co.id"
+    "blogspot.co.il"
+    "blogspot.co.ke"
+    "blogspot.co.nz"
+    "blogspot.co.uk"
+    "blogspot.co.za"
+    "blogspot.com"
+    "blogspot.com.ar"
+    "blogspot.com.au"
+    "blogspot.com.br"
+    "blogspot.com.by"
+    "blogspot.com.co"
+    "blogspot.com.cy"
+    "blogspot.com.ee"
+    "blogspot.com.eg"
+    "blogspot.com.es"
+    "blogspot.com.mt"
+    "blogspot.com.ng"
+    "blogspot.com.tr"
+    "blogspot.com.uy"
+    "blogspot.cv"
+    "blogspot.cz"
+    "blogspot.de"
+    "blogspot.dk"
+    "blogspot.fi"
+    "blogspot.fr"
+    "blogspot.gr"
+    "blogspot.hk"
+    "blogspot.hr"
+    "blogspot.hu"
+    "blogspot.ie"
+    "blogspot.in"
+    "blogspot.is"
+    "blogspot.it"
+    "blogspot.jp"
+    "blogspot.kr"
+    "blogspot.li"
+    "blogspot.lt"
+    "blogspot.lu"
+    "blogspot.md"
+    "blogspot.mk"
+    "blogspot.mr"
+    "blogspot.mx"
+    "blogspot.my"
+    "blogspot.nl"
+    "blogspot.no"
+    "blogspot.pe"
+    "blogspot.pt"
+    "blogspot.qa"
+    "blogspot.re"
+    "blogspot.ro"
+    "blogspot.rs"
+    "blogspot.ru"
+    "blogspot.se"
+    "blogspot.sg"
+    "blogspot.si"
+    "blogspot.sk"
+    "blogspot.sn"
+    "blogspot.td"
+    "blogspot.tw"
+    "blogspot.ug"
+    "blogspot.vn"
+    "blogsyte.com"
+    "bloomberg"
+    "bloxcms.com"
+    "blue"
+    "bluebite.io"
+    "blush.jp"
+    "bm"
+    "bmd.br"
+    "bmoattachments.org"
+    "bms"
+    "bmw"
+    "bn"
+    "bn.it"
+    "bnpparibas"
+    "bnr.la"
+    "bo"
+    "bo.it"
+    "bo.nordland.no"
+    "bo.telemark.no"
+    "boats"
+    "boavista.br"
+    "bodo.no"
+    "bod\303\270.no"
+    "boehringer"
+    "bofa"
+    "bokn.no"
+    "boldlygoingnowhere.org"
+    "boleslawiec.pl"
+    "bolivia.bo"
+    "bologna.it"
+    "bolt.hu"
+    "bolzano-altoadige.it"
+    "bolzano.it"
+    "bom"
+    "bomlo.no"
+    "bond"
+    "bonn.museum"
+    "boo"
+    "boo.jp"
+    "book"
+    "booking"
+    "bookonline.app"
+    "boomla.net"
+    "bosch"
+    "bostik"
+    "boston"
+    "boston.museum"
+    "bot"
+    "botanical.museum"
+    "botanicalgarden.museum"
+    "botanicgarden.museum"
+    "botany.museum"
+    "bounceme.net"
+    "bounty-full.com"
+    "boutique"
+    "boutir.com"
+    "box"
+    "boxfuse.io"
+    "boy.jp"
+    "boyfriend.jp"
+    "bozen-sudtirol.it"
+    "bozen-suedtirol.it"
+    "bozen-s\303\274dtirol.it"
+    "bozen.it"
+    "bplaced.com"
+    "bplaced.de"
+    "bplaced.net"
+    "br"
+    "br.com"
+    "br.it"
+    "bradesco"
+    "brand.se"
+    "brandywinevalley.museum"
+    "brasil.museum"
+    "brasilia.me"
+    "bremanger.no"
+    "brescia.it"
+    "bridgestone"
+    "brindisi.it"
+    "bristol.museum"
+    "british.museum"
+    "britishcolumbia.museum"
+    "broadcast.museum"
+    "broadway"
+    "broke-it.net"
+    "broker"
+    "broker.aero"
+    "bronnoy.no"
+    "bronnoysund.no"
+    "brother"
+    "browsersafetymark.io"
+    "brumunddal.no"
+    "brunel.museum"
+    "brussel.museum"
+    "brussels"
+    "brussels.museum"
+    "bruxelles.museum"
+    "bryansk.su"
+    "bryne.no"
+    "br\303\270nn\303\270y.no"
+    "br\303\270nn\303\270ysund.no"
+    "bs"
+    "bs.it"
+    "bsb.br"
+    "bss.design"
+    "bt"
+    "bt.it"
+    "bu.no"
+    "budejju.no"
+    "build"
+    "build.run"
+    "builder.code.com"
+    "builders"
+    "building.museum"
+    "builtwithdark.com"
+    "bukhara.su"
+    "bulsan-sudtirol.it"
+    "bulsan-suedtirol.it"
+    "bulsan-s\303\274dtirol.it"
+    "bulsan.it"
+    "bungoono.oita.jp"
+    "bungotakada.oita.jp"
+    "bunkyo.tokyo.jp"
+    "burghof.museum"
+    "bus.museum"
+    "busan.kr"
+    "bushey.museum"
+    "business"
+    "business.in"
+    "but.jp"
+    "buy"
+    "buyshop.jp"
+    "buyshouses.net"
+    "buzen.fukuoka.jp"
+    "buzz"
+    "bv"
+    "bw"
+    "by"
+    "bydgoszcz.pl"
+    "byen.site"
+    "bygland.no"
+    "bykle.no"
+    "bytom.pl"
+    "bz"
+    "bz.it"
+    "bzh"
+    "bzz.dapps.earth"
+    "b\303\241hcavuotna.no"
+    "b\303\241hccavuotna.no"
+    "b\303\241id\303\241r.no"
+    "b\303\241jddar.no"
+    "b\303\241l\303\241t.no"
+    "b\303\245d\303\245ddj\303\245.no"
+    "b\303\245tsfjord.no"
+    "b\303\246rum.no"
+    "b\303\270.nordland.no"
+    "b\303\270.telemark.no"
+    "b\303\270mlo.no"
+    "c.bg"
+    "c.cdn77.org"
+    "c.la"
+    "c.se"
+    "c66.me"
+    "ca"
+    "ca-central-1.elasticbeanstalk.com"
+    "ca.eu.org"
+    "ca.in"
+    "ca.it"
+    "ca.na"
+    "ca.reclaim.cloud"
+    "ca.us"
+    "caa.aero"
+    "caa.li"
+    "cab"
+    "cable-modem.org"
+    "cadaques.museum"
+    "cafe"
+    "cafjs.com"
+    "cagliari.it"
+    "cahcesuolo.no"
+    "cal"
+    "cal.it"
+    "calabria.it"
+    "california.museum"
+    "call"
+    "caltanissetta.it"
+    "calvinklein"
+    "cam"
+    "cam.it"
+    "cambridge.museum"
+    "camdvr.org"
+    "camera"
+    "camp"
+    "campaign.gov.uk"
+    "campania.it"
+    "campidano-medio.it"
+    "campidanomedio.it"
+    "campinagrande.br"
+    "campinas.br"
+    "campobasso.it"
+    "can.museum"
+    "canada.museum"
+    "candypop.jp"
+    "canon"
+    "canva-apps.cn"
+    "canva-apps.com"
+    "capebreton.museum"
+    "capetown"
+    "capital"
+    "capitalone"
+    "capoo.jp"
+    "car"
+    "caracal.mythic-beasts.com"
+    "caravan"
+    "carbonia-iglesias.it"
+    "carboniaiglesias.it"
+    "cards"
+    "care"
+    "career"
+    "careers"
+    "cargo.aero"
+    "carrara-massa.it"
+    "carraramassa.it"
+    "carrd.co"
+    "carrier.museum"
+    "cars"
+    "cartoonart.museum"
+    "casa"
+    "casacam.net"
+    "casadelamoneda.museum"
+    "case"
+    "caserta.it"
+    "cash"
+    "casino"
+    "casino.hu"
+    "castle.museum"
+    "castres.museum"
+    "cat"
+    "cat.ax"
+    "catania.it"
+    "catanzaro.it"
+    "catering"
+    "catering.aero"
+    "catfood.jp"
+    "catholic"
+    "catholic.edu.au"
+    "caxias.br"
+    "cb.it"
+    "cba"
+    "cbg.ru"
+    "cbn"
+    "cbre"
+    "cbs"
+    "cc"
+    "cc.ak.us"
+    "cc.al.us"
+    "cc.ar.us"
+    "cc.as.us"
+    "cc.az.us"
+    "cc.ca.us"
+    "cc.co.us"
+    "cc.ct.us"
+    "cc.dc.us"
+    "cc.de.us"
+    "cc.fl.us"
+    "cc.ga.us"
+    "cc.gu.us"
+    "cc.hi.us"
+    "cc.hn"
+    "cc.ia.us"
+    "cc.id.us"
+    "cc.il.us"
+    "cc.in.us"
+    "cc.ks.us"
+    "cc.ky.us"
+    "cc.la.us"
+    "cc.ma.us"
+    "cc.md.us"
+    "cc.me.us"
+    "cc.mi.us"
+    "cc.mn.us"
+    "cc.mo.us"
+    "cc.ms.us"
+    "cc.mt.us"
+    "cc.na"
+    "cc.nc.us"
+    "cc.nd.us"
+    "cc.ne.us"
+    "cc.nh.us"
+    "cc.nj.us"
+    "cc.nm.us"
+    "cc.nv.us"
+    "cc.ny.us"
+    "cc.oh.us"
+    "cc.ok.us"
+    "cc.or.us"
+    "cc.pa.us"
+    "cc.pr.us"
+    "cc.ri.us"
+    "cc.sc.us"
+    "cc.sd.us"
+    "cc.tn.us"
+    "cc.tx.us"
+    "cc.ua"
+    "cc.ut.us"
+    "cc.va.us"
+    "cc.vi.us"
+    "cc.vt.us"
+    "cc.wa.us"
+    "cc.wi.us"
+    "cc.wv.us"
+    "cc.wy.us"
+    "cci.fr"
+    "cd"
+    "cd.eu.org"
+    "cdn-edges.net"
+    "cdn.prod.atlassian-dev.net"
+    "cdn77-ssl.net"
+    "ce.gov.br"
+    "ce.it"
+    "ce.leg.br"
+    "cechire.com"
+    "celtic.museum"
+    "center"
+    "center.museum"
+    "centralus.azurestaticapps.net"
+    "ceo"
+    "cern"
+    "certification.aero"
+    "certmgr.org"
+    "cesena-forli.it"
+    "cesena-forl\303\254.it"
+    "cesenaforli.it"
+    "cesenaforl\303\254.it"
+    "cf"
+    "cf-ipfs.com"
+    "cfa"
+    "cfd"
+    "cg"
+    "ch"
+    "ch.eu.org"
+    "ch.it"
+    "ch.tc"
+    "ch.trendhosting.cloud"
+    "chambagri.fr"
+    "championship.aero"
+    "chanel"
+    "channel"
+    "channelsdvr.net"
+    "charity"
+    "charter.aero"
+    "chase"
+    "chat"
+    "chattanooga.museum"
+    "cheap"
+    "cheap.jp"
+    "cheltenham.museum"
+    "cherkassy.ua"
+    "cherkasy.ua"
+    "chernigov.ua"
+    "chernihiv.ua"
+    "chernivtsi.ua"
+    "chernovtsy.ua"
+    "chesapeakebay.museum"
+    "chiba.jp"
+    "chicago.museum"
+    "chicappa.jp"
+    "chichibu.saitama.jp"
+    "chieti.it"
+    "chigasaki.kanagawa.jp"
+    "chihayaakasaka.osaka.jp"
+    "chijiwa.nagasaki.jp"
+    "chikugo.fukuoka.jp"
+    "chikuho.fukuoka.jp"
+    "chikuhoku.nagano.jp"
+    "chikujo.fukuoka.jp"
+    "chikuma.nagano.jp"
+    "chikusei.ibaraki.jp"
+    "chikushino.fukuoka.jp"
+    "chikuzen.fukuoka.jp"
+    "children.museum"
+    "childrens.museum"
+    "childrensgarden.museum"
+    "chillout.jp"
+    "chimkent.su"
+    "chino.nagano.jp"
+    "chintai"
+    "chippubetsu.hokkaido.jp"
+    "chips.jp"
+    "chiropractic.museum"
+    "chirurgiens-dentistes-en-france.fr"
+    "chirurgiens-dentistes.fr"
+    "chiryu.aichi.jp"
+    "chita.aichi.jp"
+    "chitose.hokkaido.jp"
+    "chiyoda.gunma.jp"
+    "chiyoda.tokyo.jp"
+    "chizu.tottori.jp"
+    "chocolate.museum"
+    "chofu.tokyo.jp"
+    "chonan.chiba.jp"
+    "chosei.chiba.jp"
+    "choshi.chiba.jp"
+    "chowder.jp"
+    "choyo.kumamoto.jp"
+    "christiansburg.museum"
+    "christmas"
+    "chrome"
+    "chtr.k12.ma.us"
+    "chu.jp"
+    "chungbuk.kr"
+    "chungnam.kr"
+    "chuo.chiba.jp"
+    "chuo.fukuoka.jp"
+    "chuo.osaka.jp"
+    "chuo.tokyo.jp"
+    "chuo.yamanashi.jp"
+    "church"
+    "ci"
+    "ci.it"
+    "ciao.jp"
+    "ciencia.bo"
+    "cieszyn.pl"
+    "cim.br"
+    "cincinnati.museum"
+    "cinema.museum"
+    "cipriani"
+    "circle"
+    "circus.museum"
+    "cisco"
+    "ciscofreak.com"
+    "cistron.nl"
+    "citadel"
+    "citi"
+    "citic"
+    "city"
+    "city.hu"
+    "city.kawasaki.jp"
+    "city.kitakyushu.jp"
+    "city.kobe.jp"
+    "city.nagoya.jp"
+    "city.sapporo.jp"
+    "city.sendai.jp"
+    "city.yokohama.jp"
+    "cityeats"
+    "civilaviation.aero"
+    "civilisation.museum"
+    "civilization.museum"
+    "civilwar.museum"
+    "ck"
+    "ck.ua"
+    "cl"
+    "cl.it"
+    "claims"
+    "clan.rip"
+    "cleaning"
+    "clerk.app"
+    "clerkstage.app"
+    "cleverapps.io"
+    "click"
+    "clicketcloud.com"
+    "clickrising.net"
+    "clinic"
+    "clinique"
+    "clinton.museum"
+    "clock.museum"
+    "clothing"
+    "cloud"
+    "cloud-fr1.unispace.io"
+    "cloud.fedoraproject.org"
+    "cloud.goog"
+    "cloud.interhostsolutions.be"
+    "cloud.jelastic.open.tim.it"
+    "cloud.metacentrum.cz"
+    "cloud.nospamproxy.com"
+    "cloud66.ws"
+    "cloud66.zone"
+    "cloudaccess.host"
+    "cloudaccess.net"
+    "cloudapp.net"
+    "cloudapps.digital"
+    "cloudcontrolapp.com"
+    "cloudcontrolled.com"
+    "cloudera.site"
+    "cloudflare-ipfs.com"
+    "cloudfront.net"
+    "cloudfunctions.net"
+    "cloudjiffy.net"
+    "cloudns.asia"
+    "cloudns.biz"
+    "cloudns.cc"
+    "cloudns.club"
+    "cloudns.eu"
+    "cloudns.in"
+    "cloudns.info"
+    "cloudns.org"
+    "cloudns.pro"
+    "cloudns.pw"
+    "cloudns.us"
+    "cloudsite.builders"
+    "cloudycluster.net"
+    "club"
+    "club.aero"
+    "club.tw"
+    "clubmed"
+    "cm"
+    "cn"
+    "cn-north-1.eb.amazonaws.com.cn"
+    "cn-northwest-1.eb.amazonaws.com.cn"
+    "cn.com"
+    "cn.eu.org"
+    "cn.in"
+    "cn.it"
+    "cn.ua"
+    "cn.vu"
+    "cng.br"
+    "cnpy.gdn"
+    "cns.joyent.com"
+    "cnt.br"
+    "co"
+    "co.ae"
+    "co.ag"
+    "co.am"
+    "co.ao"
+    "co.at"
+    "co.bb"
+    "co.bi"
+    "co.bj"
+    "co.bn"
+    "co.business"
+    "co.bw"
+    "co.ca"
+    "co.ci"
+    "co.cl"
+    "co.cm"
+    "co.com"
+    "co.cr"
+    "co.cz"
+    "co.dk"
+    "co.education"
+    "co.events"
+    "co.financial"
+    "co.gg"
+    "co.gl"
+    "co.gy"
+    "co.hu"
+    "co.id"
+    "co.il"
+    "co.im"
+    "co.in"
+    "co.ir"
+    "co.it"
+    "co.je"
+    "co.jp"
+    "co.ke"
+    "co.kr"
+    "co.krd"
+    "co.lc"
+    "co.ls"
+    "co.ma"
+    "co.me"
+    "co.mg"
+    "co.mu"
+    "co.mw"
+    "co.mz"
+    "co.na"
+    "co.network"
+    "co.ni"
+    "co.nl"
+    "co.no"
+    "co.nz"
+    "co.om"
+    "co.pl"
+    "co.place"
+    "co.pn"
+    "co.pw"
+    "co.ro"
+    "co.rs"
+    "co.rw"
+    "co.st"
+    "co.sz"
+    "co.technology"
+    "co.th"
+    "co.tj"
+    "co.tm"
+    "co.tt"
+    "co.tz"
+    "co.ua"
+    "co.ug"
+    "co.uk"
+    "co.us"
+    "co.uz"
+    "co.ve"
+    "co.vi"
+    "co.za"
+    "co.zm"
+    "co.zw"
+    "coach"
+    "coal.museum"
+    "coastaldefence.museum"
+    "cocotte.jp"
+    "code.run"
+    "codeberg.page"
+    "codes"
+    "codespot.com"
+    "cody.museum"
+    "coffee"
+    "cog.mi.us"
+    "col.ng"
+    "coldwar.museum"
+    "collection.museum"
+    "college"
+    "collegefan.org"
+    "cologne"
+    "colonialwilliamsburg.museum"
+    "coloradoplateau.museum"
+    "columbia.museum"
+    "columbus.museum"
+    "com"
+    "com.ac"
+    "com.af"
+    "com.ag"
+    "com.ai"
+    "com.al"
+    "com.am"
+    "com.ar"
+    "com.au"
+    "com.aw"
+    "com.az"
+    "com.ba"
+    "com.bb"
+    "com.bh"
+    "com.bi"
+    "com.bj"
+    "com.bm"
+    "com.bn"
+    "com.bo"
+    "com.br"
+    "com.bs"
+    "com.bt"
+    "com.by"
+    "com.bz"
+    "com.ci"
+    "com.cm"
+    "com.cn"
+    "com.co"
+    "com.cu"
+    "com.cv"
+    "com.cw"
+    "com.cy"
+    "com.de"
+    "com.dm"
+    "com.do"
+    "com.dz"
+    "com.ec"
+    "com.ee"
+    "com.eg"
+    "com.es"
+    "com.et"
+    "com.fj"
+    "com.fm"
+    "com.fr"
+    "com.ge"
+    "com.gh"
+    "com.gi"
+    "com.gl"
+    "com.gn"
+    "com.gp"
+    "com.gr"
+    "com.gt"
+    "com.gu"
+    "com.gy"
+    "com.hk"
+    "com.hn"
+    "com.hr"
+    "com.ht"
+    "com.im"
+    "com.in"
+    "com.io"
+    "com.iq"
+    "com.is"
+    "com.jo"
+    "com.kg"
+    "com.ki"
+    "com.km"
+    "com.kp"
+    "com.kw"
+    "com.ky"
+    "com.kz"
+    "com.la"
+    "com.lb"
+    "com.lc"
+    "com.lk"
+    "com.lr"
+    "com.lv"
+    "com.ly"
+    "com.mg"
+    "com.mk"
+    "com.ml"
+    "com.mo"
+    "com.ms"
+    "com.mt"
+    "com.mu"
+    "com.mv"
+    "com.mw"
+    "com.mx"
+    "com.my"
+    "com.na"
+    "com.nf"
+    "com.ng"
+    "com.ni"
+    "com.nr"
+    "com.om"
+    "com.pa"
+    "com.pe"
+    "com.pf"
+    "com.ph"
+    "com.pk"
+    "com.pl"
+    "com.pr"
+    "com.ps"
+    "com.pt"
+    "com.py"
+    "com.qa"
+    "com.re"
+    "com.ro"
+    "com.ru"
+    "com.sa"
+    "com.sb"
+    "com.sc"
+    "com.sd"
+    "com.se"
+    "com.sg"
+    "com.sh"
+    "com.sl"
+    "com.sn"
+    "com.so"
+    "com.ss"
+    "com.st"
+    "com.sv"
+    "com.sy"
+    "com.tj"
+    "com.tm"
+    "com.tn"
+    "com.to"
+    "com.tr"
+    "com.tt"
+    "com.tw"
+    "com.ua"
+    "com.ug"
+    "com.uy"
+    "com.uz"
+    "com.vc"
+    "com.ve"
+    "com.vi"
+    "com.vn"
+    "com.vu"
+    "com.ws"
+    "com.ye"
+    "com.zm"
+    "comcast"
+    "commbank"
+    "commune.am"
+    "communication.museum"
+    "communications.museum"
+    "community"
+    "community-pro.de"
+    "community-pro.net"
+    "community.museum"
+    "como.it"
+    "company"
+    "compare"
+    "compute-1.amazonaws.com"
+    "compute.amazonaws.com"
+    "compute.amazonaws.com.cn"
+    "compute.estate"
+    "computer"
+    "computer.museum"
+    "computerhistory.museum"
+    "comsec"
+    "comunica\303\247\303\265es.museum"
+    "condos"
+    "conf.au"
+    "conf.lv"
+    "conf.se"
+    "conference.aero"
+    "conn.uk"
+    "construction"
+    "consulado.st"
+    "consultant.aero"
+    "consulting"
+    "consulting.aero"
+    "contact"
+    "contagem.br"
+    "contemporary.museum"
+    "contemporaryart.museum"
+    "contractors"
+    "control.aero"
+    "convent.museum"
+    "cooking"
+    "cookingchannel"
+    "cool"
+    "coolblog.jp"
+    "coop"
+    "coop.ar"
+    "coop.br"
+    "coop.ht"
+    "coop.in"
+    "coop.km"
+    "coop.mv"
+    "coop.mw"
+    "coop.py"
+    "coop.rw"
+    "coop.tt"
+    "cooperativa.bo"
+    "copenhagen.museum"
+    "copro.uk"
+    "corporation.museum"
+    "correios-e-telecomunica\303\247\303\265es.museum"
+    "corsica"
+    "corvette.museum"
+    "cosenza.it"
+    "costume.museum"
+    "couchpotatofries.org"
+    "council.aero"
+    "country"
+    "countryestate.museum"
+    "county.museum"
+    "coupon"
+    "coupons"
+    "courses"
+    "coz.br"
+    "cpa"
+    "cpa.pro"
+    "cq.cn"
+    "cr"
+    "cr.it"
+    "cr.ua"
+    "crafting.xyz"
+    "crafts.museum"
+    "cranbrook.museum"
+    "cranky.jp"
+    "crd.co"
+    "creation.museum"
+    "credit"
+    "creditcard"
+    "creditunion"
+    "cremona.it"
+    "crew.aero"
+    "cri.br"
+    "cri.nz"
+    "cricket"
+    "crimea.ua"
+    "crotone.it"
+    "crown"
+    "crs"
+    "cruise"
+    "cruises"
+    "cryptonomic.net"
+    "cs.in"
+    "cs.it"
+    "cs.keliweb.cloud"
+    "csx.cc"
+    "ct.it"
+    "ct.us"
+    "cu"
+    "cuiaba.br"
+    "cuisinella"
+    "cultural.museum"
+    "culturalcenter.museum"
+    "culture.museum"
+    "cuneo.it"
+    "cupcake.is"
+    "curitiba.br"
+    "curv.dev"
+    "cust.dev.thingdust.io"
+    "cust.disrec.thingdust.io"
+    "cust.prod.thingdust.io"
+    "cust.retrosnub.co.uk"
+    "cust.testing.thingdust.io"
+    "custom.metacentrum.cz"
+    "customer-oci.com"
+    "customer.mythic-beasts.com"
+    "customer.speedpartner.de"
+    "cutegirl.jp"
+    "cv"
+    "cv.ua"
+    "cw"
+    "cx"
+    "cx.ua"
+    "cy"
+    "cy.eu.org"
+    "cya.gg"
+    "cyber.museum"
+    "cymru"
+    "cymru.museum"
+    "cyon.link"
+    "cyon.site"
+    "cyou"
+    "cz"
+    "cz.eu.org"
+    "cz.it"
+    "czeladz.pl"
+    "czest.pl"
+    "d.bg"
+    "d.gv.vc"
+    "d.se"
+    "daa.jp"
+    "dabur"
+    "dad"
+    "daegu.kr"
+    "daejeon.kr"
+    "daemon.panel.gg"
+    "dagestan.ru"
+    "dagestan.su"
+    "daigo.ibaraki.jp"
+    "daisen.akita.jp"
+    "daito.osaka.jp"
+    "daiwa.hiroshima.jp"
+    "dali.museum"
+    "dallas.museum"
+    "damnserver.com"
+    "dance"
+    "daplie.me"
+    "dapps.earth"
+    "data"
+    "database.museum"
+    "database.run"
+    "date"
+    "date.fukushima.jp"
+    "date.hokkaido.jp"
+    "dating"
+    "datsun"
+    "dattolocal.com"
+    "dattolocal.net"
+    "dattorelay.com"
+    "dattoweb.com"
+    "davvenjarga.no"
+    "davvenj\303\241rga.no"
+    "davvesiida.no"
+    "day"
+    "dazaifu.fukuoka.jp"
+    "dc.us"
+    "dclk"
+    "dd-dns.de"
+    "ddns.me"
+    "ddns.net"
+    "ddns5.com"
+    "ddnsfree.com"
+    "ddnsgeek.com"
+    "ddnsking.com"
+    "ddnslive.com"
+    "ddnss.de"
+    "ddnss.org"
+    "ddr.museum"
+    "dds"
+    "de"
+    "de.com"
+    "de.cool"
+    "de.eu.org"
+    "de.gt"
+    "de.ls"
+    "de.md"
+    "de.trendhosting.cloud"
+    "de.us"
+    "deal"
+    "dealer"
+    "deals"
+    "deatnu.no"
+    "debian.net"
+    "deca.jp"
+    "deci.jp"
+    "decorativearts.museum"
+    "dedibox.fr"
+    "dedyn.io"
+    "def.br"
+    "definima.io"
+    "definima.net"
+    "degree"
+    "delaware.museum"
+    "delhi.in"
+    "delivery"
+    "dell"
+    "dell-ogliastra.it"
+    "dellogliastra.it"
+    "delmenhorst.museum"
+    "deloitte"
+    "delta"
+    "demo.datacenter.fi"
+    "demo.datadetect.com"
+    "demo.jelastic.com"
+    "democracia.bo"
+    "democrat"
+    "demon.nl"
+    "denmark.museum"
+    "deno-staging.dev"
+    "deno.dev"
+    "dental"
+    "dentist"
+    "dep.no"
+    "deporte.bo"
+    "depot.museum"
+    "des.br"
+    "desa.id"
+    "desi"
+    "design"
+    "design.aero"
+    "design.museum"
+    "det.br"
+    "deta.app"
+    "deta.dev"
+    "detroit.museum"
+    "dev"
+    "dev-builder.code.com"
+    "dev-myqnapcloud.com"
+    "dev.adobeaemcloud.com"
+    "dev.br"
+    "dev.static.land"
+    "dev.vu"
+    "devcdnaccesso.com"
+    "developer.app"
+    "development.run"
+    "devices.resinstaging.io"
+    "df.gov.br"
+    "df.leg.br"
+    "dgca.aero"
+    "dh.bytemark.co.uk"
+    "dhl"
+    "diadem.cloud"
+    "diamonds"
+    "dielddanuorri.no"
+    "diet"
+    "digick.jp"
+    "digital"
+    "digitaloceanspaces.com"
+    "diher.solutions"
+    "dinosaur.museum"
+    "direct"
+    "direct.quickconnect.cn"
+    "direct.quickconnect.to"
+    "directory"
+    "discordsays.com"
+    "discordsez.com"
+    "discount"
+    "discourse.group"
+    "discourse.team"
+    "discover"
+    "discovery.museum"
+    "dish"
+    "diskstation.eu"
+    "diskstation.me"
+    "diskstation.org"
+    "diskussionsbereich.de"
+    "ditchyourip.com"
+    "divtasvuodna.no"
+    "divttasvuotna.no"
+    "diy"
+    "dj"
+    "dk"
+    "dk.eu.org"
+    "dlugoleka.pl"
+    "dm"
+    "dn.ua"
+    "dnepropetrovsk.ua"
+    "dni.us"
+    "dnipropetrovsk.ua"
+    "dnp"
+    "dnsalias.com"
+    "dnsalias.net"
+    "dnsalias.org"
+    "dnsdojo.com"
+    "dnsdojo.net"
+    "dnsdojo.org"
+    "dnsfor.me"
+    "dnshome.de"
+    "dnsiskinky.com"
+    "dnsking.ch"
+    "dnsup.net"
+    "dnsupdate.info"
+    "dnsupdater.de"
+    "do"
+    "docs"
+    "doctor"
+    "does-it.net"
+    "doesntexist.com"
+    "doesntexist.org"
+    "dog"
+    "dolls.museum"
+    "domains"
+    "donetsk.ua"
+    "donna.no"
+    "donostia.museum"
+    "dontexist.com"
+    "dontexist.net"
+    "dontexist.org"
+    "doomdns.com"
+    "doomdns.org"
+    "dopaas.com"
+    "doshi.yamanashi.jp"
+    "dot"
+    "dovre.no"
+    "download"
+    "dp.ua"
+    "dr.in"
+    "dr.na"
+    "dr.tr"
+    "drammen.no"
+    "drangedal.no"
+    "dray-dns.de"
+    "drayddns.com"
+    "draydns.de"
+    "dreamhosters.com"
+    "drive"
+    "drobak.no"
+    "drr.ac"
+    "drud.io"
+    "drud.us"
+    "dr\303\270bak.no"
+    "dscloud.biz"
+    "dscloud.me"
+    "dscloud.mobi"
+    "dsmynas.com"
+    "dsmynas.net"
+    "dsmynas.org"
+    "dst.mi.us"
+    "dtv"
+    "dubai"
+    "duckdns.org"
+    "dunlop"
+    "dupont"
+    "durban"
+    "durham.museum"
+    "dvag"
+    "dvr"
+    "dvrcam.info"
+    "dvrdns.org"
+    "dweb.link"
+    "dy.fi"
+    "dyn-berlin.de"
+    "dyn-ip24.de"
+    "dyn-o-saur.com"
+    "dyn-vpn.de"
+    "dyn.cosidns.de"
+    "dyn.ddnss.de"
+    "dyn.home-webserver.de"
+    "dyn53.io"
+    "dynalias.com"
+    "dynalias.net"
+    "dynalias.org"
+    "dynamic-dns.info"
+    "dynamisches-dns.de"
+    "dynathome.net"
+    "dyndns-at-home.com"
+    "dyndns-at-work.com"
+    "dyndns-blog.com"
+    "dyndns-free.com"
+    "dyndns-home.com"
+    "dyndns-ip.com"
+    "dyndns-mail.com"
+    "dyndns-office.com"
+    "dyndns-pics.com"
+    "dyndns-remote.com"
+    "dyndns-server.com"
+    "dyndns-web.com"
+    "dyndns-wiki.com"
+    "dyndns-work.com"
+    "dyndns.biz"
+    "dyndns.dappnode.io"
+    "dyndns.ddnss.de"
+    "dyndns.info"
+    "dyndns.org"
+    "dyndns.tv"
+    "dyndns.ws"
+    "dyndns1.de"
+    "dynns.com"
+    "dynserv.org"
+    "dynu.net"
+    "dynv6.net"
+    "dynvpn.de"
+    "dyroy.no"
+    "dyr\303\270y.no"
+    "dz"
+    "d\303\270nna.no"
+    "e.bg"
+    "e.se"
+    "e12.ve"
+    "e164.arpa"
+    "e4.cz"
+    "earth"
+    "east-kazakhstan.su"
+    "eastafrica.museum"
+    "eastasia.azurestaticapps.net"
+    "eastcoast.museum"
+    "eastus2.azurestaticapps.net"
+    "easypanel.app"
+    "easypanel.host"
+    "eat"
+    "eating-organic.net"
+    "eaton.mi.us"
+    "ebetsu.hokkaido.jp"
+    "ebina.kanagawa.jp"
+    "ebino.miyazaki.jp"
+    "ebiz.tw"
+    "ec"
+    "echizen.fukui.jp"
+    "ecn.br"
+    "eco"
+    "eco.bj"
+    "eco.br"
+    "ecologia.bo"
+    "ecommerce-shop.pl"
+    "econo.bj"
+    "economia.bo"
+    "ed.ao"
+    "ed.ci"
+    "ed.cr"
+    "ed.jp"
+    "ed.pw"
+    "edeka"
+    "edgeapp.net"
+    "edgecompute.app"
+    "edgekey-staging.net"
+    "edgekey.net"
+    "edgestack.me"
+    "edgesuite-staging.net"
+    "edgesuite.net"
+    "editorx.io"
+    "edogawa.tokyo.jp"
+    "edu"
+    "edu.ac"
+    "edu.af"
+    "edu.al"
+    "edu.ar"
+    "edu.au"
+    "edu.az"
+    "edu.ba"
+    "edu.bb"
+    "edu.bh"
+    "edu.bi"
+    "edu.bj"
+    "edu.bm"
+    "edu.bn"
+    "edu.bo"
+    "edu.br"
+    "edu.bs"
+    "edu.bt"
+    "edu.bz"
+    "edu.ci"
+    "edu.cn"
+    "edu.co"
+    "edu.cu"
+    "edu.cv"
+    "edu.cw"
+    "edu.dm"
+    "edu.do"
+    "edu.dz"
+    "edu.ec"
+    "edu.ee"
+    "edu.eg"
+    "edu.es"
+    "edu.et"
+    "edu.eu.org"
+    "edu.fm"
+    "edu.gd"
+    "edu.ge"
+    "edu.gh"
+    "edu.gi"
+    "edu.gl"
+    "edu.gn"
+    "edu.gp"
+    "edu.gr"
+    "edu.gt"
+    "edu.gu"
+    "edu.gy"
+    "edu.hk"
+    "edu.hn"
+    "edu.ht"
+    "edu.in"
+    "edu.iq"
+    "edu.is"
+    "edu.it"
+    "edu.jo"
+    "edu.kg"
+    "edu.ki"
+    "edu.km"
+    "edu.kn"
+    "edu.kp"
+    "edu.krd"
+    "edu.kw"
+    "edu.ky"
+    "edu.kz"
+    "edu.la"
+    "edu.lb"
+    "edu.lc"
+    "edu.lk"
+    "edu.lr"
+    "edu.ls"
+    "edu.lv"
+    "edu.ly"
+    "edu.me"
+    "edu.mg"
+    "edu.mk"
+    "edu.ml"
+    "edu.mn"
+    "edu.mo"
+    "edu.ms"
+    "edu.mt"
+    "edu.mv"
+    "edu.mw"
+    "edu.mx"
+    "edu.my"
+    "edu.mz"
+    "edu.ng"
+    "edu.ni"
+    "edu.nr"
+    "edu.om"
+    "edu.pa"
+    "edu.pe"
+    "edu.pf"
+    "edu.ph"
+    "edu.pk"
+    "edu.pl"
+    "edu.pn"
+    "edu.pr"
+    "edu.ps"
+    "edu.pt"
+    "edu.py"
+    "edu.qa"
+    "edu.rs"
+    "edu.ru"
+    "edu.sa"
+    "edu.sb"
+    "edu.sc"
+    "edu.scot"
+    "edu.sd"
+    "edu.sg"
+    "edu.sl"
+    "edu.sn"
+    "edu.so"
+    "edu.ss"
+    "edu.st"
+    "edu.sv"
+    "edu.sy"
+    "edu.tj"
+    "edu.tm"
+    "edu.to"
+    "edu.tr"
+    "edu.tt"
+    "edu.tw"
+    "edu.ua"
+    "edu.uy"
+    "edu.vc"
+    "edu.ve"
+    "edu.vn"
+    "edu.vu"
+    "edu.ws"
+    "edu.ye"
+    "edu.za"
+    "edu.zm"
+    "education"
+    "education.museum"
+    "educational.museum"
+    "educator.aero"
+    "edugit.io"
+    "ee"
+    "ee.eu.org"
+    "eero-stage.online"
+    "eero.online"
+    "eg"
+    "egersund.no"
+    "egoism.jp"
+    "egyptian.museum"
+    "ehime.jp"
+    "eid.no"
+    "eidfjord.no"
+    "eidsberg.no"
+    "eidskog.no"
+    "eidsvoll.no"
+    "eigersund.no"
+    "eiheiji.fukui.jp"
+    "eisenbahn.museum"
+    "ekloges.cy"
+    "elasticbeanstalk.com"
+    "elb.amazonaws.com"
+    "elb.amazonaws.com.cn"
+    "elblag.pl"
+    "elburg.museum"
+    "elementor.cloud"
+    "elementor.cool"
+    "elk.pl"
+    "elvendrell.museum"
+    "elverum.no"
+    "email"
+    "emb.kw"
+    "embaixada.st"
+    "embetsu.hokkaido.jp"
+    "embroidery.museum"
+    "emerck"
+    "emergency.aero"
+    "emilia-romagna.it"
+    "emiliaromagna.it"
+    "emp.br"
+    "empresa.bo"
+    "emr.it"
+    "en-root.fr"
+    "en.it"
+    "ena.gifu.jp"
+    "encoreapi.com"
+    "encr.app"
+    "encyclopedic.museum"
+    "endofinternet.net"
+    "endofinternet.org"
+    "endoftheinternet.org"
+    "enebakk.no"
+    "energy"
+    "enf.br"
+    "eng.br"
+    "eng.pro"
+    "engerdal.no"
+    "engine.aero"
+    "engineer"
+    "engineer.aero"
+    "engineering"
+    "england.museum"
+    "eniwa.hokkaido.jp"
+    "enna.it"
+    "ens.tn"
+    "enscaled.sg"
+    "ent.platform.sh"
+    "enterprisecloud.nu"
+    "enterprises"
+    "entertainment.aero"
+    "entomology.museum"
+    "environment.museum"
+    "environmentalconservation.museum"
+    "epilepsy.museum"
+    "epson"
+    "equipment"
+    "equipment.aero"
+    "er"
+    "er.in"
+    "ericsson"
+    "erimo.hokkaido.jp"
+    "erni"
+    "erotica.hu"
+    "erotika.hu"
+    "es"
+    "es-1.axarnet.cloud"
+    "es.ax"
+    "es.eu.org"
+    "es.gov.br"
+    "es.kr"
+    "es.leg.br"
+    "esan.hokkaido.jp"
+    "esashi.hokkaido.jp"
+    "esp.br"
+    "esq"
+    "essex.museum"
+    "est-a-la-maison.com"
+    "est-a-la-masion.com"
+    "est-le-patron.com"
+    "est-mon-blogueur.com"
+    "est.pr"
+    "estate"
+    "estate.museum"
+    "et"
+    "etajima.hiroshima.jp"
+    "etc.br"
+    "ethnology.museum"
+    "eti.br"
+    "etisalat"
+    "etne.no"
+    "etnedal.no"
+    "eu"
+    "eu-1.evennode.com"
+    "eu-2.evennode.com"
+    "eu-3.evennode.com"
+    "eu-4.evennode.com"
+    "eu-central-1.elasticbeanstalk.com"
+    "eu-west-1.elasticbeanstalk.com"
+    "eu-west-2.elasticbeanstalk.com"
+    "eu-west-3.elasticbeanstalk.com"
+    "eu.ax"
+    "eu.com"
+    "eu.encoway.cloud"
+    "eu.int"
+    "eu.meteorapp.com"
+    "eu.org"
+    "eu.platform.sh"
+    "eu.pythonanywhere.com"
+    "eun.eg"
+    "eurodir.ru"
+    "eurovision"
+    "eus"
+    "evenassi.no"
+    "evenes.no"
+    "events"
+    "even\303\241\305\241\305\241i.no"
+    "evje-og-hornnes.no"
+    "ex.futurecms.at"
+    "ex.ortsinfo.at"
+    "exchange"
+    "exchange.aero"
+    "exeter.museum"
+    "exhibition.museum"
+    "exnet.su"
+    "expert"
+    "experts-comptables.fr"
+    "exposed"
+    "express"
+    "express.aero"
+    "extraspace"
+    "ezproxy.kuleuven.be"
+    "f.bg"
+    "f.se"
+    "fage"
+    "fail"
+    "fairwinds"
+    "faith"
+    "fakefur.jp"
+    "fam.pk"
+    "family"
+    "family.museum"
+    "familyds.com"
+    "familyds.net"
+    "familyds.org"
+    "fan"
+    "fans"
+    "fantasyleague.cc"
+    "far.br"
+    "farm"
+    "farm.museum"
+    "farmequipment.museum"
+    "farmers"
+    "farmers.museum"
+    "farmstead.museum"
+    "farsund.no"
+    "fashion"
+    "fashionstore.jp"
+    "fast"
+    "fastly-edge.com"
+    "fastly-terrarium.com"
+    "fastlylb.net"
+    "faststacks.net"
+    "fastvps-server.com"
+    "fastvps.host"
+    "fastvps.site"
+    "fauske.no"
+    "fbx-os.fr"
+    "fbxos.fr"
+    "fc.it"
+    "fe.it"
+    "fed.us"
+    "federation.aero"
+    "fedex"
+    "fedje.no"
+    "fedorainfracloud.org"
+    "fedorapeople.org"
+    "feedback"
+    "feira.br"
+    "fem.jp"
+    "fentiger.mythic-beasts.com"
+    "fermo.it"
+    "ferrara.it"
+    "ferrari"
+    "ferrero"
+    "feste-ip.net"
+    "fet.no"
+    "fetsund.no"
+    "fg.it"
+    "fh-muenster.io"
+    "fh.se"
+    "fhs.no"
+    "fhsk.se"
+    "fhv.se"
+    "fi"
+    "fi.cloudplatform.fi"
+    "fi.cr"
+    "fi.eu.org"
+    "fi.it"
+    "fiat"
+    "fidelity"
+    "fido"
+    "fie.ee"
+    "field.museum"
+    "figueres.museum"
+    "filatelia.museum"
+    "filegear-au.me"
+    "filegear-de.me"
+    "filegear-gb.me"
+    "filegear-ie.me"
+    "filegear-jp.me"
+    "filegear-sg.me"
+    "filegear.me"
+    "film"
+    "film.hu"
+    "film.museum"
+    "fin.ci"
+    "fin.ec"
+    "fin.tn"
+    "final"
+    "finance"
+    "financial"
+    "fineart.museum"
+    "finearts.museum"
+    "finland.museum"
+    "finnoy.no"
+    "finn\303\270y.no"
+    "fire"
+    "firebaseapp.com"
+    "firenet.ch"
+    "firenze.it"
+    "firestone"
+    "firewall-gateway.com"
+    "firewall-gateway.de"
+    "firewall-gateway.net"
+    "firewalledreplit.co"
+    "fireweb.app"
+    "firm.co"
+    "firm.dk"
+    "firm.ht"
+    "firm.in"
+    "firm.nf"
+    "firm.ng"
+    "firm.ro"
+    "firm.ve"
+    "firmdale"
+    "fish"
+    "fishing"
+    "fit"
+    "fitjar.no"
+    "fitness"
+    "fj"
+    "fj.cn"
+    "fjaler.no"
+    "fjell.no"
+    "fk"
+    "fl.us"
+    "fla.no"
+    "flakstad.no"
+    "flanders.museum"
+    "flap.id"
+    "flatanger.no"
+    "fldrv.com"
+    "flekkefjord.no"
+    "flesberg.no"
+    "flickr"
+    "flier.jp"
+    "flight.aero"
+    "flights"
+    "flir"
+    "flog.br"
+    "floppy.jp"
+    "flora.no"
+    "florence.it"
+    "florida.museum"
+    "floripa.br"
+    "florist"
+    "floro.no"
+    "flor\303\270.no"
+    "flowers"
+    "flt.cloud.muni.cz"
+    "fly"
+    "fly.dev"
+    "flynnhosting.net"
+    "fl\303\245.no"
+    "fm"
+    "fm.br"
+    "fm.it"
+    "fm.no"
+    "fnc.fr-par.scw.cloud"
+    "fnd.br"
+    "fnwk.site"
+    "fo"
+    "foggia.it"
+    "folionetwork.site"
+    "folkebibl.no"
+    "folldal.no"
+    "foo"
+    "food"
+    "foodnetwork"
+    "fool.jp"
+    "football"
+    "for-better.biz"
+    "for-more.biz"
+    "for-our.info"
+    "for-some.biz"
+    "for-the.biz"
+    "force.museum"
+    "ford"
+    "forde.no"
+    "forex"
+    "forgeblocks.com"
+    "forgot.her.name"
+    "forgot.his.name"
+    "forli-cesena.it"
+    "forlicesena.it"
+    "forl\303\254-cesena.it"
+    "forl\303\254cesena.it"
+    "forsale"
+    "forsand.no"
+    "fortal.br"
+    "forte.id"
+    "fortmissoula.museum"
+    "fortworth.museum"
+    "forum"
+    "forum.hu"
+    "forumz.info"
+    "fosnes.no"
+    "fot.br"
+    "foundation"
+    "foundation.museum"
+    "fox"
+    "foz.br"
+    "fr"
+    "fr-1.paas.massivegrid.net"
+    "fr-par-1.baremetal.scw.cloud"
+    "fr-par-2.baremetal.scw.cloud"
+    "fr.eu.org"
+    "fr.it"
+    "fra1-de.cloudjiffy.net"
+    "framer.app"
+    "framer.media"
+    "framer.photos"
+    "framer.website"
+    "framer.wiki"
+    "framercanvas.com"
+    "frana.no"
+    "francaise.museum"
+    "frankfurt.museum"
+    "franziskaner.museum"
+    "fredrikstad.no"
+    "free"
+    "free.hr"
+    "freebox-os.com"
+    "freebox-os.fr"
+    "freeboxos.com"
+    "freeboxos.fr"
+    "freeddns.org"
+    "freeddns.us"
+    "freedesktop.org"
+    "freemasonry.museum"
+    "freemyip.com"
+    "freesite.host"
+    "freetls.fastly.net"
+    "frei.no"
+    "freiburg.museum"
+    "frenchkiss.jp"
+    "fresenius"
+    "fribourg.museum"
+    "friuli-v-giulia.it"
+    "friuli-ve-giulia.it"
+    "friuli-vegiulia.it"
+    "friuli-venezia-giulia.it"
+    "friuli-veneziagiulia.it"
+    "friuli-vgiulia.it"
+    "friuliv-giulia.it"
+    "friulive-giulia.it"
+    "friulivegiulia.it"
+    "friulivenezia-giulia.it"
+    "friuliveneziagiulia.it"
+    "friulivgiulia.it"
+    "frl"
+    "frog.museum"
+    "frogans"
+    "frogn.no"
+    "froland.no"
+    "from-ak.com"
+    "from-al.com"
+    "from-ar.com"
+    "from-az.net"
+    "from-ca.com"
+    "from-co.net"
+    "from-ct.com"
+    "from-dc.com"
+    "from-de.com"
+    "from-fl.com"
+    "from-ga.com"
+    "from-hi.com"
+    "from-ia.com"
+    "from-id.com"
+    "from-il.com"
+    "from-in.com"
+    "from-ks.com"
+    "from-ky.com"
+    "from-la.net"
+    "from-ma.com"
+    "from-md.com"
+    "from-me.org"
+    "from-mi.com"
+    "from-mn.com"
+    "from-mo.com"
+    "from-ms.com"
+    "from-mt.com"
+    "from-nc.com"
+    "from-nd.com"
+    "from-ne.com"
+    "from-nh.com"
+    "from-nj.com"
+    "from-nm.com"
+    "from-nv.com"
+    "from-ny.net"
+    "from-oh.com"
+    "from-ok.com"
+    "from-or.com"
+    "from-pa.com"
+    "from-pr.com"
+    "from-ri.com"
+    "from-sc.com"
+    "from-sd.com"
+    "from-tn.com"
+    "from-tx.com"
+    "from-ut.com"
+    "from-va.com"
+    "from-vt.com"
+    "from-wa.com"
+    "from-wi.com"
+    "from-wv.com"
+    "from-wy.com"
+    "from.hr"
+    "frontdoor"
+    "frontier"
+    "frosinone.it"
+    "frosta.no"
+    "froya.no"
+    "frusky.de"
+    "fr\303\246na.no"
+    "fr\303\270ya.no"
+    "fst.br"
+    "ftpaccess.cc"
+    "ftr"
+    "fuchu.hiroshima.jp"
+    "fuchu.tokyo.jp"
+    "fuchu.toyama.jp"
+    "fudai.iwate.jp"
+    "fuefuki.yamanashi.jp"
+    "fuel.aero"
+    "fuettertdasnetz.de"
+    "fuji.shizuoka.jp"
+    "fujieda.shizuoka.jp"
+    "fujiidera.osaka.jp"
+    "fujikawa.shizuoka.jp"
+    "fujikawa.yamanashi.jp"
+    "fujikawaguchiko.yamanashi.jp"
+    "fujimi.nagano.jp"
+    "fujimi.saitama.jp"
+    "fujimino.saitama.jp"
+    "fujinomiya.shizuoka.jp"
+    "fujioka.gunma.jp"
+    "fujisato.akita.jp"
+    "fujisawa.iwate.jp"
+    "fujisawa.kanagawa.jp"
+    "fujishiro.ibaraki.jp"
+    "fujitsu"
+    "fujiyoshida.yamanashi.jp"
+    "fukagawa.hokkaido.jp"
+    "fukaya.saitama.jp"
+    "fukuchi.fukuoka.jp"
+    "fukuchiyama.kyoto.jp"
+    "fukudomi.saga.jp"
+    "fukui.fukui.jp"
+    "fukui.jp"
+    "fukumitsu.toyama.jp"
+    "fukuoka.jp"
+    "fukuroi.shizuoka.jp"
+    "fukusaki.hyogo.jp"
+    "fukushima.fukushima.jp"
+    "fukushima.hokkaido.jp"
+    "fukushima.jp"
+    "fukuyama.hiroshima.jp"
+    "fun"
+    "funabashi.chiba.jp"
+    "funagata.yamagata.jp"
+    "funahashi.toyama.jp"
+    "functions.fnc.fr-par.scw.cloud"
+    "fund"
+    "fundacio.museum"
+    "fuoisku.no"
+    "fuossko.no"
+    "furano.hokkaido.jp"
+    "furniture"
+    "furniture.museum"
+    "furubira.hokkaido.jp"
+    "furudono.fukushima.jp"
+    "furukawa.miyagi.jp"
+    "fusa.no"
+    "fuso.aichi.jp"
+    "fussa.tokyo.jp"
+    "futaba.fukushima.jp"
+    "futbol"
+    "futsu.nagasaki.jp"
+    "futtsu.chiba.jp"
+    "futurecms.at"
+    "futurehosting.at"
+    "futuremailing.at"
+    "fvg.it"
+    "fyi"
+    "fylkesbibl.no"
+    "fyresdal.no"
+    "f\303\270rde.no"
+    "g.bg"
+    "g.se"
+    "g.vbrplsbx.io"
+    "g12.br"
+    "ga"
+    "ga.us"
+    "gaivuotna.no"
+    "gal"
+    "gallery"
+    "gallery.museum"
+    "gallo"
+    "gallup"
+    "galsa.no"
+    "gamagori.aichi.jp"
+    "game"
+    "game-host.org"
+    "game-server.cc"
+    "game.tw"
+    "games"
+    "games.hu"
+    "gamo.shiga.jp"
+    "gamvik.no"
+    "gangaviika.no"
+    "gangwon.kr"
+    "gap"
+    "garden"
+    "garden.museum"
+    "gateway.dev"
+    "gateway.museum"
+    "gaular.no"
+    "gausdal.no"
+    "gay"
+    "gb"
+    "gb.net"
+    "gbiz"
+    "gc.ca"
+    "gd"
+    "gd.cn"
+    "gda.pl"
+    "gdansk.pl"
+    "gdn"
+    "gdynia.pl"
+    "ge"
+    "ge.it"
+    "gea"
+    "geek.nz"
+    "geekgalaxy.com"
+    "geelvinck.museum"
+    "gehirn.ne.jp"
+    "geisei.kochi.jp"
+    "gemological.museum"
+    "gen.in"
+    "gen.mi.us"
+    "gen.ng"
+    "gen.nz"
+    "gen.tr"
+    "genkai.saga.jp"
+    "genoa.it"
+    "genova.it"
+    "gent"
+    "gentapps.com"
+    "genting"
+    "gentlentapis.com"
+    "geo.br"
+    "geology.museum"
+    "geometre-expert.fr"
+    "george"
+    "georgia.museum"
+    "georgia.su"
+    "getmyip.com"
+    "gets-it.net"
+    "gf"
+    "gg"
+    "gg.ax"
+    "ggee"
+    "ggf.br"
+    "gh"
+    "ghost.io"
+    "gi"
+    "giehtavuoatna.no"
+    "giessen.museum"
+    "gift"
+    "gifts"
+    "gifu.gifu.jp"
+    "gifu.jp"
+    "giize.com"
+    "gildeskal.no"
+    "gildesk\303\245l.no"
+    "ginan.gifu.jp"
+    "ginowan.okinawa.jp"
+    "ginoza.okinawa.jp"
+    "girlfriend.jp"
+    "girly.jp"
+    "giske.no"
+    "git-pages.rit.edu"
+    "git-repos.de"
+    "gitapp.si"
+    "github.io"
+    "githubpreview.dev"
+    "githubusercontent.com"
+    "gitlab.io"
+    "gitpage.si"
+    "gives"
+    "giving"
+    "gjemnes.no"
+    "gjerdrum.no"
+    "gjerstad.no"
+    "gjesdal.no"
+    "gjovik.no"
+    "gj\303\270vik.no"
+    "gl"
+    "glas.museum"
+    "glass"
+    "glass.museum"
+    "gle"
+    "gleeze.com"
+    "gliding.aero"
+    "glitch.me"
+    "gliwice.pl"
+    "global"
+    "global.prod.fastly.net"
+    "global.ssl.fastly.net"
+    "globo"
+    "glogow.pl"
+    "gloomy.jp"
+    "gloppen.no"
+    "glug.org.uk"
+    "gm"
+    "gmail"
+    "gmbh"
+    "gmina.pl"
+    "gmo"
+    "gmx"
+    "gn"
+    "gniezno.pl"
+    "go.ci"
+    "go.cr"
+    "go.dyndns.org"
+    "go.gov.br"
+    "go.id"
+    "go.it"
+    "go.jp"
+    "go.ke"
+    "go.kr"
+    "go.leg.br"
+    "go.pw"
+    "go.th"
+    "go.tj"
+    "go.tz"
+    "go.ug"
+    "gob.ar"
+    "gob.bo"
+    "gob.cl"
+    "gob.do"
+    "gob.ec"
+    "gob.es"
+    "gob.gt"
+    "gob.hn"
+    "gob.mx"
+    "gob.ni"
+    "gob.pa"
+    "gob.pe"
+    "gob.pk"
+    "gob.sv"
+    "gob.ve"
+    "gobo.wakayama.jp"
+    "godaddy"
+    "godo.gifu.jp"
+    "goiania.br"
+    "goip.de"
+    "gojome.akita.jp"
+    "gok.pk"
+    "gokase.miyazaki.jp"
+    "gol.no"
+    "gold"
+    "goldpoint"
+    "golf"
+    "golffan.us"
+    "gon.pk"
+    "gonna.jp"
+    "gonohe.aomori.jp"
+    "goo"
+    "goodyear"
+    "goog"
+    "google"
+    "googleapis.com"
+    "googlecode.com"
+    "gop"
+    "gop.pk"
+    "gorge.museum"
+    "gorizia.it"
+    "gorlice.pl"
+    "gos.pk"
+    "gose.nara.jp"
+    "gosen.niigata.jp"
+    "goshiki.hyogo.jp"
+    "got"
+    "gotdns.ch"
+    "gotdns.com"
+    "gotdns.org"
+    "gotemba.shizuoka.jp"
+    "goto.nagasaki.jp"
+    "gotpantheon.com"
+    "gotsu.shimane.jp"
+    "goupile.fr"
+    "gouv.ci"
+    "gouv.fr"
+    "gouv.ht"
+    "gouv.km"
+    "gouv.ml"
+    "gouv.sn"
+    "gov"
+    "gov.ac"
+    "gov.ae"
+    "gov.af"
+    "gov.al"
+    "gov.ar"
+    "gov.as"
+    "gov.au"
+    "gov.az"
+    "gov.ba"
+    "gov.bb"
+    "gov.bf"
+    "gov.bh"
+    "gov.bm"
+    "gov.bn"
+    "gov.br"
+    "gov.bs"
+    "gov.bt"
+    "gov.by"
+    "gov.bz"
+    "gov.cd"
+    "gov.cl"
+    "gov.cm"
+    "gov.cn"
+    "gov.co"
+    "gov.cu"
+    "gov.cx"
+    "gov.cy"
+    "gov.dm"
+    "gov.do"
+    "gov.dz"
+    "gov.ec"
+    "gov.ee"
+    "gov.eg"
+    "gov.et"
+    "gov.fj"
+    "gov.gd"
+    "gov.ge"
+    "gov.gh"
+    "gov.gi"
+    "gov.gn"
+    "gov.gr"
+    "gov.gu"
+    "gov.gy"
+    "gov.hk"
+    "gov.ie"
+    "gov.il"
+    "gov.in"
+    "gov.iq"
+    "gov.ir"
+    "gov.is"
+    "gov.it"
+    "gov.jo"
+    "gov.kg"
+    "gov.ki"
+    "gov.km"
+    "gov.kn"
+    "gov.kp"
+    "gov.kw"
+    "gov.kz"
+    "gov.la"
+    "gov.lb"
+    "gov.lc"
+    "gov.lk"
+    "gov.lr"
+    "gov.ls"
+    "gov.lt"
+    "gov.lv"
+    "gov.ly"
+    "gov.ma"
+    "gov.me"
+    "gov.mg"
+    "gov.mk"
+    "gov.ml"
+    "gov.mn"
+    "gov.mo"
+    "gov.mr"
+    "gov.ms"
+    "gov.mu"
+    "gov.mv"
+    "gov.mw"
+    "gov.my"
+    "gov.mz"
+    "gov.nc.tr"
+    "gov.ng"
+    "gov.nl"
+    "gov.nr"
+    "gov.om"
+    "gov.ph"
+    "gov.pk"
+    "gov.pl"
+    "gov.pn"
+    "gov.pr"
+    "gov.ps"
+    "gov.pt"
+    "gov.py"
+    "gov.qa"
+    "gov.rs"
+    "gov.ru"
+    "gov.rw"
+    "gov.sa"
+    "gov.sb"
+    "gov.sc"
+    "gov.scot"
+    "gov.sd"
+    "gov.sg"
+    "gov.sh"
+    "gov.sl"
+    "gov.so"
+    "gov.ss"
+    "gov.sx"
+    "gov.sy"
+    "gov.tj"
+    "gov.tl"
+    "gov.tm"
+    "gov.tn"
+    "gov.to"
+    "gov.tr"
+    "gov.tt"
+    "gov.tw"
+    "gov.ua"
+    "gov.uk"
+    "gov.vc"
+    "gov.ve"
+    "gov.vn"
+    "gov.ws"
+    "gov.ye"
+    "gov.za"
+    "gov.zm"
+    "gov.zw"
+    "government.aero"
+    "govt.nz"
+    "gp"
+    "gq"
+    "gr"
+    "gr.com"
+    "gr.eu.org"
+    "gr.it"
+    "gr.jp"
+    "grainger"
+    "grajewo.pl"
+    "gran.no"
+    "grandrapids.museum"
+    "grane.no"
+    "granvin.no"
+    "graphics"
+    "graphox.us"
+    "gratangen.no"
+    "gratis"
+    "graz.museum"
+    "greater.jp"
+    "green"
+    "greta.fr"
+    "grimstad.no"
+    "gripe"
+    "griw.gov.pl"
+    "grocery"
+    "groks-the.info"
+    "groks-this.info"
+    "grondar.za"
+    "grong.no"
+    "grosseto.it"
+    "groundhandling.aero"
+    "group"
+    "group.aero"
+    "grozny.ru"
+    "grozny.su"
+    "grp.lk"
+    "gru.br"
+    "grue.no"
+    "gs"
+    "gs.aa.no"
+    "gs.ah.no"
+    "gs.bu.no"
+    "gs.cn"
+    "gs.fm.no"
+    "gs.hl.no"
+    "gs.hm.no"
+    "gs.jan-mayen.no"
+    "gs.mr.no"
+    "gs.nl.no"
+    "gs.nt.no"
+    "gs.of.no"
+    "gs.ol.no"
+    "gs.oslo.no"
+    "gs.rl.no"
+    "gs.sf.no"
+    "gs.st.no"
+    "gs.svalbard.no"
+    "gs.tm.no"
+    "gs.tr.no"
+    "gs.va.no"
+    "gs.vf.no"
+    "gsj.bz"
+    "gsm.pl"
+    "gt"
+    "gu"
+    "gu.us"
+    "guam.gu"
+    "guardian"
+    "gub.uy"
+    "gucci"
+    "guernsey.museum"
+    "guge"
+    "guide"
+    "guitars"
+    "gujarat.in"
+    "gujo.gifu.jp"
+    "gulen.no"
+    "gunma.jp"
+    "guovdageaidnu.no"
+    "guru"
+    "gushikami.okinawa.jp"
+    "gv.ao"
+    "gv.at"
+    "gv.vc"
+    "gw"
+    "gwangju.kr"
+    "gx.cn"
+    "gy"
+    "gyeongbuk.kr"
+    "gyeonggi.kr"
+    "gyeongnam.kr"
+    "gyokuto.kumamoto.jp"
+    "gz.cn"
+    "g\303\241ivuotna.no"
+    "g\303\241ls\303\241.no"
+    "g\303\241\305\213gaviika.no"
+    "g\303\274nstigbestellen.de"
+    "g\303\274nstigliefern.de"
+    "h.bg"
+    "h.se"
+    "ha.cn"
+    "ha.no"
+    "habikino.osaka.jp"
+    "habmer.no"
+    "haboro.hokkaido.jp"
+    "hacca.jp"
+    "hachijo.tokyo.jp"
+    "hachinohe.aomori.jp"
+    "hachioji.tokyo.jp"
+    "hachirogata.akita.jp"
+    "hadano.kanagawa.jp"
+    "hadsel.no"
+    "haebaru.okinawa.jp"
+    "haga.tochigi.jp"
+    "hagebostad.no"
+    "hagi.yamaguchi.jp"
+    "haibara.shizuoka.jp"
+    "hair"
+    "hakata.fukuoka.jp"
+    "hakodate.hokkaido.jp"
+    "hakone.kanagawa.jp"
+    "hakuba.nagano.jp"
+    "hakui.ishikawa.jp"
+    "hakusan.ishikawa.jp"
+    "halden.no"
+    "half.host"
+    "halloffame.museum"
+    "halsa.no"
+    "ham-radio-op.net"
+    "hamada.shimane.jp"
+    "hamamatsu.shizuoka.jp"
+    "hamar.no"
+    "hamaroy.no"
+    "hamatama.saga.jp"
+    "hamatonbetsu.hokkaido.jp"
+    "hamburg"
+    "hamburg.museum"
+    "hammarfeasta.no"
+    "hammerfest.no"
+    "hamura.tokyo.jp"
+    "hanamaki.iwate.jp"
+    "hanamigawa.chiba.jp"
+    "hanawa.fukushima.jp"
+    "handa.aichi.jp"
+    "handcrafted.jp"
+    "handson.museum"
+    "hanggliding.aero"
+    "hangout"
+    "hannan.osaka.jp"
+    "hanno.saitama.jp"
+    "hanyu.saitama.jp"
+    "hapmir.no"
+    "happou.akita.jp"
+    "hara.nagano.jp"
+    "haram.no"
+    "hareid.no"
+    "harima.hyogo.jp"
+    "harstad.no"
+    "harvestcelebration.museum"
+    "hasama.oita.jp"
+    "hasami.nagasaki.jp"
+    "hashbang.sh"
+    "hashikami.aomori.jp"
+    "hashima.gifu.jp"
+    "hashimoto.wakayama.jp"
+    "hasuda.saitama.jp"
+    "hasura-app.io"
+    "hasura.app"
+    "hasvik.no"
+    "hatogaya.saitama.jp"
+    "hatoyama.saitama.jp"
+    "hatsukaichi.hiroshima.jp"
+    "hattfjelldal.no"
+    "haugesund.no"
+    "haus"
+    "hawaii.museum"
+    "hayakawa.yamanashi.jp"
+    "hayashima.okayama.jp"
+    "hazu.aichi.jp"
+    "hb.cldmail.ru"
+    "hb.cn"
+    "hbo"
+    "hdfc"
+    "hdfcbank"
+    "he.cn"
+    "health"
+    "health-carereform.com"
+    "health.museum"
+    "health.nz"
+    "health.vn"
+    "healthcare"
+    "heavy.jp"
+    "heguri.nara.jp"
+    "heimatunduhren.museum"
+    "hekinan.aichi.jp"
+    "hellas.museum"
+    "help"
+    "helsinki"
+    "helsinki.museum"
+    "hembygdsforbund.museum"
+    "hemne.no"
+    "hemnes.no"
+    "hemsedal.no"
+    "hepforge.org"
+    "her.jp"
+    "herad.no"
+    "here"
+    "here-for-more.info"
+    "heritage.museum"
+    "hermes"
+    "herokuapp.com"
+    "herokussl.com"
+    "heroy.more-og-romsdal.no"
+    "heroy.nordland.no"
+    "her\303\270y.m\303\270re-og-romsdal.no"
+    "her\303\270y.nordland.no"
+    "heteml.net"
+    "hgtv"
+    "hi.cn"
+    "hi.us"
+    "hicam.net"
+    "hichiso.gifu.jp"
+    "hida.gifu.jp"
+    "hidaka.hokkaido.jp"
+    "hidaka.kochi.jp"
+    "hidaka.saitama.jp"
+    "hidaka.wakayama.jp"
+    "hidora.com"
+    "higashi.fukuoka.jp"
+    "higashi.fukushima.jp"
+    "higashi.okinawa.jp"
+    "higashiagatsuma.gunma.jp"
+    "higashichichibu.saitama.jp"
+    "higashihiroshima.hiroshima.jp"
+    "higashiizu.shizuoka.jp"
+    "higashiizumo.shimane.jp"
+    "higashikagawa.kagawa.jp"
+    "higashikagura.hokkaido.jp"
+    "higashikawa.hokkaido.jp"
+    "higashikurume.tokyo.jp"
+    "higashimatsushima.miyagi.jp"
+    "higashimatsuyama.saitama.jp"
+    "higashimurayama.tokyo.jp"
+    "higashinaruse.akita.jp"
+    "higashine.yamagata.jp"
+    "higashiomi.shiga.jp"
+    "higashiosaka.osaka.jp"
+    "higashishirakawa.gifu.jp"
+    "higashisumiyoshi.osaka.jp"
+    "higashitsuno.kochi.jp"
+    "higashiura.aichi.jp"
+    "higashiyama.kyoto.jp"
+    "higashiyamato.tokyo.jp"
+    "higashiyodogawa.osaka.jp"
+    "higashiyoshino.nara.jp"
+    "hiho.jp"
+    "hiji.oita.jp"
+    "hikari.yamaguchi.jp"
+    "hikawa.shimane.jp"
+    "hikimi.shimane.jp"
+    "hikone.shiga.jp"
+    "himeji.hyogo.jp"
+    "himeshima.oita.jp"
+    "himi.toyama.jp"
+    "hino.tokyo.jp"
+    "hino.tottori.jp"
+    "hinode.tokyo.jp"
+    "hinohara.tokyo.jp"
+    "hioki.kagoshima.jp"
+    "hiphop"
+    "hippy.jp"
+    "hirado.nagasaki.jp"
+    "hiraizumi.iwate.jp"
+    "hirakata.osaka.jp"
+    "hiranai.aomori.jp"
+    "hirara.okinawa.jp"
+    "hirata.fukushima.jp"
+    "hiratsuka.kanagawa.jp"
+    "hiraya.nagano.jp"
+    "hirogawa.wakayama.jp"
+    "hirokawa.fukuoka.jp"
+    "hirono.fukushima.jp"
+    "hirono.iwate.jp"
+    "hiroo.hokkaido.jp"
+    "hirosaki.aomori.jp"
+    "hiroshima.jp"
+    "hisamitsu"
+    "hisayama.fukuoka.jp"
+    "histoire.museum"
+    "historical.museum"
+    "historicalsociety.museum"
+    "historichouses.museum"
+    "historisch.museum"
+    "historisches.museum"
+    "history.museum"
+    "historyofscience.museum"
+    "hita.oita.jp"
+    "hitachi"
+    "hitachi.ibaraki.jp"
+    "hitachinaka.ibaraki.jp"
+    "hitachiomiya.ibaraki.jp"
+    "hitachiota.ibaraki.jp"
+    "hitra.no"
+    "hiv"
+    "hizen.saga.jp"
+    "hjartdal.no"
+    "hjelmeland.no"
+    "hk"
+    "hk.cn"
+    "hk.com"
+    "hk.org"
+    "hkt"
+    "hl.cn"
+    "hl.no"
+    "hlx.live"
+    "hlx.page"
+    "hlx3.page"
+    "hm"
+    "hm.no"
+    "hn"
+    "hn.cn"
+    "hobby-site.com"
+    "hobby-site.org"
+    "hobol.no"
+    "hob\303\270l.no"
+    "hockey"
+    "hof.no"
+    "hofu.yamaguchi.jp"
+    "hokkaido.jp"
+    "hokksund.no"
+    "hokuryu.hokkaido.jp"
+    "hokuto.hokkaido.jp"
+    "hokuto.yamanashi.jp"
+    "hol.no"
+    "holdings"
+    "hole.no"
+    "holiday"
+    "holmestrand.no"
+    "holtalen.no"
+    "holt\303\245len.no"
+    "holy.jp"
+    "home-webserver.de"
+    "home.dyndns.org"
+    "homebuilt.aero"
+    "homedepot"
+    "homedns.org"
+    "homeftp.net"
+    "homeftp.org"
+    "homegoods"
+    "homeip.net"
+    "homelink.one"
+    "homelinux.com"
+    "homelinux.net"
+    "homelinux.org"
+    "homeoffice.gov.uk"
+    "homes"
+    "homesecuritymac.com"
+    "homesecuritypc.com"
+    "homesense"
+    "homesklep.pl"
+    "homeunix.com"
+    "homeunix.net"
+    "homeunix.org"
+    "honai.ehime.jp"
+    "honbetsu.hokkaido.jp"
+    "honda"
+    "honefoss.no"
+    "hongo.hiroshima.jp"
+    "honjo.akita.jp"
+    "honjo.saitama.jp"
+    "honjyo.akita.jp"
+    "hoplix.shop"
+    "hopto.me"
+    "hopto.org"
+    "hornindal.no"
+    "horokanai.hokkaido.jp"
+    "horology.museum"
+    "horonobe.hokkaido.jp"
+    "horse"
+    "horten.no"
+    "hosp.uk"
+    "hospital"
+    "host"
+    "hostedpi.com"
+    "hosting"
+    "hosting-cluster.nl"
+    "hosting.myjino.ru"
+    "hosting.ovh.net"
+    "hostyhosting.io"
+    "hot"
+    "hotel.hu"
+    "hotel.lk"
+    "hotel.tz"
+    "hoteles"
+    "hotels"
+    "hotelwithflight.com"
+    "hotmail"
+    "house"
+    "house.museum"
+    "how"
+    "hoyanger.no"
+    "hoylandet.no"
+    "hr"
+    "hr.eu.org"
+    "hra.health"
+    "hs.kr"
+    "hs.run"
+    "hs.zone"
+    "hsbc"
+    "ht"
+    "httpbin.org"
+    "hu"
+    "hu.com"
+    "hu.eu.org"
+    "hu.net"
+    "hughes"
+    "huissier-justice.fr"
+    "humanities.museum"
+    "hungry.jp"
+    "hurdal.no"
+    "hurum.no"
+    "hvaler.no"
+    "hyatt"
+    "hyllestad.no"
+    "hyogo.jp"
+    "hyuga.miyazaki.jp"
+    "hyundai"
+    "hzc.io"
+    "h\303\241bmer.no"
+    "h\303\241mm\303\241rfeasta.no"
+    "h\303\241pmir.no"
+    "h\303\244kkinen.fi"
+    "h\303\245.no"
+    "h\303\246gebostad.no"
+    "h\303\270nefoss.no"
+    "h\303\270yanger.no"
+    "h\303\270ylandet.no"
+    "i.bg"
+    "i.ng"
+    "i.ph"
+    "i.se"
+    "i234.me"
+    "ia.us"
+    "iamallama.com"
+    "ibara.okayama.jp"
+    "ibaraki.ibaraki.jp"
+    "ibaraki.jp"
+    "ibaraki.osaka.jp"
+    "ibestad.no"
+    "ibigawa.gifu.jp"
+    "ibm"
+    "ibxos.it"
+    "ic.gov.pl"
+    "icbc"
+    "ice"
+    "ichiba.tokushima.jp"
+    "ichihara.chiba.jp"
+    "ichikai.tochigi.jp"
+    "ichikawa.chiba.jp"
+    "ichikawa.hyogo.jp"
+    "ichikawamisato.yamanashi.jp"
+    "ichinohe.iwate.jp"
+    "ichinomiya.aichi.jp"
+    "ichinomiya.chiba.jp"
+    "ichinoseki.iwate.jp"
+    "icu"
+    "icurus.jp"
+    "id"
+    "id.au"
+    "id.firewalledreplit.co"
+    "id.forgerock.io"
+    "id.ir"
+    "id.lv"
+    "id.ly"
+    "id.repl.co"
+    "id.us"
+    "ide.kyoto.jp"
+    "idf.il"
+    "idrett.no"
+    "idv.hk"
+    "idv.tw"
+    "ie"
+    "ie.eu.org"
+    "ieee"
+    "if.ua"
+    "ifm"
+    "iglesias-carbonia.it"
+    "iglesiascarbonia.it"
+    "iheya.okinawa.jp"
+    "iida.nagano.jp"
+    "iide.yamagata.jp"
+    "iijima.nagano.jp"
+    "iitate.fukushima.jp"
+    "iiyama.nagano.jp"
+    "iizuka.fukuoka.jp"
+    "iizuna.nagano.jp"
+    "ikano"
+    "ikaruga.nara.jp"
+    "ikata.ehime.jp"
+    "ikawa.akita.jp"
+    "ikeda.fukui.jp"
+    "ikeda.gifu.jp"
+    "ikeda.hokkaido.jp"
+    "ikeda.nagano.jp"
+    "ikeda.osaka.jp"
+    "iki.fi"
+    "iki.nagasaki.jp"
+    "ikoma.nara.jp"
+    "ikusaka.nagano.jp"
+    "il"
+    "il.eu.org"
+    "il.us"
+    "ilawa.pl"
+    "iliadboxos.it"
+    "illustration.museum"
+    "ilovecollege.info"
+    "im"
+    "im.it"
+    "imabari.ehime.jp"
+    "imageandsound.museum"
+    "imakane.hokkaido.jp"
+    "imamat"
+    "imari.saga.jp"
+    "imb.br"
+    "imdb"
+    "imizu.toyama.jp"
+    "immo"
+    "immobilien"
+    "imperia.it"
+    "impertrix.com"
+    "impertrixcdn.com"
+    "in"
+    "in-addr.arpa"
+    "in-berlin.de"
+    "in-brb.de"
+    "in-butter.de"
+    "in-dsl.de"
+    "in-dsl.net"
+    "in-dsl.org"
+    "in-the-band.net"
+    "in-vpn.de"
+    "in-vpn.net"
+    "in-vpn.org"
+    "in.eu.org"
+    "in.futurecms.at"
+    "in.na"
+    "in.net"
+    "in.ni"
+    "in.rs"
+    "in.th"
+    "in.ua"
+    "in.us"
+    "ina.ibaraki.jp"
+    "ina.nagano.jp"
+    "ina.saitama.jp"
+    "inabe.mie.jp"
+    "inagawa.hyogo.jp"
+    "inagi.tokyo.jp"
+    "inami.toyama.jp"
+    "inami.wakayama.jp"
+    "inashiki.ibaraki.jp"
+    "inatsuki.fukuoka.jp"
+    "inawashiro.fukushima.jp"
+    "inazawa.aichi.jp"
+    "inc"
+    "inc.hk"
+    "incheon.kr"
+    "ind.br"
+    "ind.gt"
+    "ind.in"
+    "ind.kw"
+    "ind.tn"
+    "independent-commission.uk"
+    "independent-inquest.uk"
+    "independent-inquiry.uk"
+    "independent-panel.uk"
+    "independent-review.uk"
+    "inderoy.no"
+    "inder\303\270y.no"
+    "indian.museum"
+    "indiana.museum"
+    "indianapolis.museum"
+    "indianmarket.museum"
+    "indie.porn"
+    "indigena.bo"
+    "industria.bo"
+    "industries"
+    "ine.kyoto.jp"
+    "inf.br"
+    "inf.cu"
+    "inf.mk"
+    "inf.ua"
+    "infiniti"
+    "info"
+    "info.at"
+    "info.au"
+    "info.az"
+    "info.bb"
+    "info.bj"
+    "info.bo"
+    "info.co"
+    "info.cx"
+    "info.ec"
+    "info.et"
+    "info.fj"
+    "info.gu"
+    "info.ht"
+    "info.hu"
+    "info.in"
+    "info.ke"
+    "info.ki"
+    "info.la"
+    "info.ls"
+    "info.mv"
+    "info.na"
+    "info.nf"
+    "info.ni"
+    "info.nr"
+    "info.pk"
+    "info.pl"
+    "info.pr"
+    "info.ro"
+    "info.sd"
+    "info.tn"
+    "info.tr"
+    "info.tt"
+    "info.tz"
+    "info.ve"
+    "info.vn"
+    "info.zm"
+    "ing"
+    "ing.pa"
+    "ingatlan.hu"
+    "ink"
+    "ino.kochi.jp"
+    "instance.datadetect.com"
+    "instances.spawn.cc"
+    "instantcloud.cn"
+    "institute"
+    "insurance"
+    "insurance.aero"
+    "insure"
+    "int"
+    "int.ar"
+    "int.az"
+    "int.bo"
+    "int.ci"
+    "int.co"
+    "int.cv"
+    "int.eu.org"
+    "int.in"
+    "int.is"
+    "int.la"
+    "int.lk"
+    "int.mv"
+    "int.mw"
+    "int.ni"
+    "int.pt"
+    "int.ru"
+    "int.tj"
+    "int.tt"
+    "int.ve"
+    "int.vn"
+    "intelligence.museum"
+    "interactive.museum"
+    "international"
+    "internet-dns.de"
+    "internet.in"
+    "intl.tn"
+    "intuit"
+    "inuyama.aichi.jp"
+    "investments"
+    "inzai.chiba.jp"
+    "io"
+    "io.in"
+    "io.kg"
+    "iobb.net"
+    "iopsys.se"
+    "ip.linodeusercontent.com"
+    "ip6.arpa"
+    "ipifony.net"
+    "ipiranga"
+    "iq"
+    "ir"
+    "iraq.museum"
+    "iris.arpa"
+    "irish"
+    "iron.museum"
+    "iruma.saitama.jp"
+    "is"
+    "is-a-anarchist.com"
+    "is-a-blogger.com"
+    "is-a-bookkeeper.com"
+    "is-a-bruinsfan.org"
+    "is-a-bulls-fan.com"
+    "is-a-candidate.org"
+    "is-a-caterer.com"
+    "is-a-celticsfan.org"
+    "is-a-chef.com"
+    "is-a-chef.net"
+    "is-a-chef.org"
+    "is-a-conservative.com"
+    "is-a-cpa.com"
+    "is-a-cubicle-slave.com"
+    "is-a-democrat.com"
+    "is-a-designer.com"
+    "is-a-doctor.com"
+    "is-a-financialadvisor.com"
+    "is-a-geek.com"
+    "is-a-geek.net"
+    "is-a-geek.org"
+    "is-a-green.com"
+    "is-a-guru.com"
+    "is-a-hard-worker.com"
+    "is-a-hunter.com"
+    "is-a-knight.org"
+    "is-a-landscaper.com"
+    "is-a-lawyer.com"
+    "is-a-liberal.com"
+    "is-a-libertarian.com"
+    "is-a-linux-user.org"
+    "is-a-llama.com"
+    "is-a-musician.com"
+    "is-a-nascarfan.com"
+    "is-a-nurse.com"
+    "is-a-painter.com"
+    "is-a-patsfan.org"
+    "is-a-personaltrainer.com"
+    "is-a-photographer.com"
+    "is-a-player.com"
+    "is-a-republican.com"
+    "is-a-rockstar.com"
+    "is-a-socialist.com"
+    "is-a-soxfan.org"
+    "is-a-student.com"
+    "is-a-teacher.com"
+    "is-a-techie.com"
+    "is-a-therapist.com"
+    "is-an-accountant.com"
+    "is-an-actor.com"
+    "is-an-actress.com"
+    "is-an-anarchist.com"
+    "is-an-artist.com"
+    "is-an-engineer.com"
+    "is-an-entertainer.com"
+    "is-by.us"
+    "is-certified.com"
+    "is-found.org"
+    "is-gone.com"
+    "is-into-anime.com"
+    "is-into-cars.com"
+    "is-into-cartoons.com"
+    "is-into-games.com"
+    "is-leet.com"
+    "is-lost.org"
+    "is-not-certified.com"
+    "is-saved.org"
+    "is-slick.com"
+    "is-uberleet.com"
+    "is-very-bad.org"
+    "is-very-evil.org"
+    "is-very-good.org"
+    "is-very-nice.org"
+    "is-very-sweet.org"
+    "is-with-theband.com"
+    "is.eu.org"
+    "is.gov.pl"
+    "is.it"
+    "isa-geek.com"
+    "isa-geek.net"
+    "isa-geek.org"
+    "isa-hockeynut.com"
+    "isa.kagoshima.jp"
+    "isa.us"
+    "isahaya.nagasaki.jp"
+    "ise.mie.jp"
+    "isehara.kanagawa.jp"
+    "isen.kagoshima.jp"
+    "isernia.it"
+    "iserv.dev"
+    "iservschule.de"
+    "isesaki.gunma.jp"
+    "ishigaki.okinawa.jp"
+    "ishikari.hokkaido.jp"
+    "ishikawa.fukushima.jp"
+    "ishikawa.jp"
+    "ishikawa.okinawa.jp"
+    "ishinomaki.miyagi.jp"
+    "isla.pr"
+    "isleofman.museum"
+    "ismaili"
+    "isshiki.aichi.jp"
+    "issmarterthanyou.com"
+    "ist"
+    "istanbul"
+    "isteingeek.de"
+    "istmein.de"
+    "isumi.chiba.jp"
+    "it"
+    "it.ao"
+    "it.com"
+    "it.eu.org"
+    "it1.eur.aruba.jenv-aruba.cloud"
+    "it1.jenv-aruba.cloud"
+    "itabashi.tokyo.jp"
+    "itako.ibaraki.jp"
+    "itakura.gunma.jp"
+    "itami.hyogo.jp"
+    "itano.tokushima.jp"
+    "itau"
+    "itayanagi.aomori.jp"
+    "itcouldbewor.se"
+    "itigo.jp"
+    "ito.shizuoka.jp"
+    "itoigawa.niigata.jp"
+    "itoman.okinawa.jp"
+    "its.me"
+    "itv"
+    "ivano-frankivsk.ua"
+    "ivanovo.su"
+    "iveland.no"
+    "ivgu.no"
+    "iwade.wakayama.jp"
+    "iwafune.tochigi.jp"
+    "iwaizumi.iwate.jp"
+    "iwaki.fukushima.jp"
+    "iwakuni.yamaguchi.jp"
+    "iwakura.aichi.jp"
+    "iwama.ibaraki.jp"
+    "iwamizawa.hokkaido.jp"
+    "iwanai.hokkaido.jp"
+    "iwanuma.miyagi.jp"
+    "iwata.shizuoka.jp"
+    "iwate.iwate.jp"
+    "iwate.jp"
+    "iwatsuki.saitama.jp"
+    "iwi.nz"
+    "iyo.ehime.jp"
+    "iz.hr"
+    "izena.okinawa.jp"
+    "izu.shizuoka.jp"
+    "izumi.kagoshima.jp"
+    "izumi.osaka.jp"
+    "izumiotsu.osaka.jp"
+    "izumisano.osaka.jp"
+    "izumizaki.fukushima.jp"
+    "izumo.shimane.jp"
+    "izumozaki.niigata.jp"
+    "izunokuni.shizuoka.jp"
+    "j.bg"
+    "j.layershift.co.uk"
+    "j.scaleforce.com.cy"
+    "j.scaleforce.net"
+    "jab.br"
+    "jaguar"
+    "jambyl.su"
+    "jamison.museum"
+    "jampa.br"
+    "jan-mayen.no"
+    "java"
+    "jaworzno.pl"
+    "jc.neen.it"
+    "jcb"
+    "jcloud-ver-jpc.ik-server.com"
+    "jcloud.ik-server.com"
+    "jcloud.kz"
+    "jdevcloud.com"
+    "jdf.br"
+    "je"
+    "jed.wafaicloud.com"
+    "jeep"
+    "jefferson.museum"
+    "jeju.kr"
+    "jelastic.dogado.eu"
+    "jelastic.regruhosting.ru"
+    "jelastic.saveincloud.net"
+    "jelastic.team"
+    "jelastic.tsukaeru.net"
+    "jele.cloud"
+    "jele.club"
+    "jele.host"
+    "jele.io"
+    "jele.site"
+    "jelenia-gora.pl"
+    "jellybean.jp"
+    "jeonbuk.kr"
+    "jeonnam.kr"
+    "jerusalem.museum"
+    "jessheim.no"
+    "jetzt"
+    "jevnaker.no"
+    "jewelry"
+    "jewelry.museum"
+    "jewish.museum"
+    "jewishart.museum"
+    "jfk.museum"
+    "jgora.pl"
+    "jinsekikogen.hiroshima.jp"
+    "jio"
+    "jl.cn"
+    "jll"
+    "jls-sto1.elastx.net"
+    "jls-sto2.elastx.net"
+    "jls-sto3.elastx.net"
+    "jm"
+    "jmp"
+    "jnj"
+    "jo"
+    "joboji.iwate.jp"
+    "jobs"
+    "jobs.tt"
+    "joburg"
+    "joetsu.niigata.jp"
+    "jogasz.hu"
+    "johana.toyama.jp"
+    "joinville.br"
+    "jolster.no"
+    "jondal.no"
+    "jor.br"
+    "jorpeland.no"
+    "joso.ibaraki.jp"
+    "jot"
+    "jotelulu.cloud"
+    "journal.aero"
+    "journalism.museum"
+    "journalist.aero"
+    "joy"
+    "joyo.kyoto.jp"
+    "jozi.biz"
+    "jp"
+    "jp.eu.org"
+    "jp.kg"
+    "jp.md"
+    "jp.net"
+    "jpmorgan"
+    "jpn.com"
+    "jprs"
+    "js.cn"
+    "js.org"
+    "js.wpenginepowered.com"
+    "ju.mp"
+    "judaica.museum"
+    "judygarland.museum"
+    "juedisches.museum"
+    "juegos"
+    "juif.museum"
+    "juniper"
+    "jur.pro"
+    "jus.br"
+    "jx.cn"
+    "j\303\270lster.no"
+    "j\303\270rpeland.no"
+    "k.bg"
+    "k.se"
+    "k12.ak.us"
+    "k12.al.us"
+    "k12.ar.us"
+    "k12.as.us"
+    "k12.az.us"
+    "k12.ca.us"
+    "k12.co.us"
+    "k12.ct.us"
+    "k12.dc.us"
+    "k12.de.us"
+    "k12.ec"
+    "k12.fl.us"
+    "k12.ga.us"
+    "k12.gu.us"
+    "k12.ia.us"
+    "k12.id.us"
+    "k12.il"
+    "k12.il.us"
+    "k12.in.us"
+    "k12.ks.us"
+    "k12.ky.us"
+    "k12.la.us"
+    "k12.ma.us"
+    "k12.md.us"
+    "k12.me.us"
+    "k12.mi.us"
+    "k12.mn.us"
+    "k12.mo.us"
+    "k12.ms.us"
+    "k12.mt.us"
+    "k12.nc.us"
+    "k12.ne.us"
+    "k12.nh.us"
+    "k12.nj.us"
+    "k12.nm.us"
+    "k12.nv.us"
+    "k12.ny.us"
+    "k12.oh.us"
+    "k12.ok.us"
+    "k12.or.us"
+    "k12.pa.us"
+    "k12.pr.us"
+    "k12.sc.us"
+    "k12.tn.us"
+    "k12.tr"
+    "k12.tx.us"
+    "k12.ut.us"
+    "k12.va.us"
+    "k12.vi"
+    "k12.vi.us"
+    "k12.vt.us"
+    "k12.wa.us"
+    "k12.wi.us"
+    "k12.wy.us"
+    "k8s.fr-par.scw.cloud"
+    "k8s.nl-ams.scw.cloud"
+    "k8s.pl-waw.scw.cloud"
+    "k8s.scw.cloud"
+    "kaas.gg"
+    "kadena.okinawa.jp"
+    "kadogawa.miyazaki.jp"
+    "kadoma.osaka.jp"
+    "kafjord.no"
+    "kaga.ishikawa.jp"
+    "kagami.kochi.jp"
+    "kagamiishi.fukushima.jp"
+    "kagamino.okayama.jp"
+    "kagawa.jp"
+    "kagoshima.jp"
+    "kagoshima.kagoshima.jp"
+    "kaho.fukuoka.jp"
+    "kahoku.ishikawa.jp"
+    "kahoku.yamagata.jp"
+    "kai.yamanashi.jp"
+    "kainan.tokushima.jp"
+    "kainan.wakayama.jp"
+    "kaisei.kanagawa.jp"
+    "kaita.hiroshima.jp"
+    "kaizuka.osaka.jp"
+    "kakamigahara.gifu.jp"
+    "kakegawa.shizuoka.jp"
+    "kakinoki.shimane.jp"
+    "kakogawa.hyogo.jp"
+    "kakuda.miyagi.jp"
+    "kalisz.pl"
+    "kalmykia.ru"
+    "kalmykia.su"
+    "kaluga.su"
+    "kamagaya.chiba.jp"
+    "kamaishi.iwate.jp"
+    "kamakura.kanagawa.jp"
+    "kameoka.kyoto.jp"
+    "kameyama.mie.jp"
+    "kami.kochi.jp"
+    "kami.miyagi.jp"
+    "kamiamakusa.kumamoto.jp"
+    "kamifurano.hokkaido.jp"
+    "kamigori.hyogo.jp"
+    "kamiichi.toyama.jp"
+    "kamiizumi.saitama.jp"
+    "kamijima.ehime.jp"
+    "kamikawa.hokkaido.jp"
+    "kamikawa.hyogo.jp"
+    "kamikawa.saitama.jp"
+    "kamikitayama.nara.jp"
+    "kamikoani.akita.jp"
+    "kamimine.saga.jp"
+    "kaminokawa.tochigi.jp"
+    "kaminoyama.yamagata.jp"
+    "kamioka.akita.jp"
+    "kamisato.saitama.jp"
+    "kamishihoro.hokkaido.jp"
+    "kamisu.ibaraki.jp"
+    "kamisunagawa.hokkaido.jp"
+    "kamitonda.wakayama.jp"
+    "kamitsue.oita.jp"
+    "kamo.kyoto.jp"
+    "kamo.niigata.jp"
+    "kamoenai.hokkaido.jp"
+    "kamogawa.chiba.jp"
+    "kanagawa.jp"
+    "kanan.osaka.jp"
+    "kanazawa.ishikawa.jp"
+    "kanegasaki.iwate.jp"
+    "kaneyama.fukushima.jp"
+    "kaneyama.yamagata.jp"
+    "kani.gifu.jp"
+    "kanie.aichi.jp"
+    "kanmaki.nara.jp"
+    "kanna.gunma.jp"
+    "kannami.shizuoka.jp"
+    "kanonji.kagawa.jp"
+    "kanoya.kagoshima.jp"
+    "kanra.gunma.jp"
+    "kanuma.tochigi.jp"
+    "kanzaki.saga.jp"
+    "kapsi.fi"
+    "karacol.su"
+    "karaganda.su"
+    "karasjohka.no"
+    "karasjok.no"
+    "karasuyama.tochigi.jp"
+    "karate.museum"
+    "karatsu.saga.jp"
+    "karelia.su"
+    "karikatur.museum"
+    "kariwa.niigata.jp"
+    "kariya.aichi.jp"
+    "karlsoy.no"
+    "karmoy.no"
+    "karm\303\270y.no"
+    "karpacz.pl"
+    "kartuzy.pl"
+    "karuizawa.nagano.jp"
+    "karumai.iwate.jp"
+    "kasahara.gifu.jp"
+    "kasai.hyogo.jp"
+    "kasama.ibaraki.jp"
+    "kasamatsu.gifu.jp"
+    "kasaoka.okayama.jp"
+    "kashiba.nara.jp"
+    "kashihara.nara.jp"
+    "kashima.ibaraki.jp"
+    "kashima.saga.jp"
+    "kashiwa.chiba.jp"
+    "kashiwara.osaka.jp"
+    "kashiwazaki.niigata.jp"
+    "kasserver.com"
+    "kasuga.fukuoka.jp"
+    "kasuga.hyogo.jp"
+    "kasugai.aichi.jp"
+    "kasukabe.saitama.jp"
+    "kasumigaura.ibaraki.jp"
+    "kasuya.fukuoka.jp"
+    "kaszuby.pl"
+    "katagami.akita.jp"
+    "katano.osaka.jp"
+    "katashina.gunma.jp"
+    "katori.chiba.jp"
+    "katowice.pl"
+    "katsuragi.nara.jp"
+    "katsuragi.wakayama.jp"
+    "katsushika.tokyo.jp"
+    "katsuura.chiba.jp"
+    "katsuyama.fukui.jp"
+    "kaufen"
+    "kautokeino.no"
+    "kawaba.gunma.jp"
+    "kawachinagano.osaka.jp"
+    "kawagoe.mie.jp"
+    "kawagoe.saitama.jp"
+    "kawaguchi.saitama.jp"
+    "kawahara.tottori.jp"
+    "kawai.iwate.jp"
+    "kawai.nara.jp"
+    "kawaiishop.jp"
+    "kawajima.saitama.jp"
+    "kawakami.nagano.jp"
+    "kawakami.nara.jp"
+    "kawakita.ishikawa.jp"
+    "kawamata.fukushima.jp"
+    "kawaminami.miyazaki.jp"
+    "kawanabe.kagoshima.jp"
+    "kawanehon.shizuoka.jp"
+    "kawanishi.hyogo.jp"
+    "kawanishi.nara.jp"
+    "kawanishi.yamagata.jp"
+    "kawara.fukuoka.jp"
+    "kawasaki.jp"
+    "kawasaki.miyagi.jp"
+    "kawatana.nagasaki.jp"
+    "kawaue.gifu.jp"
+    "kawazu.shizuoka.jp"
+    "kayabe.hokkaido.jp"
+    "kazimierz-dolny.pl"
+    "kazo.saitama.jp"
+    "kazuno.akita.jp"
+    "kddi"
+    "ke"
+    "keisen.fukuoka.jp"
+    "keliweb.cloud"
+    "kembuchi.hokkaido.jp"
+    "kep.tr"
+    "kepno.pl"
+    "kerryhotels"
+    "kerrylogistics"
+    "kerryproperties"
+    "ketrzyn.pl"
+    "keymachine.de"
+    "kfh"
+    "kg"
+    "kg.kr"
+    "kh"
+    "kh.ua"
+    "khakassia.su"
+    "kharkiv.ua"
+    "kharkov.ua"
+    "kherson.ua"
+    "khmelnitskiy.ua"
+    "khmelnytskyi.ua"
+    "khplay.nl"
+    "ki"
+    "kia"
+    "kibichuo.okayama.jp"
+    "kicks-ass.net"
+    "kicks-ass.org"
+    "kids"
+    "kids.museum"
+    "kids.us"
+    "kiev.ua"
+    "kiho.mie.jp"
+    "kihoku.ehime.jp"
+    "kijo.miyazaki.jp"
+    "kikirara.jp"
+    "kikonai.hokkaido.jp"
+    "kikuchi.kumamoto.jp"
+    "kikugawa.shizuoka.jp"
+    "kilatiron.com"
+    "kill.jp"
+    "kilo.jp"
+    "kim"
+    "kimino.wakayama.jp"
+    "kimitsu.chiba.jp"
+    "kimobetsu.hokkaido.jp"
+    "kin.okinawa.jp"
+    "kinder"
+    "kindle"
+    "kinghost.net"
+    "kinko.kagoshima.jp"
+    "kinokawa.wakayama.jp"
+    "kira.aichi.jp"
+    "kirkenes.no"
+    "kirovograd.ua"
+    "kiryu.gunma.jp"
+    "kisarazu.chiba.jp"
+    "kishiwada.osaka.jp"
+    "kiso.nagano.jp"
+    "kisofukushima.nagano.jp"
+    "kisosaki.mie.jp"
+    "kita.kyoto.jp"
+    "kita.osaka.jp"
+    "kita.tokyo.jp"
+    "kitaaiki.nagano.jp"
+    "kitaakita.akita.jp"
+    "kitadaito.okinawa.jp"
+    "kitagata.gifu.jp"
+    "kitagata.saga.jp"
+    "kitagawa.kochi.jp"
+    "kitagawa.miyazaki.jp"
+    "kitahata.saga.jp"
+    "kitahiroshima.hokkaido.jp"
+    "kitakami.iwate.jp"
+    "kitakata.fukushima.jp"
+    "kitakata.miyazaki.jp"
+    "kitakyushu.jp"
+    "kitami.hokkaido.jp"
+    "kitamoto.saitama.jp"
+    "kitanakagusuku.okinawa.jp"
+    "kitashiobara.fukushima.jp"
+    "kitaura.miyazaki.jp"
+    "kitayama.wakayama.jp"
+    "kitchen"
+    "kiwa.mie.jp"
+    "kiwi"
+    "kiwi.nz"
+    "kiyama.saga.jp"
+    "kiyokawa.kanagawa.jp"
+    "kiyosato.hokkaido.jp"
+    "kiyose.tokyo.jp"
+    "kiyosu.aichi.jp"
+    "kizu.kyoto.jp"
+    "klabu.no"
+    "klepp.no"
+    "klodzko.pl"
+    "kl\303\246bu.no"
+    "km"
+    "km.ua"
+    "kmpsp.gov.pl"
+    "kn"
+    "knightpoint.systems"
+    "knowsitall.info"
+    "knx-server.net"
+    "kobayashi.miyazaki.jp"
+    "kobe.jp"
+    "kobierzyce.pl"
+    "kochi.jp"
+    "kochi.kochi.jp"
+    "kodaira.tokyo.jp"
+    "koebenhavn.museum"
+    "koeln"
+    "koeln.museum"
+    "kofu.yamanashi.jp"
+    "koga.fukuoka.jp"
+    "koga.ibaraki.jp"
+    "koganei.tokyo.jp"
+    "koge.tottori.jp"
+    "koka.shiga.jp"
+    "kokonoe.oita.jp"
+    "kokubunji.tokyo.jp"
+    "kolobrzeg.pl"
+    "komae.tokyo.jp"
+    "komagane.nagano.jp"
+    "komaki.aichi.jp"
+    "komatsu"
+    "komatsu.ishikawa.jp"
+    "komatsushima.tokushima.jp"
+    "komforb.se"
+    "kommunalforbund.se"
+    "kommune.no"
+    "komono.mie.jp"
+    "komoro.nagano.jp"
+    "komvux.se"
+    "konan.aichi.jp"
+    "konan.shiga.jp"
+    "kongsberg.no"
+    "kongsvinger.no"
+    "konin.pl"
+    "konskowola.pl"
+    "konsulat.gov.pl"
+    "konyvelo.hu"
+    "koobin.events"
+    "koori.fukushima.jp"
+    "kopervik.no"
+    "koriyama.fukushima.jp"
+    "koryo.nara.jp"
+    "kosai.shizuoka.jp"
+    "kosaka.akita.jp"
+    "kosei.shiga.jp"
+    "kosher"
+    "koshigaya.saitama.jp"
+    "koshimizu.hokkaido.jp"
+    "koshu.yamanashi.jp"
+    "kosuge.yamanashi.jp"
+    "kota.aichi.jp"
+    "koto.shiga.jp"
+    "koto.tokyo.jp"
+    "kotohira.kagawa.jp"
+    "kotoura.tottori.jp"
+    "kouhoku.saga.jp"
+    "kounosu.saitama.jp"
+    "kouyama.kagoshima.jp"
+    "kouzushima.tokyo.jp"
+    "koya.wakayama.jp"
+    "koza.wakayama.jp"
+    "kozagawa.wakayama.jp"
+    "kozaki.chiba.jp"
+    "kozow.com"
+    "kp"
+    "kpmg"
+    "kpn"
+    "kppsp.gov.pl"
+    "kr"
+    "kr.com"
+    "kr.eu.org"
+    "kr.it"
+    "kr.ua"
+    "kraanghke.no"
+    "kragero.no"
+    "krager\303\270.no"
+    "krakow.pl"
+    "krasnik.pl"
+    "krasnodar.su"
+    "krd"
+    "kred"
+    "krellian.net"
+    "kristiansand.no"
+    "kristiansund.no"
+    "krodsherad.no"
+    "krokstadelva.no"
+    "krym.ua"
+    "kr\303\245anghke.no"
+    "kr\303\270dsherad.no"
+    "ks.ua"
+    "ks.us"
+    "ktistory.com"
+    "kuchinotsu.nagasaki.jp"
+    "kudamatsu.yamaguchi.jp"
+    "kudoyama.wakayama.jp"
+    "kui.hiroshima.jp"
+    "kuji.iwate.jp"
+    "kuju.oita.jp"
+    "kujukuri.chiba.jp"
+    "kuki.saitama.jp"
+    "kuleuven.cloud"
+    "kumagaya.saitama.jp"
+    "kumakogen.ehime.jp"
+    "kumamoto.jp"
+    "kumamoto.kumamoto.jp"
+    "kumano.hiroshima.jp"
+    "kumano.mie.jp"
+    "kumatori.osaka.jp"
+    "kumejima.okinawa.jp"
+    "kumenan.okayama.jp"
+    "kumiyama.kyoto.jp"
+    "kunden.ortsinfo.at"
+    "kunigami.okinawa.jp"
+    "kunimi.fukushima.jp"
+    "kunisaki.oita.jp"
+    "kunitachi.tokyo.jp"
+    "kunitomi.miyazaki.jp"
+    "kunneppu.hokkaido.jp"
+    "kunohe.iwate.jp"
+    "kunst.museum"
+    "kunstsammlung.museum"
+    "kunstunddesign.museum"
+    "kuokgroup"
+    "kurashiki.okayama.jp"
+    "kurate.fukuoka.jp"
+    "kure.hiroshima.jp"
+    "kurgan.su"
+    "kuriyama.hokkaido.jp"
+    "kurobe.toyama.jp"
+    "kurogi.fukuoka.jp"
+    "kuroishi.aomori.jp"
+    "kuroiso.tochigi.jp"
+    "kuromatsunai.hokkaido.jp"
+    "kuron.jp"
+    "kurotaki.nara.jp"
+    "kurume.fukuoka.jp"
+    "kusatsu.gunma.jp"
+    "kusatsu.shiga.jp"
+    "kushima.miyazaki.jp"
+    "kushimoto.wakayama.jp"
+    "kushiro.hokkaido.jp"
+    "kustanai.ru"
+    "kustanai.su"
+    "kusu.oita.jp"
+    "kutchan.hokkaido.jp"
+    "kutno.pl"
+    "kuwana.mie.jp"
+    "kuzumaki.iwate.jp"
+    "kv.ua"
+    "kvafjord.no"
+    "kvalsund.no"
+    "kvam.no"
+    "kvanangen.no"
+    "kvinesdal.no"
+    "kvinnherad.no"
+    "kviteseid.no"
+    "kvitsoy.no"
+    "kvits\303\270y.no"
+    "kv\303\246fjord.no"
+    "kv\303\246nangen.no"
+    "kw"
+    "kwp.gov.pl"
+    "kwpsp.gov.pl"
+    "ky"
+    "ky.us"
+    "kyiv.ua"
+    "kyonan.chiba.jp"
+    "kyotamba.kyoto.jp"
+    "kyotanabe.kyoto.jp"
+    "kyotango.kyoto.jp"
+    "kyoto"
+    "kyoto.jp"
+    "kyowa.akita.jp"
+    "kyowa.hokkaido.jp"
+    "kyuragi.saga.jp"
+    "kz"
+    "k\303\241r\303\241\305\241johka.no"
+    "k\303\245fjord.no"
+    "l-o-g-i-n.de"
+    "l.bg"
+    "l.se"
+    "la"
+    "la-spezia.it"
+    "la.us"
+    "laakesvuemie.no"
+    "lab.ms"
+    "labor.museum"
+    "labour.museum"
+    "lacaixa"
+    "lahppi.no"
+    "lajolla.museum"
+    "lakas.hu"
+    "lamborghini"
+    "lamer"
+    "lanbib.se"
+    "lancashire.museum"
+    "lancaster"
+    "lancia"
+    "land"
+    "land-4-sale.us"
+    "landes.museum"
+    "landing.myjino.ru"
+    "landrover"
+    "langevag.no"
+    "langev\303\245g.no"
+    "lans.museum"
+    "lanxess"
+    "lapy.pl"
+    "laquila.it"
+    "lardal.no"
+    "larsson.museum"
+    "larvik.no"
+    "lasalle"
+    "laspezia.it"
+    "lat"
+    "latina.it"
+    "latino"
+    "latrobe"
+    "lavagis.no"
+    "lavangen.no"
+    "law"
+    "law.pro"
+    "law.za"
+    "lawyer"
+    "laz.it"
+    "lazio.it"
+    "lb"
+    "lc"
+    "lc.it"
+    "lcl.dev"
+    "lclstage.dev"
+    "lcube-server.de"
+    "lds"
+    "le.it"
+    "leadpages.co"
+    "leangaviika.no"
+    "lease"
+    "leasing.aero"
+    "lea\305\213gaviika.no"
+    "lebesby.no"
+    "lebork.pl"
+    "lebtimnetz.de"
+    "lecce.it"
+    "lecco.it"
+    "leclerc"
+    "leczna.pl"
+    "lefrak"
+    "leg.br"
+    "legal"
+    "legnica.pl"
+    "lego"
+    "leikanger.no"
+    "leirfjord.no"
+    "leirvik.no"
+    "leitungsen.de"
+    "leka.no"
+    "leksvik.no"
+    "lel.br"
+    "lelux.site"
+    "lenug.su"
+    "lenvik.no"
+    "lerdal.no"
+    "lesja.no"
+    "levanger.no"
+    "lewismiller.museum"
+    "lexus"
+    "lezajsk.pl"
+    "lg.jp"
+    "lg.ua"
+    "lgbt"
+    "li"
+    "li.it"
+    "lib.ak.us"
+    "lib.al.us"
+    "lib.ar.us"
+    "lib.as.us"
+    "lib.az.us"
+    "lib.ca.us"
+    "lib.co.us"
+    "lib.ct.us"
+    "lib.dc.us"
+    "lib.de.us"
+    "lib.ee"
+    "lib.fl.us"
+    "lib.ga.us"
+    "lib.gu.us"
+    "lib.hi.us"
+    "lib.ia.us"
+    "lib.id.us"
+    "lib.il.us"
+    "lib.in.us"
+    "lib.ks.us"
+    "lib.ky.us"
+    "lib.la.us"
+    "lib.ma.us"
+    "lib.md.us"
+    "lib.me.us"
+    "lib.mi.us"
+    "lib.mn.us"
+    "lib.mo.us"
+    "lib.ms.us"
+    "lib.mt.us"
+    "lib.nc.us"
+    "lib.nd.us"
+    "lib.ne.us"
+    "lib.nh.us"
+    "lib.nj.us"
+    "lib.nm.us"
+    "lib.nv.us"
+    "lib.ny.us"
+    "lib.oh.us"
+    "lib.ok.us"
+    "lib.or.us"
+    "lib.pa.us"
+    "lib.pr.us"
+    "lib.ri.us"
+    "lib.sc.us"
+    "lib.sd.us"
+    "lib.tn.us"
+    "lib.tx.us"
+    "lib.ut.us"
+    "lib.va.us"
+    "lib.vi.us"
+    "lib.vt.us"
+    "lib.wa.us"
+    "lib.wi.us"
+    "lib.wy.us"
+    "lidl"
+    "lier.no"
+    "lierne.no"
+    "life"
+    "lifeinsurance"
+    "lifestyle"
+    "lig.it"
+    "lighting"
+    "liguria.it"
+    "like"
+    "likes-pie.com"
+    "likescandy.com"
+    "lillehammer.no"
+    "lillesand.no"
+    "lilly"
+    "lima-city.at"
+    "lima-city.ch"
+    "lima-city.de"
+    "lima-city.rocks"
+    "lima.zone"
+    "limanowa.pl"
+    "limited"
+    "limo"
+    "lincoln"
+    "lincoln.museum"
+    "lindas.no"
+    "linde"
+    "lindesnes.no"
+    "lind\303\245s.no"
+    "link"
+    "linkyard-cloud.ch"
+    "linkyard.cloud"
+    "linodeobjects.com"
+    "linz.museum"
+    "lipsy"
+    "littlestar.jp"
+    "live"
+    "living"
+    "living.museum"
+    "livinghistory.museum"
+    "livorno.it"
+    "lk"
+    "lk3.ru"
+    "llc"
+    "llp"
+    "ln.cn"
+    "lo.it"
+    "loabat.no"
+    "loab\303\241t.no"
+    "loan"
+    "loans"
+    "localhistory.museum"
+    "localhost.daplie.me"
+    "localzone.xyz"
+    "locker"
+    "locus"
+    "lodi.it"
+    "lodingen.no"
+    "log.br"
+    "loginline.app"
+    "loginline.dev"
+    "loginline.io"
+    "loginline.services"
+    "loginline.site"
+    "loginto.me"
+    "logistics.aero"
+    "logoip.com"
+    "logoip.de"
+    "lohmus.me"
+    "loisirs.bj"
+    "lol"
+    "lolipop.io"
+    "lolipopmc.jp"
+    "lolitapunk.jp"
+    "lom.it"
+    "lom.no"
+    "lombardia.it"
+    "lombardy.it"
+    "lomo.jp"
+    "lomza.pl"
+    "lon-1.paas.massivegrid.net"
+    "lon-2.paas.massivegrid.net"
+    "lon.wafaicloud.com"
+    "london"
+    "london.cloudapps.digital"
+    "london.museum"
+    "londrina.br"
+    "loppa.no"
+    "lorenskog.no"
+    "losangeles.museum"
+    "loseyourip.com"
+    "loten.no"
+    "lotte"
+    "lotto"
+    "louvre.museum"
+    "love"
+    "lovepop.jp"
+    "lovesick.jp"
+    "lowicz.pl"
+    "loyalist.museum"
+    "lpages.co"
+    "lpl"
+    "lplfinancial"
+    "lpusercontent.com"
+    "lr"
+    "ls"
+    "lt"
+    "lt.eu.org"
+    "lt.it"
+    "lt.ua"
+    "ltd"
+    "ltd.co.im"
+    "ltd.cy"
+    "ltd.gi"
+    "ltd.hk"
+    "ltd.lk"
+    "ltd.ng"
+    "ltd.ua"
+    "ltd.uk"
+    "ltda"
+    "lu"
+    "lu.eu.org"
+    "lu.it"
+    "lubartow.pl"
+    "lubin.pl"
+    "lublin.pl"
+    "lucania.it"
+    "lucca.it"
+    "lucerne.museum"
+    "lug.org.uk"
+    "lugansk.ua"
+    "lugs.org.uk"
+    "lukow.pl"
+    "lund.no"
+    "lundbeck"
+    "lunner.no"
+    "luroy.no"
+    "lur\303\270y.no"
+    "luster.no"
+    "lutsk.ua"
+    "luxe"
+    "luxembourg.museum"
+    "luxury"
+    "luzern.museum"
+    "lv"
+    "lv.eu.org"
+    "lv.ua"
+    "lviv.ua"
+    "ly"
+    "lyngdal.no"
+    "lyngen.no"
+    "lynx.mythic-beasts.com"
+    "l\303\241hppi.no"
+    "l\303\244ns.museum"
+    "l\303\246rdal.no"
+    "l\303\270dingen.no"
+    "l\303\270renskog.no"
+    "l\303\270ten.no"
+    "m.bg"
+    "m.se"
+    "ma"
+    "ma.gov.br"
+    "ma.leg.br"
+    "ma.us"
+    "macapa.br"
+    "maceio.br"
+    "macerata.it"
+    "machida.tokyo.jp"
+    "macys"
+    "mad.museum"
+    "madrid"
+    "madrid.museum"
+    "maebashi.gunma.jp"
+    "magazine.aero"
+    "magentosite.cloud"
+    "magnet.page"
+    "maibara.shiga.jp"
+    "maif"
+    "mail.pl"
+    "main.jp"
+    "maintenance.aero"
+    "maison"
+    "maizuru.kyoto.jp"
+    "makeup"
+    "makinohara.shizuoka.jp"
+    "makurazaki.kagoshima.jp"
+    "malatvuopmi.no"
+    "malbork.pl"
+    "mallorca.museum"
+    "malopolska.pl"
+    "malselv.no"
+    "malvik.no"
+    "mamurogawa.yamagata.jp"
+    "man"
+    "management"
+    "manaus.br"
+    "manchester.museum"
+    "mandal.no"
+    "mango"
+    "mangyshlak.su"
+    "maniwa.okayama.jp"
+    "manno.kagawa.jp"
+    "mansion.museum"
+    "mansions.museum"
+    "mantova.it"
+    "manx.museum"
+    "maori.nz"
+    "map"
+    "map.fastly.net"
+    "map.fastlylb.net"
+    "mar.it"
+    "marburg.museum"
+    "marche.it"
+    "marine.ru"
+    "maringa.br"
+    "maritime.museum"
+    "maritimo.museum"
+    "marker.no"
+    "market"
+    "marketing"
+    "markets"
+    "marnardal.no"
+    "marriott"
+    "marshalls"
+    "marugame.kagawa.jp"
+    "marumori.miyagi.jp"
+    "maryland.museum"
+    "marylhurst.museum"
+    "masaki.ehime.jp"
+    "maserati"
+    "masfjorden.no"
+    "mashike.hokkaido.jp"
+    "mashiki.kumamoto.jp"
+    "mashiko.tochigi.jp"
+    "masoy.no"
+    "massa-carrara.it"
+    "massacarrara.it"
+    "masuda.shimane.jp"
+    "mat.br"
+    "matera.it"
+    "matsubara.osaka.jp"
+    "matsubushi.saitama.jp"
+    "matsuda.kanagawa.jp"
+    "matsudo.chiba.jp"
+    "matsue.shimane.jp"
+    "matsukawa.nagano.jp"
+    "matsumae.hokkaido.jp"
+    "matsumoto.kagoshima.jp"
+    "matsumoto.nagano.jp"
+    "matsuno.ehime.jp"
+    "matsusaka.mie.jp"
+    "matsushige.tokushima.jp"
+    "matsushima.miyagi.jp"
+    "matsuura.nagasaki.jp"
+    "matsuyama.ehime.jp"
+    "matsuzaki.shizuoka.jp"
+    "matta-varjjat.no"
+    "mattel"
+    "mayfirst.info"
+    "mayfirst.org"
+    "mazeplay.com"
+    "mazowsze.pl"
+    "mazury.pl"
+    "mb.ca"
+    "mb.it"
+    "mba"
+    "mc"
+    "mc.ax"
+    "mc.eu.org"
+    "mc.it"
+    "mcdir.me"
+    "mcdir.ru"
+    "mckinsey"
+    "mcpe.me"
+    "mcpre.ru"
+    "md"
+    "md.ci"
+    "md.us"
+    "me"
+    "me.eu.org"
+    "me.in"
+    "me.it"
+    "me.ke"
+    "me.so"
+    "me.ss"
+    "me.tc"
+    "me.tz"
+    "me.uk"
+    "me.us"
+    "me.vu"
+    "med"
+    "med.br"
+    "med.ec"
+    "med.ee"
+    "med.ht"
+    "med.ly"
+    "med.om"
+    "med.pa"
+    "med.pl"
+    "med.pro"
+    "med.sa"
+    "med.sd"
+    "medecin.fr"
+    "medecin.km"
+    "media"
+    "media.aero"
+    "media.hu"
+    "media.museum"
+    "media.pl"
+    "mediatech.by"
+    "mediatech.dev"
+    "medical.museum"
+    "medicina.bo"
+    "medio-campidano.it"
+    "mediocampidano.it"
+    "medizinhistorisches.museum"
+    "meeres.museum"
+    "meet"
+    "meguro.tokyo.jp"
+    "mein-iserv.de"
+    "mein-vigor.de"
+    "meinforum.net"
+    "meiwa.gunma.jp"
+    "meiwa.mie.jp"
+    "mel.cloudlets.com.au"
+    "meland.no"
+    "melbourne"
+    "meldal.no"
+    "melhus.no"
+    "meloy.no"
+    "mel\303\270y.no"
+    "members.linode.com"
+    "meme"
+    "memorial"
+    "memorial.museum"
+    "memset.net"
+    "men"
+    "menu"
+    "meraker.no"
+    "merckmsd"
+    "merseine.nu"
+    "mer\303\245ker.no"
+    "mesaverde.museum"
+    "messerli.app"
+    "messina.it"
+    "messwithdns.com"
+    "meteorapp.com"
+    "mex.com"
+    "mg"
+    "mg.gov.br"
+    "mg.leg.br"
+    "mh"
+    "mi.it"
+    "mi.th"
+    "mi.us"
+    "miami"
+    "miasa.nagano.jp"
+    "miasta.pl"
+    "mibu.tochigi.jp"
+    "michigan.museum"
+    "microlight.aero"
+    "microsoft"
+    "midatlantic.museum"
+    "midori.chiba.jp"
+    "midori.gunma.jp"
+    "midsund.no"
+    "midtre-gauldal.no"
+    "mie.jp"
+    "mielec.pl"
+    "mielno.pl"
+    "mifune.kumamoto.jp"
+    "migration.run"
+    "mihama.aichi.jp"
+    "mihama.chiba.jp"
+    "mihama.fukui.jp"
+    "mihama.mie.jp"
+    "mihama.wakayama.jp"
+    "mihara.hiroshima.jp"
+    "mihara.kochi.jp"
+    "miharu.fukushima.jp"
+    "miho.ibaraki.jp"
+    "mikasa.hokkaido.jp"
+    "mikawa.yamagata.jp"
+    "miki.hyogo.jp"
+    "mil"
+    "mil.ac"
+    "mil.ae"
+    "mil.al"
+    "mil.ar"
+    "mil.az"
+    "mil.ba"
+    "mil.bo"
+    "mil.br"
+    "mil.by"
+    "mil.cl"
+    "mil.cn"
+    "mil.co"
+    "mil.cy"
+    "mil.do"
+    "mil.ec"
+    "mil.eg"
+    "mil.fj"
+    "mil.ge"
+    "mil.gh"
+    "mil.gt"
+    "mil.hn"
+    "mil.id"
+    "mil.in"
+    "mil.iq"
+    "mil.jo"
+    "mil.kg"
+    "mil.km"
+    "mil.kr"
+    "mil.kz"
+    "mil.lv"
+    "mil.mg"
+    "mil.mv"
+    "mil.my"
+    "mil.mz"
+    "mil.ng"
+    "mil.ni"
+    "mil.no"
+    "mil.nz"
+    "mil.pe"
+    "mil.ph"
+    "mil.pl"
+    "mil.py"
+    "mil.qa"
+    "mil.ru"
+    "mil.rw"
+    "mil.sh"
+    "mil.st"
+    "mil.sy"
+    "mil.tj"
+    "mil.tm"
+    "mil.to"
+    "mil.tr"
+    "mil.tw"
+    "mil.tz"
+    "mil.uy"
+    "mil.vc"
+    "mil.ve"
+    "mil.ye"
+    "mil.za"
+    "mil.zm"
+    "mil.zw"
+    "milan.it"
+    "milano.it"
+    "military.museum"
+    "mill.museum"
+    "mima.tokushima.jp"
+    "mimata.miyazaki.jp"
+    "minakami.gunma.jp"
+    "minamata.kumamoto.jp"
+    "minami-alps.yamanashi.jp"
+    "minami.fukuoka.jp"
+    "minami.kyoto.jp"
+    "minami.tokushima.jp"
+    "minamiaiki.nagano.jp"
+    "minamiashigara.kanagawa.jp"
+    "minamiawaji.hyogo.jp"
+    "minamiboso.chiba.jp"
+    "minamidaito.okinawa.jp"
+    "minamiechizen.fukui.jp"
+    "minamifurano.hokkaido.jp"
+    "minamiise.mie.jp"
+    "minamiizu.shizuoka.jp"
+    "minamimaki.nagano.jp"
+    "minamiminowa.nagano.jp"
+    "minamioguni.kumamoto.jp"
+    "minamisanriku.miyagi.jp"
+    "minamitane.kagoshima.jp"
+    "minamiuonuma.niigata.jp"
+    "minamiyamashiro.kyoto.jp"
+    "minano.saitama.jp"
+    "minato.osaka.jp"
+    "minato.tokyo.jp"
+    "mincom.tn"
+    "mine.nu"
+    "miners.museum"
+    "mini"
+    "mining.museum"
+    "miniserver.com"
+    "minisite.ms"
+    "minnesota.museum"
+    "mino.gifu.jp"
+    "minobu.yamanashi.jp"
+    "minoh.osaka.jp"
+    "minokamo.gifu.jp"
+    "minowa.nagano.jp"
+    "mint"
+    "mintere.site"
+    "mircloud.host"
+    "mircloud.ru"
+    "mircloud.us"
+    "misaki.okayama.jp"
+    "misaki.osaka.jp"
+    "misasa.tottori.jp"
+    "misato.akita.jp"
+    "misato.miyagi.jp"
+    "misato.saitama.jp"
+    "misato.shimane.jp"
+    "misato.wakayama.jp"
+    "misawa.aomori.jp"
+    "misconfused.org"
+    "mishima.fukushima.jp"
+    "mishima.shizuoka.jp"
+    "missile.museum"
+    "missoula.museum"
+    "misugi.mie.jp"
+    "mit"
+    "mitaka.tokyo.jp"
+    "mitake.gifu.jp"
+    "mitane.akita.jp"
+    "mito.ibaraki.jp"
+    "mitou.yamaguchi.jp"
+    "mitoyo.kagawa.jp"
+    "mitsubishi"
+    "mitsue.nara.jp"
+    "mitsuke.niigata.jp"
+    "miura.kanagawa.jp"
+    "miyada.nagano.jp"
+    "miyagi.jp"
+    "miyake.nara.jp"
+    "miyako.fukuoka.jp"
+    "miyako.iwate.jp"
+    "miyakonojo.miyazaki.jp"
+    "miyama.fukuoka.jp"
+    "miyama.mie.jp"
+    "miyashiro.saitama.jp"
+    "miyawaka.fukuoka.jp"
+    "miyazaki.jp"
+    "miyazaki.miyazaki.jp"
+    "miyazu.kyoto.jp"
+    "miyoshi.aichi.jp"
+    "miyoshi.hiroshima.jp"
+    "miyoshi.saitama.jp"
+    "miyoshi.tokushima.jp"
+    "miyota.nagano.jp"
+    "mizuho.tokyo.jp"
+    "mizumaki.fukuoka.jp"
+    "mizunami.gifu.jp"
+    "mizusawa.iwate.jp"
+    "mjondalen.no"
+    "mj\303\270ndalen.no"
+    "mk"
+    "mk.eu.org"
+    "mk.ua"
+    "ml"
+    "mlb"
+    "mlbfan.org"
+    "mls"
+    "mm"
+    "mma"
+    "mmafan.biz"
+    "mn"
+    "mn.it"
+    "mn.us"
+    "mo"
+    "mo-i-rana.no"
+    "mo-siemens.io"
+    "mo.cn"
+    "mo.it"
+    "mo.us"
+    "moareke.no"
+    "mobara.chiba.jp"
+    "mobi"
+    "mobi.gp"
+    "mobi.ke"
+    "mobi.na"
+    "mobi.ng"
+    "mobi.tt"
+    "mobi.tz"
+    "mobile"
+    "mochizuki.nagano.jp"
+    "mock.pstmn.io"
+    "mod.gi"
+    "moda"
+    "modalen.no"
+    "modelling.aero"
+    "modena.it"
+    "modern.museum"
+    "mods.jp"
+    "modum.no"
+    "moe"
+    "moi"
+    "moka.tochigi.jp"
+    "mol.it"
+    "molde.no"
+    "molise.it"
+    "mom"
+    "moma.museum"
+    "mombetsu.hokkaido.jp"
+    "monash"
+    "mond.jp"
+    "money"
+    "money.bj"
+    "money.museum"
+    "mongolian.jp"
+    "monmouth.museum"
+    "monster"
+    "monticello.museum"
+    "montreal.museum"
+    "monza-brianza.it"
+    "monza-e-della-brianza.it"
+    "monza.it"
+    "monzabrianza.it"
+    "monzaebrianza.it"
+    "monzaedellabrianza.it"
+    "moo.jp"
+    "moonscale.io"
+    "moonscale.net"
+    "mordovia.ru"
+    "mordovia.su"
+    "morena.br"
+    "moriguchi.osaka.jp"
+    "morimachi.shizuoka.jp"
+    "morioka.iwate.jp"
+    "moriya.ibaraki.jp"
+    "moriyama.shiga.jp"
+    "moriyoshi.akita.jp"
+    "mormon"
+    "morotsuka.miyazaki.jp"
+    "moroyama.saitama.jp"
+    "mortgage"
+    "moscow"
+    "moscow.museum"
+    "moseushi.hokkaido.jp"
+    "mosjoen.no"
+    "mosj\303\270en.no"
+    "moskenes.no"
+    "moss.no"
+    "mosvik.no"
+    "motegi.tochigi.jp"
+    "moto"
+    "motobu.okinawa.jp"
+    "motorcycle.museum"
+    "motorcycles"
+    "motosu.gifu.jp"
+    "motoyama.kochi.jp"
+    "mov"
+    "movie"
+    "movimiento.bo"
+    "mozilla-iot.org"
+    "mo\303\245reke.no"
+    "mp"
+    "mp.br"
+    "mq"
+    "mr"
+    "mr.no"
+    "mragowo.pl"
+    "ms"
+    "ms.gov.br"
+    "ms.it"
+    "ms.kr"
+    "ms.leg.br"
+    "ms.us"
+    "msd"
+    "msk.ru"
+    "msk.su"
+    "mt"
+    "mt.eu.org"
+    "mt.gov.br"
+    "mt.it"
+    "mt.leg.br"
+    "mt.us"
+    "mtn"
+    "mtr"
+    "mu"
+    "muenchen.museum"
+    "muenster.museum"
+    "mugi.tokushima.jp"
+    "muika.niigata.jp"
+    "mukawa.hokkaido.jp"
+    "muko.kyoto.jp"
+    "mulhouse.museum"
+    "munakata.fukuoka.jp"
+    "muncie.museum"
+    "muni.il"
+    "muosat.no"
+    "muos\303\241t.no"
+    "mup.gov.pl"
+    "murakami.niigata.jp"
+    "murata.miyagi.jp"
+    "murayama.yamagata.jp"
+    "murmansk.su"
+    "muroran.hokkaido.jp"
+    "muroto.kochi.jp"
+    "mus.br"
+    "mus.mi.us"
+    "musashimurayama.tokyo.jp"
+    "musashino.tokyo.jp"
+    "museet.museum"
+    "museum"
+    "museum.mv"
+    "museum.mw"
+    "museum.no"
+    "museum.om"
+    "museum.tt"
+    "museumcenter.museum"
+    "museumvereniging.museum"
+    "music"
+    "music.museum"
+    "musica.ar"
+    "musica.bo"
+    "musician.io"
+    "mutsu.aomori.jp"
+    "mutsuzawa.chiba.jp"
+    "mutual"
+    "mutual.ar"
+    "mv"
+    "mw"
+    "mw.gov.pl"
+    "mx"
+    "mx.na"
+    "my"
+    "my-firewall.org"
+    "my-gateway.de"
+    "my-router.de"
+    "my-vigor.de"
+    "my-wan.de"
+    "my.eu.org"
+    "my.id"
+    "myactivedirectory.com"
+    "myamaze.net"
+    "myasustor.com"
+    "mycd.eu"
+    "mycloud.by"
+    "mydatto.com"
+    "mydatto.net"
+    "myddns.rocks"
+    "mydissent.net"
+    "mydobiss.com"
+    "mydrobo.com"
+    "myds.me"
+    "myeffect.net"
+    "myfast.host"
+    "myfast.space"
+    "myfirewall.org"
+    "myforum.community"
+    "myfritz.net"
+    "myftp.biz"
+    "myftp.org"
+    "myhome-server.de"
+    "myiphost.com"
+    "myjino.ru"
+    "mykolaiv.ua"
+    "mymailer.com.tw"
+    "mymediapc.net"
+    "myoko.niigata.jp"
+    "mypep.link"
+    "mypets.ws"
+    "myphotos.cc"
+    "mypi.co"
+    "mypsx.net"
+    "myqnapcloud.com"
+    "mysecuritycamera.com"
+    "mysecuritycamera.net"
+    "mysecuritycamera.org"
+    "myshopblocks.com"
+    "myshopify.com"
+    "myspreadshop.at"
+    "myspreadshop.be"
+    "myspreadshop.ca"
+    "myspreadshop.ch"
+    "myspreadshop.co.uk"
+    "myspreadshop.com"
+    "myspreadshop.com.au"
+    "myspreadshop.de"
+    "myspreadshop.dk"
+    "myspreadshop.es"
+    "myspreadshop.fi"
+    "myspreadshop.fr"
+    "myspreadshop.ie"
+    "myspreadshop.it"
+    "myspreadshop.net"
+    "myspreadshop.nl"
+    "myspreadshop.no"
+    "myspreadshop.pl"
+    "myspreadshop.se"
+    "mytabit.co.il"
+    "mytabit.com"
+    "mytis.ru"
+    "mytuleap.com"
+    "myvnc.com"
+    "mywire.org"
+    "mz"
+    "m\303\241latvuopmi.no"
+    "m\303\241tta-v\303\241rjjat.no"
+    "m\303\245lselv.no"
+    "m\303\245s\303\270y.no"
+    "m\304\201ori.nz"
+    "n.bg"
+    "n.se"
+    "n4t.co"
+    "na"
+    "na.it"
+    "na4u.ru"
+    "naamesjevuemie.no"
+    "nab"
+    "nabari.mie.jp"
+    "nachikatsuura.wakayama.jp"
+    "nagahama.shiga.jp"
+    "nagai.yamagata.jp"
+    "nagano.jp"
+    "nagano.nagano.jp"
+    "naganohara.gunma.jp"
+    "nagaoka.niigata.jp"
+    "nagaokakyo.kyoto.jp"
+    "nagara.chiba.jp"
+    "nagareyama.chiba.jp"
+    "nagasaki.jp"
+    "nagasaki.nagasaki.jp"
+    "nagasu.kumamoto.jp"
+    "nagato.yamaguchi.jp"
+    "nagatoro.saitama.jp"
+    "nagawa.nagano.jp"
+    "nagi.okayama.jp"
+    "nagiso.nagano.jp"
+    "nago.okinawa.jp"
+    "nagoya"
+    "nagoya.jp"
+    "naha.okinawa.jp"
+    "nahari.kochi.jp"
+    "naie.hokkaido.jp"
+    "naka.hiroshima.jp"
+    "naka.ibaraki.jp"
+    "nakadomari.aomori.jp"
+    "nakagawa.fukuoka.jp"
+    "nakagawa.hokkaido.jp"
+    "nakagawa.nagano.jp"
+    "nakagawa.tokushima.jp"
+    "nakagusuku.okinawa.jp"
+    "nakagyo.kyoto.jp"
+    "nakai.kanagawa.jp"
+    "nakama.fukuoka.jp"
+    "nakamichi.yamanashi.jp"
+    "nakamura.kochi.jp"
+    "nakaniikawa.toyama.jp"
+    "nakano.nagano.jp"
+    "nakano.tokyo.jp"
+    "nakanojo.gunma.jp"
+    "nakanoto.ishikawa.jp"
+    "nakasatsunai.hokkaido.jp"
+    "nakatane.kagoshima.jp"
+    "nakatombetsu.hokkaido.jp"
+    "nakatsugawa.gifu.jp"
+    "nakayama.yamagata.jp"
+    "nakijin.okinawa.jp"
+    "naklo.pl"
+    "nalchik.ru"
+    "nalchik.su"
+    "namaste.jp"
+    "namdalseid.no"
+    "name"
+    "name.az"
+    "name.eg"
+    "name.et"
+    "name.fj"
+    "name.hr"
+    "name.jo"
+    "name.mk"
+    "name.mv"
+    "name.my"
+    "name.na"
+    "name.ng"
+    "name.pm"
+    "name.pr"
+    "name.qa"
+    "name.tj"
+    "name.tr"
+    "name.tt"
+    "name.vn"
+    "namegata.ibaraki.jp"
+    "namegawa.saitama.jp"
+    "namerikawa.toyama.jp"
+    "namie.fukushima.jp"
+    "namikata.ehime.jp"
+    "namsos.no"
+    "namsskogan.no"
+    "nanae.hokkaido.jp"
+    "nanao.ishikawa.jp"
+    "nanbu.tottori.jp"
+    "nanbu.yamanashi.jp"
+    "nango.fukushima.jp"
+    "nanjo.okinawa.jp"
+    "nankoku.kochi.jp"
+    "nanmoku.gunma.jp"
+    "nannestad.no"
+    "nanporo.hokkaido.jp"
+    "nantan.kyoto.jp"
+    "nanto.toyama.jp"
+    "nanyo.yamagata.jp"
+    "naoshima.kagawa.jp"
+    "naples.it"
+    "napoli.it"
+    "nara.jp"
+    "nara.nara.jp"
+    "narashino.chiba.jp"
+    "narita.chiba.jp"
+    "naroy.no"
+    "narusawa.yamanashi.jp"
+    "naruto.tokushima.jp"
+    "narviika.no"
+    "narvik.no"
+    "nasu.tochigi.jp"
+    "nasushiobara.tochigi.jp"
+    "nat.tn"
+    "natal.br"
+    "national.museum"
+    "nationalfirearms.museum"
+    "nationalheritage.museum"
+    "nativeamerican.museum"
+    "natori.miyagi.jp"
+    "natura"
+    "natural.bo"
+    "naturalhistory.museum"
+    "naturalhistorymuseum.museum"
+    "naturalsciences.museum"
+    "naturbruksgymn.se"
+    "nature.museum"
+    "naturhistorisches.museum"
+    "natuurwetenschappen.museum"
+    "naumburg.museum"
+    "naustdal.no"
+    "naval.museum"
+    "navigation.aero"
+    "navoi.su"
+    "navuotna.no"
+    "navy"
+    "nayoro.hokkaido.jp"
+    "nb.ca"
+    "nba"
+    "nc"
+    "nc.tr"
+    "nc.us"
+    "nd.us"
+    "ne"
+    "ne.jp"
+    "ne.ke"
+    "ne.kr"
+    "ne.pw"
+    "ne.tz"
+    "ne.ug"
+    "ne.us"
+    "neat-url.com"
+    "nebraska.museum"
+    "nec"
+    "nedre-eiker.no"
+    "neko.am"
+    "nemuro.hokkaido.jp"
+    "nerdpol.ovh"
+    "nerima.tokyo.jp"
+    "nes.akershus.no"
+    "nes.buskerud.no"
+    "nesna.no"
+    "nesodden.no"
+    "nesoddtangen.no"
+    "nesseby.no"
+    "nesset.no"
+    "net"
+    "net-freaks.com"
+    "net.ac"
+    "net.ae"
+    "net.af"
+    "net.ag"
+    "net.ai"
+    "net.al"
+    "net.am"
+    "net.ar"
+    "net.au"
+    "net.az"
+    "net.ba"
+    "net.bb"
+    "net.bh"
+    "net.bj"
+    "net.bm"
+    "net.bn"
+    "net.bo"
+    "net.br"
+    "net.bs"
+    "net.bt"
+    "net.bz"
+    "net.ci"
+    "net.cm"
+    "net.cn"
+    "net.co"
+    "net.cu"
+    "net.cw"
+    "net.cy"
+    "net.dm"
+    "net.do"
+    "net.dz"
+    "net.ec"
+    "net.eg"
+    "net.et"
+    "net.eu.org"
+    "net.fj"
+    "net.fm"
+    "net.ge"
+    "net.gg"
+    "net.gl"
+    "net.gn"
+    "net.gp"
+    "net.gr"
+    "net.gt"
+    "net.gu"
+    "net.gy"
+    "net.hk"
+    "net.hn"
+    "net.ht"
+    "net.id"
+    "net.il"
+    "net.im"
+    "net.in"
+    "net.iq"
+    "net.ir"
+    "net.is"
+    "net.je"
+    "net.jo"
+    "net.kg"
+    "net.ki"
+    "net.kn"
+    "net.kw"
+    "net.ky"
+    "net.kz"
+    "net.la"
+    "net.lb"
+    "net.lc"
+    "net.lk"
+    "net.lr"
+    "net.ls"
+    "net.lv"
+    "net.ly"
+    "net.ma"
+    "net.me"
+    "net.mk"
+    "net.ml"
+    "net.mo"
+    "net.ms"
+    "net.mt"
+    "net.mu"
+    "net.mv"
+    "net.mw"
+    "net.mx"
+    "net.my"
+    "net.mz"
+    "net.nf"
+    "net.ng"
+    "net.ni"
+    "net.nr"
+    "net.nz"
+    "net.om"
+    "net.pa"
+    "net.pe"
+    "net.ph"
+    "net.pk"
+    "net.pl"
+    "net.pn"
+    "net.pr"
+    "net.ps"
+    "net.pt"
+    "net.py"
+    "net.qa"
+    "net.ru"
+    "net.rw"
+    "net.sa"
+    "net.sb"
+    "net.sc"
+    "net.sd"
+    "net.sg"
+    "net.sh"
+    "net.sl"
+    "net.so"
+    "net.ss"
+    "net.st"
+    "net.sy"
+    "net.th"
+    "net.tj"
+    "net.tm"
+    "net.tn"
+    "net.to"
+    "net.tr"
+    "net.tt"
+    "net.tw"
+    "net.ua"
+    "net.uk"
+    "net.uy"
+    "net.uz"
+    "net.vc"
+    "net.ve"
+    "net.vi"
+    "net.vn"
+    "net.vu"
+    "net.ws"
+    "net.ye"
+    "net.za"
+    "net.zm"
+    "netbank"
+    "netflix"
+    "netlify.app"
+    "network"
+    "neues.museum"
+    "neustar"
+    "new"
+    "newhampshire.museum"
+    "newjersey.museum"
+    "newmexico.museum"
+    "newport.museum"
+    "news"
+    "news.hu"
+    "newspaper.museum"
+    "newyork.museum"
+    "next"
+    "nextdirect"
+    "nexus"
+    "neyagawa.osaka.jp"
+    "nf"
+    "nf.ca"
+    "nfl"
+    "nflfan.org"
+    "nfshost.com"
+    "ng"
+    "ng.eu.org"
+    "ngo"
+    "ngo.lk"
+    "ngo.ng"
+    "ngo.ph"
+    "ngo.za"
+    "ngrok.io"
+    "nh-serv.co.uk"
+    "nh.us"
+    "nhk"
+    "nhlfan.net"
+    "nhs.uk"
+    "ni"
+    "nic.in"
+    "nic.tj"
+    "nic.za"
+    "nichinan.miyazaki.jp"
+    "nichinan.tottori.jp"
+    "nico"
+    "nid.io"
+    "niepce.museum"
+    "nieruchomosci.pl"
+    "niigata.jp"
+    "niigata.niigata.jp"
+    "niihama.ehime.jp"
+    "niikappu.hokkaido.jp"
+    "niimi.okayama.jp"
+    "niiza.saitama.jp"
+    "nikaho.akita.jp"
+    "nike"
+    "niki.hokkaido.jp"
+    "nikita.jp"
+    "nikko.tochigi.jp"
+    "nikolaev.ua"
+    "nikon"
+    "ninja"
+    "ninohe.iwate.jp"
+    "ninomiya.kanagawa.jp"
+    "nirasaki.yamanashi.jp"
+    "nis.za"
+    "nishi.fukuoka.jp"
+    "nishi.osaka.jp"
+    "nishiaizu.fukushima.jp"
+    "nishiarita.saga.jp"
+    "nishiawakura.okayama.jp"
+    "nishiazai.shiga.jp"
+    "nishigo.fukushima.jp"
+    "nishihara.kumamoto.jp"
+    "nishihara.okinawa.jp"
+    "nishiizu.shizuoka.jp"
+    "nishikata.tochigi.jp"
+    "nishikatsura.yamanashi.jp"
+    "nishikawa.yamagata.jp"
+    "nishimera.miyazaki.jp"
+    "nishinomiya.hyogo.jp"
+    "nishinoomote.kagoshima.jp"
+    "nishinoshima.shimane.jp"
+    "nishio.aichi.jp"
+    "nishiokoppe.hokkaido.jp"
+    "nishitosa.kochi.jp"
+    "nishiwaki.hyogo.jp"
+    "nissan"
+    "nissay"
+    "nissedal.no"
+    "nisshin.aichi.jp"
+    "niteroi.br"
+    "nittedal.no"
+    "niyodogawa.kochi.jp"
+    "nj.us"
+    "njs.jelastic.vps-host.net"
+    "nl"
+    "nl-ams-1.baremetal.scw.cloud"
+    "nl.ca"
+    "nl.ci"
+    "nl.eu.org"
+    "nl.no"
+    "nm.cn"
+    "nm.us"
+    "no"
+    "no-ip.biz"
+    "no-ip.ca"
+    "no-ip.co.uk"
+    "no-ip.info"
+    "no-ip.net"
+    "no-ip.org"
+    "no.com"
+    "no.eu.org"
+    "no.it"
+    "nobeoka.miyazaki.jp"
+    "noboribetsu.hokkaido.jp"
+    "nobushi.jp"
+    "noda.chiba.jp"
+    "noda.iwate.jp"
+    "nodebalancer.linode.com"
+    "nodes.k8s.fr-par.scw.cloud"
+    "nodes.k8s.nl-ams.scw.cloud"
+    "nodes.k8s.pl-waw.scw.cloud"
+    "nog.community"
+    "nogata.fukuoka.jp"
+    "nogi.tochigi.jp"
+    "noheji.aomori.jp"
+    "noho.st"
+    "nohost.me"
+    "noip.me"
+    "noip.us"
+    "nokia"
+    "nom.ad"
+    "nom.ag"
+    "nom.br"
+    "nom.co"
+    "nom.es"
+    "nom.fr"
+    "nom.km"
+    "nom.mg"
+    "nom.nc"
+    "nom.ni"
+    "nom.pa"
+    "nom.pe"
+    "nom.pl"
+    "nom.re"
+    "nom.ro"
+    "nom.tm"
+    "nom.ve"
+    "nom.za"
+    "nombre.bo"
+    "nome.cv"
+    "nome.pt"
+    "nomi.ishikawa.jp"
+    "nonoichi.ishikawa.jp"
+    "noop.app"
+    "noor.jp"
+    "nord-aurdal.no"
+    "nord-fron.no"
+    "nord-odal.no"
+    "norddal.no"
+    "nordeste-idc.saveincloud.net"
+    "nordkapp.no"
+    "nordre-land.no"
+    "nordreisa.no"
+    "nore-og-uvdal.no"
+    "norfolk.museum"
+    "north-kazakhstan.su"
+    "north.museum"
+    "northflank.app"
+    "northwesternmutual"
+    "norton"
+    "nose.osaka.jp"
+    "nosegawa.nara.jp"
+    "noshiro.akita.jp"
+    "not.br"
+    "notaires.fr"
+    "notaires.km"
+    "noticeable.news"
+    "noticias.bo"
+    "noto.ishikawa.jp"
+    "notodden.no"
+    "notogawa.shiga.jp"
+    "notteroy.no"
+    "nov.ru"
+    "nov.su"
+    "novara.it"
+    "novecore.site"
+    "now"
+    "now-dns.net"
+    "now-dns.org"
+    "now-dns.top"
+    "now.sh"
+    "nowaruda.pl"
+    "nowruz"
+    "nowtv"
+    "nozawaonsen.nagano.jp"
+    "np"
+    "nr"
+    "nra"
+    "nrw"
+    "nrw.museum"
+    "ns.ca"
+    "nsn.us"
+    "nsupdate.info"
+    "nsw.au"
+    "nsw.edu.au"
+    "nt.au"
+    "nt.ca"
+    "nt.edu.au"
+    "nt.no"
+    "nt.ro"
+    "ntdll.top"
+    "ntr.br"
+    "ntt"
+    "nu"
+    "nu.ca"
+    "nu.it"
+    "numata.gunma.jp"
+    "numata.hokkaido.jp"
+    "numazu.shizuoka.jp"
+    "nuoro.it"
+    "nv.us"
+    "nx.cn"
+    "ny-1.paas.massivegrid.net"
+    "ny-2.paas.massivegrid.net"
+    "ny.us"
+    "nyaa.am"
+    "nyan.to"
+    "nyc"
+    "nyc.mn"
+    "nyc.museum"
+    "nyny.museum"
+    "nysa.pl"
+    "nyuzen.toyama.jp"
+    "nz"
+    "nz.basketball"
+    "nz.eu.org"
+    "n\303\241vuotna.no"
+    "n\303\245\303\245mesjevuemie.no"
+    "n\303\246r\303\270y.no"
+    "n\303\270tter\303\270y.no"
+    "o.bg"
+    "o.se"
+    "oamishirasato.chiba.jp"
+    "oarai.ibaraki.jp"
+    "obama.fukui.jp"
+    "obama.nagasaki.jp"
+    "obanazawa.yamagata.jp"
+    "obi"
+    "obihiro.hokkaido.jp"
+    "obira.hokkaido.jp"
+    "obninsk.su"
+    "observer"
+    "obu.aichi.jp"
+    "obuse.nagano.jp"
+    "oceanographic.museum"
+    "oceanographique.museum"
+    "ocelot.mythic-beasts.com"
+    "ochi.kochi.jp"
+    "oci.customer-oci.com"
+    "ocp.customer-oci.com"
+    "ocs.customer-oci.com"
+    "od.ua"
+    "odate.akita.jp"
+    "odawara.kanagawa.jp"
+    "odda.no"
+    "odesa.ua"
+    "odessa.ua"
+    "odo.br"
+    "oe.yamagata.jp"
+    "of.by"
+    "of.je"
+    "of.no"
+    "off.ai"
+    "office"
+    "office-on-the.net"
+    "official.academy"
+    "official.ec"
+    "ofunato.iwate.jp"
+    "og.ao"
+    "og.it"
+    "oga.akita.jp"
+    "ogaki.gifu.jp"
+    "ogano.saitama.jp"
+    "ogasawara.tokyo.jp"
+    "ogata.akita.jp"
+    "ogawa.ibaraki.jp"
+    "ogawa.nagano.jp"
+    "ogawa.saitama.jp"
+    "ogawara.miyagi.jp"
+    "ogi.saga.jp"
+    "ogimi.okinawa.jp"
+    "ogliastra.it"
+    "ogori.fukuoka.jp"
+    "ogose.saitama.jp"
+    "oguchi.aichi.jp"
+    "oguni.kumamoto.jp"
+    "oguni.yamagata.jp"
+    "oh.us"
+    "oharu.aichi.jp"
+    "ohda.shimane.jp"
+    "ohi.fukui.jp"
+    "ohira.miyagi.jp"
+    "ohira.tochigi.jp"
+    "ohkura.yamagata.jp"
+    "ohtawara.tochigi.jp"
+    "oi.kanagawa.jp"
+    "oirase.aomori.jp"
+    "oirm.gov.pl"
+    "oishida.yamagata.jp"
+    "oiso.kanagawa.jp"
+    "oita.jp"
+    "oita.oita.jp"
+    "oizumi.gunma.jp"
+    "oji.nara.jp"
+    "ojiya.niigata.jp"
+    "ok.us"
+    "okagaki.fukuoka.jp"
+    "okawa.fukuoka.jp"
+    "okawa.kochi.jp"
+    "okaya.nagano.jp"
+    "okayama.jp"
+    "okayama.okayama.jp"
+    "okazaki.aichi.jp"
+    "okegawa.saitama.jp"
+    "oketo.hokkaido.jp"
+    "oki.fukuoka.jp"
+    "okinawa"
+    "okinawa.jp"
+    "okinawa.okinawa.jp"
+    "okinoshima.shimane.jp"
+    "okoppe.hokkaido.jp"
+    "oksnes.no"
+    "okuizumo.shimane.jp"
+    "okuma.fukushima.jp"
+    "okutama.tokyo.jp"
+    "ol.no"
+    "olawa.pl"
+    "olayan"
+    "olayangroup"
+    "olbia-tempio.it"
+    "olbiatempio.it"
+    "oldnavy"
+    "olecko.pl"
+    "olkusz.pl"
+    "ollo"
+    "olsztyn.pl"
+    "om"
+    "omachi.nagano.jp"
+    "omachi.saga.jp"
+    "omaezaki.shizuoka.jp"
+    "omaha.museum"
+    "omasvuotna.no"
+    "ome.tokyo.jp"
+    "omega"
+    "omg.lol"
+    "omi.nagano.jp"
+    "omi.niigata.jp"
+    "omigawa.chiba.jp"
+    "omihachiman.shiga.jp"
+    "omitama.ibaraki.jp"
+    "omiya.saitama.jp"
+    "omniwe.site"
+    "omotego.fukushima.jp"
+    "omura.nagasaki.jp"
+    "omuta.fukuoka.jp"
+    "on-acorn.io"
+    "on-aptible.com"
+    "on-k3s.io"
+    "on-rancher.cloud"
+    "on-rio.io"
+    "on-the-web.tv"
+    "on-web.fr"
+    "on.ca"
+    "onagawa.miyagi.jp"
+    "onavstack.net"
+    "oncilla.mythic-beasts.com"
+    "ondigitalocean.app"
+    "one"
+    "onfabrica.com"
+    "onflashdrive.app"
+    "ong"
+    "ong.br"
+    "onga.fukuoka.jp"
+    "onion"
+    "onjuku.chiba.jp"
+    "onl"
+    "online"
+    "online.museum"
+    "online.th"
+    "onna.okinawa.jp"
+    "ono.fukui.jp"
+    "ono.fukushima.jp"
+    "ono.hyogo.jp"
+    "onojo.fukuoka.jp"
+    "onomichi.hiroshima.jp"
+    "onporter.run"
+    "onred.one"
+    "onrender.com"
+    "ontario.museum"
+    "onthewifi.com"
+    "onza.mythic-beasts.com"
+    "ooguy.com"
+    "ookuwa.nagano.jp"
+    "ooo"
+    "oops.jp"
+    "ooshika.nagano.jp"
+    "open"
+    "openair.museum"
+    "opencraft.hosting"
+    "opensocial.site"
+    "operaunite.com"
+    "opoczno.pl"
+    "opole.pl"
+    "oppdal.no"
+    "oppegard.no"
+    "oppeg\303\245rd.no"
+    "or.at"
+    "or.bi"
+    "or.ci"
+    "or.cr"
+    "or.id"
+    "or.it"
+    "or.jp"
+    "or.ke"
+    "or.kr"
+    "or.mu"
+    "or.na"
+    "or.pw"
+    "or.th"
+    "or.tz"
+    "or.ug"
+    "or.us"
+    "ora.gunma.jp"
+    "oracle"
+    "orange"
+    "orangecloud.tn"
+    "oregon.museum"
+    "oregontrail.museum"
+    "org"
+    "org.ac"
+    "org.ae"
+    "org.af"
+    "org.ag"
+    "org.ai"
+    "org.al"
+    "org.am"
+    "org.ar"
+    "org.au"
+    "org.az"
+    "org.ba"
+    "org.bb"
+    "org.bh"
+    "org.bi"
+    "org.bj"
+    "org.bm"
+    "org.bn"
+    "org.bo"
+    "org.br"
+    "org.bs"
+    "org.bt"
+    "org.bw"
+    "org.bz"
+    "org.ci"
+    "org.cn"
+    "org.co"
+    "org.cu"
+    "org.cv"
+    "org.cw"
+    "org.cy"
+    "org.dm"
+    "org.do"
+    "org.dz"
+    "org.ec"
+    "org.ee"
+    "org.eg"
+    "org.es"
+    "org.et"
+    "org.fj"
+    "org.fm"
+    "org.ge"
+    "org.gg"
+    "org.gh"
+    "org.gi"
+    "org.gl"
+    "org.gn"
+    "org.gp"
+    "org.gr"
+    "org.gt"
+    "org.gu"
+    "org.gy"
+    "org.hk"
+    "org.hn"
+    "org.ht"
+    "org.hu"
+    "org.il"
+    "org.im"
+    "org.in"
+    "org.iq"
+    "org.ir"
+    "org.is"
+    "org.je"
+    "org.jo"
+    "org.kg"
+    "org.ki"
+    "org.km"
+    "org.kn"
+    "org.kp"
+    "org.kw"
+    "org.ky"
+    "org.kz"
+    "org.la"
+    "org.lb"
+    "org.lc"
+    "org.lk"
+    "org.lr"
+    "org.ls"
+    "org.lv"
+    "org.ly"
+    "org.ma"
+    "org.me"
+    "org.mg"
+    "org.mk"
+    "org.ml"
+    "org.mn"
+    "org.mo"
+    "org.ms"
+    "org.mt"
+    "org.mu"
+    "org.mv"
+    "org.mw"
+    "org.mx"
+    "org.my"
+    "org.mz"
+    "org.na"
+    "org.ng"
+    "org.ni"
+    "org.nr"
+    "org.nz"
+    "org.om"
+    "org.pa"
+    "org.pe"
+    "org.pf"
+    "org.ph"
+    "org.pk"
+    "org.pl"
+    "org.pn"
+    "org.pr"
+    "org.ps"
+    "org.pt"
+    "org.py"
+    "org.qa"
+    "org.ro"
+    "org.rs"
+    "org.ru"
+    "org.rw"
+    "org.sa"
+    "org.sb"
+    "org.sc"
+    "org.sd"
+    "org.se"
+    "org.sg"
+    "org.sh"
+    "org.sl"
+    "org.sn"
+    "org.so"
+    "org.ss"
+    "org.st"
+    "org.sv"
+    "org.sy"
+    "org.sz"
+    "org.tj"
+    "org.tm"
+    "org.tn"
+    "org.to"
+    "org.tr"
+    "org.tt"
+    "org.tw"
+    "org.ua"
+    "org.ug"
+    "org.uk"
+    "org.uy"
+    "org.uz"
+    "org.vc"
+    "org.ve"
+    "org.vi"
+    "org.vn"
+    "org.vu"
+    "org.ws"
+    "org.ye"
+    "org.yt"
+    "org.za"
+    "org.zm"
+    "org.zw"
+    "organic"
+    "origins"
+    "oristano.it"
+    "orkanger.no"
+    "orkdal.no"
+    "orland.no"
+    "orsites.com"
+    "orskog.no"
+    "orsta.no"
+    "orx.biz"
+    "os.hedmark.no"
+    "os.hordaland.no"
+    "osaka"
+    "osaka.jp"
+    "osakasayama.osaka.jp"
+    "osaki.miyagi.jp"
+    "osakikamijima.hiroshima.jp"
+    "osasco.br"
+    "osen.no"
+    "oseto.nagasaki.jp"
+    "oshima.tokyo.jp"
+    "oshima.yamaguchi.jp"
+    "oshino.yamanashi.jp"
+    "oshu.iwate.jp"
+    "oslo.no"
+    "osoyro.no"
+    "osteroy.no"
+    "oster\303\270y.no"
+    "ostre-toten.no"
+    "ostroda.pl"
+    "ostroleka.pl"
+    "ostrowiec.pl"
+    "ostrowwlkp.pl"
+    "os\303\270yro.no"
+    "ot.it"
+    "ota.gunma.jp"
+    "ota.tokyo.jp"
+    "otago.museum"
+    "otake.hiroshima.jp"
+    "otaki.chiba.jp"
+    "otaki.nagano.jp"
+    "otaki.saitama.jp"
+    "otama.fukushima.jp"
+    "otap.co"
+    "otari.nagano.jp"
+    "otaru.hokkaido.jp"
+    "ote.bj"
+    "other.nf"
+    "oto.fukuoka.jp"
+    "otobe.hokkaido.jp"
+    "otofuke.hokkaido.jp"
+    "otoineppu.hokkaido.jp"
+    "otoyo.kochi.jp"
+    "otsu.shiga.jp"
+    "otsuchi.iwate.jp"
+    "otsuka"
+    "otsuki.kochi.jp"
+    "otsuki.yamanashi.jp"
+    "ott"
+    "ouchi.saga.jp"
+    "ouda.nara.jp"
+    "oum.gov.pl"
+    "oumu.hokkaido.jp"
+    "outsystemscloud.com"
+    "overhalla.no"
+    "ovh"
+    "ovre-eiker.no"
+    "owani.aomori.jp"
+    "owariasahi.aichi.jp"
+    "own.pm"
+    "ownip.net"
+    "ownprovider.com"
+    "owo.codes"
+    "ox.rs"
+    "oxa.cloud"
+    "oxford.museum"
+    "oy.lc"
+    "oya.to"
+    "oyabe.toyama.jp"
+    "oyama.tochigi.jp"
+    "oyamazaki.kyoto.jp"
+    "oyer.no"
+    "oygarden.no"
+    "oyodo.nara.jp"
+    "oystre-slidre.no"
+    "oz.au"
+    "ozora.hokkaido.jp"
+    "ozu.ehime.jp"
+    "ozu.kumamoto.jp"
+    "p.bg"
+    "p.se"
+    "pa"
+    "pa.gov.br"
+    "pa.gov.pl"
+    "pa.it"
+    "pa.leg.br"
+    "pa.us"
+    "paas.beebyte.io"
+    "paas.datacenter.fi"
+    "paas.hosted-by-previder.com"
+    "paas.massivegrid.com"
+    "pacific.museum"
+    "paderborn.museum"
+    "padova.it"
+    "padua.it"
+    "page"
+    "pagefrontapp.com"
+    "pages.dev"
+    "pages.it.hs-heilbronn.de"
+    "pages.torproject.net"
+    "pages.wiardweb.com"
+    "pagespeedmobilizer.com"
+    "pagexl.com"
+    "palace.museum"
+    "paleo.museum"
+    "palermo.it"
+    "palmas.br"
+    "palmsprings.museum"
+    "panama.museum"
+    "panasonic"
+    "panel.gg"
+    "pantheonsite.io"
+    "parachuting.aero"
+    "paragliding.aero"
+    "parallel.jp"
+    "parasite.jp"
+    "paris"
+    "paris.eu.org"
+    "paris.museum"
+    "parliament.nz"
+    "parma.it"
+    "paroch.k12.ma.us"
+    "pars"
+    "parti.se"
+    "partners"
+    "parts"
+    "party"
+    "pasadena.museum"
+    "passagens"
+    "passenger-association.aero"
+    "patria.bo"
+    "pavia.it"
+    "pay"
+    "paywhirl.com"
+    "pb.ao"
+    "pb.gov.br"
+    "pb.leg.br"
+    "pc.it"
+    "pc.pl"
+    "pccw"
+    "pcloud.host"
+    "pd.it"
+    "pdns.page"
+    "pe"
+    "pe.ca"
+    "pe.gov.br"
+    "pe.it"
+    "pe.kr"
+    "pe.leg.br"
+    "pecori.jp"
+    "peewee.jp"
+    "penne.jp"
+    "penza.su"
+    "pepper.jp"
+    "per.la"
+    "per.nf"
+    "per.sg"
+    "perma.jp"
+    "perso.ht"
+    "perso.sn"
+    "perso.tn"
+    "perspecta.cloud"
+    "perugia.it"
+    "pesaro-urbino.it"
+    "pesarourbino.it"
+    "pescara.it"
+    "pet"
+    "pf"
+    "pfizer"
+    "pg"
+    "pg.in"
+    "pg.it"
+    "pgafan.net"
+    "pgfog.com"
+    "ph"
+    "pharmacien.fr"
+    "pharmaciens.km"
+    "pharmacy"
+    "pharmacy.museum"
+    "phd"
+    "philadelphia.museum"
+    "philadelphiaarea.museum"
+    "philately.museum"
+    "philips"
+    "phoenix.museum"
+    "phone"
+    "photo"
+    "photography"
+    "photography.museum"
+    "photos"
+    "phx.enscaled.us"
+    "physio"
+    "pi.gov.br"
+    "pi.it"
+    "pi.leg.br"
+    "piacenza.it"
+    "pics"
+    "pictet"
+    "pictures"
+    "pid"
+    "piedmont.it"
+    "piemonte.it"
+    "pigboat.jp"
+    "pila.pl"
+    "pilot.aero"
+    "pilots.museum"
+    "pimienta.org"
+    "pin"
+    "pinb.gov.pl"
+    "ping"
+    "pink"
+    "pinoko.jp"
+    "pioneer"
+    "pippu.hokkaido.jp"
+    "pisa.it"
+    "pistoia.it"
+    "pisz.pl"
+    "pittsburgh.museum"
+    "piw.gov.pl"
+    "pixolino.com"
+    "pizza"
+    "pk"
+    "pl"
+    "pl.eu.org"
+    "pl.ua"
+    "place"
+    "planetarium.museum"
+    "plantation.museum"
+    "plants.museum"
+    "platform0.app"
+    "platformsh.site"
+    "platter-app.com"
+    "platter-app.dev"
+    "platterp.us"
+    "play"
+    "playstation"
+    "playstation-cloud.com"
+    "plaza.museum"
+    "plc.co.im"
+    "plc.ly"
+    "plc.uk"
+    "plesk.page"
+    "pleskns.com"
+    "plo.ps"
+    "plumbing"
+    "plurinacional.bo"
+    "plus"
+    "pm"
+    "pmn.it"
+    "pn"
+    "pn.it"
+    "pnc"
+    "po.gov.pl"
+    "po.it"
+    "poa.br"
+    "podhale.pl"
+    "podlasie.pl"
+    "podzone.net"
+    "podzone.org"
+    "pohl"
+    "point2this.com"
+    "pointto.us"
+    "poivron.org"
+    "poker"
+    "pokrovsk.su"
+    "pol.dz"
+    "pol.ht"
+    "pol.tr"
+    "police.uk"
+    "politica.bo"
+    "politie"
+    "polkowice.pl"
+    "poltava.ua"
+    "pomorskie.pl"
+    "pomorze.pl"
+    "poniatowa.pl"
+    "ponpes.id"
+    "pordenone.it"
+    "porn"
+    "porsanger.no"
+    "porsangu.no"
+    "porsgrunn.no"
+    "pors\303\241\305\213gu.no"
+    "port.fr"
+    "portal.museum"
+    "portland.museum"
+    "portlligat.museum"
+    "post"
+    "post.in"
+    "postman-echo.com"
+    "posts-and-telecommunications.museum"
+    "potager.org"
+    "potenza.it"
+    "powiat.pl"
+    "poznan.pl"
+    "pp.az"
+    "pp.ru"
+    "pp.se"
+    "pp.ua"
+    "ppg.br"
+    "pr"
+    "pr.gov.br"
+    "pr.it"
+    "pr.leg.br"
+    "pr.us"
+    "pramerica"
+    "prato.it"
+    "praxi"
+    "prd.fr"
+    "prd.km"
+    "prd.mg"
+    "prequalifyme.today"
+    "preservation.museum"
+    "presidio.museum"
+    "press"
+    "press.aero"
+    "press.cy"
+    "press.ma"
+    "press.museum"
+    "press.se"
+    "presse.ci"
+    "presse.km"
+    "presse.ml"
+    "pri.ee"
+    "prime"
+    "primetel.cloud"
+    "principe.st"
+    "priv.at"
+    "priv.hu"
+    "priv.instances.scw.cloud"
+    "priv.me"
+    "priv.no"
+    "priv.pl"
+    "privatelink.snowflake.app"
+    "privatizehealthinsurance.net"
+    "pro"
+    "pro.az"
+    "pro.br"
+    "pro.cy"
+    "pro.ec"
+    "pro.fj"
+    "pro.ht"
+    "pro.in"
+    "pro.mv"
+    "pro.na"
+    "pro.om"
+    "pro.pr"
+    "pro.tt"
+    "pro.typeform.com"
+    "pro.vn"
+    "prochowice.pl"
+    "prod"
+    "production.aero"
+    "productions"
+    "prof"
+    "prof.pr"
+    "profesional.bo"
+    "progressive"
+    "project.museum"
+    "promo"
+    "properties"
+    "property"
+    "protection"
+    "protonet.io"
+    "pru"
+    "prudential"
+    "pruszkow.pl"
+    "prvcy.page"
+    "przeworsk.pl"
+    "ps"
+    "psc.br"
+    "psi.br"
+    "psp.gov.pl"
+    "psse.gov.pl"
+    "pstmn.io"
+    "pt"
+    "pt.eu.org"
+    "pt.it"
+    "pu.it"
+    "pub"
+    "pub.instances.scw.cloud"
+    "pub.sa"
+    "publ.pt"
+    "public-inquiry.uk"
+    "public.museum"
+    "publishproxy.com"
+    "pubol.museum"
+    "pubtls.org"
+    "pueblo.bo"
+    "pug.it"
+    "puglia.it"
+    "pulawy.pl"
+    "punyu.jp"
+    "pup.gov.pl"
+    "pupu.jp"
+    "pussycat.jp"
+    "pv.it"
+    "pvh.br"
+    "pvt.ge"
+    "pvt.k12.ma.us"
+    "pw"
+    "pwc"
+    "py"
+    "pya.jp"
+    "pyatigorsk.ru"
+    "pymnt.uk"
+    "pythonanywhere.com"
+    "pz.it"
+    "q-a.eu.org"
+    "q.bg"
+    "qa"
+    "qa2.com"
+    "qbuser.com"
+    "qc.ca"
+    "qc.com"
+    "qcx.io"
+    "qh.cn"
+    "qld.au"
+    "qld.edu.au"
+    "qld.gov.au"
+    "qoto.io"
+    "qpon"
+    "qsl.br"
+    "qualifioapp.com"
+    "quebec"
+    "quebec.museum"
+    "quest"
+    "quicksytes.com"
+    "quipelements.com"
+    "r.appspot.com"
+    "r.bg"
+    "r.cdn77.net"
+    "r.se"
+    "r2.dev"
+    "ra.it"
+    "racing"
+    "rackmaze.com"
+    "rackmaze.net"
+    "rade.no"
+    "radio"
+    "radio.am"
+    "radio.br"
+    "radio.fm"
+    "radom.pl"
+    "radoy.no"
+    "rad\303\270y.no"
+    "raffleentry.org.uk"
+    "rag-cloud-ch.hosteur.com"
+    "rag-cloud.hosteur.com"
+    "ragusa.it"
+    "rahkkeravju.no"
+    "raholt.no"
+    "railroad.museum"
+    "railway.museum"
+    "raindrop.jp"
+    "raisa.no"
+    "rakkestad.no"
+    "ralingen.no"
+    "rana.no"
+    "randaberg.no"
+    "rankoshi.hokkaido.jp"
+    "ranzan.saitama.jp"
+    "rar.ve"
+    "ras.ru"
+    "rauma.no"
+    "ravendb.cloud"
+    "ravendb.community"
+    "ravendb.me"
+    "ravendb.run"
+    "ravenna.it"
+    "ravpage.co.il"
+    "rawa-maz.pl"
+    "rc.it"
+    "rdv.to"
+    "re"
+    "re.it"
+    "re.kr"
+    "read"
+    "read-books.org"
+    "readmyblog.org"
+    "readthedocs.io"
+    "readymade.jp"
+    "realestate"
+    "realestate.pl"
+    "realm.cz"
+    "realtor"
+    "realty"
+    "rebun.hokkaido.jp"
+    "rec.br"
+    "rec.co"
+    "rec.nf"
+    "rec.ro"
+    "rec.ve"
+    "recht.pro"
+    "recife.br"
+    "recipes"
+    "recreation.aero"
+    "red"
+    "red.sv"
+    "redirectme.net"
+    "redstone"
+    "redumbrella"
+    "reg.dk"
+    "reggio-calabria.it"
+    "reggio-emilia.it"
+    "reggiocalabria.it"
+    "reggioemilia.it"
+    "rehab"
+    "reise"
+    "reisen"
+    "reit"
+    "reklam.hu"
+    "rel.ht"
+    "rel.pl"
+    "reliance"
+    "remotewd.com"
+    "ren"
+    "rendalen.no"
+    "rennebu.no"
+    "rennesoy.no"
+    "rennes\303\270y.no"
+    "rent"
+    "rentals"
+    "rep.br"
+    "rep.kp"
+    "repair"
+    "repbody.aero"
+    "repl.co"
+    "repl.run"
+    "report"
+    "republican"
+    "res.aero"
+    "res.in"
+    "research.aero"
+    "research.museum"
+    "reservd.com"
+    "reservd.dev.thingdust.io"
+    "reservd.disrec.thingdust.io"
+    "reservd.testing.thingdust.io"
+    "reserve-online.com"
+    "reserve-online.net"
+    "resindevice.io"
+    "resistance.museum"
+    "rest"
+    "restaurant"
+    "restaurant.bj"
+    "resto.bj"
+    "review"
+    "reviews"
+    "revista.bo"
+    "rexroth"
+    "rg.it"
+    "rhcloud.com"
+    "ri.it"
+    "ri.us"
+    "ribeirao.br"
+    "ric.jelastic.vps-host.net"
+    "rich"
+    "richardli"
+    "ricoh"
+    "rieti.it"
+    "rifu.miyagi.jp"
+    "riik.ee"
+    "rikubetsu.hokkaido.jp"
+    "rikuzentakata.iwate.jp"
+    "ril"
+    "rimini.it"
+    "rindal.no"
+    "ringebu.no"
+    "ringerike.no"
+    "ringsaker.no"
+    "rio"
+    "rio.br"
+    "riobranco.br"
+    "riodejaneiro.museum"
+    "riopreto.br"
+    "rip"
+    "rishiri.hokkaido.jp"
+    "rishirifuji.hokkaido.jp"
+    "risor.no"
+    "rissa.no"
+    "ris\303\270r.no"
+    "ritto.shiga.jp"
+    "rivne.ua"
+    "rj.gov.br"
+    "rj.leg.br"
+    "rl.no"
+    "rm.it"
+    "rn.gov.br"
+    "rn.it"
+    "rn.leg.br"
+    "ro"
+    "ro.eu.org"
+    "ro.gov.br"
+    "ro.im"
+    "ro.it"
+    "ro.leg.br"
+    "roan.no"
+    "rocher"
+    "rochester.museum"
+    "rockart.museum"
+    "rocks"
+    "rocky.page"
+    "rodeo"
+    "rodoy.no"
+    "rogers"
+    "rokunohe.aomori.jp"
+    "rollag.no"
+    "roma.it"
+    "roma.museum"
+    "rome.it"
+    "romsa.no"
+    "romskog.no"
+    "room"
+    "roros.no"
+    "rost.no"
+    "rotorcraft.aero"
+    "router.management"
+    "rovigo.it"
+    "rovno.ua"
+    "royal-commission.uk"
+    "royken.no"
+    "royrvik.no"
+    "rr.gov.br"
+    "rr.leg.br"
+    "rs"
+    "rs.ba"
+    "rs.gov.br"
+    "rs.leg.br"
+    "rsc.cdn77.org"
+    "rss.my.id"
+    "rsvp"
+    "ru"
+    "ru.com"
+    "ru.eu.org"
+    "ru.net"
+    "rugby"
+    "ruhr"
+    "run"
+    "run.app"
+    "ruovat.no"
+    "russia.museum"
+    "rv.ua"
+    "rw"
+    "rwe"
+    "rybnik.pl"
+    "ryd.wafaicloud.com"
+    "rygge.no"
+    "ryokami.saitama.jp"
+    "ryugasaki.ibaraki.jp"
+    "ryukyu"
+    "ryuoh.shiga.jp"
+    "rzeszow.pl"
+    "rzgw.gov.pl"
+    "r\303\241hkker\303\241vju.no"
+    "r\303\241isa.no"
+    "r\303\245de.no"
+    "r\303\245holt.no"
+    "r\303\246lingen.no"
+    "r\303\270d\303\270y.no"
+    "r\303\270mskog.no"
+    "r\303\270ros.no"
+    "r\303\270st.no"
+    "r\303\270yken.no"
+    "r\303\270yrvik.no"
+    "s.bg"
+    "s.se"
+    "s3-ap-northeast-1.amazonaws.com"
+    "s3-ap-northeast-2.amazonaws.com"
+    "s3-ap-south-1.amazonaws.com"
+    "s3-ap-southeast-1.amazonaws.com"
+    "s3-ap-southeast-2.amazonaws.com"
+    "s3-ca-central-1.amazonaws.com"
+    "s3-eu-central-1.amazonaws.com"
+    "s3-eu-west-1.amazonaws.com"
+    "s3-eu-west-2.amazonaws.com"
+    "s3-eu-west-3.amazonaws.com"
+    "s3-external-1.amazonaws.com"
+    "s3-fips-us-gov-west-1.amazonaws.com"
+    "s3-sa-east-1.amazonaws.com"
+    "s3-us-east-2.amazonaws.com"
+    "s3-us-gov-west-1.amazonaws.com"
+    "s3-us-west-1.amazonaws.com"
+    "s3-us-west-2.amazonaws.com"
+    "s3-website-ap-northeast-1.amazonaws.com"
+    "s3-website-ap-southeast-1.amazonaws.com"
+    "s3-website-ap-southeast-2.amazonaws.com"
+    "s3-website-eu-west-1.amazonaws.com"
+    "s3-website-sa-east-1.amazonaws.com"
+    "s3-website-us-east-1.amazonaws.com"
+    "s3-website-us-west-1.amazonaws.com"
+    "s3-website-us-west-2.amazonaws.com"
+    "s3-website.ap-northeast-2.amazonaws.com"
+    "s3-website.ap-south-1.amazonaws.com"
+    "s3-website.ca-central-1.amazonaws.com"
+    "s3-website.eu-central-1.amazonaws.com"
+    "s3-website.eu-west-2.amazonaws.com"
+    "s3-website.eu-west-3.amazonaws.com"
+    "s3-website.fr-par.scw.cloud"
+    "s3-website.nl-ams.scw.cloud"
+    "s3-website.pl-waw.scw.cloud"
+    "s3-website.us-east-2.amazonaws.com"
+    "s3.amazonaws.com"
+    "s3.ap-northeast-2.amazonaws.com"
+    "s3.ap-south-1.amazonaws.com"
+    "s3.ca-central-1.amazonaws.com"
+    "s3.cn-north-1.amazonaws.com.cn"
+    "s3.dualstack.ap-northeast-1.amazonaws.com"
+    "s3.dualstack.ap-northeast-2.amazonaws.com"
+    "s3.dualstack.ap-south-1.amazonaws.com"
+    "s3.dualstack.ap-southeast-1.amazonaws.com"
+    "s3.dualstack.ap-southeast-2.amazonaws.com"
+    "s3.dualstack.ca-central-1.amazonaws.com"
+    "s3.dualstack.eu-central-1.amazonaws.com"
+    "s3.dualstack.eu-west-1.amazonaws.com"
+    "s3.dualstack.eu-west-2.amazonaws.com"
+    "s3.dualstack.eu-west-3.amazonaws.com"
+    "s3.dualstack.sa-east-1.amazonaws.com"
+    "s3.dualstack.us-east-1.amazonaws.com"
+    "s3.dualstack.us-east-2.amazonaws.com"
+    "s3.eu-central-1.amazonaws.com"
+    "s3.eu-west-2.amazonaws.com"
+    "s3.eu-west-3.amazonaws.com"
+    "s3.fr-par.scw.cloud"
+    "s3.nl-ams.scw.cloud"
+    "s3.pl-waw.scw.cloud"
+    "s3.teckids.org"
+    "s3.us-east-2.amazonaws.com"
+    "s5y.io"
+    "sa"
+    "sa-east-1.elasticbeanstalk.com"
+    "sa.au"
+    "sa.com"
+    "sa.cr"
+    "sa.edu.au"
+    "sa.gov.au"
+    "sa.gov.pl"
+    "sa.it"
+    "saarland"
+    "sabae.fukui.jp"
+    "sadist.jp"
+    "sado.niigata.jp"
+    "safe"
+    "safety"
+    "safety.aero"
+    "saga.jp"
+    "saga.saga.jp"
+    "sagae.yamagata.jp"
+    "sagamihara.kanagawa.jp"
+    "saigawa.fukuoka.jp"
+    "saijo.ehime.jp"
+    "saikai.nagasaki.jp"
+    "saiki.oita.jp"
+    "saintlouis.museum"
+    "saitama.jp"
+    "saitama.saitama.jp"
+    "saito.miyazaki.jp"
+    "saka.hiroshima.jp"
+    "sakado.saitama.jp"
+    "sakae.chiba.jp"
+    "sakae.nagano.jp"
+    "sakahogi.gifu.jp"
+    "sakai.fukui.jp"
+    "sakai.ibaraki.jp"
+    "sakai.osaka.jp"
+    "sakaiminato.tottori.jp"
+    "sakaki.nagano.jp"
+    "sakata.yamagata.jp"
+    "sakawa.kochi.jp"
+    "sakegawa.yamagata.jp"
+    "saku.nagano.jp"
+    "sakuho.nagano.jp"
+    "sakura"
+    "sakura.chiba.jp"
+    "sakura.tochigi.jp"
+    "sakuragawa.ibaraki.jp"
+    "sakurai.nara.jp"
+    "sakyo.kyoto.jp"
+    "salangen.no"
+    "salat.no"
+    "sale"
+    "salem.museum"
+    "salerno.it"
+    "salon"
+    "saltdal.no"
+    "salud.bo"
+    "salvador.br"
+    "salvadordali.museum"
+    "salzburg.museum"
+    "samegawa.fukushima.jp"
+    "samnanger.no"
+    "sampa.br"
+    "samsclub"
+    "samsung"
+    "samukawa.kanagawa.jp"
+    "sanagochi.tokushima.jp"
+    "sanda.hyogo.jp"
+    "sandcats.io"
+    "sande.more-og-romsdal.no"
+    "sande.m\303\270re-og-romsdal.no"
+    "sande.vestfold.no"
+    "sande.xn--mre-og-romsdal-qqb.no"
+    "sandefjord.no"
+    "sandiego.museum"
+    "sandnes.no"
+    "sandnessjoen.no"
+    "sandnessj\303\270en.no"
+    "sandoy.no"
+    "sandvik"
+    "sandvikcoromant"
+    "sand\303\270y.no"
+    "sanfrancisco.museum"
+    "sango.nara.jp"
+    "sanjo.niigata.jp"
+    "sannan.hyogo.jp"
+    "sannohe.aomori.jp"
+    "sano.tochigi.jp"
+    "sanofi"
+    "sanok.pl"
+    "santabarbara.museum"
+    "santacruz.museum"
+    "santafe.museum"
+    "santamaria.br"
+    "santoandre.br"
+    "sanuki.kagawa.jp"
+    "saobernardo.br"
+    "saogonca.br"
+    "saotome.st"
+    "sap"
+    "sapporo.jp"
+    "sar.it"
+    "sardegna.it"
+    "sardinia.it"
+    "sarl"
+    "saroma.hokkaido.jp"
+    "sarpsborg.no"
+    "sarufutsu.hokkaido.jp"
+    "sas"
+    "sasaguri.fukuoka.jp"
+    "sasayama.hyogo.jp"
+    "sasebo.nagasaki.jp"
+    "saskatchewan.museum"
+    "sassari.it"
+    "satosho.okayama.jp"
+    "satsumasendai.kagoshima.jp"
+    "satte.saitama.jp"
+    "satx.museum"
+    "sauda.no"
+    "sauherad.no"
+    "savannahga.museum"
+    "save"
+    "saves-the-whales.com"
+    "savona.it"
+    "saxo"
+    "sayama.osaka.jp"
+    "sayama.saitama.jp"
+    "sayo.hyogo.jp"
+    "sb"
+    "sb.ua"
+    "sbi"
+    "sbs"
+    "sc"
+    "sc.cn"
+    "sc.gov.br"
+    "sc.ke"
+    "sc.kr"
+    "sc.leg.br"
+    "sc.ls"
+    "sc.tz"
+    "sc.ug"
+    "sc.us"
+    "sca"
+    "scalebook.scw.cloud"
+    "scb"
+    "sch.ae"
+    "sch.id"
+    "sch.ir"
+    "sch.jo"
+    "sch.lk"
+    "sch.ly"
+    "sch.ng"
+    "sch.qa"
+    "sch.sa"
+    "sch.so"
+    "sch.ss"
+    "sch.tf"
+    "sch.uk"
+    "sch.wf"
+    "sch.zm"
+    "schaeffler"
+    "schlesisches.museum"
+    "schmidt"
+    "schoenbrunn.museum"
+    "schokokeks.net"
+    "schokoladen.museum"
+    "scholarships"
+    "school"
+    "school.museum"
+    "school.na"
+    "school.nz"
+    "school.za"
+    "schoolbus.jp"
+    "schools.nsw.edu.au"
+    "schule"
+    "schulplattform.de"
+    "schulserver.de"
+    "schwarz"
+    "schweiz.museum"
+    "sci.eg"
+    "science"
+    "science-fiction.museum"
+    "science.museum"
+    "scienceandhistory.museum"
+    "scienceandindustry.museum"
+    "sciencecenter.museum"
+    "sciencecenters.museum"
+    "sciencehistory.museum"
+    "sciences.museum"
+    "sciencesnaturelles.museum"
+    "scientist.aero"
+    "scot"
+    "scotland.museum"
+    "scrapper-site.net"
+    "scrapping.cc"
+    "scrysec.com"
+    "sd"
+    "sd.cn"
+    "sd.us"
+    "sdn.gov.pl"
+    "sdscloud.pl"
+    "se"
+    "se.eu.org"
+    "se.gov.br"
+    "se.leg.br"
+    "se.net"
+    "seaport.museum"
+    "search"
+    "seat"
+    "sebastopol.ua"
+    "sec.ps"
+    "secaas.hk"
+    "secret.jp"
+    "secure"
+    "security"
+    "securitytactics.com"
+    "seek"
+    "seg.br"
+    "seidat.net"
+    "seihi.nagasaki.jp"
+    "seika.kyoto.jp"
+    "seiro.niigata.jp"
+    "seirou.niigata.jp"
+    "seiyo.ehime.jp"
+    "sejny.pl"
+    "sekd1.beebyteapp.io"
+    "seki.gifu.jp"
+    "sekigahara.gifu.jp"
+    "sekikawa.niigata.jp"
+    "sel.no"
+    "selbu.no"
+    "select"
+    "selfip.biz"
+    "selfip.com"
+    "selfip.info"
+    "selfip.net"
+    "selfip.org"
+    "selje.no"
+    "seljord.no"
+    "sellfy.store"
+    "sells-for-less.com"
+    "sells-for-u.com"
+    "sells-it.net"
+    "sellsyourhome.org"
+    "semboku.akita.jp"
+    "semine.miyagi.jp"
+    "senasa.ar"
+    "sendai.jp"
+    "sener"
+    "sennan.osaka.jp"
+    "senseering.net"
+    "sensiosite.cloud"
+    "seoul.kr"
+    "sera.hiroshima.jp"
+    "seranishi.hiroshima.jp"
+    "servebbs.com"
+    "servebbs.net"
+    "servebbs.org"
+    "servebeer.com"
+    "serveblog.net"
+    "servecounterstrike.com"
+    "serveexchange.com"
+    "serveftp.com"
+    "serveftp.net"
+    "serveftp.org"
+    "servegame.com"
+    "servegame.org"
+    "servehalflife.com"
+    "servehttp.com"
+    "servehumour.com"
+    "serveirc.com"
+    "serveminecraft.net"
+    "servemp3.com"
+    "servep2p.com"
+    "servepics.com"
+    "servequake.com"
+    "servers.run"
+    "servesarcasm.com"
+    "service.gov.scot"
+    "service.gov.uk"
+    "service.one"
+    "services"
+    "services.aero"
+    "setagaya.tokyo.jp"
+    "seto.aichi.jp"
+    "setouchi.okayama.jp"
+    "settlement.museum"
+    "settlers.museum"
+    "settsu.osaka.jp"
+    "sevastopol.ua"
+    "seven"
+    "sew"
+    "sex"
+    "sex.hu"
+    "sex.pl"
+    "sexy"
+    "sf.no"
+    "sfr"
+    "sg"
+    "sg-1.paas.massivegrid.net"
+    "sh"
+    "sh.cn"
+    "shacknet.nu"
+    "shakotan.hokkaido.jp"
+    "shangrila"
+    "shari.hokkaido.jp"
+    "sharp"
+    "shaw"
+    "shell"
+    "shell.museum"
+    "sherbrooke.museum"
+    "shia"
+    "shibata.miyagi.jp"
+    "shibata.niigata.jp"
+    "shibecha.hokkaido.jp"
+    "shibetsu.hokkaido.jp"
+    "shibukawa.gunma.jp"
+    "shibuya.tokyo.jp"
+    "shichikashuku.miyagi.jp"
+    "shichinohe.aomori.jp"
+    "shiftcrypto.dev"
+    "shiftcrypto.io"
+    "shiftedit.io"
+    "shiga.jp"
+    "shiiba.miyazaki.jp"
+    "shijonawate.osaka.jp"
+    "shika.ishikawa.jp"
+    "shikabe.hokkaido.jp"
+    "shikama.miyagi.jp"
+    "shikaoi.hokkaido.jp"
+    "shikatsu.aichi.jp"
+    "shiki.saitama.jp"
+    "shikokuchuo.ehime.jp"
+    "shiksha"
+    "shima.mie.jp"
+    "shimabara.nagasaki.jp"
+    "shimada.shizuoka.jp"
+    "shimamaki.hokkaido.jp"
+    "shimamoto.osaka.jp"
+    "shimane.jp"
+    "shimane.shimane.jp"
+    "shimizu.hokkaido.jp"
+    "shimizu.shizuoka.jp"
+    "shimoda.shizuoka.jp"
+    "shimodate.ibaraki.jp"
+    "shimofusa.chiba.jp"
+    "shimogo.fukushima.jp"
+    "shimoichi.nara.jp"
+    "shimoji.okinawa.jp"
+    "shimokawa.hokkaido.jp"
+    "shimokitayama.nara.jp"
+    "shimonita.gunma.jp"
+    "shimonoseki.yamaguchi.jp"
+    "shimosuwa.nagano.jp"
+    "shimotsuke.tochigi.jp"
+    "shimotsuma.ibaraki.jp"
+    "shinagawa.tokyo.jp"
+    "shinanomachi.nagano.jp"
+    "shingo.aomori.jp"
+    "shingu.fukuoka.jp"
+    "shingu.hyogo.jp"
+    "shingu.wakayama.jp"
+    "shinichi.hiroshima.jp"
+    "shinjo.nara.jp"
+    "shinjo.okayama.jp"
+    "shinjo.yamagata.jp"
+    "shinjuku.tokyo.jp"
+    "shinkamigoto.nagasaki.jp"
+    "shinonsen.hyogo.jp"
+    "shinshinotsu.hokkaido.jp"
+    "shinshiro.aichi.jp"
+    "shinto.gunma.jp"
+    "shintoku.hokkaido.jp"
+    "shintomi.miyazaki.jp"
+    "shinyoshitomi.fukuoka.jp"
+    "shiogama.miyagi.jp"
+    "shiojiri.nagano.jp"
+    "shioya.tochigi.jp"
+    "shirahama.wakayama.jp"
+    "shirakawa.fukushima.jp"
+    "shirakawa.gifu.jp"
+    "shirako.chiba.jp"
+    "shiranuka.hokkaido.jp"
+    "shiraoi.hokkaido.jp"
+    "shiraoka.saitama.jp"
+    "shirataka.yamagata.jp"
+    "shiriuchi.hokkaido.jp"
+    "shiroi.chiba.jp"
+    "shiroishi.miyagi.jp"
+    "shiroishi.saga.jp"
+    "shirosato.ibaraki.jp"
+    "shishikui.tokushima.jp"
+    "shiso.hyogo.jp"
+    "shisui.chiba.jp"
+    "shitara.aichi.jp"
+    "shiwa.iwate.jp"
+    "shizukuishi.iwate.jp"
+    "shizuoka.jp"
+    "shizuoka.shizuoka.jp"
+    "shobara.hiroshima.jp"
+    "shoes"
+    "shonai.fukuoka.jp"
+    "shonai.yamagata.jp"
+    "shoo.okayama.jp"
+    "shop"
+    "shop.brendly.rs"
+    "shop.ht"
+    "shop.hu"
+    "shop.pl"
+    "shop.ro"
+    "shop.th"
+    "shoparena.pl"
+    "shopitsite.com"
+    "shopping"
+    "shopselect.net"
+    "shopware.store"
+    "shouji"
+    "show"
+    "show.aero"
+    "showa.fukushima.jp"
+    "showa.gunma.jp"
+    "showa.yamanashi.jp"
+    "showtime"
+    "shunan.yamaguchi.jp"
+    "shw.io"
+    "si"
+    "si.eu.org"
+    "si.it"
+    "sibenik.museum"
+    "sic.it"
+    "sicilia.it"
+    "sicily.it"
+    "siellak.no"
+    "siena.it"
+    "sigdal.no"
+    "siiites.com"
+    "siljan.no"
+    "silk"
+    "silk.museum"
+    "simple-url.com"
+    "simplesite.com"
+    "simplesite.com.br"
+    "simplesite.gr"
+    "simplesite.pl"
+    "sina"
+    "sinaapp.com"
+    "singles"
+    "siracusa.it"
+    "sirdal.no"
+    "site"
+    "site.tb-hosting.com"
+    "site.transip.me"
+    "siteleaf.net"
+    "sites.static.land"
+    "sj"
+    "sjc.br"
+    "sk"
+    "sk.ca"
+    "sk.eu.org"
+    "skanit.no"
+    "skanland.no"
+    "skaun.no"
+    "skedsmo.no"
+    "skedsmokorset.no"
+    "ski"
+    "ski.museum"
+    "ski.no"
+    "skien.no"
+    "skierva.no"
+    "skierv\303\241.no"
+    "skin"
+    "skiptvet.no"
+    "skjak.no"
+    "skjervoy.no"
+    "skjerv\303\270y.no"
+    "skj\303\245k.no"
+    "sklep.pl"
+    "sko.gov.pl"
+    "skoczow.pl"
+    "skodje.no"
+    "skole.museum"
+    "sky"
+    "skydiving.aero"
+    "skygearapp.com"
+    "skype"
+    "sk\303\241nit.no"
+    "sk\303\245nland.no"
+    "sl"
+    "slask.pl"
+    "slattum.no"
+    "sld.do"
+    "sld.pa"
+    "slg.br"
+    "sling"
+    "slupsk.pl"
+    "slz.br"
+    "sm"
+    "sm.ua"
+    "small-web.org"
+    "smart"
+    "smartlabeling.scw.cloud"
+    "smile"
+    "smola.no"
+    "smushcdn.com"
+    "sm\303\270la.no"
+    "sn"
+    "sn.cn"
+    "snaase.no"
+    "snasa.no"
+    "sncf"
+    "snillfjord.no"
+    "snoasa.no"
+    "snowflake.app"
+    "sn\303\245ase.no"
+    "sn\303\245sa.no"
+    "so"
+    "so.gov.pl"
+    "so.it"
+    "sobetsu.hokkaido.jp"
+    "soc.dz"
+    "soc.lk"
+    "soc.srcf.net"
+    "soccer"
+    "sochi.su"
+    "social"
+    "society.museum"
+    "sodegaura.chiba.jp"
+    "soeda.fukuoka.jp"
+    "softbank"
+    "software"
+    "software.aero"
+    "sogndal.no"
+    "sogne.no"
+    "sohu"
+    "soja.okayama.jp"
+    "soka.saitama.jp"
+    "sokndal.no"
+    "sola.no"
+    "solar"
+    "sologne.museum"
+    "solund.no"
+    "solutions"
+    "soma.fukushima.jp"
+    "somna.no"
+    "sondre-land.no"
+    "sondrio.it"
+    "song"
+    "songdalen.no"
+    "soni.nara.jp"
+    "sony"
+    "soo.kagoshima.jp"
+    "sopot.pl"
+    "sor-aurdal.no"
+    "sor-fron.no"
+    "sor-odal.no"
+    "sor-varanger.no"
+    "sorfold.no"
+    "sorocaba.br"
+    "sorreisa.no"
+    "sortland.no"
+    "sorum.no"
+    "sos.pl"
+    "sosa.chiba.jp"
+    "sosnowiec.pl"
+    "soundandvision.museum"
+    "soundcast.me"
+    "southcarolina.museum"
+    "southwest.museum"
+    "sowa.ibaraki.jp"
+    "soy"
+    "sp.gov.br"
+    "sp.it"
+    "sp.leg.br"
+    "spa"
+    "space"
+    "space-to-rent.com"
+    "space.museum"
+    "spacekit.io"
+    "spb.ru"
+    "spb.su"
+    "spdns.de"
+    "spdns.eu"
+    "spdns.org"
+    "spectrum.myjino.ru"
+    "sphinx.mythic-beasts.com"
+    "spjelkavik.no"
+    "sport"
+    "sport.hu"
+    "spot"
+    "spy.museum"
+    "spydeberg.no"
+    "square.museum"
+    "square7.ch"
+    "square7.de"
+    "square7.net"
+    "sr"
+    "sr.gov.pl"
+    "sr.it"
+    "srht.site"
+    "srl"
+    "srv.br"
+    "ss"
+    "ss.it"
+    "ssl.origin.cdn77-secure.org"
+    "st"
+    "st.no"
+    "staba.jp"
+    "stackhero-network.com"
+    "stada"
+    "stadt.museum"
+    "stage.nodeart.io"
+    "staging.onred.one"
+    "stalbans.museum"
+    "stalowa-wola.pl"
+    "stange.no"
+    "staples"
+    "star"
+    "starachowice.pl"
+    "stargard.pl"
+    "starnberg.museum"
+    "starostwo.gov.pl"
+    "stat.no"
+    "state.museum"
+    "statebank"
+    "statefarm"
+    "stateofdelaware.museum"
+    "stathelle.no"
+    "static-access.net"
+    "static.land"
+    "static.observableusercontent.com"
+    "statics.cloud"
+    "station.museum"
+    "stavanger.no"
+    "stavern.no"
+    "stc"
+    "stcgroup"
+    "steam.museum"
+    "steiermark.museum"
+    "steigen.no"
+    "steinkjer.no"
+    "stg-builder.code.com"
+    "stg.dev"
+    "stgstage.dev"
+    "sth.ac.at"
+    "stjohn.museum"
+    "stjordal.no"
+    "stjordalshalsen.no"
+    "stj\303\270rdal.no"
+    "stj\303\270rdalshalsen.no"
+    "stockholm"
+    "stockholm.museum"
+    "stokke.no"
+    "stolos.io"
+    "stor-elvdal.no"
+    "storage"
+    "storage.yandexcloud.net"
+    "stord.no"
+    "stordal.no"
+    "store"
+    "store.bb"
+    "store.dk"
+    "store.nf"
+    "store.ro"
+    "store.st"
+    "store.ve"
+    "storebase.store"
+    "storfjord.no"
+    "storj.farm"
+    "stpetersburg.museum"
+    "strand.no"
+    "stranda.no"
+    "stream"
+    "streamlit.app"
+    "streamlitapp.com"
+    "stripper.jp"
+    "stryn.no"
+    "student.aero"
+    "studio"
+    "study"
+    "stuff-4-sale.org"
+    "stuff-4-sale.us"
+    "stufftoread.com"
+    "stuttgart.museum"
+    "style"
+    "su"
+    "su.paba.se"
+    "sub.jp"
+    "sucks"
+    "sue.fukuoka.jp"
+    "suedtirol.it"
+    "suginami.tokyo.jp"
+    "sugito.saitama.jp"
+    "suifu.ibaraki.jp"
+    "suisse.museum"
+    "suita.osaka.jp"
+    "sukagawa.fukushima.jp"
+    "sukumo.kochi.jp"
+    "sula.no"
+    "suldal.no"
+    "suli.hu"
+    "sumida.tokyo.jp"
+    "sumita.iwate.jp"
+    "sumoto.hyogo.jp"
+    "sumoto.kumamoto.jp"
+    "sumy.ua"
+    "sunagawa.hokkaido.jp"
+    "sund.no"
+    "sunndal.no"
+    "sunnyday.jp"
+    "supabase.co"
+    "supabase.in"
+    "supabase.net"
+    "supersale.jp"
+    "supplies"
+    "supply"
+    "support"
+    "surf"
+    "surgeonshall.museum"
+    "surgery"
+    "surnadal.no"
+    "surrey.museum"
+    "susaki.kochi.jp"
+    "susono.shizuoka.jp"
+    "suwa.nagano.jp"
+    "suwalki.pl"
+    "suzaka.nagano.jp"
+    "suzu.ishikawa.jp"
+    "suzuka.mie.jp"
+    "suzuki"
+    "sv"
+    "sv.it"
+    "svalbard.no"
+    "svc.firenet.ch"
+    "sveio.no"
+    "svelvik.no"
+    "svizzera.museum"
+    "svn-repos.de"
+    "swatch"
+    "sweden.museum"
+    "sweetpepper.org"
+    "swidnica.pl"
+    "swidnik.pl"
+    "swiebodzin.pl"
+    "swinoujscie.pl"
+    "swiss"
+    "sx"
+    "sx.cn"
+    "sy"
+    "sydney"
+    "sydney.museum"
+    "sykkylven.no"
+    "syncloud.it"
+    "syno-ds.de"
+    "synology-diskstation.de"
+    "synology-ds.de"
+    "synology.me"
+    "sys.qcx.io"
+    "systems"
+    "sytes.net"
+    "sz"
+    "szczecin.pl"
+    "szczytno.pl"
+    "szex.hu"
+    "szkola.pl"
+    "s\303\241lat.no"
+    "s\303\241l\303\241t.no"
+    "s\303\270gne.no"
+    "s\303\270mna.no"
+    "s\303\270ndre-land.no"
+    "s\303\270r-aurdal.no"
+    "s\303\270r-fron.no"
+    "s\303\270r-odal.no"
+    "s\303\270r-varanger.no"
+    "s\303\270rfold.no"
+    "s\303\270rreisa.no"
+    "s\303\270rum.no"
+    "s\303\274dtirol.it"
+    "t.bg"
+    "t.se"
+    "t3l3p0rt.net"
+    "ta.it"
+    "taa.it"
+    "tab"
+    "tabayama.yamanashi.jp"
+    "tabitorder.co.il"
+    "tabuse.yamaguchi.jp"
+    "tachiarai.fukuoka.jp"
+    "tachikawa.tokyo.jp"
+    "tadaoka.osaka.jp"
+    "tado.mie.jp"
+    "tadotsu.kagawa.jp"
+    "tagajo.miyagi.jp"
+    "tagami.niigata.jp"
+    "tagawa.fukuoka.jp"
+    "tahara.aichi.jp"
+    "taifun-dns.de"
+    "taiji.wakayama.jp"
+    "taiki.hokkaido.jp"
+    "taiki.mie.jp"
+    "tainai.niigata.jp"
+    "taipei"
+    "taira.toyama.jp"
+    "taishi.hyogo.jp"
+    "taishi.osaka.jp"
+    "taishin.fukushima.jp"
+    "taito.tokyo.jp"
+    "taiwa.miyagi.jp"
+    "tajimi.gifu.jp"
+    "tajiri.osaka.jp"
+    "taka.hyogo.jp"
+    "takagi.nagano.jp"
+    "takahagi.ibaraki.jp"
+    "takahama.aichi.jp"
+    "takahama.fukui.jp"
+    "takaharu.miyazaki.jp"
+    "takahashi.okayama.jp"
+    "takahata.yamagata.jp"
+    "takaishi.osaka.jp"
+    "takamatsu.kagawa.jp"
+    "takamori.kumamoto.jp"
+    "takamori.nagano.jp"
+    "takanabe.miyazaki.jp"
+    "takanezawa.tochigi.jp"
+    "takaoka.toyama.jp"
+    "takarazuka.hyogo.jp"
+    "takasago.hyogo.jp"
+    "takasaki.gunma.jp"
+    "takashima.shiga.jp"
+    "takasu.hokkaido.jp"
+    "takata.fukuoka.jp"
+    "takatori.nara.jp"
+    "takatsuki.osaka.jp"
+    "takatsuki.shiga.jp"
+    "takayama.gifu.jp"
+    "takayama.gunma.jp"
+    "takayama.nagano.jp"
+    "takazaki.miyazaki.jp"
+    "takehara.hiroshima.jp"
+    "taketa.oita.jp"
+    "taketomi.okinawa.jp"
+    "taki.mie.jp"
+    "takikawa.hokkaido.jp"
+    "takino.hyogo.jp"
+    "takinoue.hokkaido.jp"
+    "takko.aomori.jp"
+    "tako.chiba.jp"
+    "taku.saga.jp"
+    "talk"
+    "tama.tokyo.jp"
+    "tamakawa.fukushima.jp"
+    "tamaki.mie.jp"
+    "tamamura.gunma.jp"
+    "tamano.okayama.jp"
+    "tamatsukuri.ibaraki.jp"
+    "tamayu.shimane.jp"
+    "tamba.hyogo.jp"
+    "tana.no"
+    "tanabe.kyoto.jp"
+    "tanabe.wakayama.jp"
+    "tanagura.fukushima.jp"
+    "tananger.no"
+    "tank.museum"
+    "tanohata.iwate.jp"
+    "taobao"
+    "tara.saga.jp"
+    "tarama.okinawa.jp"
+    "taranto.it"
+    "target"
+    "targi.pl"
+    "tarnobrzeg.pl"
+    "tarui.gifu.jp"
+    "tarumizu.kagoshima.jp"
+    "tas.au"
+    "tas.edu.au"
+    "tas.gov.au"
+    "tashkent.su"
+    "tatamotors"
+    "tatar"
+    "tatebayashi.gunma.jp"
+    "tateshina.nagano.jp"
+    "tateyama.chiba.jp"
+    "tateyama.toyama.jp"
+    "tatsuno.hyogo.jp"
+    "tatsuno.nagano.jp"
+    "tattoo"
+    "tawaramoto.nara.jp"
+    "tax"
+    "taxi"
+    "taxi.br"
+    "tc"
+    "tc.br"
+    "tci"
+    "tcm.museum"
+    "tcp4.me"
+    "td"
+    "tdk"
+    "te.it"
+    "te.ua"
+    "teaches-yoga.com"
+    "team"
+    "tec.br"
+    "tec.mi.us"
+    "tec.ve"
+    "tech"
+    "tech.orange"
+    "technology"
+    "technology.museum"
+    "tecnologia.bo"
+    "tel"
+    "tel.tr"
+    "tele.amune.org"
+    "telebit.app"
+    "telebit.io"
+    "telebit.xyz"
+    "telekommunikation.museum"
+    "television.museum"
+    "temasek"
+    "temp-dns.com"
+    "tempio-olbia.it"
+    "tempioolbia.it"
+    "tempurl.host"
+    "tendo.yamagata.jp"
+    "tenei.fukushima.jp"
+    "tenkawa.nara.jp"
+    "tennis"
+    "tenri.nara.jp"
+    "teo.br"
+    "teramo.it"
+    "termez.su"
+    "terni.it"
+    "ternopil.ua"
+    "teshikaga.hokkaido.jp"
+    "test-iserv.de"
+    "test.ru"
+    "test.tj"
+    "teva"
+    "texas.museum"
+    "textile.museum"
+    "tf"
+    "tg"
+    "tgory.pl"
+    "th"
+    "thd"
+    "the.br"
+    "theater"
+    "theater.museum"
+    "theatre"
+    "theshop.jp"
+    "theworkpc.com"
+    "thick.jp"
+    "thingdustdata.com"
+    "thruhere.net"
+    "tiaa"
+    "tickets"
+    "tickets.io"
+    "tienda"
+    "tiffany"
+    "time.museum"
+    "time.no"
+    "timekeeping.museum"
+    "tingvoll.no"
+    "tinn.no"
+    "tips"
+    "tires"
+    "tirol"
+    "tj"
+    "tj.cn"
+    "tjeldsund.no"
+    "tjmaxx"
+    "tjome.no"
+    "tjx"
+    "tj\303\270me.no"
+    "tk"
+    "tkmaxx"
+    "tksat.bo"
+    "tl"
+    "tlon.network"
+    "tm"
+    "tm.cy"
+    "tm.dz"
+    "tm.fr"
+    "tm.hu"
+    "tm.km"
+    "tm.mc"
+    "tm.mg"
+    "tm.no"
+    "tm.pl"
+    "tm.ro"
+    "tm.se"
+    "tm.za"
+    "tmall"
+    "tmp.br"
+    "tn"
+    "tn.it"
+    "tn.oxa.cloud"
+    "tn.us"
+    "to"
+    "to.gov.br"
+    "to.gt"
+    "to.it"
+    "to.leg.br"
+    "to.md"
+    "toba.mie.jp"
+    "tobe.ehime.jp"
+    "tobetsu.hokkaido.jp"
+    "tobishima.aichi.jp"
+    "tochigi.jp"
+    "tochigi.tochigi.jp"
+    "tochio.niigata.jp"
+    "toda.saitama.jp"
+    "today"
+    "toei.aichi.jp"
+    "toga.toyama.jp"
+    "togakushi.nagano.jp"
+    "togane.chiba.jp"
+    "togitsu.nagasaki.jp"
+    "togliatti.su"
+    "togo.aichi.jp"
+    "togura.nagano.jp"
+    "tohma.hokkaido.jp"
+    "tohnosho.chiba.jp"
+    "toho.fukuoka.jp"
+    "tokai.aichi.jp"
+    "tokai.ibaraki.jp"
+    "tokamachi.niigata.jp"
+    "tokashiki.okinawa.jp"
+    "toki.gifu.jp"
+    "tokigawa.saitama.jp"
+    "tokke.no"
+    "tokoname.aichi.jp"
+    "tokorozawa.saitama.jp"
+    "tokushima.jp"
+    "tokushima.tokushima.jp"
+    "tokuyama.yamaguchi.jp"
+    "tokyo"
+    "tokyo.jp"
+    "tolga.no"
+    "tomakomai.hokkaido.jp"
+    "tomari.hokkaido.jp"
+    "tome.miyagi.jp"
+    "tomi.nagano.jp"
+    "tomigusuku.okinawa.jp"
+    "tomika.gifu.jp"
+    "tomioka.gunma.jp"
+    "tomisato.chiba.jp"
+    "tomiya.miyagi.jp"
+    "tomobe.ibaraki.jp"
+    "tonaki.okinawa.jp"
+    "tonami.toyama.jp"
+    "tondabayashi.osaka.jp"
+    "tone.ibaraki.jp"
+    "tonkotsu.jp"
+    "tono.iwate.jp"
+    "tonosho.kagawa.jp"
+    "tonsberg.no"
+    "toolforge.org"
+    "tools"
+    "toon.ehime.jp"
+    "top"
+    "topology.museum"
+    "torahime.shiga.jp"
+    "toray"
+    "toride.ibaraki.jp"
+    "torino.it"
+    "torino.museum"
+    "torproject.net"
+    "torsken.no"
+    "tos.it"
+    "tosa.kochi.jp"
+    "tosashimizu.kochi.jp"
+    "toscana.it"
+    "toshiba"
+    "toshima.tokyo.jp"
+    "tosu.saga.jp"
+    "total"
+    "tottori.jp"
+    "tottori.tottori.jp"
+    "touch.museum"
+    "tourism.bj"
+    "tourism.pl"
+    "tourism.tn"
+    "tours"
+    "towada.aomori.jp"
+    "town"
+    "town.museum"
+    "townnews-staging.com"
+    "toya.hokkaido.jp"
+    "toyako.hokkaido.jp"
+    "toyama.jp"
+    "toyama.toyama.jp"
+    "toyo.kochi.jp"
+    "toyoake.aichi.jp"
+    "toyohashi.aichi.jp"
+    "toyokawa.aichi.jp"
+    "toyonaka.osaka.jp"
+    "toyone.aichi.jp"
+    "toyono.osaka.jp"
+    "toyooka.hyogo.jp"
+    "toyosato.shiga.jp"
+    "toyota"
+    "toyota.aichi.jp"
+    "toyota.yamaguchi.jp"
+    "toyotomi.hokkaido.jp"
+    "toyotsu.fukuoka.jp"
+    "toyoura.hokkaido.jp"
+    "toys"
+    "tozawa.yamagata.jp"
+    "tozsde.hu"
+    "tp.it"
+    "tr"
+    "tr.eu.org"
+    "tr.it"
+    "tr.no"
+    "tra.kp"
+    "trade"
+    "trader.aero"
+    "trading"
+    "trading.aero"
+    "traeumtgerade.de"
+    "trafficplex.cloud"
+    "trainer.aero"
+    "training"
+    "trana.no"
+    "tranby.no"
+    "trani-andria-barletta.it"
+    "trani-barletta-andria.it"
+    "traniandriabarletta.it"
+    "tranibarlettaandria.it"
+    "tranoy.no"
+    "translate.goog"
+    "translated.page"
+    "transport.museum"
+    "transporte.bo"
+    "transurl.be"
+    "transurl.eu"
+    "transurl.nl"
+    "tran\303\270y.no"
+    "trapani.it"
+    "travel"
+    "travel.in"
+    "travel.pl"
+    "travel.tt"
+    "travelchannel"
+    "travelers"
+    "travelersinsurance"
+    "trd.br"
+    "tree.museum"
+    "trentin-sud-tirol.it"
+    "trentin-sudtirol.it"
+    "trentin-sued-tirol.it"
+    "trentin-suedtirol.it"
+    "trentin-s\303\274d-tirol.it"
+    "trentin-s\303\274dtirol.it"
+    "trentino-a-adige.it"
+    "trentino-aadige.it"
+    "trentino-alto-adige.it"
+    "trentino-altoadige.it"
+    "trentino-s-tirol.it"
+    "trentino-stirol.it"
+    "trentino-sud-tirol.it"
+    "trentino-sudtirol.it"
+    "trentino-sued-tirol.it"
+    "trentino-suedtirol.it"
+    "trentino-s\303\274d-tirol.it"
+    "trentino-s\303\274dtirol.it"
+    "trentino.it"
+    "trentinoa-adige.it"
+    "trentinoaadige.it"
+    "trentinoalto-adige.it"
+    "trentinoaltoadige.it"
+    "trentinos-tirol.it"
+    "trentinostirol.it"
+    "trentinosud-tirol.it"
+    "trentinosudtirol.it"
+    "trentinosued-tirol.it"
+    "trentinosuedtirol.it"
+    "trentinos\303\274d-tirol.it"
+    "trentinos\303\274dtirol.it"
+    "trentinsud-tirol.it"
+    "trentinsudtirol.it"
+    "trentinsued-tirol.it"
+    "trentinsuedtirol.it"
+    "trentins\303\274d-tirol.it"
+    "trentins\303\274dtirol.it"
+    "trento.it"
+    "treviso.it"
+    "trieste.it"
+    "triton.zone"
+    "troandin.no"
+    "trogstad.no"
+    "troitsk.su"
+    "trolley.museum"
+    "tromsa.no"
+    "tromso.no"
+    "troms\303\270.no"
+    "trondheim.no"
+    "trust"
+    "trust.museum"
+    "trustee.museum"
+    "trv"
+    "try-snowplow.com"
+    "trycloudflare.com"
+    "trysil.no"
+    "tr\303\246na.no"
+    "tr\303\270gstad.no"
+    "ts.it"
+    "ts.net"
+    "tselinograd.su"
+    "tsk.tr"
+    "tst.site"
+    "tsu.mie.jp"
+    "tsubame.niigata.jp"
+    "tsubata.ishikawa.jp"
+    "tsubetsu.hokkaido.jp"
+    "tsuchiura.ibaraki.jp"
+    "tsuga.tochigi.jp"
+    "tsugaru.aomori.jp"
+    "tsuiki.fukuoka.jp"
+    "tsukigata.hokkaido.jp"
+    "tsukiyono.gunma.jp"
+    "tsukuba.ibaraki.jp"
+    "tsukui.kanagawa.jp"
+    "tsukumi.oita.jp"
+    "tsumagoi.gunma.jp"
+    "tsunan.niigata.jp"
+    "tsuno.kochi.jp"
+    "tsuno.miyazaki.jp"
+    "tsuru.yamanashi.jp"
+    "tsuruga.fukui.jp"
+    "tsurugashima.saitama.jp"
+    "tsurugi.ishikawa.jp"
+    "tsuruoka.yamagata.jp"
+    "tsuruta.aomori.jp"
+    "tsushima.aichi.jp"
+    "tsushima.nagasaki.jp"
+    "tsuwano.shimane.jp"
+    "tsuyama.okayama.jp"
+    "tt"
+    "tt.im"
+    "tube"
+    "tui"
+    "tula.su"
+    "tuleap-partners.com"
+    "tunes"
+    "tunk.org"
+    "tur.ar"
+    "tur.br"
+    "turek.pl"
+    "turin.it"
+    "turystyka.pl"
+    "tuscany.it"
+    "tushu"
+    "tuva.su"
+    "tuxfamily.org"
+    "tv"
+    "tv.bb"
+    "tv.bo"
+    "tv.br"
+    "tv.im"
+    "tv.in"
+    "tv.it"
+    "tv.kg"
+    "tv.na"
+    "tv.sd"
+    "tv.tr"
+    "tv.tz"
+    "tvedestrand.no"
+    "tvs"
+    "tw"
+    "tw.cn"
+    "twmail.cc"
+    "twmail.net"
+    "twmail.org"
+    "tx.us"
+    "tychy.pl"
+    "tydal.no"
+    "tynset.no"
+    "typedream.app"
+    "tysfjord.no"
+    "tysnes.no"
+    "tysvar.no"
+    "tysv\303\246r.no"
+    "tz"
+    "t\303\270nsberg.no"
+    "u.bg"
+    "u.channelsdvr.net"
+    "u.se"
+    "u2-local.xnbay.com"
+    "u2.xnbay.com"
+    "ua"
+    "ua.rs"
+    "ubank"
+    "ube.yamaguchi.jp"
+    "uber.space"
+    "uberspace.de"
+    "ubs"
+    "uchihara.ibaraki.jp"
+    "uchiko.ehime.jp"
+    "uchinada.ishikawa.jp"
+    "uchinomi.kagawa.jp"
+    "ud.it"
+    "uda.nara.jp"
+    "udi.br"
+    "udine.it"
+    "udono.mie.jp"
+    "ueda.nagano.jp"
+    "ueno.gunma.jp"
+    "uenohara.yamanashi.jp"
+    "ufcfan.org"
+    "ug"
+    "ug.gov.pl"
+    "ugim.gov.pl"
+    "uhren.museum"
+    "ui.nabu.casa"
+    "uji.kyoto.jp"
+    "ujiie.tochigi.jp"
+    "ujitawara.kyoto.jp"
+    "uk"
+    "uk.com"
+    "uk.eu.org"
+    "uk.in"
+    "uk.kg"
+    "uk.net"
+    "uk.oxa.cloud"
+    "uk.primetel.cloud"
+    "uk.reclaim.cloud"
+    "uk0.bigv.io"
+    "uki.kumamoto.jp"
+    "ukiha.fukuoka.jp"
+    "ullensaker.no"
+    "ullensvang.no"
+    "ulm.museum"
+    "ulsan.kr"
+    "ulvik.no"
+    "um.gov.pl"
+    "umaji.kochi.jp"
+    "umb.it"
+    "umbria.it"
+    "umi.fukuoka.jp"
+    "umig.gov.pl"
+    "unazuki.toyama.jp"
+    "under.jp"
+    "undersea.museum"
+    "uni5.net"
+    "unicloud.pl"
+    "unicom"
+    "union.aero"
+    "univ.bj"
+    "univ.sn"
+    "university"
+    "university.museum"
+    "unjarga.no"
+    "unj\303\241rga.no"
+    "unnan.shimane.jp"
+    "uno"
+    "unusualperson.com"
+    "unzen.nagasaki.jp"
+    "uol"
+    "uonuma.niigata.jp"
+    "uozu.toyama.jp"
+    "up.in"
+    "upaas.kazteleport.kz"
+    "upli.io"
+    "upow.gov.pl"
+    "upper.jp"
+    "uppo.gov.pl"
+    "ups"
+    "urakawa.hokkaido.jp"
+    "urasoe.okinawa.jp"
+    "urausu.hokkaido.jp"
+    "urawa.saitama.jp"
+    "urayasu.chiba.jp"
+    "urbino-pesaro.it"
+    "urbinopesaro.it"
+    "ureshino.mie.jp"
+    "uri.arpa"
+    "url.tw"
+    "urn.arpa"
+    "urown.cloud"
+    "uruma.okinawa.jp"
+    "uryu.hokkaido.jp"
+    "us"
+    "us-1.evennode.com"
+    "us-2.evennode.com"
+    "us-3.evennode.com"
+    "us-4.evennode.com"
+    "us-east-1.amazonaws.com"
+    "us-east-1.elasticbeanstalk.com"
+    "us-east-2.elasticbeanstalk.com"
+    "us-gov-west-1.elasticbeanstalk.com"
+    "us-west-1.elasticbeanstalk.com"
+    "us-west-2.elasticbeanstalk.com"
+    "us.ax"
+    "us.com"
+    "us.eu.org"
+    "us.gov.pl"
+    "us.in"
+    "us.kg"
+    "us.na"
+    "us.org"
+    "us.platform.sh"
+    "us.reclaim.cloud"
+    "usa.museum"
+    "usa.oita.jp"
+    "usantiques.museum"
+    "usarts.museum"
+    "uscountryestate.museum"
+    "usculture.museum"
+    "usdecorativearts.museum"
+    "user.aseinet.ne.jp"
+    "user.fm"
+    "user.localcert.dev"
+    "user.party.eus"
+    "user.srcf.net"
+    "usercontent.goog"
+    "usercontent.jp"
+    "users.scale.virtualcloud.com.br"
+    "usgarden.museum"
+    "ushiku.ibaraki.jp"
+    "ushistory.museum"
+    "ushuaia.museum"
+    "uslivinghistory.museum"
+    "usr.cloud.muni.cz"
+    "ustka.pl"
+    "usui.fukuoka.jp"
+    "usuki.oita.jp"
+    "ut.us"
+    "utah.museum"
+    "utashinai.hokkaido.jp"
+    "utazas.hu"
+    "utazu.kagawa.jp"
+    "uto.kumamoto.jp"
+    "utsira.no"
+    "utsunomiya.tochigi.jp"
+    "utwente.io"
+    "uvic.museum"
+    "uw.gov.pl"
+    "uwajima.ehime.jp"
+    "uwu.ai"
+    "uy"
+    "uy.com"
+    "uz"
+    "uz.ua"
+    "uzhgorod.ua"
+    "uzs.gov.pl"
+    "v-info.info"
+    "v.bg"
+    "v.ua"
+    "va"
+    "va.it"
+    "va.no"
+    "va.us"
+    "vaapste.no"
+    "vacations"
+    "vadso.no"
+    "vads\303\270.no"
+    "vaga.no"
+    "vagan.no"
+    "vagsoy.no"
+    "vaksdal.no"
+    "val-d-aosta.it"
+    "val-daosta.it"
+    "vald-aosta.it"
+    "valdaosta.it"
+    "valer.hedmark.no"
+    "valer.ostfold.no"
+    "valle-aosta.it"
+    "valle-d-aosta.it"
+    "valle-daosta.it"
+    "valle.no"
+    "valleaosta.it"
+    "valled-aosta.it"
+    "valledaosta.it"
+    "vallee-aoste.it"
+    "vallee-d-aoste.it"
+    "valleeaoste.it"
+    "valleedaoste.it"
+    "valley.museum"
+    "vall\303\251e-aoste.it"
+    "vall\303\251e-d-aoste.it"
+    "vall\303\251eaoste.it"
+    "vall\303\251edaoste.it"
+    "vana"
+    "vang.no"
+    "vanguard"
+    "vantaa.museum"
+    "vanylven.no"
+    "vao.it"
+    "vapor.cloud"
+    "vaporcloud.io"
+    "vardo.no"
+    "vard\303\270.no"
+    "varese.it"
+    "varggat.no"
+    "varoy.no"
+    "vb.it"
+    "vc"
+    "vc.it"
+    "vda.it"
+    "ve"
+    "ve.it"
+    "vefsn.no"
+    "vega.no"
+    "vegarshei.no"
+    "vegas"
+    "veg\303\245rshei.no"
+    "velvet.jp"
+    "ven.it"
+    "veneto.it"
+    "venezia.it"
+    "venice.it"
+    "vennesla.no"
+    "ventures"
+    "verbania.it"
+    "vercel.app"
+    "vercel.dev"
+    "vercelli.it"
+    "verdal.no"
+    "verisign"
+    "verm\303\266gensberater"
+    "verm\303\266gensberatung"
+    "verona.it"
+    "verran.no"
+    "versailles.museum"
+    "verse.jp"
+    "versicherung"
+    "versus.jp"
+    "vestby.no"
+    "vestnes.no"
+    "vestre-slidre.no"
+    "vestre-toten.no"
+    "vestvagoy.no"
+    "vestv\303\245g\303\270y.no"
+    "vet"
+    "vet.br"
+    "veterinaire.fr"
+    "veterinaire.km"
+    "vevelstad.no"
+    "vf.no"
+    "vfs.cloud9.af-south-1.amazonaws.com"
+    "vfs.cloud9.ap-east-1.amazonaws.com"
+    "vfs.cloud9.ap-northeast-1.amazonaws.com"
+    "vfs.cloud9.ap-northeast-2.amazonaws.com"
+    "vfs.cloud9.ap-northeast-3.amazonaws.com"
+    "vfs.cloud9.ap-south-1.amazonaws.com"
+    "vfs.cloud9.ap-southeast-1.amazonaws.com"
+    "vfs.cloud9.ap-southeast-2.amazonaws.com"
+    "vfs.cloud9.ca-central-1.amazonaws.com"
+    "vfs.cloud9.eu-central-1.amazonaws.com"
+    "vfs.cloud9.eu-north-1.amazonaws.com"
+    "vfs.cloud9.eu-south-1.amazonaws.com"
+    "vfs.cloud9.eu-west-1.amazonaws.com"
+    "vfs.cloud9.eu-west-2.amazonaws.com"
+    "vfs.cloud9.eu-west-3.amazonaws.com"
+    "vfs.cloud9.me-south-1.amazonaws.com"
+    "vfs.cloud9.sa-east-1.amazonaws.com"
+    "vfs.cloud9.us-east-1.amazonaws.com"
+    "vfs.cloud9.us-east-2.amazonaws.com"
+    "vfs.cloud9.us-west-1.amazonaws.com"
+    "vfs.cloud9.us-west-2.amazonaws.com"
+    "vg"
+    "vgs.no"
+    "vi"
+    "vi.it"
+    "vi.us"
+    "viajes"
+    "vibo-valentia.it"
+    "vibovalentia.it"
+    "vic.au"
+    "vic.edu.au"
+    "vic.gov.au"
+    "vicenza.it"
+    "video"
+    "video.hu"
+    "vig"
+    "vik.no"
+    "viking"
+    "viking.museum"
+    "vikna.no"
+    "village.museum"
+    "villas"
+    "vin"
+    "vindafjord.no"
+    "vinnica.ua"
+    "vinnytsia.ua"
+    "vip"
+    "vip.jelastic.cloud"
+    "vipsinaapp.com"
+    "virgin"
+    "virginia.museum"
+    "virtual-user.de"
+    "virtual.museum"
+    "virtualserver.io"
+    "virtualuser.de"
+    "virtuel.museum"
+    "visa"
+    "vision"
+    "viterbo.it"
+    "viva"
+    "vivian.jp"
+    "vivo"
+    "vix.br"
+    "vlaanderen"
+    "vlaanderen.museum"
+    "vladikavkaz.ru"
+    "vladikavkaz.su"
+    "vladimir.ru"
+    "vladimir.su"
+    "vlog.br"
+    "vm.bytemark.co.uk"
+    "vn"
+    "vn.ua"
+    "voagat.no"
+    "vodka"
+    "volda.no"
+    "volkenkunde.museum"
+    "volkswagen"
+    "vologda.su"
+    "volvo"
+    "volyn.ua"
+    "voorloper.cloud"
+    "voss.no"
+    "vossevangen.no"
+    "vote"
+    "voting"
+    "voto"
+    "voyage"
+    "vp4.me"
+    "vpndns.net"
+    "vpnplus.to"
+    "vps-host.net"
+    "vps.mcdir.ru"
+    "vps.myjino.ru"
+    "vr.it"
+    "vs.it"
+    "vs.mythic-beasts.com"
+    "vt.it"
+    "vt.us"
+    "vu"
+    "vuelos"
+    "vultrobjects.com"
+    "vv.it"
+    "vxl.sh"
+    "v\303\241rgg\303\241t.no"
+    "v\303\245gan.no"
+    "v\303\245gs\303\270y.no"
+    "v\303\245g\303\245.no"
+    "v\303\245ler.hedmark.no"
+    "v\303\245ler.\303\270stfold.no"
+    "v\303\246r\303\270y.no"
+    "w.bg"
+    "w.se"
+    "wa.au"
+    "wa.edu.au"
+    "wa.gov.au"
+    "wa.us"
+    "wada.nagano.jp"
+    "wafflecell.com"
+    "wajiki.tokushima.jp"
+    "wajima.ishikawa.jp"
+    "wakasa.fukui.jp"
+    "wakasa.tottori.jp"
+    "wakayama.jp"
+    "wakayama.wakayama.jp"
+    "wake.okayama.jp"
+    "wakkanai.hokkaido.jp"
+    "wakuya.miyagi.jp"
+    "walbrzych.pl"
+    "wales"
+    "wales.museum"
+    "wallonie.museum"
+    "walmart"
+    "walter"
+    "wang"
+    "wanggou"
+    "wanouchi.gifu.jp"
+    "war.museum"
+    "warabi.saitama.jp"
+    "warmia.pl"
+    "warszawa.pl"
+    "washingtondc.museum"
+    "washtenaw.mi.us"
+    "wassamu.hokkaido.jp"
+    "watarai.mie.jp"
+    "watari.miyagi.jp"
+    "watch"
+    "watch-and-clock.museum"
+    "watchandclock.museum"
+    "watches"
+    "watson.jp"
+    "waw.pl"
+    "wazuka.kyoto.jp"
+    "we.bs"
+    "we.tc"
+    "weather"
+    "weatherchannel"
+    "web.app"
+    "web.bo"
+    "web.co"
+    "web.do"
+    "web.gu"
+    "web.id"
+    "web.in"
+    "web.lk"
+    "web.nf"
+    "web.ni"
+    "web.pk"
+    "web.tj"
+    "web.tr"
+    "web.ve"
+    "web.za"
+    "webcam"
+    "weber"
+    "webhare.dev"
+    "webhop.biz"
+    "webhop.info"
+    "webhop.me"
+    "webhop.net"
+    "webhop.org"
+    "webhosting.be"
+    "weblike.jp"
+    "webpaas.ovh.net"
+    "webredirect.org"
+    "website"
+    "website.yandexcloud.net"
+    "webspace.rocks"
+    "webthings.io"
+    "webview-assets.cloud9.af-south-1.amazonaws.com"
+    "webview-assets.cloud9.ap-east-1.amazonaws.com"
+    "webview-assets.cloud9.ap-northeast-1.amazonaws.com"
+    "webview-assets.cloud9.ap-northeast-2.amazonaws.com"
+    "webview-assets.cloud9.ap-northeast-3.amazonaws.com"
+    "webview-assets.cloud9.ap-south-1.amazonaws.com"
+    "webview-assets.cloud9.ap-southeast-1.amazonaws.com"
+    "webview-assets.cloud9.ap-southeast-2.amazonaws.com"
+    "webview-assets.cloud9.ca-central-1.amazonaws.com"
+    "webview-assets.cloud9.eu-central-1.amazonaws.com"
+    "webview-assets.cloud9.eu-north-1.amazonaws.com"
+    "webview-assets.cloud9.eu-south-1.amazonaws.com"
+    "webview-assets.cloud9.eu-west-1.amazonaws.com"
+    "webview-assets.cloud9.eu-west-2.amazonaws.com"
+    "webview-assets.cloud9.eu-west-3.amazonaws.com"
+    "webview-assets.cloud9.me-south-1.amazonaws.com"
+    "webview-assets.cloud9.sa-east-1.amazonaws.com"
+    "webview-assets.cloud9.us-east-1.amazonaws.com"
+    "webview-assets.cloud9.us-east-2.amazonaws.com"
+    "webview-assets.cloud9.us-west-1.amazonaws.com"
+    "webview-assets.cloud9.us-west-2.amazonaws.com"
+    "wedding"
+    "wedeploy.io"
+    "wedeploy.me"
+    "wedeploy.sh"
+    "weeklylottery.org.uk"
+    "wegrow.pl"
+    "weibo"
+    "weir"
+    "wellbeingzone.co.uk"
+    "wellbeingzone.eu"
+    "west1-us.cloudjiffy.net"
+    "western.museum"
+    "westeurope.azurestaticapps.net"
+    "westfalen.museum"
+    "westus2.azurestaticapps.net"
+    "wf"
+    "whaling.museum"
+    "whitesnow.jp"
+    "whm.fr-par.scw.cloud"
+    "whm.nl-ams.scw.cloud"
+    "whoswho"
+    "wi.us"
+    "wielun.pl"
+    "wien"
+    "wien.funkfeuer.at"
+    "wif.gov.pl"
+    "wiih.gov.pl"
+    "wiki"
+    "wiki.bo"
+    "wiki.br"
+    "wildlife.museum"
+    "williamhill"
+    "williamsburg.museum"
+    "win"
+    "winb.gov.pl"
+    "windmill.museum"
+    "windows"
+    "wine"
+    "winners"
+    "wios.gov.pl"
+    "witd.gov.pl"
+    "withgoogle.com"
+    "withyoutube.com"
+    "wiw.gov.pl"
+    "wixsite.com"
+    "wlocl.pl"
+    "wloclawek.pl"
+    "wmcloud.org"
+    "wme"
+    "wmflabs.org"
+    "wnext.app"
+    "wodzislaw.pl"
+    "wolomin.pl"
+    "wolterskluwer"
+    "woltlab-demo.com"
+    "woodside"
+    "work"
+    "workers.dev"
+    "workinggroup.aero"
+    "workisboring.com"
+    "works"
+    "works.aero"
+    "workshop.museum"
+    "world"
+    "worse-than.tv"
+    "wow"
+    "wpdevcloud.com"
+    "wpenginepowered.com"
+    "wphostedmail.com"
+    "wpmucdn.com"
+    "wpmudev.host"
+    "writesthisblog.com"
+    "wroc.pl"
+    "wroclaw.pl"
+    "ws"
+    "ws.na"
+    "wsa.gov.pl"
+    "wskr.gov.pl"
+    "wtc"
+    "wtf"
+    "wuoz.gov.pl"
+    "wv.us"
+    "www.ck"
+    "www.ro"
+    "wy.us"
+    "wzmiuw.gov.pl"
+    "x.bg"
+    "x.mythic-beasts.com"
+    "x.se"
+    "x443.pw"
+    "xbox"
+    "xen.prgmr.com"
+    "xerox"
+    "xfinity"
+    "xihuan"
+    "xin"
+    "xj.cn"
+    "xn--0trq7p7nn.jp"
+    "xn--11b4c3d"
+    "xn--12c1fe0br.xn--o3cw4h"
+    "xn--12cfi8ixb8l.xn--o3cw4h"
+    "xn--12co0c3b4eva.xn--o3cw4h"
+    "xn--1ck2e1b"
+    "xn--1ctwo.jp"
+    "xn--1lqs03n.jp"
+    "xn--1lqs71d.jp"
+    "xn--1qqw23a"
+    "xn--2m4a15e.jp"
+    "xn--2scrj9c"
+    "xn--30rr7y"
+    "xn--32vp30h.jp"
+    "xn--3bst00m"
+    "xn--3ds443g"
+    "xn--3e0b707e"
+    "xn--3hcrj9c"
+    "xn--3pxu8k"
+    "xn--41a.xn--p1acf"
+    "xn--42c2d9a"
+    "xn--45br5cyl"
+    "xn--45brj9c"
+    "xn--45q11c"
+    "xn--4dbgdty6c.xn--4dbrk0ce"
+    "xn--4dbrk0ce"
+    "xn--4gbrim"
+    "xn--4it168d.jp"
+    "xn--4it797k.jp"
+    "xn--4pvxs.jp"
+    "xn--54b7fta0cc"
+    "xn--55qw42g"
+    "xn--55qx5d"
+    "xn--55qx5d.cn"
+    "xn--55qx5d.hk"
+    "xn--55qx5d.xn--j6w193g"
+    "xn--5dbhl8d.xn--4dbrk0ce"
+    "xn--5js045d.jp"
+    "xn--5rtp49c.jp"
+    "xn--5rtq34k.jp"
+    "xn--5su34j936bgsg"
+    "xn--5tzm5g"
+    "xn--6btw5a.jp"
+    "xn--6frz82g"
+    "xn--6orx2r.jp"
+    "xn--6qq986b3xl"
+    "xn--7t0a264c.jp"
+    "xn--80aaa0cvac.xn--p1acf"
+    "xn--80adxhks"
+    "xn--80ao21a"
+    "xn--80aqecdr1a"
+    "xn--80asehdb"
+    "xn--80aswg"
+    "xn--80au.xn--90a3ac"
+    "xn--8dbq2a.xn--4dbrk0ce"
+    "xn--8ltr62k.jp"
+    "xn--8pvr4u.jp"
+    "xn--8y0a063a"
+    "xn--90a1af.xn--p1acf"
+    "xn--90a3ac"
+    "xn--90ae"
+    "xn--90ais"
+    "xn--90amc.xn--p1acf"
+    "xn--90azh.xn--90a3ac"
+    "xn--9dbhblg6di.museum"
+    "xn--9dbq2a"
+    "xn--9et52u"
+    "xn--9krt00a"
+    "xn--andy-ira.no"
+    "xn--aroport-bya.ci"
+    "xn--asky-ira.no"
+    "xn--aurskog-hland-jnb.no"
+    "xn--avery-yua.no"
+    "xn--b-5ga.nordland.no"
+    "xn--b-5ga.telemark.no"
+    "xn--b4w605ferd"
+    "xn--balsan-sdtirol-nsb.it"
+    "xn--bck1b9a5dre4c"
+    "xn--bdddj-mrabd.no"
+    "xn--bearalvhki-y4a.no"
+    "xn--berlevg-jxa.no"
+    "xn--bhcavuotna-s4a.no"
+    "xn--bhccavuotna-k7a.no"
+    "xn--bidr-5nac.no"
+    "xn--bievt-0qa.no"
+    "xn--bjarky-fya.no"
+    "xn--bjddar-pta.no"
+    "xn--blt-elab.no"
+    "xn--bmlo-gra.no"
+    "xn--bod-2na.no"
+    "xn--bozen-sdtirol-2ob.it"
+    "xn--brnny-wuac.no"
+    "xn--brnnysund-m8ac.no"
+    "xn--brum-voa.no"
+    "xn--btsfjord-9za.no"
+    "xn--bulsan-sdtirol-nsb.it"
+    "xn--c1avg"
+    "xn--c1avg.xn--90a3ac"
+    "xn--c1avg.xn--p1acf"
+    "xn--c2br7g"
+    "xn--c3s14m.jp"
+    "xn--cck2b3b"
+    "xn--cckwcxetd"
+    "xn--cesena-forl-mcb.it"
+    "xn--cesenaforl-i8a.it"
+    "xn--cg4bki"
+    "xn--ciqpn.hk"
+    "xn--clchc0ea0b2g2a9gcd"
+    "xn--comunicaes-v6a2o.museum"
+    "xn--correios-e-telecomunicaes-ghc29a.museum"
+    "xn--czr694b"
+    "xn--czrs0t"
+    "xn--czru2d"
+    "xn--czrw28b.tw"
+    "xn--d1acj3b"
+    "xn--d1alf"
+    "xn--d1at.xn--90a3ac"
+    "xn--d5qv7z876c.jp"
+    "xn--davvenjrga-y4a.no"
+    "xn--djrs72d6uy.jp"
+    "xn--djty4k.jp"
+    "xn--dnna-gra.no"
+    "xn--drbak-wua.no"
+    "xn--dyry-ira.no"
+    "xn--e1a4c"
+    "xn--eckvdtc9d"
+    "xn--efvn9s.jp"
+    "xn--efvy88h"
+    "xn--ehqz56n.jp"
+    "xn--elqq16h.jp"
+    "xn--eveni-0qa01ga.no"
+    "xn--f6qx53a.jp"
+    "xn--fct429k"
+    "xn--fhbei"
+    "xn--finny-yua.no"
+    "xn--fiq228c5hs"
+    "xn--fiq64b"
+    "xn--fiqs8s"
+    "xn--fiqz9s"
+    "xn--fjord-lra.no"
+    "xn--fjq720a"
+    "xn--fl-zia.no"
+    "xn--flor-jra.no"
+    "xn--flw351e"
+    "xn--forl-cesena-fcb.it"
+    "xn--forlcesena-c8a.it"
+    "xn--fpcrj9c3d"
+    "xn--frde-gra.no"
+    "xn--frna-woa.no"
+    "xn--frya-hra.no"
+    "xn--fzc2c9e2c"
+    "xn--fzys8d69uvgm"
+    "xn--g2xx48c"
+    "xn--gckr3f0f"
+    "xn--gecrj9c"
+    "xn--ggaviika-8ya47h.no"
+    "xn--gildeskl-g0a.no"
+    "xn--givuotna-8ya.no"
+    "xn--gjvik-wua.no"
+    "xn--gk3at1e"
+    "xn--gls-elac.no"
+    "xn--gmq050i.hk"
+    "xn--gmqw5a.hk"
+    "xn--gmqw5a.xn--j6w193g"
+    "xn--gnstigbestellen-zvb.de"
+    "xn--gnstigliefern-wob.de"
+    "xn--h-2fa.no"
+    "xn--h1aegh.museum"
+    "xn--h1ahn.xn--p1acf"
+    "xn--h1aliz.xn--p1acf"
+    "xn--h2breg3eve"
+    "xn--h2brj9c"
+    "xn--h2brj9c8c"
+    "xn--h3cuzk1di.xn--o3cw4h"
+    "xn--hbmer-xqa.no"
+    "xn--hcesuolo-7ya35b.no"
+    "xn--hebda8b.xn--4dbrk0ce"
+    "xn--hery-ira.nordland.no"
+    "xn--hery-ira.xn--mre-og-romsdal-qqb.no"
+    "xn--hgebostad-g3a.no"
+    "xn--hkkinen-5wa.fi"
+    "xn--hmmrfeasta-s4ac.no"
+    "xn--hnefoss-q1a.no"
+    "xn--hobl-ira.no"
+    "xn--holtlen-hxa.no"
+    "xn--hpmir-xqa.no"
+    "xn--hxt814e"
+    "xn--hyanger-q1a.no"
+    "xn--hylandet-54a.no"
+    "xn--i1b6b1a6a2e"
+    "xn--imr513n"
+    "xn--indery-fya.no"
+    "xn--io0a7i"
+    "xn--io0a7i.cn"
+    "xn--io0a7i.hk"
+    "xn--j1adp.xn--p1acf"
+    "xn--j1aef"
+    "xn--j1aef.xn--p1acf"
+    "xn--j1ael8b.xn--p1acf"
+    "xn--j1amh"
+    "xn--j6w193g"
+    "xn--jlq480n2rg"
+    "xn--jlster-bya.no"
+    "xn--jrpeland-54a.no"
+    "xn--jvr189m"
+    "xn--k7yn95e.jp"
+    "xn--karmy-yua.no"
+    "xn--kbrq7o.jp"
+    "xn--kcrx77d1x4a"
+    "xn--kfjord-iua.no"
+    "xn--klbu-woa.no"
+    "xn--klt787d.jp"
+    "xn--kltp7d.jp"
+    "xn--kltx9a.jp"
+    "xn--klty5x.jp"
+    "xn--koluokta-7ya57h.no"
+    "xn--kprw13d"
+    "xn--kpry57d"
+    "xn--kput3i"
+    "xn--krager-gya.no"
+    "xn--kranghke-b0a.no"
+    "xn--krdsherad-m8a.no"
+    "xn--krehamn-dxa.no"
+    "xn--krjohka-hwab49j.no"
+    "xn--ksnes-uua.no"
+    "xn--kvfjord-nxa.no"
+    "xn--kvitsy-fya.no"
+    "xn--kvnangen-k0a.no"
+    "xn--l-1fa.no"
+    "xn--l1acc"
+    "xn--laheadju-7ya.no"
+    "xn--langevg-jxa.no"
+    "xn--lcvr32d.hk"
+    "xn--ldingen-q1a.no"
+    "xn--leagaviika-52b.no"
+    "xn--lesund-hua.no"
+    "xn--lgbbat1ad8j"
+    "xn--lgrd-poac.no"
+    "xn--lhppi-xqa.no"
+    "xn--linds-pra.no"
+    "xn--lns-qla.museum"
+    "xn--loabt-0qa.no"
+    "xn--lrdal-sra.no"
+    "xn--lrenskog-54a.no"
+    "xn--lt-liac.no"
+    "xn--lten-gra.no"
+    "xn--lury-ira.no"
+    "xn--m3ch0j3a.xn--o3cw4h"
+    "xn--mely-ira.no"
+    "xn--merker-kua.no"
+    "xn--mgb2ddes"
+    "xn--mgb9awbf"
+    "xn--mgba3a3ejt"
+    "xn--mgba3a4f16a"
+    "xn--mgba3a4f16a.ir"
+    "xn--mgba3a4fra"
+    "xn--mgba3a4fra.ir"
+    "xn--mgba7c0bbn0a"
+    "xn--mgbaakc7dvf"
+    "xn--mgbaam7a8h"
+    "xn--mgbab2bd"
+    "xn--mgbah1a3hjkrd"
+    "xn--mgbai9a5eva00b"
+    "xn--mgbai9azgqp6j"
+    "xn--mgbayh7gpa"
+    "xn--mgbbh1a"
+    "xn--mgbbh1a71e"
+    "xn--mgbc0a9azcg"
+    "xn--mgbca7dzdo"
+    "xn--mgbcpq6gpa1a"
+    "xn--mgberp4a5d4a87g"
+    "xn--mgberp4a5d4ar"
+    "xn--mgbgu82a"
+    "xn--mgbi4ecexp"
+    "xn--mgbpl2fh"
+    "xn--mgbqly7c0a67fbc"
+    "xn--mgbqly7cvafr"
+    "xn--mgbt3dhd"
+    "xn--mgbtf8fl"
+    "xn--mgbtx2b"
+    "xn--mgbx4cd0ab"
+    "xn--mix082f"
+    "xn--mix891f"
+    "xn--mjndalen-64a.no"
+    "xn--mk0axi.hk"
+    "xn--mk1bu44c"
+    "xn--mkru45i.jp"
+    "xn--mlatvuopmi-s4a.no"
+    "xn--mli-tla.no"
+    "xn--mlselv-iua.no"
+    "xn--moreke-jua.no"
+    "xn--mori-qsa.nz"
+    "xn--mosjen-eya.no"
+    "xn--mot-tla.no"
+    "xn--msy-ula0h.no"
+    "xn--mtta-vrjjat-k7af.no"
+    "xn--muost-0qa.no"
+    "xn--mxtq1m"
+    "xn--mxtq1m.hk"
+    "xn--mxtq1m.xn--j6w193g"
+    "xn--ngbc5azd"
+    "xn--ngbe9e0a"
+    "xn--ngbrx"
+    "xn--nit225k.jp"
+    "xn--nmesjevuemie-tcba.no"
+    "xn--nnx388a"
+    "xn--node"
+    "xn--nqv7f"
+    "xn--nqv7fs00ema"
+    "xn--nry-yla5g.no"
+    "xn--ntso0iqx3a.jp"
+    "xn--ntsq17g.jp"
+    "xn--nttery-byae.no"
+    "xn--nvuotna-hwa.no"
+    "xn--nyqy26a"
+    "xn--o1ac.xn--90a3ac"
+    "xn--o1ach.xn--90a3ac"
+    "xn--o3cw4h"
+    "xn--o3cyx2a.xn--o3cw4h"
+    "xn--od0alg.cn"
+    "xn--od0alg.hk"
+    "xn--od0alg.xn--j6w193g"
+    "xn--od0aq3b.hk"
+    "xn--ogbpf8fl"
+    "xn--oppegrd-ixa.no"
+    "xn--ostery-fya.no"
+    "xn--osyro-wua.no"
+    "xn--otu796d"
+    "xn--p1acf"
+    "xn--p1ai"
+    "xn--pgbs0dh"
+    "xn--porsgu-sta26f.no"
+    "xn--pssu33l.jp"
+    "xn--pssy2u"
+    "xn--q7ce6a"
+    "xn--q9jyb4c"
+    "xn--qcka1pmc"
+    "xn--qqqt11m.jp"
+    "xn--qxa6a"
+    "xn--qxam"
+    "xn--rady-ira.no"
+    "xn--rdal-poa.no"
+    "xn--rde-ula.no"
+    "xn--rdy-0nab.no"
+    "xn--rennesy-v1a.no"
+    "xn--rhkkervju-01af.no"
+    "xn--rholt-mra.no"
+    "xn--rhqv96g"
+    "xn--rht27z.jp"
+    "xn--rht3d.jp"
+    "xn--rht61e.jp"
+    "xn--risa-5na.no"
+    "xn--risr-ira.no"
+    "xn--rland-uua.no"
+    "xn--rlingen-mxa.no"
+    "xn--rmskog-bya.no"
+    "xn--rny31h.jp"
+    "xn--rovu88b"
+    "xn--rros-gra.no"
+    "xn--rskog-uua.no"
+    "xn--rst-0na.no"
+    "xn--rsta-fra.no"
+    "xn--rvc1e0am3e"
+    "xn--ryken-vua.no"
+    "xn--ryrvik-bya.no"
+    "xn--s-1fa.no"
+    "xn--s9brj9c"
+    "xn--sandnessjen-ogb.no"
+    "xn--sandy-yua.no"
+    "xn--sdtirol-n2a.it"
+    "xn--seral-lra.no"
+    "xn--ses554g"
+    "xn--sgne-gra.no"
+    "xn--skierv-uta.no"
+    "xn--skjervy-v1a.no"
+    "xn--skjk-soa.no"
+    "xn--sknit-yqa.no"
+    "xn--sknland-fxa.no"
+    "xn--slat-5na.no"
+    "xn--slt-elab.no"
+    "xn--smla-hra.no"
+    "xn--smna-gra.no"
+    "xn--snase-nra.no"
+    "xn--sndre-land-0cb.no"
+    "xn--snes-poa.no"
+    "xn--snsa-roa.no"
+    "xn--sr-aurdal-l8a.no"
+    "xn--sr-fron-q1a.no"
+    "xn--sr-odal-q1a.no"
+    "xn--sr-varanger-ggb.no"
+    "xn--srfold-bya.no"
+    "xn--srreisa-q1a.no"
+    "xn--srum-gra.no"
+    "xn--stjrdal-s1a.no"
+    "xn--stjrdalshalsen-sqb.no"
+    "xn--stre-toten-zcb.no"
+    "xn--t60b56a"
+    "xn--tckwe"
+    "xn--tiq49xqyj"
+    "xn--tjme-hra.no"
+    "xn--tn0ag.hk"
+    "xn--tnsberg-q1a.no"
+    "xn--tor131o.jp"
+    "xn--trany-yua.no"
+    "xn--trentin-sd-tirol-rzb.it"
+    "xn--trentin-sdtirol-7vb.it"
+    "xn--trentino-sd-tirol-c3b.it"
+    "xn--trentino-sdtirol-szb.it"
+    "xn--trentinosd-tirol-rzb.it"
+    "xn--trentinosdtirol-7vb.it"
+    "xn--trentinsd-tirol-6vb.it"
+    "xn--trentinsdtirol-nsb.it"
+    "xn--trgstad-r1a.no"
+    "xn--trna-woa.no"
+    "xn--troms-zua.no"
+    "xn--tysvr-vra.no"
+    "xn--uc0atv.hk"
+    "xn--uc0atv.tw"
+    "xn--uc0atv.xn--j6w193g"
+    "xn--uc0ay4a.hk"
+    "xn--uist22h.jp"
+    "xn--uisz3g.jp"
+    "xn--unjrga-rta.no"
+    "xn--unup4y"
+    "xn--uuwu58a.jp"
+    "xn--vads-jra.no"
+    "xn--valle-aoste-ebb.it"
+    "xn--valle-d-aoste-ehb.it"
+    "xn--valleaoste-e7a.it"
+    "xn--valledaoste-ebb.it"
+    "xn--vard-jra.no"
+    "xn--vegrshei-c0a.no"
+    "xn--vermgensberater-ctb"
+    "xn--vermgensberatung-pwb"
+    "xn--vestvgy-ixa6o.no"
+    "xn--vg-yiab.no"
+    "xn--vgan-qoa.no"
+    "xn--vgsy-qoa0j.no"
+    "xn--vgu402c.jp"
+    "xn--vhquv"
+    "xn--vler-qoa.hedmark.no"
+    "xn--vler-qoa.xn--stfold-9xa.no"
+    "xn--vre-eiker-k8a.no"
+    "xn--vrggt-xqad.no"
+    "xn--vry-yla5g.no"
+    "xn--vuq861b"
+    "xn--w4r85el8fhu5dnra"
+    "xn--w4rs40l"
+    "xn--wcvs22d.hk"
+    "xn--wcvs22d.xn--j6w193g"
+    "xn--wgbh1c"
+    "xn--wgbl6a"
+    "xn--xhq521b"
+    "xn--xkc2al3hye2a"
+    "xn--xkc2dl3a5ee0h"
+    "xn--y9a3aq"
+    "xn--yer-zna.no"
+    "xn--yfro4i67o"
+    "xn--ygarden-p1a.no"
+    "xn--ygbi2ammx"
+    "xn--ystre-slidre-ujb.no"
+    "xn--zbx025d.jp"
+    "xn--zf0ao64a.tw"
+    "xn--zf0avx.hk"
+    "xn--zfr164b"
+    "xnbay.com"
+    "xs4all.space"
+    "xx.gl"
+    "xxx"
+    "xy.ax"
+    "xyz"
+    "xz.cn"
+    "y.bg"
+    "y.se"
+    "yabu.hyogo.jp"
+    "yabuki.fukushima.jp"
+    "yachimata.chiba.jp"
+    "yachiyo.chiba.jp"
+    "yachiyo.ibaraki.jp"
+    "yachts"
+    "yaese.okinawa.jp"
+    "yahaba.iwate.jp"
+    "yahiko.niigata.jp"
+    "yahoo"
+    "yaita.tochigi.jp"
+    "yaizu.shizuoka.jp"
+    "yakage.okayama.jp"
+    "yakumo.hokkaido.jp"
+    "yakumo.shimane.jp"
+    "yali.mythic-beasts.com"
+    "yalta.ua"
+    "yamada.fukuoka.jp"
+    "yamada.iwate.jp"
+    "yamada.toyama.jp"
+    "yamaga.kumamoto.jp"
+    "yamagata.gifu.jp"
+    "yamagata.ibaraki.jp"
+    "yamagata.jp"
+    "yamagata.nagano.jp"
+    "yamagata.yamagata.jp"
+    "yamaguchi.jp"
+    "yamakita.kanagawa.jp"
+    "yamamoto.miyagi.jp"
+    "yamanakako.yamanashi.jp"
+    "yamanashi.jp"
+    "yamanashi.yamanashi.jp"
+    "yamanobe.yamagata.jp"
+    "yamanouchi.nagano.jp"
+    "yamashina.kyoto.jp"
+    "yamato.fukushima.jp"
+    "yamato.kanagawa.jp"
+    "yamato.kumamoto.jp"
+    "yamatokoriyama.nara.jp"
+    "yamatotakada.nara.jp"
+    "yamatsuri.fukushima.jp"
+    "yamaxun"
+    "yamazoe.nara.jp"
+    "yame.fukuoka.jp"
+    "yanagawa.fukuoka.jp"
+    "yanaizu.fukushima.jp"
+    "yandex"
+    "yandexcloud.net"
+    "yao.osaka.jp"
+    "yaotsu.gifu.jp"
+    "yasaka.nagano.jp"
+    "yashio.saitama.jp"
+    "yashiro.hyogo.jp"
+    "yasu.shiga.jp"
+    "yasuda.kochi.jp"
+    "yasugi.shimane.jp"
+    "yasuoka.nagano.jp"
+    "yatomi.aichi.jp"
+    "yatsuka.shimane.jp"
+    "yatsushiro.kumamoto.jp"
+    "yawara.ibaraki.jp"
+    "yawata.kyoto.jp"
+    "yawatahama.ehime.jp"
+    "yazu.tottori.jp"
+    "ybo.faith"
+    "ybo.party"
+    "ybo.review"
+    "ybo.science"
+    "ybo.trade"
+    "ye"
+    "yk.ca"
+    "yn.cn"
+    "ynh.fr"
+    "yodobashi"
+    "yoga"
+    "yoichi.hokkaido.jp"
+    "yoita.niigata.jp"
+    "yoka.hyogo.jp"
+    "yokaichiba.chiba.jp"
+    "yokawa.hyogo.jp"
+    "yokkaichi.mie.jp"
+    "yokohama"
+    "yokohama.jp"
+    "yokoshibahikari.chiba.jp"
+    "yokosuka.kanagawa.jp"
+    "yokote.akita.jp"
+    "yokoze.saitama.jp"
+    "yolasite.com"
+    "yombo.me"
+    "yomitan.okinawa.jp"
+    "yonabaru.okinawa.jp"
+    "yonago.tottori.jp"
+    "yonaguni.okinawa.jp"
+    "yonezawa.yamagata.jp"
+    "yono.saitama.jp"
+    "yorii.saitama.jp"
+    "york.museum"
+    "yorkshire.museum"
+    "yoro.gifu.jp"
+    "yosemite.museum"
+    "yoshida.saitama.jp"
+    "yoshida.shizuoka.jp"
+    "yoshikawa.saitama.jp"
+    "yoshimi.saitama.jp"
+    "yoshino.nara.jp"
+    "yoshinogari.saga.jp"
+    "yoshioka.gunma.jp"
+    "yotsukaido.chiba.jp"
+    "you"
+    "youth.museum"
+    "youtube"
+    "yt"
+    "yuasa.wakayama.jp"
+    "yufu.oita.jp"
+    "yugawa.fukushima.jp"
+    "yugawara.kanagawa.jp"
+    "yuki.ibaraki.jp"
+    "yukuhashi.fukuoka.jp"
+    "yun"
+    "yura.wakayama.jp"
+    "yurihonjo.akita.jp"
+    "yusuhara.kochi.jp"
+    "yusui.kagoshima.jp"
+    "yuu.yamaguchi.jp"
+    "yuza.yamagata.jp"
+    "yuzawa.niigata.jp"
+    "z.bg"
+    "z.se"
+    "za.bz"
+    "za.com"
+    "za.net"
+    "za.org"
+    "zachpomor.pl"
+    "zagan.pl"
+    "zakopane.pl"
+    "zama.kanagawa.jp"
+    "zamami.okinawa.jp"
+    "zao.miyagi.jp"
+    "zaporizhzhe.ua"
+    "zaporizhzhia.ua"
+    "zappos"
+    "zapto.org"
+    "zapto.xyz"
+    "zara"
+    "zarow.pl"
+    "zentsuji.kagawa.jp"
+    "zero"
+    "zgora.pl"
+    "zgorzelec.pl"
+    "zhitomir.ua"
+    "zhytomyr.ua"
+    "zip"
+    "zj.cn"
+    "zlg.br"
+    "zm"
+    "zombie.jp"
+    "zone"
+    "zoological.museum"
+    "zoology.museum"
+    "zp.gov.pl"
+    "zp.ua"
+    "zt.ua"
+    "zuerich"
+    "zushi.kanagawa.jp"
+    "zw"
+    "\303\241k\305\213oluokta.no"
+    "\303\241laheadju.no"
+    "\303\241lt\303\241.no"
+    "\303\245fjord.no"
+    "\303\245krehamn.no"
+    "\303\245l.no"
+    "\303\245lesund.no"
+    "\303\245lg\303\245rd.no"
+    "\303\245mli.no"
+    "\303\245mot.no"
+    "\303\245rdal.no"
+    "\303\245s.no"
+    "\303\245seral.no"
+    "\303\245snes.no"
+    "\303\270ksnes.no"
+    "\303\270rland.no"
+    "\303\270rskog.no"
+    "\303\270rsta.no"
+    "\303\270stre-toten.no"
+    "\303\270vre-eiker.no"
+    "\303\270yer.no"
+    "\303\270ygarden.no"
+    "\303\270ystre-slidre.no"
+    "\304\215\303\241hcesuolo.no"
+    "\316\265\316\273"
+    "\316\265\317\205"
+    "\320\260\320\272.\321\201\321\200\320\261"
+    "\320\261\320\263"
+    "\320\261\320\265\320\273"
+    "\320\261\320\270\320\267.\321\200\321\203\321\201"
+    "\320\264\320\265\321\202\320\270"
+    "\320\265\321\216"
+    "\320\270\320\272\320\276\320\274.museum"
+    "\320\272\320\260\321\202\320\276\320\273\320\270\320\272"
+    "\320\272\320\276\320\274"
+    "\320\272\320\276\320\274.\321\200\321\203\321\201"
+    "\320\272\321\200\321\213\320\274.\321\200\321\203\321\201"
+    "\320\274\320\270\321\200.\321\200\321\203\321\201"
+    "\320\274\320\272\320\264"
+    "\320\274\320\276\320\275"
+    "\320\274\320\276\321\201\320\272\320\262\320\260"
+    "\320\274\321\201\320\272.\321\200\321\203\321\201"
+    "\320\276\320\261\321\200.\321\201\321\200\320\261"
+    "\320\276\320\264.\321\201\321\200\320\261"
+    "\320\276\320\275\320\273\320\260\320\271\320\275"
+    "\320\276\321\200\320\263"
+    "\320\276\321\200\320\263.\321\200\321\203\321\201"
+    "\320\276\321\200\320\263.\321\201\321\200\320\261"
+    "\320\277\321\200.\321\201\321\200\320\261"
+    "\321\200\321\203\321\201"
+    "\321\200\321\204"
+    "\321\201\320\260\320\271\321\202"
+    "\321\201\320\260\320\274\320\260\321\200\320\260.\321\200\321\203\321\201"
+    "\321\201\320\276\321\207\320\270.\321\200\321\203\321\201"
+    "\321\201\320\277\320\261.\321\200\321\203\321\201"
+    "\321\201\321\200\320\261"
+    "\321\203\320\272\321\200"
+    "\321\203\320\277\321\200.\321\201\321\200\320\261"
+    "\321\217.\321\200\321\203\321\201"
+    "\322\233\320\260\320\267"
+    "\325\260\325\241\325\265"
+    "\327\220\327\247\327\223\327\236\327\231\327\224.\327\231\327\251\327\250\327\220\327\234"
+    "\327\231\327\250\327\225\327\251\327\234\327\231\327\235.museum"
+    "\327\231\327\251\327\225\327\221.\327\231\327\251\327\250\327\220\327\234"
+    "\327\231\327\251\327\250\327\220\327\234"
+    "\327\236\327\236\327\251\327\234.\327\231\327\251\327\250\327\220\327\234"
+    "\327\246\327\224\327\234.\327\231\327\251\327\250\327\220\327\234"
+    "\327\247\327\225\327\235"
+    "\330\247\330\250\331\210\330\270\330\250\331\212"
+    "\330\247\330\252\330\265\330\247\331\204\330\247\330\252"
+    "\330\247\330\261\330\247\331\205\331\203\331\210"
+    "\330\247\331\204\330\247\330\261\330\257\331\206"
+    "\330\247\331\204\330\250\330\255\330\261\331\212\331\206"
+    "\330\247\331\204\330\254\330\262\330\247\330\246\330\261"
+    "\330\247\331\204\330\263\330\271\331\210\330\257\331\212\330\251"
+    "\330\247\331\204\330\263\330\271\331\210\330\257\331\212\331\207"
+    "\330\247\331\204\330\263\330\271\331\210\330\257\333\214\330\251"
+    "\330\247\331\204\330\263\330\271\331\210\330\257\333\214\333\203"
+    "\330\247\331\204\330\271\331\204\331\212\330\247\331\206"
+    "\330\247\331\204\331\205\330\272\330\261\330\250"
+    "\330\247\331\204\331\212\331\205\331\206"
+    "\330\247\331\205\330\247\330\261\330\247\330\252"
+    "\330\247\331\212\330\261\330\247\331\206"
+    "\330\247\331\212\330\261\330\247\331\206.ir"
+    "\330\247\333\214\330\261\330\247\331\206"
+    "\330\247\333\214\330\261\330\247\331\206.ir"
+    "\330\250\330\247\330\261\330\252"
+    "\330\250\330\247\330\262\330\247\330\261"
+    "\330\250\331\212\330\252\331\203"
+    "\330\250\332\276\330\247\330\261\330\252"
+    "\330\252\331\210\331\206\330\263"
+    "\330\263\331\210\330\257\330\247\331\206"
+    "\330\263\331\210\330\261\331\212\330\247"
+    "\330\263\331\210\330\261\331\212\330\251"
+    "\330\264\330\250\331\203\330\251"
+    "\330\271\330\261\330\247\331\202"
+    "\330\271\330\261\330\250"
+    "\330\271\331\205\330\247\331\206"
+    "\331\201\331\204\330\263\330\267\331\212\331\206"
+    "\331\202\330\267\330\261"
+    "\331\203\330\247\330\253\331\210\331\204\331\212\331\203"
+    "\331\203\331\210\331\205"
+    "\331\205\330\265\330\261"
+    "\331\205\331\204\331\212\330\263\331\212\330\247"
+    "\331\205\331\210\330\261\331\212\330\252\330\247\331\206\331\212\330\247"
+    "\331\205\331\210\331\202\330\271"
+    "\331\207\331\205\330\261\330\247\331\207"
+    "\331\276\330\247\331\203\330\263\330\252\330\247\331\206"
+    "\331\276\330\247\332\251\330\263\330\252\330\247\331\206"
+    "\332\200\330\247\330\261\330\252"
+    "\340\244\225\340\245\211\340\244\256"
+    "\340\244\250\340\245\207\340\244\237"
+    "\340\244\255\340\244\276\340\244\260\340\244\244"
+    "\340\244\255\340\244\276\340\244\260\340\244\244\340\244\256\340\245\215"
+    "\340\244\255\340\244\276\340\244\260\340\245\213\340\244\244"
+    "\340\244\270\340\244\202\340\244\227\340\244\240\340\244\250"
+    "\340\246\254\340\246\276\340\246\202\340\246\262\340\246\276"
+    "\340\246\255\340\246\276\340\246\260\340\246\244"
+    "\340\246\255\340\246\276\340\247\260\340\246\244"
+    "\340\250\255\340\250\276\340\250\260\340\250\244"
+    "\340\252\255\340\252\276\340\252\260\340\252\244"
+    "\340\254\255\340\254\276\340\254\260\340\254\244"
+    "\340\256\207\340\256\250\340\257\215\340\256\244\340\256\277\340\256\257\340\256\276"
+    "\340\256\207\340\256\262\340\256\231\340\257\215\340\256\225\340\257\210"
+    "\340\256\232\340\256\277\340\256\231\340\257\215\340\256\225\340\256\252\340\257\215\340\256\252\340\257\202\340\256\260\340\257\215"
+    "\340\260\255\340\260\276\340\260\260\340\260\244\340\261\215"
+    "\340\262\255\340\262\276\340\262\260\340\262\244"
+    "\340\264\255\340\264\276\340\264\260\340\264\244\340\264\202"
+    "\340\266\275\340\266\202\340\266\232\340\267\217"
+    "\340\270\204\340\270\255\340\270\241"
+    "\340\270\227\340\270\253\340\270\262\340\270\243.\340\271\204\340\270\227\340\270\242"
+    "\340\270\230\340\270\270\340\270\243\340\270\201\340\270\264\340\270\210.\340\271\204\340\270\227\340\270\242"
+    "\340\270\243\340\270\261\340\270\220\340\270\232\340\270\262\340\270\245.\340\271\204\340\270\227\340\270\242"
+    "\340\270\250\340\270\266\340\270\201\340\270\251\340\270\262.\340\271\204\340\270\227\340\270\242"
+    "\340\270\255\340\270\207\340\270\204\340\271\214\340\270\201\340\270\243.\340\271\204\340\270\227\340\270\242"
+    "\340\271\200\340\270\231\340\271\207\340\270\225.\340\271\204\340\270\227\340\270\242"
+    "\340\271\204\340\270\227\340\270\242"
+    "\340\272\245\340\272\262\340\272\247"
+    "\341\203\222\341\203\224"
+    "\343\201\277\343\202\223\343\201\252"
+    "\343\202\242\343\203\236\343\202\276\343\203\263"
+    "\343\202\257\343\203\251\343\202\246\343\203\211"
+    "\343\202\260\343\203\274\343\202\260\343\203\253"
+    "\343\202\263\343\203\240"
+    "\343\202\271\343\203\210\343\202\242"
+    "\343\202\273\343\203\274\343\203\253"
+    "\343\203\225\343\202\241\343\203\203\343\202\267\343\203\247\343\203\263"
+    "\343\203\235\343\202\244\343\203\263\343\203\210"
+    "\344\270\211\351\207\215.jp"
+    "\344\270\226\347\225\214"
+    "\344\270\252\344\272\272.hk"
+    "\344\270\255\344\277\241"
+    "\344\270\255\345\233\275"
+    "\344\270\255\345\234\213"
+    "\344\270\255\346\226\207\347\275\221"
+    "\344\272\232\351\251\254\351\200\212"
+    "\344\272\254\351\203\275.jp"
+    "\344\274\201\344\270\232"
+    "\344\275\220\350\263\200.jp"
+    "\344\275\233\345\261\261"
+    "\344\277\241\346\201\257"
+    "\345\200\213\344\272\272.hk"
+    "\345\200\213\344\272\272.\351\246\231\346\270\257"
+    "\345\201\245\345\272\267"
+    "\345\205\253\345\215\246"
+    "\345\205\254\345\217\270"
+    "\345\205\254\345\217\270.cn"
+    "\345\205\254\345\217\270.hk"
+    "\345\205\254\345\217\270.\351\246\231\346\270\257"
+    "\345\205\254\347\233\212"
+    "\345\205\265\345\272\253.jp"
+    "\345\214\227\346\265\267\351\201\223.jp"
+    "\345\215\203\350\221\211.jp"
+    "\345\217\260\346\271\276"
+    "\345\217\260\347\201\243"
+    "\345\222\214\346\255\214\345\261\261.jp"
+    "\345\225\206\345\237\216"
+    "\345\225\206\345\272\227"
+    "\345\225\206\346\240\207"
+    "\345\225\206\346\245\255.tw"
+    "\345\230\211\351\207\214"
+    "\345\230\211\351\207\214\345\244\247\351\205\222\345\272\227"
+    "\345\234\250\347\272\277"
+    "\345\237\274\347\216\211.jp"
+    "\345\244\247\345\210\206.jp"
+    "\345\244\247\346\213\277"
+    "\345\244\247\351\230\252.jp"
+    "\345\244\251\344\270\273\346\225\231"
+    "\345\245\210\350\211\257.jp"
+    "\345\250\261\344\271\220"
+    "\345\256\256\345\237\216.jp"
+    "\345\256\256\345\264\216.jp"
+    "\345\256\266\351\233\273"
+    "\345\257\214\345\261\261.jp"
+    "\345\261\261\345\217\243.jp"
+    "\345\261\261\345\275\242.jp"
+    "\345\261\261\346\242\250.jp"
+    "\345\262\220\351\230\234.jp"
+    "\345\262\241\345\261\261.jp"
+    "\345\262\251\346\211\213.jp"
+    "\345\263\266\346\240\271.jp"
+    "\345\271\277\344\270\234"
+    "\345\272\203\345\263\266.jp"
+    "\345\276\256\345\215\232"
+    "\345\276\263\345\263\266.jp"
+    "\346\204\233\345\252\233.jp"
+    "\346\204\233\347\237\245.jp"
+    "\346\205\210\345\226\204"
+    "\346\210\221\347\210\261\344\275\240"
+    "\346\211\213\346\234\272"
+    "\346\213\233\350\201\230"
+    "\346\224\277\345\212\241"
+    "\346\224\277\345\272\234"
+    "\346\224\277\345\272\234.hk"
+    "\346\224\277\345\272\234.\351\246\231\346\270\257"
+    "\346\225\216\350\202\262.hk"
+    "\346\225\231\350\202\262.hk"
+    "\346\225\231\350\202\262.\351\246\231\346\270\257"
+    "\346\226\260\345\212\240\345\235\241"
+    "\346\226\260\346\275\237.jp"
+    "\346\226\260\351\227\273"
+    "\346\227\266\345\260\232"
+    "\346\233\270\347\261\215"
+    "\346\234\272\346\236\204"
+    "\346\235\261\344\272\254.jp"
+    "\346\240\203\346\234\250.jp"
+    "\346\262\226\347\270\204.jp"
+    "\346\267\241\351\251\254\351\224\241"
+    "\346\270\270\346\210\217"
+    "\346\273\213\350\263\200.jp"
+    "\346\276\263\351\226\200"
+    "\346\276\263\351\227\250"
+    "\347\202\271\347\234\213"
+    "\347\206\212\346\234\254.jp"
+    "\347\237\263\345\267\235.jp"
+    "\347\245\236\345\245\210\345\267\235.jp"
+    "\347\246\217\344\272\225.jp"
+    "\347\246\217\345\262\241.jp"
+    "\347\246\217\345\263\266.jp"
+    "\347\247\213\347\224\260.jp"
+    "\347\247\273\345\212\250"
+    "\347\256\207\344\272\272.hk"
+    "\347\265\204\347\271\224.hk"
+    "\347\265\204\347\271\224.tw"
+    "\347\265\204\347\271\224.\351\246\231\346\270\257"
+    "\347\265\204\347\273\207.hk"
+    "\347\266\262\347\265\241.cn"
+    "\347\266\262\347\265\241.hk"
+    "\347\266\262\347\265\241.\351\246\231\346\270\257"
+    "\347\266\262\347\273\234.hk"
+    "\347\266\262\350\267\257.tw"
+    "\347\273\204\347\271\224.hk"
+    "\347\273\204\347\273\207.hk"
+    "\347\273\204\347\273\207\346\234\272\346\236\204"
+    "\347\275\221\345\235\200"
+    "\347\275\221\345\272\227"
+    "\347\275\221\347\253\231"
+    "\347\275\221\347\265\241.hk"
+    "\347\275\221\347\273\234"
+    "\347\275\221\347\273\234.cn"
+    "\347\275\221\347\273\234.hk"
+    "\347\276\244\351\246\254.jp"
+    "\350\201\224\351\200\232"
+    "\350\207\272\347\201\243"
+    "\350\214\250\345\237\216.jp"
+    "\350\260\267\346\255\214"
+    "\350\264\255\347\211\251"
+    "\351\200\232\350\262\251"
+    "\351\225\267\345\264\216.jp"
+    "\351\225\267\351\207\216.jp"
+    "\351\233\206\345\233\242"
+    "\351\233\273\350\250\212\347\233\210\347\247\221"
+    "\351\235\222\346\243\256.jp"
+    "\351\235\231\345\262\241.jp"
+    "\351\243\236\345\210\251\346\265\246"
+    "\351\243\237\345\223\201"
+    "\351\244\220\345\216\205"
+    "\351\246\231\345\267\235.jp"
+    "\351\246\231\346\240\274\351\207\214\346\213\211"
+    "\351\246\231\346\270\257"
+    "\351\253\230\347\237\245.jp"
+    "\351\263\245\345\217\226.jp"
+    "\351\271\277\345\205\220\345\263\266.jp"
+    "\353\213\267\353\204\267"
+    "\353\213\267\354\273\264"
+    "\354\202\274\354\204\261"
+    "\355\225\234\352\265\255"
+;
+
+static const unsigned short psl_seeds[PSL_BUCKETS] = {
+    8, 19, 4, 1, 2, 0, 83, 5, 5, 4, 14, 31,
+    1, 5, 6, 8, 40, 13, 19, 2, 36, 2, 3, 6,
+    5, 3, 7, 13, 1, 1, 2, 38, 76, 7, 1, 12,
+    1, 2, 3, 16, 31, 13, 9, 4, 21, 22, 11, 14,
+    33, 46, 21, 3, 1, 5, 8, 1, 15, 0, 1, 1,
+    5, 16, 1, 8, 17, 4, 1, 7, 2, 5, 18, 2,
+    4, 2, 7, 14, 1, 85, 22, 19, 3, 1, 4, 13,
+    3, 15, 3, 21, 16, 10, 7, 12, 1, 12, 10, 35,
+    53, 1, 17, 12, 29, 16, 2, 10, 3, 58, 1, 1,
+    4, 15, 6, 1, 4, 7, 7, 9, 8, 3, 5, 2,
+    36, 3, 3, 33, 8, 3, 9, 2, 8, 1, 45, 28,
+    8, 11, 4, 18, 3, 27, 1, 16, 7, 1, 3, 1,
+    76, 2, 4, 1, 1, 15, 1, 3, 6, 16, 2, 58,
+    1, 28, 7, 0, 2, 6, 1, 5, 19, 49, 1, 43,
+    3, 8, 19, 1, 1, 3, 4, 2, 2, 2, 1, 3,
+    18, 4, 11, 4, 2, 8, 1, 3, 4, 3, 7, 11,
+    1, 5, 1, 11, 2, 26, 14, 30, 5, 1, 15, 8,
+    18, 10, 1, 9, 13, 4, 5, 1, 6, 6, 27, 27,
+    1, 1, 2, 5, 22, 3, 2, 23, 1, 5, 13, 1,
+    6, 44, 14, 4, 1, 3, 2, 9, 1, 3, 4, 2,
+    18, 14, 1, 1, 2, 1, 6, 3, 8, 2, 17, 1,
+    1, 3, 5, 10, 5, 32, 3, 6, 23, 2, 4, 12,
+    1, 36, 32, 1, 1, 6, 1, 1, 14, 4, 5, 35,
+    4, 5, 65, 56, 7, 30, 2, 7, 3, 5, 15, 42,
+    3, 20, 4, 21, 1, 9, 8, 11, 8, 3, 3, 6,
+    15, 12, 12, 4, 36, 12, 4, 20, 4, 2, 6, 42,
+    6, 28, 29, 13, 1, 22, 18, 1, 9, 4, 5, 2,
+    10, 18, 4, 10, 31, 1, 1, 2, 3, 8, 4, 4,
+    1, 6, 4, 16, 3, 6, 1, 12, 1, 4, 3, 1,
+    21, 2, 17, 1, 7, 66, 9, 2, 31, 2, 2, 28,
+    13, 68, 8, 8, 12, 4, 8, 36, 73, 7, 27, 1,
+    1, 10, 2, 7, 1, 56, 71, 2, 9, 1, 4, 2,
+    11, 11, 38, 3, 8, 1, 30, 14, 1, 1, 1, 5,
+    12, 1, 17, 10, 14, 13, 14, 2, 4, 1, 7, 15,
+    3, 4, 6, 1, 3, 7, 38, 1, 3, 2, 2, 1,
+    14, 5, 2, 3, 1, 17, 3, 1, 12, 11, 11, 37,
+    1, 10, 24, 47, 1, 33, 32, 1, 7, 2, 2, 8,
+    10, 1, 9, 6, 33, 5, 14, 13, 24, 0, 5, 23,
+    1, 22, 2, 1, 0, 11, 1, 2, 13, 3, 3, 23,
+    21, 35, 16, 132, 3, 4, 14, 10, 2, 2, 9, 6,
+    7, 8, 3, 31, 9, 1, 1, 2, 6, 2, 39, 5,
+    39, 26, 28, 2, 34, 37, 2, 1, 1, 16, 4, 33,
+    5, 8, 1, 3, 2, 17, 1, 44, 11, 78, 1, 2,
+    25, 6, 8, 21, 24, 2, 3, 3, 14, 3, 0, 24,
+    14, 3, 5, 4, 3, 4, 19, 15, 3, 23, 2, 44,
+    15, 4, 27, 28, 21, 20, 3, 14, 3, 3, 25, 26,
+    5, 1, 17, 12, 6, 1, 5, 9, 24, 11, 9, 7,
+    21, 1, 8, 7, 14, 4, 2, 6, 9, 2, 33, 1,
+    10, 6, 13, 1, 1, 4, 29, 8, 3, 6, 6, 8,
+    2, 17, 9, 26, 3, 43, 1, 11, 5, 8, 2, 5,
+    10, 73, 4, 1, 2, 2, 0, 1, 17, 58, 2, 5,
+    46, 2, 3, 7, 5, 9, 4, 1, 59, 7, 11, 3,
+    2, 35, 4, 2, 28, 14, 43, 12, 1, 2, 6, 30,
+    2, 2, 6, 3, 9, 4, 4, 4, 6, 6, 40, 25,
+    7, 5, 2, 28, 5, 21, 1, 18, 22, 22, 16, 3,
+    4, 52, 4, 1, 1, 3, 12, 15, 2, 46, 13, 1,
+    1, 9, 3, 48, 2, 24, 40, 10, 1, 72, 1, 3,
+    19, 0, 2, 31, 12, 6, 1, 27, 2, 21, 1, 1,
+    7, 8, 11, 2, 30, 57, 3, 26, 3, 10, 1, 5,
+    2, 5, 2, 6, 29, 11, 1, 29, 4, 4, 0, 17,
+    4, 4, 5, 18, 20, 8, 3, 22, 1, 1, 4, 4,
+    1, 1, 1, 4, 31, 2, 10, 27, 7, 2, 10, 1,
+    1, 18, 10, 5, 2, 1, 17, 11, 1, 5, 13, 14,
+    3, 42, 12, 19, 4, 2, 8, 4, 9, 25, 1, 1,
+    3, 5, 17, 10, 2, 4, 0, 1, 4, 8, 29, 13,
+    16, 2, 9, 1, 5, 22, 2, 9, 16, 10, 1, 7,
+    5, 2, 9, 9, 24, 1, 2, 22, 17, 8, 4, 12,
+    1, 17, 5, 1, 4, 4, 2, 11, 48, 30, 14, 2,
+    2, 30, 46, 8, 34, 2, 5, 9, 19, 1, 25, 5,
+    12, 33, 79, 1, 5, 0, 2, 3, 26, 15, 20, 1,
+    19, 5, 10, 6, 59, 7, 15, 8, 3, 7, 8, 39,
+    8, 7, 1, 8, 6, 14, 1, 5, 37, 5, 13, 4,
+    4, 5, 0, 10, 31, 58, 19, 2, 3, 6, 50, 5,
+    100, 1, 3, 5, 0, 9, 2, 25, 44, 7, 2, 5,
+    10, 47, 13, 8, 37, 1, 5, 9, 2, 11, 3, 1,
+    52, 2, 4, 7, 1, 2, 5, 3, 24, 1, 21, 15,
+    12, 43, 10, 0, 6, 1, 1, 25, 7, 1, 14, 29,
+    16, 2, 1, 2, 16, 2, 45, 15, 4, 38, 14, 2,
+    1, 18, 20, 21, 11, 1, 6, 11, 0, 16, 4, 33,
+    21, 11, 9, 52, 10, 5, 2, 1, 35, 4, 7, 8,
+    1, 1, 3, 16, 1, 6, 1, 3, 8, 17, 7, 29,
+    35, 4, 63, 7, 5, 26, 1, 1, 28, 18, 2, 7,
+    3, 3, 2, 1, 11, 2, 26, 1, 6, 22, 7, 6,
+    2, 3, 14, 16, 71, 18, 1, 8, 21, 6, 3, 39,
+    3, 18, 16, 6, 73, 31, 24, 71, 6, 2, 3, 30,
+    1, 36, 10, 31, 115, 5, 3, 3, 9, 20, 14, 19,
+    42, 7, 9, 42, 17, 28, 7, 8, 5, 32, 20, 1,
+    18, 9, 5, 53, 21, 1, 1, 17, 9, 5, 3, 12,
+    10, 55, 3, 8, 17, 1, 10, 0, 14, 7, 6, 1,
+    2, 29, 4, 26, 2, 1, 1, 40, 3, 19, 35, 1,
+    15, 2, 1, 10, 1, 10, 8, 17, 9, 8, 9, 1,
+    20, 20, 31, 9, 10, 6, 17, 4, 2, 1, 7, 0,
+    5, 25, 13, 18, 11, 45, 0, 1, 37, 1, 1, 25,
+    13, 4, 3, 1, 62, 3, 15, 1, 4, 13, 5, 14,
+    32, 9, 7, 3, 4, 8, 22, 3, 2, 1, 1, 2,
+    5, 7, 6, 6, 2, 72, 3, 1, 1, 31, 11, 4,
+    44, 8, 1, 11, 1, 11, 5, 9, 7, 28, 8, 6,
+    29, 55, 11, 6, 5, 3, 15, 13, 1, 21, 8, 3,
+    33, 8, 6, 7, 1, 9, 10, 33, 22, 8, 2, 17,
+    27, 2, 1, 1, 1, 23, 31, 5, 45, 5, 2, 3,
+    22, 13, 25, 22, 3, 2, 11, 6, 10, 25, 9, 4,
+    11, 4, 44, 0, 1, 21, 8, 6, 7, 9, 14, 39,
+    24, 4, 9, 5, 2, 3, 68, 2, 10, 21, 4, 1,
+    1, 10, 3, 78, 1, 2, 27, 1, 5, 1, 15, 70,
+    0, 5, 7, 13, 7, 1, 14, 1, 1, 2, 2, 125,
+    9, 36, 8, 1, 26, 9, 8, 0, 14, 3, 2, 7,
+    4, 7, 1, 14, 1, 10, 4, 4, 5, 25, 31, 37,
+    4, 20, 15, 1, 0, 2, 1, 15, 4, 1, 21, 2,
+    2, 7, 3, 23, 64, 1, 1, 2, 12, 3, 7, 1,
+    2, 1, 2, 2, 0, 18, 0, 78, 3, 2, 39, 7,
+    81, 4, 10, 0, 3, 0, 21, 6, 56, 33, 1, 0,
+    13, 5, 20, 25, 6, 13, 12, 21, 11, 14, 12, 16,
+    35, 9, 74, 10, 4, 5, 2, 3, 31, 0, 36, 6,
+    5, 32, 29, 2, 0, 4, 17, 5, 45, 49, 2, 11,
+    4, 20, 5, 41, 36, 3, 4, 10, 4, 66, 69, 27,
+    28, 3, 4, 5, 100, 2, 5, 49, 8, 7, 13, 5,
+    47, 2, 1, 1, 6, 0, 28, 24, 0, 2, 3, 29,
+    20, 1, 11, 2, 9, 58, 21, 18, 24, 53, 15, 19,
+    61, 1, 6, 2, 4, 2, 7, 11, 6, 1, 16, 20,
+    4, 2, 19, 11, 2, 2, 72, 2, 10, 11, 52, 1,
+    19, 16, 2, 3, 12, 1, 34, 16, 60, 38, 11, 14,
+    5, 25, 4, 28, 46, 7, 9, 24, 1, 2, 4, 10,
+    19, 33, 2, 96, 6, 3, 10, 21, 5, 9, 14, 14,
+    11, 20, 29, 1, 37, 0, 12, 58, 16, 4, 5, 23,
+    1, 2, 2, 19, 9, 17, 90, 3, 2, 19, 5, 8,
+    2, 29, 3, 22, 13, 12, 2, 4, 19, 17, 13, 1,
+    74, 25, 39, 2, 0, 36, 1, 22, 1, 31, 2, 20,
+    6, 24, 23, 4, 1, 3, 1, 8, 9, 21, 21, 29,
+    1, 7, 1, 79, 37, 9, 0, 15, 1, 10, 84, 25,
+    26, 47, 41, 8, 5, 41, 24, 8, 11, 15, 4, 12,
+    2, 2, 182, 9, 3, 0, 1, 4, 32, 9, 16, 7,
+    5, 36, 22, 5, 14, 8, 37, 1, 52, 5, 4, 24,
+    3, 8, 5, 32, 1, 12, 18, 48, 0, 9, 1, 2,
+    2, 4, 268, 10, 1, 7, 26, 18, 4, 1, 12, 5,
+    19, 12, 73, 16, 11, 51, 17, 9, 9, 31, 1, 3,
+    40, 7, 15, 23, 7, 1, 34, 12, 6, 1, 3, 16,
+    49, 31, 3, 9, 1, 3, 17, 2, 2, 17, 78, 1,
+    27, 4, 20, 1, 1, 3, 4, 18, 14, 7, 3, 120,
+    1, 2, 1, 35, 2, 34, 11, 74, 21, 31, 16, 1,
+    117, 6, 21, 5, 16, 39, 51, 2, 3, 13, 10, 2,
+    12, 39, 5, 5, 4, 7, 1, 38, 3, 3, 6, 7,
+    6, 25, 8, 17, 1, 19, 16, 2, 1, 70, 108, 53,
+    9, 46, 9, 23, 19, 1, 20, 4, 2, 11, 18, 5,
+    6, 4, 45, 4, 7, 4, 2, 40, 1, 26, 1, 38,
+    6, 5, 24, 1, 15, 25, 1, 35, 6, 1, 7, 35,
+    3, 2, 50, 15, 17, 4, 13, 1, 13, 38, 6, 10,
+    1, 19, 5, 1, 6, 5, 17, 8, 2, 2, 42, 48,
+    0, 94, 9, 3, 4, 3, 3, 19, 166, 3, 56, 17,
+    14, 97, 15, 142, 4, 11, 3, 37, 2, 3, 2, 1,
+    3, 1, 2, 48, 1, 2, 4, 8, 115, 7, 1, 26,
+    11, 4, 27, 28, 12, 10, 35, 7, 49, 4, 40, 8,
+    11, 1, 5, 30, 4, 5, 1, 9, 13, 9, 18, 1,
+    2, 11, 28, 72, 5, 10, 7, 81, 1, 9, 38, 36,
+    33, 1, 16, 64, 9, 24, 14, 6, 22, 5, 2, 112,
+    22, 25, 146, 8, 4, 1, 2, 49, 42, 17, 15, 7,
+    9, 9, 12, 0, 9, 34, 52, 92, 13, 2, 4, 25,
+    13, 4, 9, 22, 24, 0, 114, 9, 11, 30, 131, 7,
+    28, 5, 21, 8, 3, 41, 61, 14, 29, 10, 9, 9,
+    26, 1, 188, 1, 10, 30, 18, 4, 38, 3, 1, 1,
+    5, 46, 3, 68, 8, 11, 2, 13, 24, 91, 31, 2,
+    17, 1, 38, 11, 11, 23, 52, 37, 0, 7, 49, 21,
+    10, 52, 44, 12, 139, 2, 7, 9, 3, 38, 10, 17,
+    81, 10, 14, 10, 17, 27, 8, 46, 1, 2, 24, 29,
+    26, 5, 141, 13, 58, 118, 14, 52, 3, 25, 1, 27,
+    27, 18, 71, 18, 1, 1, 19, 9, 12, 2, 4, 70,
+    95, 7, 15, 13, 10, 0, 42, 4, 66, 31, 9, 2,
+    1, 47, 35, 23, 33, 1, 14, 15, 11, 25, 1, 8,
+    0, 2, 8, 3, 3, 1, 121, 32, 5, 4, 2, 49,
+    4, 22, 1, 0, 14, 1, 51, 10, 33, 18, 4, 3,
+    3, 69, 78, 4, 7, 3, 5, 3, 17, 5, 4, 85,
+    2, 92, 7, 9, 40, 8, 11, 4, 12, 26, 0, 1,
+    3, 20, 2, 8, 7, 10, 2, 1, 6, 7, 2, 13,
+    4, 1, 9, 11, 1, 1, 39, 24, 55, 4, 9, 45,
+    2, 1, 3, 42, 6, 13, 6, 2, 1, 53, 148, 1,
+    32, 1, 38, 10, 58, 1, 1, 24, 2, 16, 8, 4,
+    6, 32, 3, 1, 156, 2, 3, 5, 24, 8, 24, 6,
+    1, 8, 56, 1, 26, 5, 46, 4, 6, 2, 14, 4,
+    2, 22, 3, 1, 6, 15, 95, 1, 12, 2, 4, 41,
+    6, 5, 5, 27, 1, 78, 36, 26, 37, 77, 6, 13,
+    48, 1, 5, 1, 13, 44, 104, 5, 14, 106, 3, 4,
+    3, 4, 4, 1, 69, 20, 3, 3, 6, 0, 4, 28,
+    8, 55, 9, 5, 128, 12, 3, 2, 7, 15, 41, 22,
+    6, 46, 13, 36, 4, 56, 14, 41, 23, 5, 19, 12,
+    6, 34, 13, 7, 19, 34, 32, 5, 1, 44, 54, 1,
+    22, 10, 26, 2, 2, 79, 2, 9, 2, 5, 6, 24,
+    3, 8, 121, 5, 11, 26, 9, 85, 13, 76, 33, 1,
+    4, 20, 1, 29, 2, 32, 1, 18, 12, 10, 36, 239,
+    4, 15, 0, 14, 2, 4, 24, 2, 1, 45, 79, 16,
+    43, 32, 10, 4, 80, 2, 35, 1, 12, 24, 2, 2,
+    39, 1, 25, 18, 9, 2, 7, 60, 6, 0, 51, 196,
+    14, 5, 24, 9, 4, 26, 1, 33, 3, 34, 19, 12,
+    23, 40, 15, 5, 3, 36, 6, 1, 1, 3, 141, 73,
+    21, 1, 51, 12, 8, 66, 2, 3, 14, 9, 4, 8,
+    1, 18, 2, 38, 190, 34, 33, 1, 32, 14, 1, 4,
+    84, 60, 1, 3, 94, 7, 22, 13, 5, 30, 16, 8,
+    0, 38, 20, 123, 3, 9, 18, 2, 67, 12, 92, 0,
+    46, 133, 3, 3, 46, 1, 8, 13, 7, 1, 1, 45,
+    17, 16, 18, 6, 13, 21, 21, 1, 1, 3, 2, 25,
+    2, 1, 51, 5, 2, 16, 16, 11, 3, 3, 4, 2,
+    20, 10, 86, 14, 1, 32, 17, 16, 1, 10, 9, 29,
+    21, 40, 17, 40, 4, 7, 7, 16, 3, 25, 29, 13,
+    32, 18, 19, 4, 1, 15, 33, 3, 20, 40, 12, 68,
+    16, 57, 18, 25, 13, 31, 1, 14, 9, 9, 13, 20,
+    2, 115, 13, 37, 6, 93, 11, 61, 23, 9, 15, 53,
+    12, 92, 1, 42, 17, 4, 7, 48, 204, 6, 5, 40,
+    21, 102, 8, 174, 185, 0, 61, 58, 15, 143, 17, 27,
+    44, 39, 8, 184, 5, 54, 12, 23, 14, 22, 66, 87,
+    0, 53, 12, 177, 34, 1, 19, 3, 1, 14,
+};
+
+static const PslSlot psl_slots[PSL_SLOTS] = {
+    {0, 0, 0},
+    {0, 0, 0},
+    {62595, 6, 1},
+    {0, 0, 0},
+    {65183, 25, 1},
+    {65456, 3, 1},
+    {70775, 3, 1},
+    {85879, 11, 1},
+    {19691, 9, 1},
+    {112328, 9, 1},
+    {0, 0, 0},
+    {20277, 11, 1},
+    {28670, 6, 1},
+    {0, 0, 0},
+    {29005, 13, 1},
+    {14121, 5, 1},
+    {6548, 9, 1},
+    {10418, 14, 1},
+    {61436, 22, 1},
+    {38090, 19, 1},
+    {0, 0, 0},
+    {2795, 9, 1},
+    {111068, 12, 1},
+    {25793, 7, 1},
+    {33864, 5, 1},
+    {0, 0, 0},
+    {64405, 6, 1},
+    {110957, 18, 1},
+    {0, 0, 0},
+    {522, 5, 1},
+    {635, 17, 1},
+    {70778, 19, 1},
+    {40487, 19, 1},
+    {58911, 11, 1},
+    {72276, 3, 1},
+    {15132, 5, 1},
+    {52040, 15, 1},
+    {0, 0, 0},
+    {6090, 11, 1},
+    {33135, 11, 1},
+    {95433, 8, 1},
+    {65747, 14, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {58812, 10, 1},
+    {88616, 14, 1},
+    {22280, 6, 1},
+    {52913, 10, 1},
+    {28943, 8, 1},
+    {8063, 12, 1},
+    {8140, 10, 1},
+    {97054, 14, 1},
+    {9686, 11, 1},
+    {24168, 18, 1},
+    {3916, 12, 1},
+    {22438, 6, 1},
+    {10812, 10, 1},
+    {24408, 13, 1},
+    {70752, 8, 1},
+    {97875, 6, 1},
+    {49344, 12, 1},
+    {50641, 9, 1},
+    {9815, 11, 1},
+    {0, 0, 0},
+    {86819, 15, 1},
+    {83013, 13, 1},
+    {46694, 18, 1},
+    {23519, 10, 1},
+    {102816, 22, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {82955, 14, 1},
+    {12588, 8, 1},
+    {0, 0, 0},
+    {87750, 15, 1},
+    {83924, 8, 1},
+    {68609, 6, 1},
+    {4674, 14, 1},
+    {28752, 6, 1},
+    {0, 0, 0},
+    {51961, 14, 1},
+    {105973, 15, 1},
+    {110129, 12, 1},
+    {1823, 8, 1},
+    {17168, 22, 1},
+    {398, 8, 1},
+    {2440, 11, 1},
+    {92760, 2, 1},
+    {77928, 11, 1},
+    {71315, 4, 1},
+    {55171, 6, 1},
+    {67316, 16, 1},
+    {0, 0, 0},
+    {71676, 9, 1},
+    {111452, 9, 1},
+    {36454, 4, 1},
+    {79794, 6, 1},
+    {22535, 18, 1},
+    {79016, 9, 1},
+    {15726, 6, 1},
+    {22450, 6, 1},
+    {78741, 18, 1},
+    {97376, 19, 1},
+    {31967, 5, 1},
+    {12604, 8, 1},
+    {50062, 7, 1},
+    {4328, 6, 1},
+    {9390, 11, 1},
+    {77861, 17, 1},
+    {101884, 14, 1},
+    {8854, 11, 1},
+    {53752, 21, 1},
+    {107438, 12, 1},
+    {63228, 4, 1},
+    {80878, 20, 1},
+    {5960, 9, 1},
+    {21961, 6, 1},
+    {11246, 15, 1},
+    {0, 0, 0},
+    {68399, 6, 1},
+    {38566, 7, 1},
+    {82321, 21, 1},
+    {86504, 4, 1},
+    {6772, 7, 1},
+    {83461, 5, 1},
+    {66006, 16, 1},
+    {95011, 13, 1},
+    {0, 0, 0},
+    {22651, 8, 1},
+    {0, 0, 0},
+    {65020, 10, 1},
+    {21618, 19, 1},
+    {35699, 7, 1},
+    {89505, 22, 1},
+    {0, 0, 0},
+    {63777, 6, 1},
+    {0, 0, 0},
+    {19233, 12, 1},
+    {37178, 9, 1},
+    {71274, 15, 1},
+    {34334, 22, 1},
+    {90723, 22, 1},
+    {26580, 13, 1},
+    {2573, 13, 2},
+    {11374, 5, 1},
+    {44050, 17, 1},
+    {69176, 15, 1},
+    {15527, 13, 1},
+    {88075, 16, 1},
+    {27485, 11, 1},
+    {71027, 13, 1},
+    {20763, 12, 1},
+    {73516, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {78261, 13, 1},
+    {72964, 7, 1},
+    {103780, 21, 1},
+    {79441, 24, 1},
+    {50695, 9, 1},
+    {99555, 7, 1},
+    {73805, 17, 1},
+    {2677, 21, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {50053, 9, 1},
+    {84511, 2, 1},
+    {58477, 6, 1},
+    {80041, 11, 1},
+    {84004, 8, 1},
+    {100623, 24, 1},
+    {73034, 16, 2},
+    {109355, 16, 1},
+    {72327, 6, 1},
+    {30759, 6, 1},
+    {95698, 14, 1},
+    {44806, 10, 1},
+    {46497, 20, 1},
+    {46898, 20, 1},
+    {72676, 13, 1},
+    {37375, 16, 1},
+    {69232, 15, 1},
+    {22420, 6, 1},
+    {0, 0, 0},
+    {22676, 11, 1},
+    {80967, 4, 1},
+    {0, 0, 0},
+    {107492, 19, 1},
+    {0, 0, 0},
+    {21287, 28, 1},
+    {0, 0, 0},
+    {72216, 7, 1},
+    {0, 0, 0},
+    {51800, 26, 1},
+    {97788, 7, 1},
+    {49774, 15, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {107198, 23, 1},
+    {91484, 19, 1},
+    {0, 0, 0},
+    {12889, 15, 1},
+    {52100, 2, 1},
+    {94874, 14, 1},
+    {89553, 8, 1},
+    {53973, 5, 1},
+    {83591, 13, 1},
+    {63703, 15, 1},
+    {38347, 13, 1},
+    {14790, 13, 2},
+    {0, 0, 0},
+    {16257, 6, 1},
+    {84231, 9, 1},
+    {54111, 12, 1},
+    {80833, 2, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {43936, 22, 1},
+    {88642, 2, 1},
+    {32258, 5, 1},
+    {31855, 8, 1},
+    {57633, 21, 1},
+    {17281, 7, 1},
+    {13147, 13, 1},
+    {75316, 8, 1},
+    {97019, 5, 1},
+    {1890, 12, 1},
+    {0, 0, 0},
+    {68081, 6, 1},
+    {51028, 9, 1},
+    {6660, 18, 1},
+    {62265, 6, 1},
+    {104392, 14, 1},
+    {88380, 7, 1},
+    {31388, 15, 1},
+    {97741, 5, 1},
+    {27045, 11, 1},
+    {70684, 2, 1},
+    {62753, 7, 1},
+    {41871, 9, 1},
+    {64995, 6, 1},
+    {90605, 16, 1},
+    {43855, 16, 1},
+    {0, 0, 0},
+    {66738, 9, 1},
+    {68519, 6, 1},
+    {31996, 7, 1},
+    {59893, 11, 1},
+    {60676, 7, 1},
+    {0, 0, 0},
+    {51329, 14, 1},
+    {51376, 13, 1},
+    {92330, 20, 1},
+    {88925, 5, 1},
+    {108702, 8, 1},
+    {58035, 9, 1},
+    {0, 0, 0},
+    {20581, 6, 1},
+    {71538, 10, 1},
+    {93518, 16, 1},
+    {0, 0, 0},
+    {73886, 12, 1},
+    {93507, 11, 1},
+    {57595, 11, 1},
+    {55821, 23, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {31358, 6, 1},
+    {31110, 6, 1},
+    {89561, 8, 1},
+    {88552, 21, 1},
+    {0, 0, 0},
+    {11828, 20, 1},
+    {23037, 10, 1},
+    {18755, 12, 1},
+    {78330, 9, 1},
+    {30351, 14, 1},
+    {94125, 9, 1},
+    {2560, 13, 1},
+    {105829, 15, 1},
+    {54587, 2, 1},
+    {110388, 19, 1},
+    {18232, 4, 1},
+    {16954, 15, 1},
+    {0, 0, 0},
+    {64974, 3, 1},
+    {3514, 19, 1},
+    {108835, 19, 1},
+    {108817, 18, 1},
+    {80196, 9, 1},
+    {56721, 20, 1},
+    {74347, 9, 1},
+    {54062, 6, 1},
+    {111745, 6, 1},
+    {20559, 5, 1},
+    {31653, 11, 1},
+    {11938, 14, 1},
+    {43108, 9, 1},
+    {21943, 6, 1},
+    {686, 10, 1},
+    {36596, 17, 1},
+    {21182, 9, 1},
+    {56523, 16, 1},
+    {22310, 6, 1},
+    {62839, 16, 1},
+    {56963, 12, 1},
+    {86520, 5, 1},
+    {4658, 16, 1},
+    {0, 0, 0},
+    {93867, 2, 1},
+    {0, 0, 0},
+    {111823, 6, 1},
+    {100753, 14, 1},
+    {38981, 6, 1},
+    {111527, 6, 1},
+    {51057, 4, 1},
+    {71654, 10, 1},
+    {0, 0, 0},
+    {16587, 6, 1},
+    {29067, 6, 1},
+    {7565, 5, 1},
+    {72345, 6, 1},
+    {0, 0, 0},
+    {101370, 16, 1},
+    {42169, 11, 1},
+    {0, 0, 0},
+    {99947, 7, 1},
+    {89687, 17, 1},
+    {99964, 2, 1},
+    {0, 0, 0},
+    {68827, 8, 1},
+    {87815, 11, 1},
+    {0, 0, 0},
+    {3421, 13, 1},
+    {10510, 11, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {111479, 12, 1},
+    {18091, 26, 1},
+    {12747, 13, 1},
+    {41407, 17, 1},
+    {0, 0, 0},
+    {23679, 17, 1},
+    {8302, 20, 1},
+    {14670, 10, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {21385, 3, 1},
+    {88284, 3, 1},
+    {86672, 16, 1},
+    {38887, 6, 1},
+    {70494, 9, 1},
+    {72899, 7, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {42955, 9, 1},
+    {74769, 10, 1},
+    {80835, 25, 1},
+    {1495, 16, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {106799, 24, 1},
+    {107429, 9, 1},
+    {71090, 17, 1},
+    {18682, 4, 1},
+    {0, 0, 0},
+    {10651, 10, 1},
+    {64181, 26, 1},
+    {46479, 18, 1},
+    {88998, 12, 1},
+    {8898, 14, 1},
+    {14475, 8, 1},
+    {0, 0, 0},
+    {11620, 17, 1},
+    {9412, 11, 1},
+    {0, 0, 0},
+    {30819, 6, 1},
+    {50326, 9, 1},
+    {49747, 4, 1},
+    {90207, 16, 1},
+    {4813, 14, 1},
+    {71801, 4, 1},
+    {0, 0, 0},
+    {68279, 6, 1},
+    {89889, 3, 1},
+    {0, 0, 0},
+    {38671, 7, 1},
+    {30795, 6, 1},
+    {43072, 9, 1},
+    {25316, 9, 1},
+    {40217, 16, 1},
+    {28505, 10, 1},
+    {57559, 12, 2},
+    {8670, 11, 1},
+    {57399, 15, 1},
+    {0, 0, 0},
+    {90416, 15, 1},
+    {107622, 16, 1},
+    {105910, 18, 1},
+    {18141, 11, 1},
+    {70487, 2, 1},
+    {56401, 14, 1},
+    {28617, 7, 1},
+    {26040, 15, 1},
+    {88208, 6, 1},
+    {44613, 17, 1},
+    {48636, 19, 1},
+    {46819, 16, 1},
+    {0, 0, 0},
+    {48216, 15, 1},
+    {0, 0, 0},
+    {26012, 8, 1},
+    {68579, 6, 1},
+    {84746, 12, 1},
+    {0, 0, 0},
+    {92404, 18, 1},
+    {82342, 15, 1},
+    {108268, 12, 1},
+    {0, 0, 0},
+    {40718, 19, 1},
+    {27953, 17, 1},
+    {40422, 16, 1},
+    {70725, 13, 1},
+    {78992, 5, 1},
+    {68093, 6, 1},
+    {59904, 20, 1},
+    {54255, 4, 1},
+    {67841, 6, 1},
+    {88980, 5, 1},
+    {38360, 14, 1},
+    {74702, 5, 1},
+    {31101, 9, 1},
+    {85479, 2, 1},
+    {0, 0, 0},
+    {102718, 20, 1},
+    {105274, 10, 1},
+    {60520, 20, 1},
+    {11973, 4, 1},
+    {101521, 21, 1},
+    {68525, 6, 1},
+    {78289, 10, 1},
+    {17792, 5, 1},
+    {46142, 15, 1},
+    {27474, 11, 1},
+    {0, 0, 0},
+    {85354, 16, 1},
+    {39194, 8, 1},
+    {16719, 7, 1},
+    {49652, 8, 1},
+    {53037, 10, 1},
+    {56946, 17, 1},
+    {0, 0, 0},
+    {21937, 6, 1},
+    {86525, 6, 1},
+    {39153, 8, 1},
+    {39250, 11, 1},
+    {0, 0, 0},
+    {79925, 8, 1},
+    {14629, 20, 2},
+    {16683, 6, 1},
+    {73319, 8, 1},
+    {0, 0, 0},
+    {5300, 13, 1},
+    {0, 0, 0},
+    {35648, 7, 1},
+    {72523, 11, 1},
+    {0, 0, 0},
+    {61774, 15, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {51924, 8, 1},
+    {17476, 20, 1},
+    {8821, 11, 1},
+    {0, 0, 0},
+    {17295, 7, 1},
+    {9188, 15, 1},
+    {72315, 6, 1},
+    {0, 0, 0},
+    {38473, 6, 1},
+    {24629, 12, 1},
+    {0, 0, 0},
+    {64885, 3, 1},
+    {31664, 19, 1},
+    {91804, 10, 1},
+    {50554, 9, 1},
+    {0, 0, 0},
+    {55081, 6, 1},
+    {0, 0, 0},
+    {14308, 19, 1},
+    {57375, 12, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {108671, 15, 1},
+    {25154, 4, 1},
+    {0, 0, 0},
+    {70699, 5, 1},
+    {57044, 5, 1},
+    {75078, 7, 1},
+    {0, 0, 0},
+    {86884, 14, 1},
+    {7710, 9, 2},
+    {26115, 15, 1},
+    {945, 5, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {39116, 11, 1},
+    {11848, 19, 1},
+    {32392, 18, 1},
+    {80867, 11, 1},
+    {19078, 5, 1},
+    {70843, 14, 1},
+    {103994, 23, 1},
+    {0, 0, 0},
+    {23103, 17, 1},
+    {79189, 7, 1},
+    {0, 0, 0},
+    {57329, 20, 1},
+    {97990, 9, 1},
+    {107221, 10, 1},
+    {22112, 6, 1},
+    {92029, 20, 1},
+    {84113, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {15158, 8, 1},
+    {79727, 6, 1},
+    {40835, 16, 1},
+    {7670, 9, 1},
+    {439, 7, 1},
+    {39368, 18, 1},
+    {21053, 10, 1},
+    {5469, 14, 1},
+    {69432, 3, 1},
+    {0, 0, 0},
+    {11396, 15, 1},
+    {0, 0, 0},
+    {36882, 3, 1},
+    {80248, 16, 2},
+    {52831, 10, 1},
+    {73726, 6, 1},
+    {0, 0, 0},
+    {28798, 4, 1},
+    {49077, 20, 1},
+    {48917, 20, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {31176, 6, 1},
+    {0, 0, 0},
+    {79006, 5, 1},
+    {0, 0, 0},
+    {67393, 9, 1},
+    {111955, 9, 1},
+    {46404, 16, 1},
+    {38727, 7, 1},
+    {49166, 24, 1},
+    {17642, 9, 1},
+    {16575, 6, 1},
+    {17761, 3, 1},
+    {102111, 14, 1},
+    {61789, 15, 1},
+    {71664, 12, 1},
+    {0, 0, 0},
+    {39350, 18, 1},
+    {22782, 17, 2},
+    {0, 0, 0},
+    {69470, 16, 1},
+    {8109, 12, 1},
+    {1810, 13, 1},
+    {0, 0, 0},
+    {65257, 7, 1},
+    {188, 14, 1},
+    {53978, 5, 1},
+    {83197, 16, 1},
+    {52623, 13, 1},
+    {0, 0, 0},
+    {26711, 15, 1},
+    {88166, 7, 1},
+    {61901, 6, 1},
+    {50758, 9, 1},
+    {0, 0, 0},
+    {105486, 12, 1},
+    {4884, 15, 1},
+    {0, 0, 0},
+    {26546, 7, 1},
+    {50256, 15, 1},
+    {27659, 9, 2},
+    {28999, 6, 1},
+    {9098, 15, 1},
+    {101864, 10, 1},
+    {73135, 8, 1},
+    {31011, 6, 1},
+    {59706, 13, 1},
+    {16239, 6, 1},
+    {38741, 7, 1},
+    {26156, 8, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {83059, 9, 1},
+    {7577, 9, 1},
+    {87252, 17, 1},
+    {74992, 2, 1},
+    {11821, 7, 1},
+    {28027, 17, 1},
+    {20330, 8, 1},
+    {0, 0, 0},
+    {112403, 6, 1},
+    {99906, 11, 1},
+    {15951, 6, 1},
+    {111005, 15, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {71749, 7, 1},
+    {51650, 10, 1},
+    {0, 0, 0},
+    {29311, 6, 1},
+    {30783, 6, 1},
+    {61689, 5, 1},
+    {33454, 21, 1},
+    {3078, 4, 1},
+    {56164, 13, 1},
+    {77303, 6, 1},
+    {94376, 16, 2},
+    {11348, 5, 1},
+    {16617, 6, 1},
+    {0, 0, 0},
+    {24825, 26, 1},
+    {99562, 4, 1},
+    {10042, 13, 1},
+    {112544, 6, 1},
+    {62798, 16, 1},
+    {0, 0, 0},
+    {65821, 11, 1},
+    {77988, 8, 1},
+    {0, 0, 0},
+    {2586, 14, 1},
+    {55237, 6, 1},
+    {92683, 8, 1},
+    {22968, 14, 1},
+    {92678, 5, 1},
+    {23949, 30, 1},
+    {60412, 20, 1},
+    {54484, 8, 1},
+    {15429, 5, 1},
+    {0, 0, 0},
+    {32717, 10, 1},
+    {3558, 15, 1},
+    {1539, 6, 1},
+    {74356, 5, 1},
+    {62589, 6, 1},
+    {0, 0, 0},
+    {94799, 5, 1},
+    {21063, 18, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {95291, 10, 1},
+    {28931, 7, 1},
+    {60343, 21, 1},
+    {2804, 14, 1},
+    {25229, 15, 1},
+    {0, 0, 0},
+    {44748, 10, 1},
+    {0, 0, 0},
+    {98, 14, 1},
+    {86310, 2, 1},
+    {83863, 7, 1},
+    {0, 0, 0},
+    {15323, 5, 1},
+    {22474, 6, 1},
+    {0, 0, 0},
+    {15333, 5, 1},
+    {621, 14, 1},
+    {90699, 24, 1},
+    {0, 0, 0},
+    {29107, 9, 1},
+    {49214, 17, 1},
+    {62457, 6, 1},
+    {68237, 6, 1},
+    {0, 0, 0},
+    {87545, 20, 1},
+    {83135, 2, 1},
+    {41783, 12, 1},
+    {0, 0, 0},
+    {16647, 6, 1},
+    {68507, 6, 1},
+    {0, 0, 0},
+    {14048, 10, 1},
+    {109155, 7, 1},
+    {0, 0, 0},
+    {13700, 19, 1},
+    {0, 0, 0},
+    {5420, 18, 1},
+    {12551, 8, 1},
+    {37160, 12, 1},
+    {0, 0, 0},
+    {50190, 15, 1},
+    {62541, 6, 1},
+    {28802, 13, 1},
+    {73534, 4, 1},
+    {0, 0, 0},
+    {74779, 5, 1},
+    {34211, 23, 1},
+    {79136, 6, 1},
+    {36681, 14, 1},
+    {70099, 12, 1},
+    {70978, 11, 1},
+    {66601, 9, 1},
+    {68621, 6, 1},
+    {26070, 15, 1},
+    {19015, 4, 1},
+    {59803, 19, 1},
+    {22575, 2, 1},
+    {0, 0, 0},
+    {15891, 6, 1},
+    {102510, 19, 1},
+    {73088, 5, 1},
+    {30585, 7, 1},
+    {25470, 8, 1},
+    {87235, 17, 1},
+    {88906, 12, 1},
+    {0, 0, 0},
+    {11602, 18, 1},
+    {57155, 7, 1},
+    {33269, 19, 1},
+    {0, 0, 0},
+    {21765, 6, 1},
+    {101117, 15, 1},
+    {50767, 9, 1},
+    {39739, 16, 1},
+    {42576, 9, 1},
+    {106408, 28, 1},
+    {0, 0, 0},
+    {65639, 20, 2},
+    {68453, 6, 1},
+    {23363, 17, 1},
+    {0, 0, 0},
+    {106923, 24, 1},
+    {62235, 6, 1},
+    {7945, 20, 1},
+    {0, 0, 0},
+    {51089, 8, 1},
+    {52116, 5, 1},
+    {0, 0, 0},
+    {33288, 24, 1},
+    {16113, 6, 1},
+    {0, 0, 0},
+    {21741, 6, 1},
+    {24078, 21, 1},
+    {6445, 24, 2},
+    {0, 0, 0},
+    {32033, 8, 1},
+    {39889, 24, 1},
+    {100322, 14, 1},
+    {0, 0, 0},
+    {82700, 8, 1},
+    {48261, 2, 1},
+    {56331, 16, 1},
+    {84870, 13, 2},
+    {57027, 10, 1},
+    {35597, 18, 1},
+    {43818, 17, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {16299, 6, 1},
+    {28693, 15, 1},
+    {10504, 6, 1},
+    {18417, 11, 1},
+    {0, 0, 0},
+    {97842, 14, 1},
+    {0, 0, 0},
+    {72927, 6, 1},
+    {21469, 7, 1},
+    {87609, 13, 1},
+    {0, 0, 0},
+    {76587, 41, 1},
+    {11289, 4, 1},
+    {0, 0, 0},
+    {100048, 19, 1},
+    {31238, 6, 1},
+    {110695, 8, 1},
+    {757, 5, 1},
+    {89608, 14, 1},
+    {74488, 3, 1},
+    {20613, 11, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {29963, 3, 1},
+    {89704, 16, 1},
+    {108854, 17, 1},
+    {104713, 23, 1},
+    {18370, 15, 1},
+    {0, 0, 0},
+    {26147, 9, 1},
+    {109633, 6, 1},
+    {87425, 20, 1},
+    {61109, 12, 1},
+    {90241, 9, 1},
+    {33615, 22, 1},
+    {0, 0, 0},
+    {49303, 19, 1},
+    {77659, 16, 1},
+    {2526, 14, 1},
+    {0, 0, 0},
+    {1349, 14, 1},
+    {109639, 2, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {64387, 6, 1},
+    {45905, 15, 1},
+    {67684, 5, 1},
+    {88822, 7, 1},
+    {0, 0, 0},
+    {30096, 6, 1},
+    {102348, 13, 1},
+    {58948, 17, 1},
+    {108178, 15, 1},
+    {66229, 14, 1},
+    {105746, 22, 1},
+    {66729, 9, 1},
+    {1406, 2, 1},
+    {88879, 9, 1},
+    {0, 0, 0},
+    {30365, 3, 1},
+    {31588, 11, 1},
+    {54852, 15, 1},
+    {68291, 6, 1},
+    {372, 14, 1},
+    {12925, 2, 1},
+    {93168, 5, 1},
+    {28869, 6, 1},
+    {79827, 4, 1},
+    {103598, 22, 1},
+    {0, 0, 0},
+    {101386, 16, 1},
+    {9777, 5, 1},
+    {0, 0, 0},
+    {9728, 18, 1},
+    {42127, 10, 1},
+    {0, 0, 0},
+    {9746, 3, 1},
+    {0, 0, 0},
+    {9966, 4, 1},
+    {16479, 6, 1},
+    {58805, 7, 1},
+    {47853, 21, 1},
+    {32174, 13, 1},
+    {8527, 6, 1},
+    {85761, 10, 1},
+    {0, 0, 0},
+    {95252, 13, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {80164, 16, 1},
+    {73426, 13, 1},
+    {36276, 15, 2},
+    {78213, 17, 1},
+    {78987, 3, 1},
+    {111736, 9, 1},
+    {22926, 19, 1},
+    {57039, 5, 1},
+    {10937, 14, 1},
+    {56430, 13, 1},
+    {0, 0, 0},
+    {72339, 6, 1},
+    {57863, 17, 1},
+    {100262, 14, 1},
+    {0, 0, 0},
+    {8699, 7, 1},
+    {29077, 5, 1},
+    {940, 5, 1},
+    {68219, 6, 1},
+    {91934, 14, 1},
+    {73529, 5, 1},
+    {31821, 8, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {97078, 4, 1},
+    {103152, 13, 1},
+    {16701, 6, 1},
+    {93054, 2, 1},
+    {76305, 34, 1},
+    {0, 0, 0},
+    {22027, 6, 1},
+    {0, 0, 0},
+    {26223, 9, 1},
+    {110056, 14, 1},
+    {15338, 5, 1},
+    {74750, 14, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {30861, 6, 1},
+    {106004, 21, 1},
+    {0, 0, 0},
+    {87530, 15, 1},
+    {52515, 9, 1},
+    {81335, 7, 1},
+    {0, 0, 0},
+    {77899, 15, 1},
+    {40702, 16, 1},
+    {0, 0, 0},
+    {19700, 15, 1},
+    {8515, 6, 1},
+    {35430, 3, 1},
+    {60854, 17, 1},
+    {83265, 11, 1},
+    {85842, 7, 1},
+    {60380, 15, 1},
+    {91016, 21, 1},
+    {10306, 5, 1},
+    {50311, 8, 1},
+    {5227, 6, 1},
+    {91729, 11, 2},
+    {50534, 4, 1},
+    {0, 0, 0},
+    {15631, 21, 1},
+    {97595, 16, 1},
+    {105201, 11, 1},
+    {99222, 23, 1},
+    {0, 0, 0},
+    {17323, 7, 1},
+    {1629, 16, 1},
+    {66389, 16, 1},
+    {84502, 3, 1},
+    {37809, 12, 1},
+    {57532, 21, 1},
+    {0, 0, 0},
+    {66210, 19, 1},
+    {72938, 6, 1},
+    {4111, 5, 1},
+    {0, 0, 0},
+    {17891, 14, 1},
+    {58792, 13, 1},
+    {97911, 6, 1},
+    {0, 0, 0},
+    {89871, 5, 1},
+    {45799, 18, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {110649, 10, 1},
+    {73002, 13, 1},
+    {40582, 16, 1},
+    {21009, 14, 1},
+    {106881, 19, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {64647, 12, 1},
+    {65122, 18, 1},
+    {34855, 17, 1},
+    {3276, 9, 1},
+    {91585, 19, 1},
+    {0, 0, 0},
+    {78339, 7, 1},
+    {25902, 3, 1},
+    {81190, 20, 1},
+    {92882, 19, 1},
+    {97881, 6, 1},
+    {25442, 7, 1},
+    {0, 0, 0},
+    {12808, 3, 1},
+    {25996, 12, 1},
+    {19052, 18, 1},
+    {59439, 15, 1},
+    {38573, 7, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {23602, 18, 1},
+    {0, 0, 0},
+    {75043, 2, 1},
+    {0, 0, 0},
+    {74832, 11, 1},
+    {73842, 5, 1},
+    {7765, 10, 1},
+    {16677, 6, 1},
+    {0, 0, 0},
+    {10742, 5, 1},
+    {102944, 18, 1},
+    {108554, 11, 1},
+    {33410, 13, 1},
+    {40604, 19, 1},
+    {0, 0, 0},
+    {81443, 18, 1},
+    {38510, 7, 1},
+    {42456, 6, 1},
+    {38975, 6, 1},
+    {0, 0, 0},
+    {70686, 6, 1},
+    {106463, 27, 1},
+    {99127, 11, 1},
+    {54707, 18, 1},
+    {44258, 24, 1},
+    {20215, 8, 1},
+    {71564, 11, 1},
+    {68669, 6, 1},
+    {92658, 10, 1},
+    {42046, 10, 1},
+    {0, 0, 0},
+    {288, 7, 1},
+    {11472, 11, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {22384, 6, 1},
+    {97348, 14, 1},
+    {11711, 5, 1},
+    {88691, 13, 1},
+    {79552, 15, 1},
+    {52214, 9, 1},
+    {71441, 6, 1},
+    {109531, 9, 1},
+    {16329, 6, 1},
+    {0, 0, 0},
+    {96240, 34, 1},
+    {84399, 8, 1},
+    {77420, 12, 1},
+    {19204, 6, 1},
+    {21515, 11, 1},
+    {11977, 11, 1},
+    {46085, 12, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {87024, 20, 1},
+    {55159, 6, 1},
+    {37130, 5, 1},
+    {78928, 4, 1},
+    {64949, 21, 1},
+    {112436, 6, 1},
+    {22328, 6, 1},
+    {62685, 6, 1},
+    {54049, 7, 1},
+    {20885, 15, 1},
+    {13869, 21, 1},
+    {102219, 10, 1},
+    {76747, 41, 1},
+    {18826, 5, 1},
+    {23290, 11, 1},
+    {0, 0, 0},
+    {58103, 5, 1},
+    {106295, 12, 1},
+    {51593, 13, 1},
+    {0, 0, 0},
+    {80072, 8, 1},
+    {103702, 9, 1},
+    {30004, 9, 1},
+    {13135, 12, 1},
+    {31023, 6, 1},
+    {54683, 15, 1},
+    {0, 0, 0},
+    {72599, 2, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {12859, 16, 1},
+    {35413, 5, 1},
+    {42553, 13, 1},
+    {105943, 15, 1},
+    {15328, 5, 1},
+    {18831, 5, 1},
+    {98563, 48, 1},
+    {71756, 13, 1},
+    {69460, 10, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {1105, 3, 1},
+    {30915, 6, 1},
+    {27375, 11, 1},
+    {12760, 6, 1},
+    {0, 0, 0},
+    {73974, 12, 1},
+    {0, 0, 0},
+    {16221, 6, 1},
+    {77268, 30, 1},
+    {74302, 5, 1},
+    {37723, 4, 1},
+    {112511, 9, 1},
+    {20142, 11, 1},
+    {0, 0, 0},
+    {69247, 17, 1},
+    {0, 0, 0},
+    {104196, 12, 1},
+    {0, 0, 0},
+    {18296, 3, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {42595, 6, 1},
+    {0, 0, 0},
+    {85207, 5, 1},
+    {25909, 11, 1},
+    {463, 9, 1},
+    {1376, 14, 1},
+    {70036, 18, 1},
+    {0, 0, 0},
+    {1217, 18, 1},
+    {71193, 5, 1},
+    {25590, 9, 1},
+    {601, 6, 1},
+    {6200, 15, 1},
+    {82605, 15, 1},
+    {0, 0, 0},
+    {99474, 7, 1},
+    {57584, 11, 1},
+    {0, 0, 0},
+    {109745, 13, 1},
+    {85252, 8, 1},
+    {60988, 12, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {99665, 11, 1},
+    {61738, 7, 1},
+    {304, 21, 1},
+    {108623, 16, 1},
+    {81518, 20, 1},
+    {96700, 14, 1},
+    {4387, 18, 1},
+    {19647, 22, 1},
+    {502, 4, 1},
+    {90151, 5, 1},
+    {51220, 9, 1},
+    {32091, 5, 1},
+    {79718, 9, 1},
+    {8742, 11, 1},
+    {99790, 16, 1},
+    {67877, 6, 1},
+    {5939, 5, 1},
+    {0, 0, 0},
+    {50454, 9, 1},
+    {34727, 13, 1},
+    {32465, 17, 1},
+    {48240, 2, 1},
+    {32025, 8, 1},
+    {69597, 9, 2},
+    {62529, 6, 1},
+    {92521, 12, 1},
+    {34681, 15, 1},
+    {60704, 7, 1},
+    {26748, 15, 1},
+    {3159, 14, 1},
+    {37222, 20, 1},
+    {0, 0, 0},
+    {111581, 6, 1},
+    {85401, 6, 1},
+    {58833, 11, 1},
+    {59379, 15, 1},
+    {83636, 9, 1},
+    {101683, 13, 1},
+    {73538, 14, 1},
+    {0, 0, 0},
+    {79112, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {70076, 10, 1},
+    {24715, 8, 1},
+    {26099, 16, 1},
+    {97114, 12, 1},
+    {93470, 10, 1},
+    {7560, 3, 1},
+    {22262, 6, 1},
+    {102435, 11, 1},
+    {94747, 11, 1},
+    {0, 0, 0},
+    {42518, 17, 1},
+    {72659, 17, 1},
+    {0, 0, 0},
+    {72921, 6, 1},
+    {0, 0, 0},
+    {23235, 11, 1},
+    {90410, 6, 1},
+    {0, 0, 0},
+    {93310, 8, 1},
+    {92082, 17, 1},
+    {0, 0, 0},
+    {3928, 10, 1},
+    {44835, 10, 1},
+    {38755, 3, 1},
+    {24386, 10, 1},
+    {5642, 8, 1},
+    {28917, 14, 1},
+    {37187, 6, 1},
+    {64659, 14, 2},
+    {100078, 4, 1},
+    {12386, 8, 1},
+    {64129, 26, 1},
+    {106748, 14, 1},
+    {38016, 12, 1},
+    {51737, 13, 1},
+    {0, 0, 0},
+    {72405, 11, 1},
+    {97024, 8, 1},
+    {103225, 21, 1},
+    {78571, 14, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {40905, 13, 1},
+    {0, 0, 0},
+    {42631, 22, 1},
+    {94926, 16, 1},
+    {13827, 15, 1},
+    {104134, 17, 1},
+    {84262, 17, 1},
+    {5520, 5, 1},
+    {7572, 5, 1},
+    {29331, 18, 1},
+    {70723, 2, 1},
+    {75614, 26, 1},
+    {0, 0, 0},
+    {55153, 6, 1},
+    {32621, 9, 1},
+    {56880, 16, 1},
+    {8753, 12, 1},
+    {806, 5, 1},
+    {103636, 18, 1},
+    {0, 0, 0},
+    {29955, 8, 1},
+    {63003, 10, 1},
+    {38893, 6, 1},
+    {0, 0, 0},
+    {100993, 19, 1},
+    {46245, 11, 1},
+    {0, 0, 0},
+    {13335, 18, 1},
+    {86864, 20, 1},
+    {31416, 6, 1},
+    {41133, 8, 1},
+    {58965, 11, 1},
+    {68633, 6, 1},
+    {28637, 14, 1},
+    {21208, 2, 1},
+    {0, 0, 0},
+    {2600, 10, 1},
+    {71986, 6, 1},
+    {67955, 6, 1},
+    {66176, 16, 1},
+    {21855, 6, 1},
+    {107838, 11, 1},
+    {39949, 19, 1},
+    {96735, 15, 1},
+    {11117, 15, 2},
+    {74684, 9, 1},
+    {30108, 6, 1},
+    {20094, 9, 1},
+    {51097, 10, 1},
+    {72833, 6, 1},
+    {29524, 13, 1},
+    {0, 0, 0},
+    {90564, 6, 1},
+    {4639, 19, 1},
+    {36377, 12, 1},
+    {30578, 7, 1},
+    {43413, 15, 1},
+    {101073, 11, 1},
+    {15198, 5, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {17746, 10, 1},
+    {0, 0, 0},
+    {97072, 6, 1},
+    {0, 0, 0},
+    {41823, 28, 1},
+    {0, 0, 0},
+    {109247, 20, 1},
+    {50436, 10, 1},
+    {950, 7, 1},
+    {77377, 15, 1},
+    {55279, 6, 1},
+    {110837, 6, 1},
+    {49580, 15, 1},
+    {85782, 11, 1},
+    {51107, 4, 1},
+    {0, 0, 0},
+    {73412, 6, 1},
+    {18710, 9, 1},
+    {8692, 7, 1},
+    {48231, 9, 1},
+    {75256, 8, 1},
+    {57943, 17, 1},
+    {0, 0, 0},
+    {46317, 19, 1},
+    {36317, 8, 1},
+    {0, 0, 0},
+    {1256, 5, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {70681, 3, 1},
+    {51164, 5, 1},
+    {38685, 7, 1},
+    {70531, 9, 1},
+    {0, 0, 0},
+    {58464, 13, 1},
+    {0, 0, 0},
+    {23380, 18, 1},
+    {16047, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {16794, 16, 1},
+    {19837, 21, 1},
+    {92493, 6, 1},
+    {84767, 9, 1},
+    {48565, 13, 1},
+    {56791, 15, 1},
+    {0, 0, 0},
+    {61576, 15, 1},
+    {43045, 9, 1},
+    {12237, 8, 1},
+    {66875, 14, 1},
+    {59031, 11, 1},
+    {22118, 6, 1},
+    {0, 0, 0},
+    {60718, 7, 1},
+    {57421, 17, 1},
+    {7215, 10, 1},
+    {68183, 6, 1},
+    {112206, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {105284, 10, 1},
+    {2658, 4, 1},
+    {67472, 16, 1},
+    {28624, 13, 1},
+    {50563, 9, 1},
+    {0, 0, 0},
+    {94306, 18, 1},
+    {55393, 6, 1},
+    {69103, 5, 1},
+    {52794, 23, 1},
+    {22665, 11, 1},
+    {86005, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {8587, 5, 1},
+    {44530, 14, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {71548, 11, 1},
+    {42284, 19, 1},
+    {68929, 15, 1},
+    {67925, 6, 1},
+    {0, 0, 0},
+    {68123, 6, 1},
+    {31218, 6, 1},
+    {50378, 12, 1},
+    {0, 0, 0},
+    {67634, 5, 1},
+    {0, 0, 0},
+    {2357, 17, 1},
+    {93605, 5, 1},
+    {28758, 3, 1},
+    {30789, 6, 1},
+    {103431, 13, 1},
+    {74286, 11, 1},
+    {19180, 16, 1},
+    {54199, 17, 1},
+    {77719, 22, 1},
+    {8497, 6, 1},
+    {95989, 39, 1},
+    {111293, 25, 1},
+    {86107, 15, 1},
+    {79100, 6, 1},
+    {95176, 16, 1},
+    {65158, 25, 1},
+    {3375, 22, 1},
+    {33973, 10, 1},
+    {30599, 7, 1},
+    {20130, 2, 1},
+    {49506, 11, 1},
+    {24723, 5, 1},
+    {50341, 6, 1},
+    {85992, 13, 1},
+    {89929, 17, 1},
+    {0, 0, 0},
+    {102294, 11, 1},
+    {42731, 7, 1},
+    {21233, 9, 1},
+    {46369, 7, 1},
+    {89281, 16, 1},
+    {42240, 8, 1},
+    {6187, 13, 1},
+    {90266, 13, 1},
+    {0, 0, 0},
+    {17302, 7, 1},
+    {0, 0, 0},
+    {42744, 5, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {107919, 18, 1},
+    {39447, 13, 1},
+    {15545, 5, 1},
+    {48164, 16, 1},
+    {1335, 7, 1},
+    {64970, 2, 2},
+    {31538, 11, 1},
+    {7478, 13, 1},
+    {8364, 13, 1},
+    {0, 0, 0},
+    {68741, 9, 1},
+    {89171, 5, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {26469, 8, 1},
+    {78090, 7, 1},
+    {47874, 13, 1},
+    {56030, 14, 1},
+    {63990, 9, 1},
+    {65619, 20, 2},
+    {0, 0, 0},
+    {37563, 2, 1},
+    {41201, 18, 1},
+    {92485, 8, 1},
+    {39245, 5, 1},
+    {50164, 2, 1},
+    {5898, 7, 1},
+    {6572, 11, 1},
+    {89720, 17, 1},
+    {9068, 15, 1},
+    {0, 0, 0},
+    {59662, 4, 1},
+    {91700, 9, 1},
+    {58746, 9, 1},
+    {0, 0, 0},
+    {27613, 9, 1},
+    {0, 0, 0},
+    {48736, 17, 1},
+    {12495, 8, 1},
+    {32767, 7, 1},
+    {83563, 2, 1},
+    {12652, 9, 1},
+    {41281, 17, 1},
+    {81883, 14, 1},
+    {103818, 15, 1},
+    {0, 0, 0},
+    {109806, 11, 1},
+    {38636, 7, 1},
+    {112074, 9, 1},
+    {62535, 6, 1},
+    {96411, 34, 1},
+    {36843, 15, 1},
+    {16395, 6, 1},
+    {42773, 4, 1},
+    {82944, 11, 1},
+    {0, 0, 0},
+    {32505, 17, 1},
+    {103580, 18, 1},
+    {0, 0, 0},
+    {109704, 7, 1},
+    {0, 0, 0},
+    {88040, 17, 1},
+    {67095, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {109935, 8, 1},
+    {91321, 21, 1},
+    {17577, 7, 1},
+    {97181, 5, 1},
+    {0, 0, 0},
+    {60501, 19, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {50472, 8, 1},
+    {0, 0, 0},
+    {27507, 11, 1},
+    {111179, 15, 1},
+    {0, 0, 0},
+    {15885, 6, 1},
+    {35223, 14, 1},
+    {102491, 19, 1},
+    {58869, 12, 1},
+    {44563, 17, 1},
+    {0, 0, 0},
+    {88001, 20, 1},
+    {15434, 5, 1},
+    {32671, 17, 1},
+    {99178, 5, 1},
+    {0, 0, 0},
+    {91762, 10, 1},
+    {107109, 17, 1},
+    {59679, 7, 1},
+    {50540, 5, 1},
+    {91795, 9, 1},
+    {18299, 8, 1},
+    {0, 0, 0},
+    {105044, 10, 1},
+    {40506, 9, 1},
+    {70548, 8, 1},
+    {91962, 10, 1},
+    {13048, 4, 1},
+    {109407, 6, 1},
+    {58844, 12, 1},
+    {57782, 13, 1},
+    {0, 0, 0},
+    {33938, 17, 1},
+    {8449, 6, 1},
+    {28558, 20, 1},
+    {64427, 7, 1},
+    {5684, 12, 1},
+    {44733, 15, 1},
+    {82148, 17, 1},
+    {0, 0, 0},
+    {28081, 20, 1},
+    {42601, 8, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {4424, 19, 1},
+    {110905, 14, 1},
+    {35363, 8, 1},
+    {88509, 6, 1},
+    {0, 0, 0},
+    {35539, 17, 1},
+    {75075, 3, 1},
+    {6957, 24, 1},
+    {0, 0, 0},
+    {25345, 19, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {98219, 50, 1},
+    {17718, 6, 1},
+    {14603, 26, 1},
+    {76470, 31, 1},
+    {65995, 11, 1},
+    {0, 0, 0},
+    {77332, 9, 1},
+    {27797, 18, 1},
+    {112586, 9, 1},
+    {0, 0, 0},
+    {63078, 4, 1},
+    {28310, 22, 1},
+    {95590, 9, 1},
+    {44013, 17, 1},
+    {0, 0, 0},
+    {45315, 21, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {52195, 11, 1},
+    {91236, 20, 1},
+    {86402, 14, 1},
+    {0, 0, 0},
+    {18499, 12, 2},
+    {66862, 13, 1},
+    {81932, 17, 1},
+    {30987, 6, 1},
+    {54589, 9, 1},
+    {105894, 16, 1},
+    {44395, 14, 1},
+    {20288, 11, 1},
+    {5548, 7, 1},
+    {46168, 3, 1},
+    {22100, 6, 1},
+    {18291, 5, 1},
+    {67649, 5, 1},
+    {42056, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {99442, 10, 1},
+    {0, 0, 0},
+    {21897, 6, 1},
+    {0, 0, 0},
+    {21199, 9, 1},
+    {0, 0, 0},
+    {85443, 15, 1},
+    {1281, 10, 2},
+    {102125, 20, 1},
+    {0, 0, 0},
+    {110141, 13, 1},
+    {99412, 9, 1},
+    {2719, 6, 1},
+    {20309, 18, 1},
+    {51983, 5, 1},
+    {55635, 20, 1},
+    {37291, 16, 1},
+    {27642, 9, 1},
+    {26686, 18, 1},
+    {406, 8, 1},
+    {95500, 17, 1},
+    {47750, 14, 1},
+    {57086, 5, 1},
+    {21526, 17, 1},
+    {11147, 16, 1},
+    {109561, 18, 1},
+    {105784, 18, 1},
+    {33784, 17, 1},
+    {80311, 12, 1},
+    {111566, 9, 1},
+    {27529, 11, 1},
+    {0, 0, 0},
+    {20411, 10, 1},
+    {48429, 7, 1},
+    {5555, 25, 1},
+    {67901, 6, 1},
+    {98929, 45, 1},
+    {98974, 45, 1},
+    {111560, 6, 1},
+    {0, 0, 0},
+    {68447, 6, 1},
+    {66970, 20, 1},
+    {70289, 8, 1},
+    {3113, 7, 1},
+    {4590, 3, 1},
+    {100806, 12, 1},
+    {84942, 17, 1},
+    {110497, 12, 1},
+    {6716, 9, 1},
+    {60922, 18, 1},
+    {0, 0, 0},
+    {18872, 5, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {43135, 9, 1},
+    {0, 0, 0},
+    {108356, 15, 1},
+    {0, 0, 0},
+    {42922, 6, 1},
+    {21247, 5, 1},
+    {90076, 5, 1},
+    {62577, 6, 1},
+    {79130, 6, 1},
+    {0, 0, 0},
+    {30178, 7, 1},
+    {68730, 11, 1},
+    {76162, 35, 1},
+    {72223, 25, 1},
+    {87743, 7, 1},
+    {62373, 6, 1},
+    {27704, 3, 1},
+    {57815, 10, 1},
+    {26265, 3, 1},
+    {31502, 8, 1},
+    {84981, 20, 2},
+    {3633, 15, 1},
+    {75875, 39, 1},
+    {0, 0, 0},
+    {34872, 17, 1},
+    {111673, 12, 1},
+    {92543, 5, 1},
+    {105425, 21, 1},
+    {0, 0, 0},
+    {15186, 2, 1},
+    {27265, 11, 1},
+    {52766, 6, 1},
+    {0, 0, 0},
+    {23260, 17, 1},
+    {0, 0, 0},
+    {34632, 17, 1},
+    {104260, 14, 1},
+    {69606, 5, 1},
+    {0, 0, 0},
+    {16191, 6, 1},
+    {5877, 6, 1},
+    {92649, 9, 1},
+    {61652, 5, 1},
+    {54300, 13, 1},
+    {74542, 19, 1},
+    {12184, 3, 1},
+    {0, 0, 0},
+    {68099, 6, 1},
+    {0, 0, 0},
+    {86610, 18, 1},
+    {0, 0, 0},
+    {81342, 12, 1},
+    {70054, 22, 1},
+    {18385, 14, 1},
+    {95321, 6, 1},
+    {112625, 6, 1},
+    {0, 0, 0},
+    {97088, 6, 1},
+    {25556, 15, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {68321, 6, 1},
+    {3329, 24, 1},
+    {0, 0, 0},
+    {70583, 8, 1},
+    {22908, 6, 1},
+    {68561, 6, 1},
+    {24125, 3, 1},
+    {71928, 2, 1},
+    {0, 0, 0},
+    {35297, 22, 1},
+    {69675, 18, 1},
+    {0, 0, 0},
+    {92605, 5, 1},
+    {63021, 6, 1},
+    {63426, 23, 1},
+    {3624, 9, 1},
+    {101172, 21, 1},
+    {73993, 8, 1},
+    {39913, 21, 1},
+    {13024, 7, 1},
+    {47919, 14, 1},
+    {0, 0, 0},
+    {43801, 17, 1},
+    {75051, 9, 1},
+    {66192, 18, 1},
+    {68645, 6, 1},
+    {112388, 6, 1},
+    {4611, 6, 1},
+    {3206, 14, 1},
+    {63000, 3, 1},
+    {82393, 20, 1},
+    {13563, 23, 1},
+    {8217, 18, 1},
+    {25087, 14, 1},
+    {112520, 9, 1},
+    {84677, 4, 1},
+    {74318, 25, 1},
+    {0, 0, 0},
+    {4767, 7, 1},
+    {22456, 6, 1},
+    {79625, 17, 1},
+    {4264, 5, 1},
+    {70425, 5, 1},
+    {35166, 21, 1},
+    {111443, 9, 1},
+    {59703, 3, 1},
+    {51286, 12, 1},
+    {3548, 3, 1},
+    {65761, 5, 1},
+    {97725, 16, 1},
+    {32647, 8, 1},
+    {0, 0, 0},
+    {78878, 17, 1},
+    {110285, 13, 1},
+    {96657, 10, 1},
+    {89428, 19, 1},
+    {7648, 6, 1},
+    {0, 0, 0},
+    {30507, 16, 1},
+    {44106, 18, 1},
+    {81123, 15, 1},
+    {109466, 17, 1},
+    {55255, 6, 1},
+    {86170, 5, 1},
+    {0, 0, 0},
+    {28407, 20, 1},
+    {29241, 14, 1},
+    {21331, 27, 1},
+    {38945, 6, 1},
+    {24869, 7, 1},
+    {84631, 15, 1},
+    {98748, 45, 1},
+    {33117, 18, 1},
+    {0, 0, 0},
+    {51660, 14, 1},
+    {9083, 15, 1},
+    {74955, 9, 1},
+    {94914, 12, 1},
+    {20643, 5, 1},
+    {58071, 6, 1},
+    {88057, 18, 1},
+    {0, 0, 0},
+    {46918, 13, 2},
+    {12023, 4, 1},
+    {0, 0, 0},
+    {88496, 13, 1},
+    {60233, 21, 1},
+    {68021, 6, 1},
+    {43219, 9, 1},
+    {34962, 20, 1},
+    {90081, 10, 1},
+    {0, 0, 0},
+    {97929, 6, 1},
+    {0, 0, 0},
+    {15560, 5, 1},
+    {52, 16, 1},
+    {0, 0, 0},
+    {61684, 5, 1},
+    {49836, 14, 1},
+    {72489, 10, 1},
+    {0, 0, 0},
+    {13751, 16, 1},
+    {43000, 9, 1},
+    {39170, 24, 1},
+    {11114, 3, 1},
+    {0, 0, 0},
+    {1183, 17, 1},
+    {0, 0, 0},
+    {85316, 9, 1},
+    {22063, 6, 1},
+    {0, 0, 0},
+    {95301, 8, 1},
+    {12661, 13, 1},
+    {0, 0, 0},
+    {2396, 19, 1},
+    {8643, 16, 1},
+    {84357, 24, 1},
+    {88634, 8, 1},
+    {15228, 5, 1},
+    {11572, 4, 1},
+    {19292, 6, 1},
+    {18719, 12, 1},
+    {94726, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {17601, 12, 1},
+    {108171, 7, 1},
+    {58258, 13, 1},
+    {35052, 18, 1},
+    {16107, 6, 1},
+    {1863, 14, 1},
+    {20117, 13, 1},
+    {0, 0, 0},
+    {67733, 14, 1},
+    {1442, 6, 1},
+    {22250, 6, 1},
+    {63837, 19, 1},
+    {0, 0, 0},
+    {107173, 11, 1},
+    {21973, 6, 1},
+    {1291, 10, 1},
+    {63935, 5, 1},
+    {30023, 5, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {39515, 17, 1},
+    {50420, 10, 1},
+    {49542, 2, 1},
+    {53453, 6, 1},
+    {36773, 16, 1},
+    {34310, 24, 1},
+    {78346, 15, 1},
+    {4405, 5, 1},
+    {25364, 20, 1},
+    {50875, 9, 1},
+    {8419, 6, 1},
+    {83647, 9, 1},
+    {77846, 15, 1},
+    {17818, 6, 1},
+    {105089, 13, 1},
+    {74964, 10, 1},
+    {22498, 6, 1},
+    {53620, 19, 1},
+    {1467, 2, 1},
+    {55099, 6, 1},
+    {16932, 14, 2},
+    {74816, 9, 1},
+    {67787, 6, 1},
+    {85381, 8, 1},
+    {1488, 7, 1},
+    {62869, 4, 1},
+    {94054, 30, 1},
+    {30554, 10, 1},
+    {96644, 13, 1},
+    {24759, 8, 1},
+    {5366, 7, 1},
+    {8788, 11, 1},
+    {0, 0, 0},
+    {68693, 6, 1},
+    {22659, 6, 1},
+    {19298, 8, 1},
+    {70225, 11, 1},
+    {27199, 11, 1},
+    {105348, 15, 1},
+    {11700, 11, 1},
+    {91353, 18, 1},
+    {23818, 17, 1},
+    {66098, 17, 1},
+    {20366, 10, 1},
+    {35752, 9, 1},
+    {44816, 9, 1},
+    {84047, 15, 1},
+    {70462, 11, 1},
+    {5179, 8, 1},
+    {71148, 10, 1},
+    {79567, 25, 1},
+    {11072, 9, 1},
+    {45022, 15, 1},
+    {29986, 5, 1},
+    {87322, 16, 1},
+    {9643, 11, 1},
+    {1794, 10, 1},
+    {97238, 9, 1},
+    {33312, 15, 1},
+    {20960, 15, 1},
+    {99645, 8, 1},
+    {86312, 11, 1},
+    {11591, 11, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {55742, 16, 1},
+    {56614, 9, 1},
+    {70565, 6, 1},
+    {88850, 12, 1},
+    {0, 0, 0},
+    {42886, 9, 1},
+    {0, 0, 0},
+    {7541, 3, 1},
+    {58278, 9, 1},
+    {2329, 12, 1},
+    {52602, 5, 1},
+    {37342, 16, 1},
+    {83324, 10, 1},
+    {15610, 5, 1},
+    {41175, 17, 1},
+    {83587, 4, 1},
+    {0, 0, 0},
+    {74902, 17, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {19909, 2, 1},
+    {0, 0, 0},
+    {32482, 19, 1},
+    {64014, 9, 1},
+    {58501, 9, 1},
+    {6851, 7, 1},
+    {10187, 6, 1},
+    {70923, 9, 1},
+    {29029, 14, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {74843, 7, 1},
+    {84798, 12, 1},
+    {91661, 20, 1},
+    {0, 0, 0},
+    {4937, 16, 1},
+    {66959, 11, 1},
+    {54598, 9, 1},
+    {40918, 10, 1},
+    {0, 0, 0},
+    {45694, 21, 1},
+    {29639, 9, 1},
+    {83216, 10, 1},
+    {0, 0, 0},
+    {66513, 14, 1},
+    {102670, 12, 1},
+    {57776, 6, 1},
+    {30873, 6, 1},
+    {30468, 10, 1},
+    {85562, 16, 1},
+    {7439, 12, 1},
+    {56279, 17, 1},
+    {0, 0, 0},
+    {8485, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {22390, 6, 1},
+    {96981, 18, 1},
+    {4569, 4, 1},
+    {23137, 20, 1},
+    {72178, 24, 1},
+    {2097, 10, 1},
+    {100729, 11, 1},
+    {11520, 11, 1},
+    {35980, 14, 1},
+    {0, 0, 0},
+    {71930, 9, 1},
+    {84228, 3, 1},
+    {0, 0, 0},
+    {86323, 11, 1},
+    {43479, 12, 1},
+    {16665, 6, 1},
+    {88440, 17, 1},
+    {63926, 9, 1},
+    {102327, 21, 1},
+    {24859, 10, 1},
+    {100370, 11, 1},
+    {0, 0, 0},
+    {59394, 15, 1},
+    {53526, 16, 1},
+    {26371, 22, 1},
+    {72279, 6, 1},
+    {106267, 13, 1},
+    {94814, 9, 1},
+    {68195, 6, 1},
+    {9544, 11, 1},
+    {27331, 11, 1},
+    {15137, 5, 1},
+    {84479, 9, 1},
+    {0, 0, 0},
+    {85694, 15, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {30229, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {85816, 12, 1},
+    {40050, 15, 1},
+    {105605, 11, 1},
+    {35035, 17, 1},
+    {92795, 4, 1},
+    {48468, 5, 1},
+    {85903, 15, 1},
+    {19994, 12, 1},
+    {68051, 6, 1},
+    {110209, 13, 1},
+    {4247, 9, 1},
+    {25403, 11, 1},
+    {109388, 4, 1},
+    {95039, 14, 1},
+    {9898, 10, 1},
+    {54653, 15, 1},
+    {15117, 6, 1},
+    {17688, 11, 1},
+    {537, 11, 1},
+    {5580, 14, 1},
+    {40669, 10, 1},
+    {0, 0, 0},
+    {63568, 25, 1},
+    {6055, 8, 2},
+    {99871, 19, 1},
+    {68309, 6, 1},
+    {56741, 19, 1},
+    {66312, 12, 1},
+    {0, 0, 0},
+    {86013, 5, 1},
+    {102060, 13, 1},
+    {8276, 5, 1},
+    {83455, 6, 1},
+    {39493, 22, 1},
+    {50281, 9, 1},
+    {60662, 7, 1},
+    {81576, 17, 1},
+    {0, 0, 0},
+    {69869, 27, 1},
+    {73771, 18, 1},
+    {79340, 17, 1},
+    {55954, 15, 1},
+    {31790, 15, 1},
+    {90176, 11, 1},
+    {0, 0, 0},
+    {15615, 5, 1},
+    {60634, 7, 1},
+    {9752, 2, 1},
+    {15479, 5, 1},
+    {103125, 17, 1},
+    {25501, 7, 1},
+    {65104, 18, 1},
+    {55399, 8, 1},
+    {0, 0, 0},
+    {49447, 12, 1},
+    {20168, 15, 1},
+    {72202, 7, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {8031, 6, 1},
+    {98079, 23, 1},
+    {100689, 17, 1},
+    {105305, 12, 1},
+    {0, 0, 0},
+    {70264, 12, 1},
+    {30645, 6, 1},
+    {6620, 13, 1},
+    {8284, 6, 1},
+    {32788, 15, 1},
+    {27606, 7, 1},
+    {71805, 7, 1},
+    {905, 5, 1},
+    {15921, 6, 1},
+    {103280, 17, 1},
+    {58125, 3, 1},
+    {44319, 13, 1},
+    {89331, 15, 1},
+    {21135, 10, 1},
+    {22366, 6, 1},
+    {0, 0, 0},
+    {13783, 14, 1},
+    {18866, 6, 1},
+    {7891, 13, 1},
+    {75953, 34, 1},
+    {0, 0, 0},
+    {72073, 8, 1},
+    {19530, 3, 1},
+    {97395, 18, 1},
+    {43470, 9, 1},
+    {46190, 13, 1},
+    {79357, 14, 1},
+    {59672, 2, 1},
+    {71498, 11, 1},
+    {15152, 6, 1},
+    {65079, 5, 1},
+    {32212, 20, 1},
+    {103002, 15, 1},
+    {103206, 19, 1},
+    {45446, 14, 1},
+    {20722, 21, 1},
+    {28676, 17, 1},
+    {32560, 16, 1},
+    {0, 0, 0},
+    {40273, 16, 1},
+    {65220, 7, 1},
+    {0, 0, 0},
+    {62015, 6, 1},
+    {42025, 21, 1},
+    {68719, 11, 1},
+    {27122, 11, 1},
+    {7271, 17, 1},
+    {0, 0, 0},
+    {110927, 9, 1},
+    {15770, 14, 1},
+    {7003, 24, 1},
+    {0, 0, 0},
+    {101672, 11, 1},
+    {1511, 10, 1},
+    {89636, 21, 1},
+    {9677, 9, 1},
+    {29369, 10, 1},
+    {70591, 8, 1},
+    {9712, 8, 1},
+    {86387, 15, 1},
+    {20018, 11, 1},
+    {23076, 8, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {58483, 9, 1},
+    {25194, 5, 1},
+    {39127, 14, 1},
+    {71066, 4, 1},
+    {20787, 16, 1},
+    {110777, 8, 1},
+    {2236, 24, 1},
+    {40757, 21, 1},
+    {0, 0, 0},
+    {25961, 12, 1},
+    {24941, 7, 1},
+    {97047, 7, 1},
+    {0, 0, 0},
+    {2516, 5, 1},
+    {39313, 19, 1},
+    {53714, 20, 1},
+    {0, 0, 0},
+    {67919, 6, 1},
+    {11556, 10, 1},
+    {0, 0, 0},
+    {107450, 5, 1},
+    {0, 0, 0},
+    {92237, 17, 1},
+    {6101, 2, 1},
+    {97953, 5, 1},
+    {74600, 9, 1},
+    {0, 0, 0},
+    {69270, 8, 1},
+    {2190, 14, 1},
+    {0, 0, 0},
+    {61335, 21, 1},
+    {49983, 12, 1},
+    {80770, 15, 1},
+    {29511, 13, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {85849, 4, 1},
+    {62075, 6, 1},
+    {0, 0, 0},
+    {95403, 10, 1},
+    {6633, 12, 1},
+    {25624, 6, 1},
+    {78188, 25, 1},
+    {36346, 19, 1},
+    {36241, 18, 1},
+    {0, 0, 0},
+    {101601, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {63161, 20, 1},
+    {18731, 12, 1},
+    {78555, 16, 1},
+    {92461, 19, 1},
+    {100276, 11, 1},
+    {21500, 3, 1},
+    {30263, 9, 1},
+    {69413, 19, 1},
+    {91923, 5, 1},
+    {0, 0, 0},
+    {90570, 5, 1},
+    {62703, 6, 1},
+    {32285, 9, 1},
+    {57929, 14, 1},
+    {15993, 6, 1},
+    {55407, 9, 1},
+    {68787, 7, 1},
+    {2992, 16, 1},
+    {97226, 12, 1},
+    {36536, 9, 1},
+    {21735, 6, 1},
+    {92555, 13, 1},
+    {67727, 6, 1},
+    {0, 0, 0},
+    {22256, 6, 1},
+    {25935, 14, 1},
+    {85053, 18, 1},
+    {58422, 24, 1},
+    {9833, 8, 1},
+    {0, 0, 0},
+    {38491, 8, 1},
+    {0, 0, 0},
+    {79510, 21, 1},
+    {74433, 3, 1},
+    {100490, 10, 1},
+    {1681, 8, 1},
+    {0, 0, 0},
+    {17024, 7, 1},
+    {90902, 9, 1},
+    {76089, 34, 1},
+    {75345, 4, 1},
+    {17584, 5, 1},
+    {446, 5, 1},
+    {20661, 11, 1},
+    {16371, 6, 1},
+    {0, 0, 0},
+    {35968, 12, 1},
+    {0, 0, 0},
+    {27254, 11, 1},
+    {27034, 11, 1},
+    {0, 0, 0},
+    {42964, 9, 1},
+    {79148, 6, 1},
+    {28427, 19, 1},
+    {0, 0, 0},
+    {29737, 11, 1},
+    {91057, 21, 1},
+    {52010, 10, 1},
+    {64863, 9, 1},
+    {92580, 5, 1},
+    {0, 0, 0},
+    {18805, 7, 1},
+    {100976, 8, 1},
+    {47366, 17, 1},
+    {6041, 14, 1},
+    {0, 0, 0},
+    {67664, 5, 1},
+    {112346, 9, 1},
+    {22088, 6, 1},
+    {0, 0, 0},
+    {83686, 6, 1},
+    {30993, 6, 1},
+    {40928, 14, 1},
+    {68995, 7, 1},
+    {80007, 8, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {29969, 2, 1},
+    {44920, 17, 1},
+    {0, 0, 0},
+    {12033, 9, 1},
+    {43709, 19, 1},
+    {17462, 14, 1},
+    {57387, 12, 1},
+    {86628, 16, 1},
+    {84552, 8, 1},
+    {8087, 17, 1},
+    {106325, 14, 1},
+    {71000, 10, 1},
+    {97428, 17, 1},
+    {43387, 10, 1},
+    {0, 0, 0},
+    {18285, 6, 1},
+    {86440, 16, 1},
+    {109032, 20, 1},
+    {70193, 16, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {62295, 6, 1},
+    {89847, 11, 1},
+    {57049, 2, 1},
+    {26183, 16, 1},
+    {92970, 6, 1},
+    {104543, 13, 1},
+    {0, 0, 0},
+    {30162, 16, 1},
+    {0, 0, 0},
+    {82674, 12, 1},
+    {109730, 15, 1},
+    {54797, 9, 1},
+    {73837, 5, 1},
+    {4599, 6, 1},
+    {58342, 20, 1},
+    {30327, 4, 1},
+    {94499, 22, 1},
+    {29401, 2, 1},
+    {0, 0, 0},
+    {45298, 17, 1},
+    {48359, 12, 1},
+    {82186, 22, 1},
+    {46931, 18, 1},
+    {48790, 17, 1},
+    {49051, 17, 1},
+    {20975, 17, 1},
+    {43126, 9, 1},
+    {82686, 14, 1},
+    {0, 0, 0},
+    {72291, 6, 1},
+    {0, 0, 0},
+    {36620, 6, 1},
+    {97215, 5, 1},
+    {102646, 24, 1},
+    {10164, 10, 1},
+    {0, 0, 0},
+    {67488, 3, 1},
+    {57187, 13, 1},
+    {74712, 9, 1},
+    {91857, 3, 1},
+    {17934, 8, 1},
+    {52190, 5, 1},
+    {50538, 2, 1},
+    {66813, 12, 1},
+    {80436, 12, 1},
+    {62907, 5, 1},
+    {0, 0, 0},
+    {83738, 18, 1},
+    {36218, 4, 1},
+    {104032, 17, 1},
+    {66682, 11, 1},
+    {85497, 5, 1},
+    {0, 0, 0},
+    {72878, 5, 1},
+    {30272, 4, 1},
+    {32312, 8, 1},
+    {0, 0, 0},
+    {42137, 16, 1},
+    {73357, 12, 1},
+    {12285, 8, 1},
+    {13275, 23, 1},
+    {69983, 9, 1},
+    {52163, 6, 1},
+    {63759, 18, 1},
+    {111838, 9, 1},
+    {90091, 18, 1},
+    {31722, 6, 1},
+    {17802, 16, 1},
+    {35477, 5, 1},
+    {0, 0, 0},
+    {89998, 13, 1},
+    {82931, 9, 1},
+    {79082, 6, 1},
+    {19036, 16, 1},
+    {38699, 7, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {91990, 19, 1},
+    {0, 0, 0},
+    {17672, 6, 1},
+    {49769, 5, 1},
+    {16137, 6, 1},
+    {72367, 6, 1},
+    {64008, 6, 1},
+    {71575, 6, 1},
+    {3998, 6, 1},
+    {20399, 12, 1},
+    {45651, 22, 1},
+    {48386, 15, 1},
+    {24381, 5, 1},
+    {53886, 8, 1},
+    {0, 0, 0},
+    {15285, 5, 1},
+    {920, 5, 1},
+    {99711, 10, 1},
+    {7750, 15, 1},
+    {6419, 11, 1},
+    {54470, 4, 1},
+    {12535, 8, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {19158, 8, 1},
+    {80519, 12, 1},
+    {63350, 6, 1},
+    {16473, 6, 1},
+    {24568, 7, 1},
+    {18515, 17, 1},
+    {96959, 9, 1},
+    {23728, 13, 1},
+    {0, 0, 0},
+    {15818, 22, 1},
+    {65049, 5, 1},
+    {22274, 6, 1},
+    {100855, 10, 1},
+    {0, 0, 0},
+    {38615, 7, 1},
+    {31735, 2, 1},
+    {0, 0, 0},
+    {27725, 14, 1},
+    {32041, 16, 1},
+    {53773, 16, 1},
+    {55039, 6, 1},
+    {27177, 11, 1},
+    {15600, 5, 1},
+    {16305, 6, 1},
+    {11353, 5, 1},
+    {62361, 6, 1},
+    {70599, 8, 1},
+    {92049, 16, 1},
+    {37242, 19, 1},
+    {45336, 19, 1},
+    {62607, 6, 1},
+    {83106, 12, 1},
+    {50713, 9, 1},
+    {93537, 17, 1},
+    {99334, 14, 1},
+    {56669, 22, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {53058, 8, 1},
+    {12163, 5, 1},
+    {50893, 9, 1},
+    {111645, 13, 1},
+    {79964, 18, 1},
+    {49691, 15, 1},
+    {1650, 5, 1},
+    {0, 0, 0},
+    {37093, 22, 1},
+    {5661, 7, 1},
+    {40392, 15, 1},
+    {109270, 16, 1},
+    {31441, 8, 1},
+    {0, 0, 0},
+    {21582, 5, 1},
+    {98116, 12, 1},
+    {0, 0, 0},
+    {261, 7, 1},
+    {16281, 6, 1},
+    {0, 0, 0},
+    {50812, 9, 1},
+    {35082, 9, 1},
+    {73683, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {88843, 2, 1},
+    {31116, 6, 1},
+    {29462, 4, 1},
+    {91902, 9, 1},
+    {14024, 2, 1},
+    {0, 0, 0},
+    {19774, 16, 1},
+    {12042, 13, 1},
+    {87888, 6, 1},
+    {64598, 16, 1},
+    {0, 0, 0},
+    {8585, 2, 1},
+    {0, 0, 0},
+    {87593, 12, 1},
+    {0, 0, 0},
+    {42790, 9, 1},
+    {103266, 14, 1},
+    {0, 0, 0},
+    {21270, 17, 1},
+    {40964, 30, 1},
+    {3748, 35, 1},
+    {80611, 16, 1},
+    {61907, 6, 1},
+    {16413, 6, 1},
+    {83907, 17, 1},
+    {36789, 18, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {27386, 11, 1},
+    {0, 0, 0},
+    {83159, 9, 1},
+    {19279, 13, 1},
+    {0, 0, 0},
+    {68835, 20, 1},
+    {109450, 16, 1},
+    {28061, 20, 1},
+    {39434, 13, 1},
+    {37546, 17, 1},
+    {0, 0, 0},
+    {89858, 13, 1},
+    {71055, 11, 1},
+    {68225, 6, 1},
+    {44987, 17, 1},
+    {74936, 19, 1},
+    {73082, 6, 1},
+    {0, 0, 0},
+    {19582, 7, 1},
+    {36904, 17, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {43335, 17, 1},
+    {80062, 10, 1},
+    {0, 0, 0},
+    {93824, 11, 1},
+    {31412, 2, 1},
+    {8557, 6, 1},
+    {27692, 12, 1},
+    {43913, 23, 1},
+    {9918, 7, 1},
+    {86571, 19, 1},
+    {22021, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {5045, 4, 1},
+    {72785, 11, 1},
+    {45837, 14, 1},
+    {88660, 14, 1},
+    {62619, 6, 1},
+    {59330, 19, 1},
+    {36861, 8, 1},
+    {75152, 18, 1},
+    {84245, 9, 1},
+    {94153, 5, 1},
+    {69817, 5, 1},
+    {0, 0, 0},
+    {9379, 11, 1},
+    {0, 0, 0},
+    {83307, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {68135, 6, 1},
+    {48340, 12, 1},
+    {88762, 6, 1},
+    {25006, 4, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {49190, 8, 1},
+    {107937, 23, 1},
+    {69533, 15, 1},
+    {7706, 4, 1},
+    {10982, 8, 1},
+    {108910, 15, 1},
+    {48879, 18, 1},
+    {16389, 6, 1},
+    {0, 0, 0},
+    {42164, 5, 1},
+    {0, 0, 0},
+    {30259, 4, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {79277, 9, 1},
+    {93497, 10, 1},
+    {62259, 6, 1},
+    {44448, 21, 1},
+    {0, 0, 0},
+    {62782, 16, 1},
+    {87466, 14, 1},
+    {42871, 6, 1},
+    {112248, 9, 1},
+    {48092, 15, 1},
+    {79094, 6, 1},
+    {0, 0, 0},
+    {20525, 11, 1},
+    {1608, 7, 1},
+    {13112, 11, 1},
+    {43228, 9, 1},
+    {53083, 16, 1},
+    {7586, 5, 1},
+    {0, 0, 0},
+    {16707, 6, 1},
+    {110459, 12, 1},
+    {54867, 15, 1},
+    {83501, 5, 1},
+    {40553, 12, 1},
+    {51702, 10, 1},
+    {49440, 7, 1},
+    {83579, 8, 1},
+    {52710, 4, 1},
+    {42366, 4, 1},
+    {48283, 5, 1},
+    {0, 0, 0},
+    {66120, 14, 1},
+    {9701, 11, 1},
+    {0, 0, 0},
+    {60832, 9, 1},
+    {0, 0, 0},
+    {58108, 9, 1},
+    {55033, 6, 1},
+    {9759, 10, 1},
+    {35418, 6, 1},
+    {34982, 19, 1},
+    {1108, 6, 1},
+    {103899, 16, 1},
+    {0, 0, 0},
+    {18955, 11, 1},
+    {66663, 5, 1},
+    {25435, 7, 1},
+    {30214, 15, 1},
+    {106585, 15, 1},
+    {21783, 6, 1},
+    {0, 0, 0},
+    {95553, 17, 1},
+    {56132, 16, 1},
+    {0, 0, 0},
+    {32437, 15, 1},
+    {58326, 16, 1},
+    {10074, 22, 1},
+    {0, 0, 0},
+    {26899, 18, 1},
+    {73580, 12, 1},
+    {105928, 15, 1},
+    {13975, 13, 1},
+    {5453, 16, 1},
+    {62145, 6, 1},
+    {91604, 18, 1},
+    {16245, 6, 1},
+    {35851, 13, 1},
+    {45138, 16, 1},
+    {19669, 22, 1},
+    {33103, 14, 1},
+    {97362, 14, 1},
+    {79258, 6, 1},
+    {57722, 6, 1},
+    {88153, 3, 1},
+    {15915, 6, 1},
+    {38503, 7, 1},
+    {105221, 8, 1},
+    {62217, 6, 1},
+    {110881, 10, 1},
+    {62828, 4, 1},
+    {30028, 5, 1},
+    {49755, 2, 1},
+    {74454, 10, 1},
+    {44140, 21, 1},
+    {0, 0, 0},
+    {1200, 17, 1},
+    {104568, 14, 1},
+    {78074, 8, 1},
+    {25812, 5, 1},
+    {0, 0, 0},
+    {21242, 5, 1},
+    {72954, 10, 1},
+    {27419, 11, 1},
+    {0, 0, 0},
+    {2158, 10, 1},
+    {53857, 5, 1},
+    {0, 0, 0},
+    {72717, 10, 1},
+    {18202, 12, 1},
+    {31286, 6, 1},
+    {61657, 2, 1},
+    {0, 0, 0},
+    {75126, 18, 1},
+    {96720, 15, 1},
+    {79665, 2, 1},
+    {4480, 14, 1},
+    {110791, 8, 1},
+    {29123, 3, 1},
+    {41554, 14, 1},
+    {26393, 10, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {69108, 12, 1},
+    {68663, 6, 1},
+    {50178, 12, 2},
+    {94794, 5, 1},
+    {21931, 6, 1},
+    {31520, 12, 1},
+    {94888, 13, 1},
+    {732, 5, 1},
+    {22166, 6, 1},
+    {72065, 8, 1},
+    {53795, 13, 1},
+    {111542, 9, 1},
+    {17963, 24, 1},
+    {65059, 9, 1},
+    {23203, 11, 1},
+    {111724, 6, 1},
+    {0, 0, 0},
+    {101132, 24, 1},
+    {0, 0, 0},
+    {31510, 10, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {110873, 8, 1},
+    {74274, 7, 1},
+    {0, 0, 0},
+    {23031, 6, 1},
+    {12121, 10, 1},
+    {48056, 18, 1},
+    {9258, 11, 1},
+    {38485, 6, 1},
+    {38186, 6, 1},
+    {7679, 20, 1},
+    {62009, 6, 1},
+    {21813, 6, 1},
+    {112065, 9, 1},
+    {99305, 27, 1},
+    {12644, 6, 1},
+    {86737, 13, 1},
+    {77561, 18, 1},
+    {57116, 4, 1},
+    {3082, 5, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {6562, 10, 1},
+    {52286, 8, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {64220, 17, 1},
+    {80373, 22, 1},
+    {21997, 6, 1},
+    {82884, 9, 1},
+    {100661, 14, 1},
+    {0, 0, 0},
+    {99206, 16, 1},
+    {44645, 8, 1},
+    {65883, 16, 1},
+    {43728, 17, 1},
+    {5781, 7, 1},
+    {35342, 21, 1},
+    {74025, 6, 1},
+    {42991, 9, 1},
+    {69056, 12, 1},
+    {0, 0, 0},
+    {112143, 6, 1},
+    {64478, 7, 1},
+    {58077, 6, 1},
+    {0, 0, 0},
+    {78515, 14, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {53192, 9, 1},
+    {84339, 18, 2},
+    {99425, 17, 1},
+    {14868, 12, 1},
+    {99762, 11, 1},
+    {35070, 12, 1},
+    {24542, 16, 1},
+    {63969, 11, 1},
+    {26212, 11, 1},
+    {80988, 18, 1},
+    {14945, 11, 1},
+    {92857, 10, 1},
+    {0, 0, 0},
+    {16407, 6, 1},
+    {16167, 6, 1},
+    {109540, 9, 1},
+    {8509, 6, 1},
+    {0, 0, 0},
+    {68585, 6, 1},
+    {15879, 6, 1},
+    {14081, 13, 1},
+    {36939, 17, 1},
+    {83788, 13, 1},
+    {78832, 16, 1},
+    {62121, 6, 1},
+    {20502, 12, 1},
+    {38170, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {66324, 15, 1},
+    {92223, 14, 1},
+    {26137, 10, 1},
+    {72420, 7, 1},
+    {12727, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {83554, 9, 1},
+    {100818, 11, 1},
+    {70111, 10, 1},
+    {0, 0, 0},
+    {55309, 6, 1},
+    {51756, 6, 1},
+    {112493, 6, 1},
+    {25684, 11, 1},
+    {41964, 24, 1},
+    {8015, 9, 1},
+    {74858, 10, 1},
+    {83382, 14, 1},
+    {107405, 13, 1},
+    {12078, 10, 1},
+    {107471, 4, 1},
+    {62439, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {30084, 6, 1},
+    {0, 0, 0},
+    {30867, 6, 1},
+    {0, 0, 0},
+    {70738, 14, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {35510, 8, 1},
+    {51944, 17, 1},
+    {83344, 9, 1},
+    {19858, 15, 1},
+    {47536, 14, 1},
+    {87996, 5, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {2848, 12, 1},
+    {90877, 10, 1},
+    {0, 0, 0},
+    {5446, 7, 1},
+    {77471, 18, 1},
+    {111515, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {18009, 20, 1},
+    {9588, 11, 1},
+    {11174, 11, 1},
+    {0, 0, 0},
+    {78990, 2, 1},
+    {38999, 6, 1},
+    {151, 10, 1},
+    {8389, 9, 1},
+    {112275, 13, 1},
+    {96274, 35, 1},
+    {99452, 11, 1},
+    {87622, 21, 1},
+    {10116, 13, 1},
+    {54932, 15, 1},
+    {0, 0, 0},
+    {22553, 13, 1},
+    {36291, 15, 1},
+    {29390, 11, 1},
+    {0, 0, 0},
+    {32655, 16, 1},
+    {52869, 10, 1},
+    {67991, 6, 1},
+    {80461, 13, 1},
+    {77341, 5, 1},
+    {97284, 18, 1},
+    {108576, 5, 1},
+    {21494, 6, 1},
+    {107463, 3, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {15203, 5, 1},
+    {74017, 8, 1},
+    {79228, 18, 1},
+    {38192, 6, 1},
+    {97621, 17, 1},
+    {6737, 16, 1},
+    {61967, 6, 1},
+    {68537, 6, 1},
+    {72297, 6, 1},
+    {100391, 17, 1},
+    {0, 0, 0},
+    {105511, 15, 1},
+    {8461, 6, 1},
+    {111167, 12, 1},
+    {75071, 4, 1},
+    {109591, 12, 1},
+    {79952, 12, 1},
+    {56313, 18, 1},
+    {62832, 7, 1},
+    {68807, 15, 1},
+    {0, 0, 0},
+    {31813, 8, 1},
+    {28973, 13, 1},
+    {31310, 6, 1},
+    {69046, 10, 1},
+    {66366, 5, 1},
+    {0, 0, 0},
+    {15565, 5, 1},
+    {61139, 15, 1},
+    {91342, 11, 1},
+    {98319, 50, 1},
+    {68075, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {84827, 11, 1},
+    {44347, 20, 1},
+    {0, 0, 0},
+    {39628, 14, 1},
+    {0, 0, 0},
+    {21991, 6, 1},
+    {215, 13, 1},
+    {74928, 8, 1},
+    {54403, 9, 1},
+    {64586, 12, 1},
+    {11540, 16, 1},
+    {0, 0, 0},
+    {96489, 5, 1},
+    {72591, 8, 1},
+    {59057, 13, 1},
+    {31403, 7, 1},
+    {67565, 14, 1},
+    {93179, 12, 1},
+    {81735, 21, 1},
+    {0, 0, 0},
+    {1301, 10, 1},
+    {28736, 16, 1},
+    {12213, 8, 1},
+    {55303, 6, 1},
+    {0, 0, 0},
+    {27686, 6, 1},
+    {386, 4, 1},
+    {106567, 18, 1},
+    {22982, 17, 1},
+    {30374, 12, 1},
+    {84739, 7, 1},
+    {0, 0, 0},
+    {70513, 9, 1},
+    {95342, 7, 1},
+    {37905, 10, 1},
+    {83692, 12, 1},
+    {55993, 7, 1},
+    {0, 0, 0},
+    {31728, 7, 1},
+    {53305, 15, 1},
+    {50162, 2, 1},
+    {0, 0, 0},
+    {548, 4, 1},
+    {75914, 39, 1},
+    {22402, 6, 1},
+    {50626, 9, 1},
+    {30741, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {96499, 6, 1},
+    {65335, 10, 1},
+    {82969, 14, 1},
+    {101504, 17, 1},
+    {83889, 9, 1},
+    {34811, 8, 1},
+    {35272, 7, 1},
+    {21577, 5, 1},
+    {0, 0, 0},
+    {40789, 19, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {43513, 15, 1},
+    {88457, 18, 1},
+    {58122, 3, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {89396, 20, 1},
+    {102446, 12, 1},
+    {78636, 11, 1},
+    {39968, 17, 1},
+    {26477, 16, 1},
+    {30286, 6, 1},
+    {91642, 19, 1},
+    {104328, 16, 1},
+    {99734, 16, 1},
+    {71017, 10, 1},
+    {72689, 16, 1},
+    {107479, 13, 1},
+    {83529, 5, 1},
+    {76669, 37, 1},
+    {71902, 5, 1},
+    {0, 0, 0},
+    {92422, 18, 1},
+    {0, 0, 0},
+    {16689, 6, 1},
+    {0, 0, 0},
+    {69162, 14, 1},
+    {0, 0, 0},
+    {110117, 6, 1},
+    {0, 0, 0},
+    {95127, 16, 1},
+    {0, 0, 0},
+    {66825, 13, 1},
+    {68231, 6, 1},
+    {0, 0, 0},
+    {110553, 16, 1},
+    {15254, 5, 1},
+    {17626, 16, 1},
+    {52543, 9, 1},
+    {15378, 5, 1},
+    {41683, 4, 1},
+    {38622, 7, 1},
+    {99289, 16, 1},
+    {60871, 17, 1},
+    {40245, 11, 1},
+    {74734, 16, 1},
+    {65525, 15, 1},
+    {64420, 7, 1},
+    {0, 0, 0},
+    {85890, 13, 1},
+    {268, 7, 1},
+    {1269, 6, 1},
+    {86341, 9, 1},
+    {1999, 19, 1},
+    {275, 13, 1},
+    {19223, 10, 1},
+    {5387, 7, 1},
+    {40470, 17, 1},
+    {41536, 18, 1},
+    {17045, 15, 1},
+    {0, 0, 0},
+    {41014, 17, 1},
+    {0, 0, 0},
+    {935, 5, 1},
+    {95143, 18, 1},
+    {30849, 6, 1},
+    {10055, 3, 1},
+    {71559, 5, 1},
+    {23246, 14, 1},
+    {64351, 6, 1},
+    {15051, 2, 1},
+    {61356, 16, 1},
+    {15550, 5, 1},
+    {107295, 14, 1},
+    {16491, 6, 1},
+    {24457, 3, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {80798, 5, 1},
+    {27024, 10, 1},
+    {52534, 9, 1},
+    {108980, 15, 1},
+    {69398, 15, 1},
+    {22697, 11, 1},
+    {17248, 4, 1},
+    {41899, 2, 1},
+    {30825, 6, 1},
+    {90559, 5, 1},
+    {19495, 9, 1},
+    {0, 0, 0},
+    {73130, 5, 1},
+    {95196, 7, 1},
+    {12370, 8, 1},
+    {31972, 15, 1},
+    {97692, 19, 1},
+    {25176, 6, 1},
+    {72883, 10, 1},
+    {103178, 19, 1},
+    {39221, 2, 1},
+    {78702, 3, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {80586, 14, 1},
+    {88745, 7, 1},
+    {0, 0, 0},
+    {9203, 11, 1},
+    {42276, 5, 1},
+    {100478, 12, 1},
+    {0, 0, 0},
+    {82940, 4, 1},
+    {84322, 8, 1},
+    {87199, 17, 1},
+    {17274, 7, 1},
+    {0, 0, 0},
+    {6725, 12, 1},
+    {38241, 22, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {54386, 9, 1},
+    {49915, 4, 1},
+    {7591, 14, 1},
+    {34819, 18, 1},
+    {25649, 7, 1},
+    {93869, 17, 1},
+    {0, 0, 0},
+    {73418, 8, 1},
+    {26593, 12, 1},
+    {5159, 4, 1},
+    {52772, 22, 1},
+    {107600, 17, 1},
+    {52223, 10, 1},
+    {85260, 15, 1},
+    {62063, 6, 1},
+    {86018, 11, 1},
+    {78472, 8, 1},
+    {2493, 9, 1},
+    {42351, 15, 1},
+    {51574, 6, 1},
+    {68687, 6, 1},
+    {21759, 6, 1},
+    {23886, 33, 1},
+    {61614, 18, 1},
+    {0, 0, 0},
+    {28446, 30, 1},
+    {0, 0, 0},
+    {30138, 6, 1},
+    {0, 0, 0},
+    {62337, 6, 1},
+    {0, 0, 0},
+    {77914, 14, 1},
+    {96594, 6, 1},
+    {71319, 11, 1},
+    {0, 0, 0},
+    {40808, 20, 1},
+    {88960, 5, 1},
+    {98042, 15, 2},
+    {25206, 9, 1},
+    {84776, 22, 1},
+    {0, 0, 0},
+    {79864, 14, 1},
+    {5525, 17, 1},
+    {33588, 4, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {33327, 12, 1},
+    {19070, 8, 1},
+    {46455, 6, 1},
+    {30523, 15, 1},
+    {83295, 12, 1},
+    {44332, 15, 1},
+    {101918, 19, 1},
+    {45390, 6, 1},
+    {89026, 5, 1},
+    {34186, 25, 1},
+    {66339, 11, 1},
+    {88541, 11, 1},
+    {0, 0, 0},
+    {95003, 8, 1},
+    {36093, 11, 1},
+    {17060, 7, 1},
+    {40188, 21, 1},
+    {9720, 2, 1},
+    {78499, 16, 1},
+    {70937, 9, 1},
+    {13002, 7, 1},
+    {0, 0, 0},
+    {22903, 5, 1},
+    {68531, 6, 1},
+    {59859, 15, 1},
+    {0, 0, 0},
+    {20710, 12, 1},
+    {62325, 6, 1},
+    {103950, 14, 1},
+    {68267, 6, 1},
+    {52006, 4, 1},
+    {0, 0, 0},
+    {47220, 5, 1},
+    {0, 0, 0},
+    {91751, 11, 1},
+    {50884, 9, 1},
+    {77596, 17, 1},
+    {73226, 21, 1},
+    {16017, 6, 1},
+    {61564, 12, 1},
+    {79392, 6, 1},
+    {0, 0, 0},
+    {5163, 8, 1},
+    {45941, 17, 1},
+    {68033, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {77810, 14, 1},
+    {30013, 5, 1},
+    {74243, 8, 1},
+    {60972, 16, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {13936, 11, 1},
+    {77368, 9, 1},
+    {0, 0, 0},
+    {68327, 6, 1},
+    {68177, 6, 1},
+    {11056, 2, 1},
+    {8926, 14, 1},
+    {25927, 8, 1},
+    {72134, 5, 1},
+    {71179, 9, 1},
+    {1596, 12, 1},
+    {0, 0, 0},
+    {527, 3, 1},
+    {49282, 21, 1},
+    {35687, 12, 1},
+    {59822, 18, 1},
+    {0, 0, 0},
+    {68315, 6, 1},
+    {57960, 3, 1},
+    {9610, 11, 1},
+    {30699, 6, 1},
+    {37425, 14, 1},
+    {0, 0, 0},
+    {6010, 10, 1},
+    {92570, 5, 1},
+    {44086, 20, 1},
+    {54765, 17, 1},
+    {74872, 8, 1},
+    {24480, 6, 1},
+    {75066, 5, 1},
+    {80234, 14, 1},
+    {0, 0, 0},
+    {25638, 11, 1},
+    {89657, 14, 1},
+    {68381, 6, 1},
+    {21720, 3, 1},
+    {49820, 7, 1},
+    {61266, 8, 1},
+    {0, 0, 0},
+    {16623, 6, 1},
+    {41239, 7, 1},
+    {0, 4, 1},
+    {22238, 6, 1},
+    {78139, 14, 1},
+    {38643, 7, 1},
+    {2507, 9, 1},
+    {13925, 11, 1},
+    {37659, 20, 1},
+    {100312, 10, 1},
+    {64363, 6, 1},
+    {84758, 9, 1},
+    {0, 0, 0},
+    {85793, 11, 1},
+    {56860, 20, 1},
+    {12410, 8, 1},
+    {107418, 11, 1},
+    {38764, 11, 1},
+    {6602, 18, 1},
+    {56071, 12, 1},
+    {109848, 10, 1},
+    {39087, 7, 1},
+    {59666, 6, 1},
+    {7654, 16, 1},
+    {0, 0, 0},
+    {28599, 18, 1},
+    {102051, 9, 1},
+    {72248, 28, 1},
+    {90821, 13, 1},
+    {81991, 24, 1},
+    {59543, 11, 1},
+    {37017, 19, 1},
+    {8681, 4, 1},
+    {8545, 6, 1},
+    {74994, 5, 1},
+    {107585, 15, 1},
+    {10222, 18, 1},
+    {109694, 5, 1},
+    {23445, 5, 1},
+    {58094, 9, 1},
+    {83956, 4, 1},
+    {44067, 19, 1},
+    {5861, 16, 1},
+    {25852, 2, 1},
+    {72601, 9, 1},
+    {42383, 17, 1},
+    {74343, 4, 1},
+    {0, 0, 0},
+    {72510, 3, 1},
+    {0, 0, 0},
+    {61202, 11, 1},
+    {79753, 4, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {88287, 6, 1},
+    {0, 0, 0},
+    {72164, 7, 1},
+    {95309, 5, 1},
+    {50366, 12, 1},
+    {103099, 15, 1},
+    {0, 0, 0},
+    {55147, 6, 1},
+    {0, 0, 0},
+    {16969, 22, 1},
+    {19262, 6, 1},
+    {25660, 7, 1},
+    {38336, 11, 1},
+    {84213, 15, 1},
+    {29422, 8, 1},
+    {55351, 6, 1},
+    {84144, 21, 1},
+    {26781, 19, 1},
+    {0, 0, 0},
+    {7288, 15, 1},
+    {11653, 11, 1},
+    {0, 0, 0},
+    {29229, 6, 1},
+    {15147, 5, 1},
+    {94561, 13, 1},
+    {14517, 5, 1},
+    {66668, 8, 1},
+    {105541, 16, 1},
+    {0, 0, 0},
+    {62109, 6, 1},
+    {93421, 8, 1},
+    {72610, 5, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {17824, 5, 1},
+    {32320, 16, 1},
+    {13160, 13, 1},
+    {56988, 2, 1},
+    {0, 0, 0},
+    {67223, 15, 1},
+    {101542, 15, 1},
+    {0, 0, 0},
+    {33428, 3, 1},
+    {29933, 11, 1},
+    {56177, 11, 1},
+    {89074, 19, 1},
+    {53998, 3, 1},
+    {96309, 34, 1},
+    {0, 0, 0},
+    {36133, 21, 1},
+    {71524, 14, 1},
+    {112164, 6, 1},
+    {0, 0, 0},
+    {39277, 2, 1},
+    {67679, 5, 1},
+    {112266, 9, 1},
+    {77396, 6, 1},
+    {37574, 5, 1},
+    {73615, 8, 1},
+    {78724, 17, 1},
+    {91409, 20, 1},
+    {16551, 6, 1},
+    {0, 0, 0},
+    {56000, 13, 1},
+    {6430, 15, 1},
+    {107785, 18, 1},
+    {0, 0, 0},
+    {7619, 15, 1},
+    {0, 0, 0},
+    {17923, 11, 1},
+    {0, 0, 0},
+    {64944, 5, 1},
+    {10697, 2, 1},
+    {25726, 8, 1},
+    {0, 0, 0},
+    {87101, 19, 1},
+    {33538, 21, 1},
+    {796, 5, 1},
+    {109413, 6, 1},
+    {16864, 23, 2},
+    {0, 0, 0},
+    {67185, 13, 1},
+    {32709, 8, 1},
+    {96343, 34, 1},
+    {41820, 3, 1},
+    {110811, 6, 1},
+    {56044, 11, 1},
+    {0, 0, 0},
+    {59349, 15, 1},
+    {106247, 11, 1},
+    {34506, 20, 1},
+    {83284, 11, 1},
+    {103316, 11, 1},
+    {44429, 19, 1},
+    {15700, 11, 1},
+    {100984, 9, 1},
+    {8968, 14, 1},
+    {28476, 4, 1},
+    {0, 0, 0},
+    {112215, 9, 1},
+    {722, 5, 1},
+    {0, 0, 0},
+    {103801, 17, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {57274, 3, 1},
+    {0, 0, 0},
+    {16527, 6, 1},
+    {17913, 10, 1},
+    {0, 0, 0},
+    {112315, 13, 1},
+    {57768, 8, 1},
+    {100336, 11, 1},
+    {93630, 7, 1},
+    {26020, 5, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {77613, 17, 1},
+    {0, 0, 0},
+    {9925, 20, 1},
+    {0, 0, 0},
+    {12503, 8, 1},
+    {105168, 17, 1},
+    {93440, 6, 1},
+    {81299, 16, 1},
+    {44544, 19, 1},
+    {46877, 21, 1},
+    {0, 0, 0},
+    {79030, 5, 1},
+    {0, 0, 0},
+    {71944, 9, 1},
+    {28823, 5, 1},
+    {45610, 20, 1},
+    {10193, 12, 1},
+    {101909, 9, 1},
+    {0, 0, 0},
+    {4627, 6, 1},
+    {49751, 4, 1},
+    {9533, 11, 1},
+    {24058, 6, 1},
+    {67414, 14, 1},
+    {22586, 17, 1},
+    {61997, 6, 1},
+    {21831, 6, 1},
+    {48371, 15, 1},
+    {88653, 7, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {72303, 6, 1},
+    {0, 0, 0},
+    {18159, 2, 1},
+    {104488, 14, 1},
+    {557, 6, 1},
+    {94521, 17, 1},
+    {96028, 37, 1},
+    {21503, 6, 1},
+    {77579, 17, 1},
+    {4471, 9, 1},
+    {111056, 12, 1},
+    {0, 0, 0},
+    {54913, 19, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {67261, 6, 1},
+    {88339, 24, 1},
+    {27937, 16, 1},
+    {32127, 11, 1},
+    {86259, 14, 1},
+    {68027, 6, 1},
+    {38951, 6, 1},
+    {41752, 9, 1},
+    {67747, 13, 1},
+    {68255, 6, 1},
+    {26643, 18, 1},
+    {0, 0, 0},
+    {86334, 7, 1},
+    {0, 0, 0},
+    {15855, 15, 1},
+    {59787, 16, 1},
+    {0, 0, 0},
+    {61721, 3, 1},
+    {100020, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {42012, 13, 1},
+    {72452, 14, 1},
+    {11531, 3, 1},
+    {0, 0, 0},
+    {1949, 14, 1},
+    {82088, 24, 1},
+    {45817, 20, 1},
+    {31089, 6, 1},
+    {16095, 6, 1},
+    {96600, 13, 1},
+    {68855, 15, 1},
+    {66527, 7, 1},
+    {18966, 12, 1},
+    {8191, 18, 1},
+    {68896, 9, 1},
+    {101032, 21, 1},
+    {84012, 13, 1},
+    {61637, 3, 1},
+    {109212, 20, 1},
+    {0, 0, 0},
+    {46127, 15, 1},
+    {34118, 22, 1},
+    {0, 0, 0},
+    {43669, 20, 1},
+    {25143, 11, 1},
+    {42895, 9, 1},
+    {0, 0, 0},
+    {108797, 12, 1},
+    {112034, 9, 1},
+    {21837, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {60725, 7, 1},
+    {44675, 13, 1},
+    {97947, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {45498, 19, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {86467, 12, 1},
+    {69309, 19, 1},
+    {75286, 10, 1},
+    {53894, 8, 1},
+    {0, 0, 0},
+    {62643, 6, 1},
+    {74707, 5, 1},
+    {60596, 13, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {43054, 9, 1},
+    {53832, 11, 1},
+    {17834, 2, 1},
+    {86284, 10, 2},
+    {0, 0, 0},
+    {0, 0, 0},
+    {96494, 5, 1},
+    {9023, 15, 1},
+    {0, 0, 0},
+    {101193, 21, 1},
+    {53872, 9, 1},
+    {0, 0, 0},
+    {50006, 7, 1},
+    {112134, 9, 1},
+    {108388, 17, 1},
+    {25630, 8, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {1091, 14, 1},
+    {0, 0, 0},
+    {102406, 13, 1},
+    {17987, 22, 1},
+    {14987, 18, 1},
+    {65582, 24, 1},
+    {0, 0, 0},
+    {83168, 11, 1},
+    {60057, 15, 1},
+    {49963, 9, 1},
+    {71419, 16, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {30072, 6, 1},
+    {56975, 13, 1},
+    {18797, 2, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {34089, 29, 1},
+    {37453, 13, 1},
+    {67109, 17, 1},
+    {87064, 20, 1},
+    {30126, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {99584, 11, 1},
+    {49946, 17, 2},
+    {99699, 12, 1},
+    {77824, 16, 1},
+    {0, 0, 0},
+    {96714, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {41441, 14, 1},
+    {58224, 15, 1},
+    {31376, 6, 1},
+    {38499, 4, 1},
+    {100137, 11, 1},
+    {11872, 4, 1},
+    {15903, 6, 1},
+    {0, 0, 0},
+    {25750, 17, 1},
+    {52694, 16, 1},
+    {85679, 15, 1},
+    {0, 0, 0},
+    {63800, 16, 1},
+    {83072, 19, 1},
+    {0, 0, 0},
+    {62223, 6, 1},
+    {31961, 6, 1},
+    {8296, 6, 1},
+    {51181, 12, 1},
+    {57277, 15, 1},
+    {66305, 7, 1},
+    {79831, 6, 1},
+    {5767, 14, 1},
+    {99836, 5, 1},
+    {53734, 18, 1},
+    {44845, 10, 1},
+    {0, 0, 0},
+    {77947, 4, 1},
+    {45869, 18, 1},
+    {82112, 18, 1},
+    {0, 0, 0},
+    {95235, 6, 1},
+    {25656, 4, 1},
+    {43063, 9, 1},
+    {8713, 7, 1},
+    {18949, 6, 1},
+    {93772, 15, 1},
+    {44384, 11, 1},
+    {34548, 24, 1},
+    {4443, 8, 1},
+    {87287, 18, 1},
+    {60540, 18, 1},
+    {83811, 8, 1},
+    {87407, 18, 1},
+    {0, 0, 0},
+    {16311, 6, 1},
+    {93990, 30, 1},
+    {64268, 7, 1},
+    {18197, 5, 1},
+    {19752, 14, 1},
+    {67760, 18, 1},
+    {0, 0, 0},
+    {101954, 21, 1},
+    {0, 0, 0},
+    {71602, 11, 1},
+    {92610, 5, 1},
+    {58362, 11, 1},
+    {0, 0, 0},
+    {56654, 15, 1},
+    {96841, 4, 1},
+    {61642, 5, 1},
+    {34063, 26, 1},
+    {27287, 11, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {11299, 2, 1},
+    {68189, 6, 1},
+    {36740, 4, 1},
+    {44469, 20, 1},
+    {0, 0, 0},
+    {12154, 9, 1},
+    {0, 0, 0},
+    {32593, 19, 1},
+    {32081, 5, 1},
+    {74673, 9, 1},
+    {89892, 15, 1},
+    {110006, 4, 1},
+    {0, 0, 0},
+    {55718, 24, 1},
+    {103711, 19, 1},
+    {97905, 6, 1},
+    {110154, 13, 1},
+    {4593, 6, 1},
+    {83179, 8, 1},
+    {21126, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {16035, 6, 1},
+    {33475, 13, 1},
+    {60815, 17, 1},
+    {49789, 6, 1},
+    {21979, 6, 1},
+    {72055, 10, 1},
+    {59454, 16, 1},
+    {20672, 14, 1},
+    {63487, 21, 1},
+    {47086, 14, 1},
+    {30156, 6, 1},
+    {78062, 12, 1},
+    {28480, 15, 1},
+    {15981, 6, 1},
+    {25807, 5, 1},
+    {38559, 7, 1},
+    {55984, 9, 1},
+    {0, 0, 0},
+    {68705, 7, 1},
+    {33955, 18, 1},
+    {46541, 13, 1},
+    {0, 0, 0},
+    {30067, 5, 1},
+    {0, 0, 0},
+    {50848, 9, 1},
+    {61512, 26, 1},
+    {83988, 16, 1},
+    {93446, 10, 1},
+    {26673, 13, 1},
+    {17351, 17, 1},
+    {106777, 22, 1},
+    {74281, 5, 1},
+    {20376, 12, 1},
+    {111766, 6, 1},
+    {60558, 8, 1},
+    {0, 0, 0},
+    {83475, 6, 1},
+    {9841, 10, 1},
+    {53201, 7, 1},
+    {13960, 15, 1},
+    {95483, 9, 1},
+    {12447, 8, 1},
+    {24954, 2, 1},
+    {91429, 18, 1},
+    {8281, 3, 1},
+    {32098, 10, 1},
+    {24883, 12, 1},
+    {68411, 6, 1},
+    {57795, 20, 1},
+    {0, 0, 0},
+    {109728, 2, 1},
+    {5594, 6, 1},
+    {37000, 17, 1},
+    {10878, 9, 1},
+    {33878, 15, 1},
+    {2325, 4, 1},
+    {7518, 4, 1},
+    {68405, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {83433, 10, 1},
+    {63826, 11, 1},
+    {20547, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {58177, 16, 1},
+    {79654, 11, 1},
+    {0, 0, 0},
+    {101309, 18, 1},
+    {0, 0, 0},
+    {8239, 13, 1},
+    {47199, 10, 1},
+    {42799, 9, 1},
+    {60011, 16, 1},
+    {0, 0, 0},
+    {4451, 10, 1},
+    {0, 0, 0},
+    {79606, 4, 1},
+    {10722, 5, 1},
+    {64572, 14, 1},
+    {0, 0, 0},
+    {31549, 10, 1},
+    {105661, 15, 1},
+    {0, 0, 0},
+    {24895, 6, 1},
+    {0, 0, 0},
+    {17288, 7, 1},
+    {55117, 6, 1},
+    {4116, 12, 1},
+    {47239, 19, 1},
+    {0, 0, 0},
+    {6318, 9, 1},
+    {0, 0, 0},
+    {42474, 15, 1},
+    {84545, 2, 1},
+    {78705, 19, 1},
+    {3087, 14, 1},
+    {111988, 6, 1},
+    {30424, 16, 1},
+    {77346, 8, 1},
+    {47506, 18, 1},
+    {58605, 11, 1},
+    {61694, 12, 1},
+    {70867, 11, 1},
+    {0, 0, 0},
+    {33435, 8, 1},
+    {8685, 7, 1},
+    {69638, 6, 1},
+    {0, 0, 0},
+    {43599, 18, 1},
+    {0, 0, 0},
+    {42187, 14, 1},
+    {1562, 8, 1},
+    {66350, 16, 1},
+    {43009, 9, 1},
+    {0, 0, 0},
+    {72736, 6, 1},
+    {84308, 6, 1},
+    {12205, 8, 1},
+    {104437, 16, 1},
+    {27815, 16, 1},
+    {73466, 11, 1},
+    {33078, 25, 1},
+    {23620, 6, 1},
+    {104513, 11, 1},
+    {0, 0, 0},
+    {48507, 22, 1},
+    {99624, 10, 1},
+    {25277, 4, 1},
+    {75588, 26, 1},
+    {72556, 2, 1},
+    {39297, 16, 1},
+    {0, 0, 0},
+    {14327, 19, 1},
+    {0, 0, 0},
+    {56896, 15, 1},
+    {38778, 12, 1},
+    {8467, 6, 1},
+    {72386, 4, 1},
+    {112043, 9, 1},
+    {99109, 7, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {39843, 14, 1},
+    {74659, 9, 1},
+    {0, 0, 0},
+    {31583, 5, 1},
+    {52394, 9, 1},
+    {228, 13, 1},
+    {15939, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {989, 9, 1},
+    {76454, 16, 1},
+    {108565, 9, 1},
+    {88896, 8, 1},
+    {12471, 8, 1},
+    {63289, 5, 1},
+    {0, 0, 0},
+    {97316, 4, 1},
+    {67360, 21, 1},
+    {30681, 6, 1},
+    {110831, 6, 1},
+    {5058, 11, 1},
+    {83232, 8, 1},
+    {43162, 9, 1},
+    {46256, 15, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {7225, 10, 1},
+    {24274, 6, 1},
+    {43397, 16, 1},
+    {0, 0, 0},
+    {75702, 26, 1},
+    {0, 0, 0},
+    {109603, 11, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {15244, 5, 1},
+    {51193, 12, 1},
+    {58899, 12, 1},
+    {0, 0, 0},
+    {5380, 7, 1},
+    {78299, 15, 1},
+    {57438, 15, 1},
+    {47336, 14, 1},
+    {58009, 5, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {108511, 15, 1},
+    {0, 0, 0},
+    {91843, 14, 1},
+    {57847, 7, 1},
+    {86029, 14, 2},
+    {31083, 6, 1},
+    {57728, 21, 1},
+    {98515, 48, 1},
+    {26301, 28, 1},
+    {0, 0, 0},
+    {65035, 5, 1},
+    {29748, 10, 1},
+    {50509, 5, 1},
+    {0, 0, 0},
+    {96065, 37, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {93554, 17, 1},
+    {97941, 6, 1},
+    {49471, 13, 1},
+    {22148, 6, 1},
+    {0, 0, 0},
+    {28515, 18, 1},
+    {70820, 16, 1},
+    {11664, 13, 1},
+    {0, 0, 0},
+    {82667, 7, 1},
+    {17031, 7, 1},
+    {34889, 17, 1},
+    {3134, 9, 1},
+    {26628, 15, 1},
+    {89222, 15, 1},
+    {0, 0, 0},
+    {63372, 14, 1},
+    {476, 17, 1},
+    {26605, 12, 1},
+    {17394, 36, 1},
+    {0, 0, 0},
+    {66478, 18, 1},
+    {71998, 18, 1},
+    {35794, 9, 1},
+    {101063, 10, 1},
+    {0, 0, 0},
+    {94864, 10, 1},
+    {108280, 14, 1},
+    {71052, 3, 1},
+    {42090, 15, 1},
+    {18877, 9, 1},
+    {103730, 18, 1},
+    {50446, 8, 1},
+    {65074, 3, 1},
+    {55674, 22, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {31766, 8, 1},
+    {85657, 7, 1},
+    {60254, 16, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {75085, 9, 1},
+    {19504, 9, 1},
+    {0, 0, 0},
+    {94690, 11, 1},
+    {72209, 7, 1},
+    {27188, 11, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {18767, 8, 1},
+    {34572, 22, 1},
+    {83645, 2, 1},
+    {40368, 12, 1},
+    {60690, 7, 1},
+    {1657, 5, 1},
+    {0, 0, 0},
+    {92480, 5, 1},
+    {14064, 17, 1},
+    {62637, 6, 1},
+    {0, 0, 0},
+    {78848, 11, 1},
+    {80335, 12, 1},
+    {61538, 15, 1},
+    {100301, 11, 1},
+    {0, 0, 0},
+    {38748, 7, 1},
+    {58822, 11, 1},
+    {0, 0, 0},
+    {53694, 20, 1},
+    {62133, 6, 1},
+    {88233, 11, 1},
+    {0, 0, 0},
+    {11274, 11, 1},
+    {75107, 5, 1},
+    {111781, 9, 1},
+    {24396, 6, 1},
+    {38445, 10, 1},
+    {22009, 6, 1},
+    {90942, 18, 1},
+    {93903, 17, 1},
+    {61979, 6, 1},
+    {21173, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {61913, 6, 1},
+    {26232, 6, 1},
+    {30675, 6, 1},
+    {0, 0, 0},
+    {30705, 6, 1},
+    {88318, 10, 1},
+    {40118, 17, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {23192, 11, 1},
+    {0, 0, 0},
+    {63213, 15, 1},
+    {0, 0, 0},
+    {90845, 11, 2},
+    {71457, 9, 1},
+    {13447, 19, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {29471, 12, 1},
+    {89806, 11, 1},
+    {48401, 13, 1},
+    {9158, 15, 1},
+    {59236, 15, 1},
+    {2415, 13, 1},
+    {6393, 4, 1},
+    {15474, 5, 1},
+    {16467, 6, 1},
+    {11358, 16, 1},
+    {109321, 18, 1},
+    {109164, 17, 1},
+    {15233, 11, 1},
+    {99854, 3, 1},
+    {99758, 4, 1},
+    {56083, 19, 1},
+    {71884, 9, 1},
+    {58631, 18, 1},
+    {45997, 8, 1},
+    {38326, 10, 1},
+    {109650, 4, 1},
+    {38198, 6, 1},
+    {39655, 20, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {25985, 11, 1},
+    {79316, 18, 1},
+    {110855, 18, 1},
+    {68285, 6, 1},
+    {12131, 8, 1},
+    {161, 13, 1},
+    {36460, 11, 1},
+    {15927, 6, 1},
+    {9884, 14, 1},
+    {69486, 19, 1},
+    {68375, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {81897, 17, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {55231, 6, 1},
+    {106542, 25, 1},
+    {10386, 10, 1},
+    {89472, 21, 1},
+    {1011, 27, 1},
+    {44663, 12, 1},
+    {73078, 4, 1},
+    {22136, 6, 1},
+    {97104, 10, 1},
+    {74631, 9, 1},
+    {49795, 12, 1},
+    {0, 0, 0},
+    {37155, 5, 1},
+    {59744, 17, 1},
+    {23505, 4, 1},
+    {16287, 6, 1},
+    {64972, 2, 1},
+    {68513, 6, 1},
+    {0, 0, 0},
+    {46271, 16, 1},
+    {89156, 15, 1},
+    {105054, 22, 1},
+    {66134, 15, 1},
+    {0, 0, 0},
+    {762, 5, 1},
+    {0, 0, 0},
+    {12927, 9, 1},
+    {0, 0, 0},
+    {51693, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {45935, 4, 1},
+    {0, 0, 0},
+    {59961, 19, 1},
+    {30120, 6, 1},
+    {31410, 2, 1},
+    {0, 0, 0},
+    {81862, 21, 1},
+    {68159, 6, 1},
+    {65208, 5, 1},
+    {44515, 15, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {46993, 25, 1},
+    {32803, 13, 1},
+    {106900, 23, 1},
+    {97220, 6, 1},
+    {0, 0, 0},
+    {73256, 14, 1},
+    {0, 0, 0},
+    {20514, 11, 1},
+    {4633, 6, 1},
+    {49708, 16, 1},
+    {87843, 6, 1},
+    {12253, 8, 1},
+    {0, 0, 0},
+    {25478, 4, 1},
+    {99138, 11, 1},
+    {1615, 7, 1},
+    {86534, 21, 1},
+    {0, 0, 0},
+    {78419, 15, 1},
+    {18270, 4, 1},
+    {8043, 2, 1},
+    {103865, 16, 1},
+    {3404, 9, 1},
+    {24327, 10, 1},
+    {22914, 12, 1},
+    {47701, 9, 1},
+    {80907, 17, 1},
+    {48723, 13, 1},
+    {66289, 16, 1},
+    {17730, 7, 1},
+    {15763, 7, 1},
+    {27595, 11, 1},
+    {87986, 10, 1},
+    {94469, 16, 1},
+    {85727, 7, 1},
+    {54457, 10, 1},
+    {67853, 6, 1},
+    {63273, 11, 1},
+    {8832, 11, 1},
+    {0, 0, 0},
+    {53948, 5, 1},
+    {9008, 15, 1},
+    {50529, 5, 1},
+    {0, 0, 0},
+    {6030, 9, 1},
+    {46078, 2, 2},
+    {79785, 9, 1},
+    {97999, 10, 1},
+    {0, 0, 0},
+    {42550, 3, 1},
+    {23791, 8, 1},
+    {0, 0, 0},
+    {55867, 23, 1},
+    {37939, 5, 1},
+    {2540, 12, 1},
+    {29665, 21, 1},
+    {8029, 2, 1},
+    {70961, 6, 1},
+    {91544, 21, 1},
+    {74497, 12, 1},
+    {55123, 6, 1},
+    {38517, 7, 1},
+    {0, 0, 0},
+    {24445, 12, 1},
+    {73732, 14, 1},
+    {79592, 14, 1},
+    {90031, 10, 1},
+    {46603, 14, 1},
+    {18532, 16, 1},
+    {70694, 5, 1},
+    {3049, 15, 1},
+    {0, 0, 0},
+    {89139, 17, 1},
+    {0, 0, 0},
+    {23459, 14, 1},
+    {68003, 6, 1},
+    {0, 0, 0},
+    {1545, 11, 1},
+    {100071, 7, 1},
+    {0, 0, 0},
+    {96635, 6, 1},
+    {69011, 10, 1},
+    {0, 0, 0},
+    {92189, 17, 1},
+    {38128, 23, 1},
+    {59996, 15, 1},
+    {16695, 6, 1},
+    {58596, 9, 1},
+    {67267, 13, 1},
+    {62734, 7, 1},
+    {95241, 11, 1},
+    {72351, 16, 1},
+    {0, 0, 0},
+    {47400, 17, 1},
+    {29355, 14, 1},
+    {20743, 8, 1},
+    {53147, 15, 1},
+    {0, 0, 0},
+    {91371, 17, 1},
+    {0, 0, 0},
+    {92311, 19, 1},
+    {101783, 27, 1},
+    {90638, 12, 1},
+    {77309, 5, 1},
+    {60904, 18, 1},
+    {4742, 11, 1},
+    {62505, 6, 1},
+    {18460, 9, 1},
+    {84105, 8, 1},
+    {79837, 10, 1},
+    {0, 0, 0},
+    {46461, 6, 1},
+    {99540, 15, 1},
+    {85001, 7, 2},
+    {14708, 15, 1},
+    {80214, 5, 1},
+    {6355, 2, 1},
+    {65236, 10, 1},
+    {24014, 6, 1},
+    {33905, 18, 1},
+    {46782, 17, 1},
+    {96878, 14, 1},
+    {30331, 6, 1},
+    {71975, 5, 1},
+    {46080, 5, 1},
+    {11387, 6, 1},
+    {51037, 4, 1},
+    {85578, 13, 1},
+    {112288, 9, 1},
+    {69659, 16, 1},
+    {0, 0, 0},
+    {63614, 21, 1},
+    {5650, 2, 1},
+    {0, 0, 0},
+    {3143, 16, 1},
+    {1151, 15, 1},
+    {103881, 18, 1},
+    {69831, 5, 1},
+    {31206, 6, 1},
+    {15193, 5, 1},
+    {49757, 12, 1},
+    {93398, 8, 1},
+    {74436, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {60270, 17, 1},
+    {70902, 15, 1},
+    {0, 0, 0},
+    {98032, 10, 1},
+    {107252, 16, 1},
+    {92699, 9, 1},
+    {64851, 6, 1},
+    {0, 0, 0},
+    {70957, 4, 1},
+    {95334, 8, 1},
+    {0, 0, 0},
+    {38412, 10, 1},
+    {14001, 17, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {58547, 23, 1},
+    {109987, 4, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {48242, 4, 1},
+    {9346, 11, 1},
+    {111318, 28, 1},
+    {22220, 6, 1},
+    {38939, 6, 1},
+    {80180, 16, 1},
+    {106708, 13, 1},
+    {0, 0, 0},
+    {16179, 6, 1},
+    {80706, 13, 1},
+    {0, 0, 0},
+    {23052, 11, 1},
+    {54530, 12, 1},
+    {9769, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {56708, 13, 1},
+    {0, 0, 0},
+    {25880, 12, 1},
+    {16557, 6, 1},
+    {59010, 12, 1},
+    {55273, 6, 1},
+    {39675, 15, 1},
+    {109052, 18, 1},
+    {112095, 6, 1},
+    {50208, 5, 1},
+    {94245, 22, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {17038, 7, 1},
+    {13215, 11, 1},
+    {0, 0, 0},
+    {78026, 15, 1},
+    {15419, 5, 1},
+    {31334, 6, 1},
+    {85853, 19, 1},
+    {79048, 19, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {21452, 17, 1},
+    {23450, 9, 1},
+    {62157, 6, 1},
+    {63467, 20, 1},
+    {47258, 15, 1},
+    {21648, 12, 1},
+    {77775, 15, 1},
+    {33007, 15, 1},
+    {109483, 13, 1},
+    {105818, 11, 1},
+    {53066, 3, 1},
+    {0, 0, 0},
+    {60477, 24, 1},
+    {5800, 13, 1},
+    {10432, 14, 1},
+    {87445, 21, 1},
+    {49263, 19, 1},
+    {51124, 14, 1},
+    {57134, 7, 1},
+    {37756, 10, 1},
+    {52923, 9, 1},
+    {37140, 5, 1},
+    {0, 0, 0},
+    {88229, 4, 1},
+    {40154, 16, 1},
+    {38790, 23, 1},
+    {85136, 9, 2},
+    {63257, 16, 1},
+    {0, 0, 0},
+    {62912, 3, 1},
+    {64628, 19, 1},
+    {95282, 9, 1},
+    {101451, 15, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {15484, 8, 1},
+    {0, 0, 0},
+    {25296, 10, 2},
+    {83091, 15, 1},
+    {25854, 9, 1},
+    {59583, 10, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {111377, 9, 1},
+    {104927, 17, 1},
+    {35110, 15, 1},
+    {24655, 18, 1},
+    {21807, 6, 1},
+    {61985, 6, 1},
+    {58054, 9, 1},
+    {1877, 13, 1},
+    {0, 0, 0},
+    {61632, 5, 1},
+    {6836, 12, 2},
+    {0, 0, 0},
+    {0, 0, 0},
+    {15975, 6, 1},
+    {70325, 8, 1},
+    {90621, 17, 1},
+    {0, 0, 0},
+    {41810, 10, 1},
+    {14150, 7, 1},
+    {28495, 10, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {58085, 9, 1},
+    {62229, 6, 1},
+    {91157, 21, 1},
+    {0, 0, 0},
+    {4857, 12, 1},
+    {50686, 9, 1},
+    {54503, 11, 1},
+    {110471, 14, 1},
+    {107268, 17, 1},
+    {94901, 13, 1},
+    {45733, 17, 1},
+    {20751, 12, 1},
+    {72813, 13, 1},
+    {79894, 17, 1},
+    {28843, 7, 1},
+    {0, 0, 0},
+    {31645, 8, 1},
+    {15343, 5, 1},
+    {63101, 16, 1},
+    {93279, 13, 1},
+    {0, 0, 0},
+    {109549, 4, 1},
+    {101874, 10, 1},
+    {67778, 3, 1},
+    {92595, 5, 1},
+    {22396, 6, 1},
+    {54514, 16, 1},
+    {5233, 8, 1},
+    {38713, 7, 1},
+    {27540, 11, 1},
+    {0, 0, 0},
+    {42826, 9, 1},
+    {74369, 14, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {38855, 9, 1},
+    {2892, 19, 1},
+    {0, 0, 0},
+    {104844, 24, 1},
+    {4494, 17, 1},
+    {51870, 6, 1},
+    {95678, 6, 1},
+    {0, 0, 0},
+    {25524, 8, 1},
+    {18441, 14, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {30185, 12, 1},
+    {62379, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {38305, 21, 1},
+    {22184, 6, 1},
+    {105861, 18, 1},
+    {36760, 13, 1},
+    {8659, 11, 1},
+    {45093, 13, 1},
+    {103979, 15, 1},
+    {56771, 20, 1},
+    {0, 0, 0},
+    {95388, 6, 1},
+    {23716, 6, 1},
+    {77432, 17, 1},
+    {97511, 16, 1},
+    {69582, 15, 1},
+    {105647, 14, 1},
+    {94710, 16, 1},
+    {5141, 18, 1},
+    {36333, 7, 1},
+    {59515, 15, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {5894, 4, 1},
+    {31953, 8, 1},
+    {24009, 5, 1},
+    {42672, 18, 1},
+    {88630, 2, 1},
+    {72427, 14, 1},
+    {36732, 4, 1},
+    {73063, 4, 1},
+    {83334, 10, 1},
+    {3353, 22, 1},
+    {530, 7, 1},
+    {39549, 15, 1},
+    {0, 0, 0},
+    {104887, 9, 1},
+    {0, 0, 0},
+    {48180, 16, 1},
+    {68141, 6, 1},
+    {0, 0, 0},
+    {16089, 6, 1},
+    {7491, 7, 1},
+    {45971, 20, 1},
+    {0, 0, 0},
+    {30933, 6, 1},
+    {99019, 45, 1},
+    {56822, 20, 1},
+    {99380, 20, 1},
+    {0, 0, 0},
+    {110990, 15, 1},
+    {62181, 6, 1},
+    {46640, 15, 1},
+    {0, 0, 0},
+    {52721, 7, 1},
+    {26542, 4, 1},
+    {58519, 9, 1},
+    {0, 0, 0},
+    {47785, 15, 1},
+    {78097, 20, 1},
+    {89314, 17, 1},
+    {31340, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {20564, 11, 1},
+    {24594, 15, 1},
+    {1977, 22, 1},
+    {73406, 6, 1},
+    {36436, 5, 1},
+    {49735, 12, 1},
+    {108460, 17, 1},
+    {24733, 6, 1},
+    {45887, 18, 1},
+    {0, 0, 0},
+    {100706, 10, 1},
+    {93302, 8, 1},
+    {27243, 11, 1},
+    {37483, 15, 1},
+    {0, 0, 0},
+    {73962, 6, 1},
+    {92867, 12, 2},
+    {8996, 12, 1},
+    {41219, 10, 1},
+    {18238, 9, 1},
+    {46681, 13, 1},
+    {14266, 16, 4},
+    {82525, 20, 1},
+    {4334, 16, 1},
+    {0, 0, 0},
+    {21191, 8, 1},
+    {80052, 10, 1},
+    {82722, 14, 1},
+    {7522, 5, 1},
+    {109955, 17, 1},
+    {83534, 8, 1},
+    {33760, 24, 1},
+    {78759, 19, 1},
+    {71701, 12, 1},
+    {36736, 4, 1},
+    {6063, 3, 1},
+    {15897, 6, 1},
+    {35723, 15, 1},
+    {111805, 9, 1},
+    {72860, 18, 1},
+    {0, 0, 0},
+    {92065, 17, 1},
+    {103762, 18, 1},
+    {80021, 10, 1},
+    {93689, 17, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {15683, 5, 1},
+    {36956, 17, 1},
+    {77201, 19, 1},
+    {22720, 16, 1},
+    {9654, 11, 1},
+    {6132, 14, 1},
+    {53421, 15, 1},
+    {0, 0, 0},
+    {752, 5, 1},
+    {58297, 10, 1},
+    {0, 0, 0},
+    {5707, 8, 1},
+    {18236, 2, 1},
+    {5949, 11, 1},
+    {0, 0, 0},
+    {40942, 2, 1},
+    {88223, 6, 1},
+    {88647, 6, 1},
+    {111994, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {12055, 14, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {95634, 15, 1},
+    {0, 0, 0},
+    {92639, 3, 1},
+    {82480, 14, 1},
+    {7139, 10, 1},
+    {0, 0, 0},
+    {72996, 6, 1},
+    {29710, 6, 1},
+    {51456, 5, 1},
+    {19150, 8, 1},
+    {36494, 6, 1},
+    {0, 0, 0},
+    {68063, 6, 1},
+    {0, 0, 0},
+    {30150, 6, 1},
+    {0, 0, 0},
+    {53105, 14, 1},
+    {0, 0, 0},
+    {60566, 10, 1},
+    {0, 0, 0},
+    {75112, 2, 1},
+    {57836, 11, 1},
+    {17870, 21, 1},
+    {1390, 11, 1},
+    {0, 0, 0},
+    {64237, 15, 1},
+    {82262, 19, 1},
+    {71246, 13, 1},
+    {72171, 7, 1},
+    {13594, 19, 1},
+    {35944, 12, 1},
+    {78651, 18, 1},
+    {0, 0, 0},
+    {28815, 6, 1},
+    {15652, 10, 1},
+    {451, 4, 1},
+    {80785, 13, 1},
+    {71384, 10, 1},
+    {16533, 6, 1},
+    {53177, 9, 1},
+    {11439, 11, 1},
+    {0, 0, 0},
+    {6494, 14, 1},
+    {94148, 5, 1},
+    {36078, 15, 1},
+    {84810, 17, 1},
+    {109104, 17, 1},
+    {94134, 9, 1},
+    {51152, 12, 1},
+    {59251, 15, 1},
+    {99811, 10, 1},
+    {89992, 6, 1},
+    {33218, 13, 1},
+    {52532, 2, 1},
+    {0, 0, 0},
+    {68303, 6, 1},
+    {0, 0, 0},
+    {101402, 17, 1},
+    {62409, 6, 1},
+    {69946, 9, 1},
+    {0, 0, 0},
+    {32816, 15, 1},
+    {94485, 14, 1},
+    {81046, 18, 1},
+    {35783, 11, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {104225, 18, 1},
+    {57024, 3, 1},
+    {0, 0, 0},
+    {42574, 2, 1},
+    {57654, 16, 1},
+    {80809, 6, 1},
+    {39048, 13, 1},
+    {25802, 5, 1},
+    {80412, 12, 1},
+    {94546, 15, 1},
+    {70857, 5, 1},
+    {72623, 23, 1},
+    {61019, 15, 1},
+    {0, 0, 0},
+    {15026, 9, 1},
+    {0, 0, 0},
+    {34601, 12, 1},
+    {39225, 11, 1},
+    {110089, 15, 1},
+    {23021, 10, 1},
+    {0, 0, 0},
+    {110233, 6, 1},
+    {25281, 15, 1},
+    {0, 0, 0},
+    {62667, 6, 1},
+    {45673, 21, 1},
+    {59500, 15, 1},
+    {71198, 18, 1},
+    {66462, 16, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {90666, 9, 1},
+    {70967, 8, 1},
+    {0, 0, 0},
+    {23084, 19, 1},
+    {18354, 16, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {96818, 10, 1},
+    {39402, 19, 1},
+    {52524, 4, 1},
+    {0, 0, 0},
+    {33497, 9, 1},
+    {0, 0, 0},
+    {107569, 16, 1},
+    {69633, 5, 1},
+    {16744, 20, 1},
+    {66534, 10, 1},
+    {7351, 15, 1},
+    {3173, 5, 1},
+    {0, 0, 0},
+    {20928, 15, 1},
+    {35237, 23, 1},
+    {82449, 15, 1},
+    {85502, 14, 1},
+    {74640, 9, 1},
+    {63816, 10, 1},
+    {62349, 6, 1},
+    {35319, 23, 1},
+    {25016, 12, 1},
+    {52294, 7, 1},
+    {41389, 18, 1},
+    {61664, 5, 1},
+    {90893, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {45544, 13, 1},
+    {73901, 11, 1},
+    {18574, 14, 1},
+    {0, 0, 0},
+    {46071, 2, 1},
+    {85648, 9, 1},
+    {62814, 14, 1},
+    {73015, 5, 1},
+    {5187, 10, 1},
+    {0, 0, 0},
+    {39808, 17, 1},
+    {0, 0, 0},
+    {80395, 17, 1},
+    {95053, 15, 1},
+    {6237, 16, 1},
+    {0, 0, 0},
+    {52301, 8, 1},
+    {40515, 9, 1},
+    {87158, 20, 1},
+    {53288, 17, 1},
+    {22999, 16, 1},
+    {13988, 13, 1},
+    {50974, 9, 1},
+    {69002, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {72564, 6, 1},
+    {73202, 24, 1},
+    {79246, 12, 1},
+    {38720, 7, 1},
+    {72101, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {65459, 19, 1},
+    {86184, 6, 1},
+    {0, 0, 0},
+    {77163, 19, 1},
+    {0, 0, 0},
+    {52096, 2, 1},
+    {23743, 20, 1},
+    {86051, 10, 1},
+    {92454, 7, 1},
+    {0, 0, 0},
+    {27441, 11, 1},
+    {0, 0, 0},
+    {71912, 5, 1},
+    {87690, 22, 1},
+    {103524, 17, 1},
+    {87580, 13, 1},
+    {0, 0, 0},
+    {5359, 7, 1},
+    {65741, 6, 1},
+    {0, 0, 0},
+    {67883, 6, 1},
+    {29065, 2, 1},
+    {85626, 15, 1},
+    {71685, 12, 1},
+    {0, 0, 0},
+    {56446, 15, 1},
+    {75533, 29, 1},
+    {0, 0, 0},
+    {83656, 5, 1},
+    {10620, 15, 1},
+    {97677, 15, 1},
+    {100540, 14, 1},
+    {24154, 14, 1},
+    {108089, 18, 1},
+    {109777, 12, 1},
+    {6001, 9, 1},
+    {0, 0, 0},
+    {5672, 7, 1},
+    {96892, 14, 1},
+    {10961, 8, 1},
+    {0, 0, 0},
+    {42425, 12, 1},
+    {96828, 4, 1},
+    {89830, 17, 1},
+    {77266, 2, 1},
+    {104418, 19, 1},
+    {39602, 13, 1},
+    {109995, 11, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {86133, 10, 1},
+    {6106, 11, 1},
+    {32115, 12, 1},
+    {32914, 14, 1},
+    {79045, 3, 1},
+    {64990, 5, 1},
+    {59874, 19, 1},
+    {0, 0, 0},
+    {86143, 13, 1},
+    {25456, 7, 1},
+    {69644, 15, 1},
+    {82514, 11, 1},
+    {0, 0, 0},
+    {29147, 16, 1},
+    {43204, 6, 1},
+    {0, 0, 0},
+    {35518, 9, 1},
+    {58587, 9, 1},
+    {24223, 13, 1},
+    {9456, 11, 1},
+    {73956, 6, 1},
+    {57749, 19, 1},
+    {18614, 14, 1},
+    {88729, 12, 1},
+    {31893, 8, 1},
+    {47491, 15, 1},
+    {83946, 10, 1},
+    {57148, 7, 1},
+    {34755, 15, 1},
+    {361, 4, 1},
+    {31005, 6, 1},
+    {22408, 6, 1},
+    {42153, 11, 1},
+    {26008, 4, 1},
+    {16810, 17, 1},
+    {47662, 10, 1},
+    {20153, 15, 1},
+    {35825, 13, 1},
+    {24315, 12, 1},
+    {65870, 13, 1},
+    {5829, 12, 1},
+    {111101, 18, 1},
+    {68912, 17, 1},
+    {85228, 8, 1},
+    {61049, 17, 1},
+    {32542, 18, 1},
+    {27221, 11, 1},
+    {58649, 6, 1},
+    {56490, 15, 1},
+    {25892, 10, 1},
+    {25905, 4, 1},
+    {59686, 17, 1},
+    {1556, 6, 1},
+    {0, 0, 0},
+    {95837, 39, 1},
+    {25743, 7, 1},
+    {80815, 6, 1},
+    {12543, 8, 1},
+    {0, 0, 0},
+    {100031, 13, 1},
+    {110585, 16, 1},
+    {103165, 13, 1},
+    {11379, 8, 1},
+    {112000, 6, 1},
+    {0, 0, 0},
+    {111847, 6, 1},
+    {30052, 5, 1},
+    {30319, 8, 1},
+    {107563, 6, 1},
+    {0, 0, 0},
+    {91215, 21, 1},
+    {73986, 7, 1},
+    {19217, 6, 1},
+    {59574, 9, 1},
+    {92367, 17, 1},
+    {0, 0, 0},
+    {82736, 6, 1},
+    {74121, 28, 1},
+    {0, 0, 0},
+    {73708, 15, 1},
+    {35496, 14, 1},
+    {0, 0, 0},
+    {88930, 5, 1},
+    {78778, 10, 1},
+    {40170, 18, 1},
+    {48590, 17, 1},
+    {37466, 17, 1},
+    {54619, 5, 1},
+    {29490, 9, 1},
+    {94701, 9, 1},
+    {0, 0, 0},
+    {10300, 6, 1},
+    {22268, 6, 1},
+    {0, 0, 0},
+    {106382, 26, 1},
+    {7885, 6, 1},
+    {89968, 14, 1},
+    {108995, 18, 1},
+    {37950, 5, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {11566, 6, 1},
+    {0, 0, 0},
+    {39143, 5, 1},
+    {58934, 14, 1},
+    {6522, 15, 1},
+    {28237, 8, 1},
+    {24215, 8, 1},
+    {33036, 8, 1},
+    {38176, 10, 1},
+    {52910, 3, 1},
+    {99609, 15, 1},
+    {109867, 10, 1},
+    {54313, 14, 1},
+    {0, 0, 0},
+    {112442, 6, 1},
+    {0, 0, 0},
+    {90856, 11, 2},
+    {64369, 6, 1},
+    {111491, 9, 1},
+    {83680, 6, 1},
+    {0, 0, 0},
+    {44282, 21, 1},
+    {0, 0, 0},
+    {14161, 5, 1},
+    {75334, 11, 1},
+    {865, 5, 1},
+    {87765, 18, 1},
+    {10141, 15, 1},
+    {3902, 5, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {51988, 5, 1},
+    {47075, 4, 1},
+    {105102, 22, 1},
+    {37742, 4, 1},
+    {97302, 10, 1},
+    {110537, 16, 1},
+    {0, 0, 0},
+    {48196, 20, 1},
+    {57414, 7, 1},
+    {62962, 6, 1},
+    {21637, 11, 1},
+    {109641, 9, 1},
+    {84909, 10, 1},
+    {16005, 6, 1},
+    {87878, 10, 1},
+    {110029, 8, 1},
+    {98128, 46, 1},
+    {33859, 5, 1},
+    {31194, 6, 1},
+    {96906, 11, 1},
+    {0, 0, 0},
+    {74383, 7, 1},
+    {75987, 34, 1},
+    {100067, 4, 1},
+    {11952, 4, 1},
+    {12100, 8, 1},
+    {35475, 2, 1},
+    {38692, 7, 1},
+    {73020, 14, 1},
+    {40233, 12, 1},
+    {99496, 11, 1},
+    {0, 0, 0},
+    {112149, 9, 1},
+    {30945, 6, 1},
+    {57220, 14, 1},
+    {0, 0, 0},
+    {30999, 6, 1},
+    {73866, 6, 1},
+    {18179, 6, 1},
+    {33044, 9, 1},
+    {0, 0, 0},
+    {81671, 24, 1},
+    {22603, 11, 1},
+    {680, 6, 1},
+    {26164, 19, 1},
+    {51774, 11, 1},
+    {7313, 8, 1},
+    {23173, 6, 1},
+    {53341, 19, 1},
+    {62583, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {32061, 20, 1},
+    {21985, 6, 1},
+    {0, 0, 0},
+    {24236, 13, 1},
+    {62051, 6, 1},
+    {0, 0, 0},
+    {105076, 13, 1},
+    {31316, 6, 1},
+    {46617, 23, 1},
+    {0, 0, 0},
+    {49595, 17, 1},
+    {78451, 15, 1},
+    {69292, 17, 1},
+    {0, 0, 0},
+    {5373, 7, 1},
+    {81593, 18, 1},
+    {19920, 12, 1},
+    {0, 0, 0},
+    {36755, 5, 1},
+    {71520, 4, 1},
+    {24280, 21, 1},
+    {0, 0, 0},
+    {34396, 21, 1},
+    {96780, 14, 1},
+    {0, 0, 0},
+    {33165, 15, 1},
+    {36062, 16, 1},
+    {109396, 5, 1},
+    {90470, 18, 1},
+    {19553, 16, 1},
+    {92254, 18, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {47764, 8, 1},
+    {46730, 20, 1},
+    {25101, 14, 1},
+    {0, 0, 0},
+    {67104, 5, 1},
+    {50239, 5, 1},
+    {45715, 18, 1},
+    {112484, 9, 1},
+    {19019, 17, 1},
+    {83213, 3, 1},
+    {27989, 22, 1},
+    {42781, 9, 1},
+    {95314, 2, 1},
+    {8521, 6, 1},
+    {70313, 4, 1},
+    {51715, 10, 1},
+    {98057, 15, 1},
+    {0, 0, 0},
+    {67491, 7, 1},
+    {50866, 9, 1},
+    {15249, 5, 1},
+    {74825, 7, 1},
+    {29483, 7, 1},
+    {10350, 13, 1},
+    {47710, 14, 1},
+    {0, 0, 0},
+    {94988, 15, 1},
+    {4580, 4, 1},
+    {29716, 10, 1},
+    {62211, 6, 1},
+    {36048, 14, 1},
+    {1902, 12, 1},
+    {0, 0, 0},
+    {74887, 15, 1},
+    {13031, 12, 1},
+    {0, 0, 0},
+    {105363, 15, 1},
+    {31382, 6, 1},
+    {3605, 3, 1},
+    {31991, 5, 1},
+    {109579, 4, 1},
+    {0, 0, 0},
+    {31635, 10, 1},
+    {28951, 13, 1},
+    {33506, 10, 1},
+    {109304, 17, 1},
+    {28207, 16, 1},
+    {26818, 24, 1},
+    {66149, 12, 1},
+    {17337, 14, 1},
+    {60620, 7, 1},
+    {99721, 13, 1},
+    {106762, 15, 1},
+    {54170, 11, 1},
+    {45212, 10, 1},
+    {7509, 6, 1},
+    {71114, 10, 1},
+    {92799, 18, 1},
+    {50335, 6, 1},
+    {88741, 4, 1},
+    {20471, 10, 1},
+    {0, 0, 0},
+    {62463, 6, 1},
+    {26842, 23, 1},
+    {54698, 9, 1},
+    {31077, 6, 1},
+    {97899, 6, 1},
+    {62391, 6, 1},
+    {18168, 2, 1},
+    {68087, 6, 1},
+    {107036, 23, 1},
+    {108477, 15, 1},
+    {72093, 8, 1},
+    {0, 0, 0},
+    {29555, 17, 1},
+    {0, 0, 0},
+    {77082, 29, 1},
+    {11785, 8, 1},
+    {16449, 6, 1},
+    {16353, 6, 1},
+    {90156, 16, 1},
+    {20915, 13, 1},
+    {22298, 6, 1},
+    {30337, 14, 1},
+    {0, 0, 0},
+    {101576, 25, 1},
+    {41893, 6, 1},
+    {77840, 6, 1},
+    {0, 0, 0},
+    {67280, 9, 1},
+    {8398, 3, 1},
+    {80938, 12, 1},
+    {35556, 11, 1},
+    {10205, 17, 1},
+    {35527, 6, 1},
+    {104087, 15, 1},
+    {28152, 17, 1},
+    {94392, 14, 1},
+    {97068, 4, 1},
+    {41099, 19, 1},
+    {104958, 18, 1},
+    {12168, 3, 1},
+    {0, 0, 0},
+    {93816, 8, 1},
+    {100347, 11, 1},
+    {8731, 11, 1},
+    {825, 5, 1},
+    {110332, 6, 1},
+    {64561, 11, 1},
+    {51308, 4, 1},
+    {55459, 18, 1},
+    {62925, 11, 1},
+    {39223, 2, 1},
+    {0, 0, 0},
+    {100514, 14, 1},
+    {1177, 6, 1},
+    {9489, 11, 1},
+    {36869, 9, 1},
+    {37135, 5, 1},
+    {0, 0, 0},
+    {23554, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {17777, 15, 2},
+    {88139, 7, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {22178, 6, 1},
+    {71447, 2, 1},
+    {76827, 39, 1},
+    {104879, 8, 1},
+    {110323, 9, 1},
+    {0, 0, 0},
+    {5606, 18, 1},
+    {60711, 7, 1},
+    {0, 0, 0},
+    {108310, 17, 1},
+    {35813, 12, 1},
+    {83898, 9, 1},
+    {49247, 16, 1},
+    {0, 0, 0},
+    {62915, 10, 1},
+    {49544, 10, 1},
+    {2451, 13, 1},
+    {61409, 27, 1},
+    {75008, 9, 1},
+    {29618, 12, 1},
+    {45222, 17, 1},
+    {47980, 18, 1},
+    {88214, 9, 1},
+    {0, 0, 0},
+    {86688, 17, 1},
+    {90575, 11, 1},
+    {106680, 14, 1},
+    {55327, 6, 1},
+    {38422, 11, 1},
+    {112052, 13, 1},
+    {0, 0, 0},
+    {30981, 6, 1},
+    {4806, 2, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {41500, 5, 1},
+    {59022, 9, 1},
+    {4216, 2, 1},
+    {97320, 5, 1},
+    {30957, 6, 1},
+    {71233, 13, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {82413, 22, 1},
+    {36154, 15, 1},
+    {89015, 2, 1},
+    {0, 0, 0},
+    {36885, 19, 1},
+    {18399, 18, 1},
+    {65560, 22, 1},
+    {12519, 8, 1},
+    {56505, 18, 1},
+    {77503, 18, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {55207, 6, 1},
+    {11796, 25, 1},
+    {7563, 2, 2},
+    {62081, 6, 1},
+    {65153, 5, 1},
+    {58446, 18, 1},
+    {0, 0, 0},
+    {21681, 13, 1},
+    {9291, 11, 1},
+    {18214, 9, 1},
+    {84477, 2, 1},
+    {58392, 15, 1},
+    {44972, 15, 1},
+    {0, 0, 0},
+    {88920, 5, 1},
+    {57996, 11, 1},
+    {67799, 6, 1},
+    {0, 0, 0},
+    {21543, 8, 1},
+    {77644, 15, 1},
+    {100107, 6, 1},
+    {64523, 10, 1},
+    {67943, 6, 1},
+    {53208, 12, 1},
+    {40326, 11, 1},
+    {0, 0, 0},
+    {23696, 20, 1},
+    {48897, 20, 1},
+    {19083, 18, 1},
+    {0, 0, 0},
+    {14933, 12, 1},
+    {0, 0, 0},
+    {102239, 16, 1},
+    {0, 0, 0},
+    {50400, 13, 1},
+    {7123, 8, 1},
+    {88490, 6, 1},
+    {43428, 23, 1},
+    {23563, 9, 1},
+    {101436, 15, 1},
+    {0, 0, 0},
+    {56382, 19, 1},
+    {18428, 13, 1},
+    {23480, 8, 1},
+    {51785, 7, 1},
+    {18343, 11, 1},
+    {109392, 4, 1},
+    {0, 0, 0},
+    {78480, 19, 1},
+    {0, 0, 0},
+    {66779, 14, 1},
+    {83048, 11, 1},
+    {55315, 6, 1},
+    {0, 0, 0},
+    {14282, 8, 1},
+    {57234, 9, 1},
+    {64291, 7, 1},
+    {0, 0, 0},
+    {102279, 15, 1},
+    {11915, 15, 1},
+    {29900, 5, 1},
+    {31170, 6, 1},
+    {0, 0, 0},
+    {88975, 5, 1},
+    {18163, 5, 1},
+    {55339, 6, 1},
+    {9324, 11, 1},
+    {88845, 5, 1},
+    {78964, 13, 1},
+    {23430, 15, 1},
+    {74044, 15, 1},
+    {42738, 6, 1},
+    {61274, 15, 1},
+    {79118, 6, 1},
+    {0, 0, 0},
+    {78806, 26, 1},
+    {29991, 13, 1},
+    {36222, 12, 1},
+    {50013, 7, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {85335, 6, 1},
+    {42230, 10, 1},
+    {0, 0, 0},
+    {105024, 20, 1},
+    {0, 0, 0},
+    {89360, 16, 1},
+    {106436, 27, 1},
+    {32612, 9, 1},
+    {0, 0, 0},
+    {58664, 2, 1},
+    {105958, 15, 1},
+    {0, 0, 0},
+    {41901, 18, 1},
+    {0, 0, 0},
+    {102984, 18, 1},
+    {79070, 6, 1},
+    {0, 0, 0},
+    {67659, 5, 1},
+    {110569, 16, 1},
+    {87374, 16, 1},
+    {0, 0, 0},
+    {111790, 6, 1},
+    {16887, 21, 2},
+    {34805, 6, 1},
+    {42749, 11, 1},
+    {1083, 8, 1},
+    {0, 0, 0},
+    {3551, 2, 1},
+    {16335, 6, 1},
+    {2820, 5, 1},
+    {0, 0, 0},
+    {38706, 7, 1},
+    {108294, 16, 1},
+    {21903, 6, 1},
+    {0, 0, 0},
+    {99116, 11, 1},
+    {101270, 18, 1},
+    {108952, 16, 1},
+    {19007, 8, 1},
+    {13226, 19, 1},
+    {22360, 6, 1},
+    {81103, 20, 1},
+    {29116, 2, 1},
+    {83187, 10, 1},
+    {70148, 13, 1},
+    {90011, 20, 1},
+    {0, 0, 0},
+    {11760, 8, 1},
+    {88811, 11, 1},
+    {70656, 15, 1},
+    {30837, 6, 1},
+    {0, 0, 0},
+    {52151, 6, 1},
+    {0, 0, 0},
+    {4899, 17, 1},
+    {0, 0, 0},
+    {14566, 10, 1},
+    {17905, 8, 1},
+    {9478, 11, 1},
+    {58655, 9, 1},
+    {0, 0, 0},
+    {61949, 6, 1},
+    {89493, 12, 1},
+    {104617, 17, 1},
+    {23626, 3, 1},
+    {29790, 5, 1},
+    {61853, 10, 1},
+    {57162, 6, 1},
+    {83068, 4, 1},
+    {99400, 7, 1},
+    {92644, 5, 1},
+    {58760, 21, 1},
+    {57081, 5, 1},
+    {107769, 16, 1},
+    {9423, 11, 1},
+    {104182, 14, 1},
+    {26415, 13, 1},
+    {8347, 17, 1},
+    {31134, 6, 1},
+    {6357, 9, 1},
+    {72831, 2, 1},
+    {59123, 9, 1},
+    {14108, 13, 1},
+    {0, 0, 0},
+    {46441, 14, 1},
+    {104911, 16, 1},
+    {11637, 16, 1},
+    {0, 0, 0},
+    {52436, 22, 1},
+    {110945, 12, 1},
+    {55442, 17, 1},
+    {0, 0, 0},
+    {82903, 8, 1},
+    {61458, 17, 1},
+    {586, 6, 1},
+    {88475, 15, 1},
+    {88712, 17, 1},
+    {110891, 14, 1},
+    {72050, 5, 1},
+    {0, 0, 0},
+    {11393, 3, 1},
+    {73067, 11, 1},
+    {0, 0, 0},
+    {97611, 10, 1},
+    {59628, 11, 1},
+    {563, 20, 1},
+    {0, 0, 0},
+    {91256, 22, 1},
+    {75473, 31, 1},
+    {85220, 8, 1},
+    {47609, 25, 1},
+    {0, 0, 0},
+    {16359, 6, 1},
+    {68357, 6, 1},
+    {1578, 18, 1},
+    {0, 0, 0},
+    {22799, 20, 2},
+    {61763, 11, 1},
+    {50857, 9, 1},
+    {105124, 14, 1},
+    {0, 0, 0},
+    {7416, 13, 1},
+    {29779, 11, 1},
+    {15035, 7, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {30639, 6, 1},
+    {0, 0, 0},
+    {16461, 6, 1},
+    {73439, 17, 1},
+    {59924, 18, 1},
+    {17091, 15, 1},
+    {55069, 6, 1},
+    {0, 0, 0},
+    {38657, 7, 1},
+    {64080, 13, 1},
+    {17252, 11, 1},
+    {0, 0, 0},
+    {27909, 28, 1},
+    {45372, 18, 1},
+    {29223, 6, 1},
+    {105294, 11, 1},
+    {0, 0, 0},
+    {73247, 9, 1},
+    {18812, 9, 1},
+    {15711, 6, 1},
+    {73602, 13, 1},
+    {84838, 32, 1},
+    {87975, 11, 1},
+    {5206, 15, 1},
+    {19412, 6, 1},
+    {17548, 6, 1},
+    {4312, 16, 1},
+    {56990, 9, 1},
+    {0, 0, 0},
+    {52552, 5, 1},
+    {12378, 8, 1},
+    {52415, 2, 1},
+    {0, 0, 0},
+    {16734, 10, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {24916, 14, 1},
+    {86094, 13, 1},
+    {79933, 19, 1},
+    {72544, 12, 1},
+    {52932, 17, 1},
+    {0, 0, 0},
+    {36030, 18, 1},
+    {41988, 24, 1},
+    {67381, 12, 1},
+    {60777, 20, 1},
+    {74764, 5, 1},
+    {95950, 39, 1},
+    {583, 3, 1},
+    {18602, 12, 1},
+    {65782, 6, 1},
+    {4294, 18, 1},
+    {69264, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {66905, 20, 1},
+    {55381, 6, 1},
+    {100966, 10, 1},
+    {0, 0, 0},
+    {70640, 16, 1},
+    {50956, 9, 1},
+    {8940, 14, 1},
+    {83483, 5, 1},
+    {46467, 12, 1},
+    {31188, 6, 1},
+    {0, 0, 0},
+    {50839, 9, 1},
+    {27562, 11, 1},
+    {0, 0, 0},
+    {10058, 16, 1},
+    {15957, 6, 1},
+    {86849, 15, 1},
+    {53578, 20, 1},
+    {99169, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {54492, 11, 1},
+    {79878, 16, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {95724, 5, 1},
+    {41482, 6, 1},
+    {13890, 9, 1},
+    {18686, 9, 1},
+    {4154, 18, 1},
+    {68794, 13, 1},
+    {21925, 6, 1},
+    {0, 0, 0},
+    {57469, 24, 1},
+    {67835, 6, 1},
+    {52102, 9, 1},
+    {28828, 12, 1},
+    {47933, 6, 1},
+    {66793, 20, 1},
+    {0, 0, 0},
+    {9851, 4, 1},
+    {110785, 6, 1},
+    {0, 0, 0},
+    {78041, 21, 1},
+    {70430, 9, 1},
+    {108586, 6, 1},
+    {75504, 29, 1},
+    {50545, 9, 1},
+    {8491, 6, 1},
+    {17227, 7, 1},
+    {26957, 22, 1},
+    {83718, 6, 1},
+    {78932, 15, 1},
+    {45424, 22, 1},
+    {92447, 4, 1},
+    {65295, 9, 1},
+    {57901, 17, 1},
+    {0, 0, 0},
+    {31059, 6, 1},
+    {10327, 23, 1},
+    {72128, 6, 1},
+    {0, 0, 0},
+    {58881, 11, 1},
+    {101466, 14, 1},
+    {112619, 6, 1},
+    {69567, 6, 1},
+    {96861, 17, 1},
+    {20361, 5, 1},
+    {73050, 13, 2},
+    {0, 0, 0},
+    {67931, 6, 1},
+    {0, 0, 0},
+    {23316, 18, 1},
+    {16443, 6, 1},
+    {36340, 6, 1},
+    {355, 6, 1},
+    {107545, 18, 1},
+    {90745, 22, 1},
+    {0, 0, 0},
+    {108526, 9, 1},
+    {4869, 15, 1},
+    {0, 0, 0},
+    {31931, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {30488, 19, 1},
+    {83276, 8, 1},
+    {62493, 6, 1},
+    {62487, 6, 1},
+    {112006, 6, 1},
+    {67258, 3, 1},
+    {59409, 15, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {33448, 6, 1},
+    {55555, 15, 1},
+    {73111, 12, 1},
+    {110298, 6, 1},
+    {15368, 5, 1},
+    {38210, 6, 1},
+    {22057, 6, 1},
+    {69724, 16, 1},
+    {16545, 6, 1},
+    {84254, 3, 1},
+    {88993, 5, 1},
+    {0, 0, 0},
+    {79687, 11, 1},
+    {89754, 16, 1},
+    {102571, 14, 1},
+    {62741, 12, 1},
+    {0, 0, 0},
+    {80120, 15, 1},
+    {64470, 8, 1},
+    {92009, 20, 1},
+    {29777, 2, 1},
+    {82742, 4, 1},
+    {99971, 10, 1},
+    {43036, 9, 1},
+    {107059, 30, 1},
+    {57051, 12, 1},
+    {94789, 5, 1},
+    {95764, 34, 1},
+    {59042, 15, 1},
+    {24490, 11, 1},
+    {43835, 20, 1},
+    {42462, 12, 1},
+    {98793, 45, 1},
+    {0, 0, 0},
+    {88935, 5, 1},
+    {32886, 14, 1},
+    {17309, 7, 1},
+    {36973, 27, 1},
+    {7605, 14, 1},
+    {102924, 20, 1},
+    {42653, 5, 1},
+    {68243, 6, 1},
+    {0, 0, 0},
+    {91786, 9, 1},
+    {92568, 2, 1},
+    {71917, 5, 1},
+    {83570, 9, 1},
+    {12027, 6, 1},
+    {5394, 10, 1},
+    {46220, 11, 1},
+    {73822, 15, 1},
+    {7303, 10, 1},
+    {0, 0, 0},
+    {30711, 6, 1},
+    {20593, 13, 1},
+    {48355, 4, 1},
+    {12322, 8, 1},
+    {65282, 13, 1},
+    {43792, 9, 1},
+    {45071, 22, 1},
+    {0, 0, 0},
+    {107390, 15, 1},
+    {44758, 16, 1},
+    {0, 0, 0},
+    {94787, 2, 1},
+    {0, 0, 0},
+    {43635, 18, 1},
+    {0, 0, 0},
+    {2341, 16, 1},
+    {93381, 17, 1},
+    {15348, 5, 1},
+    {51111, 13, 1},
+    {61872, 3, 1},
+    {20900, 15, 1},
+    {89924, 5, 1},
+    {0, 0, 0},
+    {60364, 16, 1},
+    {51272, 9, 1},
+    {17574, 3, 1},
+    {87178, 21, 1},
+    {62655, 6, 1},
+    {93356, 14, 1},
+    {100014, 6, 4},
+    {15840, 15, 1},
+    {37619, 17, 1},
+    {89050, 11, 1},
+    {50039, 14, 1},
+    {107887, 12, 1},
+    {99841, 13, 1},
+    {107153, 20, 1},
+    {11534, 6, 1},
+    {53137, 10, 1},
+    {93574, 17, 1},
+    {9225, 11, 1},
+    {50303, 8, 1},
+    {8455, 6, 1},
+    {65345, 13, 1},
+    {41923, 16, 1},
+    {87338, 18, 1},
+    {31422, 9, 1},
+    {65679, 5, 1},
+    {91928, 6, 1},
+    {0, 0, 0},
+    {61289, 23, 1},
+    {0, 0, 0},
+    {42489, 3, 1},
+    {14, 5, 1},
+    {83823, 15, 1},
+    {86913, 14, 1},
+    {108765, 15, 1},
+    {51792, 8, 1},
+    {0, 0, 0},
+    {53808, 12, 1},
+    {29971, 10, 1},
+    {55051, 6, 1},
+    {49909, 6, 1},
+    {9368, 11, 1},
+    {108544, 10, 1},
+    {11334, 9, 1},
+    {90187, 20, 1},
+    {16323, 6, 1},
+    {0, 0, 0},
+    {65001, 13, 1},
+    {0, 0, 0},
+    {40778, 11, 1},
+    {43451, 19, 1},
+    {16635, 6, 1},
+    {24464, 16, 1},
+    {48772, 18, 1},
+    {95366, 13, 1},
+    {94742, 5, 1},
+    {14140, 10, 1},
+    {97161, 20, 1},
+    {8810, 11, 1},
+    {43564, 16, 1},
+    {66270, 19, 1},
+    {0, 0, 0},
+    {202, 13, 1},
+    {15512, 5, 1},
+    {0, 0, 0},
+    {36365, 7, 1},
+    {85008, 12, 2},
+    {9599, 11, 1},
+    {81210, 17, 1},
+    {19808, 14, 1},
+    {51389, 4, 1},
+    {94942, 16, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {9302, 11, 1},
+    {98009, 10, 1},
+    {0, 0, 0},
+    {72081, 12, 1},
+    {70946, 11, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {51993, 13, 1},
+    {0, 0, 0},
+    {29410, 4, 1},
+    {83000, 13, 1},
+    {53397, 8, 1},
+    {47568, 15, 1},
+    {5749, 18, 1},
+    {81282, 17, 1},
+    {0, 0, 0},
+    {92513, 8, 1},
+    {38884, 3, 1},
+    {82225, 16, 1},
+    {72570, 10, 1},
+    {97334, 9, 1},
+    {17591, 5, 1},
+    {100575, 13, 1},
+    {31250, 6, 1},
+    {110749, 10, 1},
+    {6882, 9, 1},
+    {92836, 5, 1},
+    {94823, 8, 1},
+    {30747, 6, 1},
+    {5624, 18, 1},
+    {0, 0, 0},
+    {105446, 16, 1},
+    {96794, 14, 1},
+    {56013, 4, 1},
+    {0, 0, 0},
+    {68615, 6, 1},
+    {0, 0, 0},
+    {62385, 6, 1},
+    {0, 0, 0},
+    {52055, 9, 1},
+    {99806, 5, 1},
+    {4584, 6, 1},
+    {40894, 3, 1},
+    {15188, 5, 1},
+    {16515, 6, 1},
+    {68759, 11, 1},
+    {0, 0, 0},
+    {106093, 18, 1},
+    {5049, 9, 1},
+    {0, 0, 0},
+    {61659, 5, 1},
+    {11775, 10, 1},
+    {2911, 18, 1},
+    {79025, 5, 1},
+    {38905, 6, 1},
+    {47079, 7, 1},
+    {51450, 3, 1},
+    {104651, 15, 1},
+    {0, 0, 0},
+    {31863, 8, 1},
+    {95068, 17, 1},
+    {48578, 12, 1},
+    {82746, 9, 1},
+    {0, 0, 0},
+    {7498, 6, 1},
+    {0, 0, 0},
+    {62968, 6, 1},
+    {0, 0, 0},
+    {88363, 17, 1},
+    {65805, 16, 1},
+    {10025, 5, 1},
+    {57968, 13, 1},
+    {21435, 17, 1},
+    {0, 0, 0},
+    {94659, 21, 1},
+    {95349, 12, 1},
+    {59167, 20, 1},
+    {62331, 6, 1},
+    {0, 0, 0},
+    {58063, 5, 1},
+    {0, 0, 0},
+    {82376, 17, 1},
+    {9775, 2, 1},
+    {53273, 15, 1},
+    {48414, 15, 1},
+    {46016, 14, 1},
+    {18903, 7, 1},
+    {86190, 13, 1},
+    {0, 0, 0},
+    {54377, 9, 1},
+    {98838, 46, 1},
+    {96542, 10, 1},
+    {0, 0, 0},
+    {31212, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {9955, 3, 1},
+    {25073, 14, 1},
+    {56623, 14, 1},
+    {89569, 21, 1},
+    {48807, 18, 2},
+    {72016, 19, 1},
+    {32268, 17, 1},
+    {0, 0, 0},
+    {598, 3, 1},
+    {79757, 13, 1},
+    {0, 0, 0},
+    {18029, 25, 1},
+    {0, 0, 0},
+    {82165, 21, 1},
+    {0, 0, 0},
+    {69822, 9, 1},
+    {52326, 9, 1},
+    {74974, 9, 1},
+    {65659, 20, 2},
+    {0, 0, 0},
+    {19956, 6, 1},
+    {72801, 6, 1},
+    {0, 0, 0},
+    {55030, 3, 1},
+    {71124, 7, 1},
+    {27754, 14, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {38957, 6, 1},
+    {15444, 10, 1},
+    {71394, 11, 1},
+    {66022, 12, 1},
+    {47350, 16, 1},
+    {51399, 13, 1},
+    {84723, 16, 1},
+    {78274, 15, 1},
+    {20992, 17, 1},
+    {107013, 14, 1},
+    {42437, 10, 1},
+    {19545, 8, 1},
+    {68657, 6, 1},
+    {0, 0, 0},
+    {74257, 7, 1},
+    {46383, 3, 1},
+    {37199, 2, 1},
+    {75810, 26, 1},
+    {75784, 26, 1},
+    {103541, 19, 1},
+    {57825, 11, 1},
+    {100934, 12, 1},
+    {0, 0, 0},
+    {11716, 13, 1},
+    {42180, 7, 1},
+    {80347, 13, 1},
+    {38545, 7, 1},
+    {5280, 20, 1},
+    {55105, 6, 1},
+    {64106, 23, 2},
+    {0, 0, 0},
+    {63508, 20, 1},
+    {0, 0, 0},
+    {12426, 5, 1},
+    {91565, 20, 1},
+    {94331, 18, 2},
+    {81354, 21, 1},
+    {29572, 13, 1},
+    {48622, 14, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {3480, 15, 1},
+    {15409, 5, 1},
+    {0, 0, 0},
+    {36458, 2, 1},
+    {0, 0, 0},
+    {27739, 15, 1},
+    {0, 0, 0},
+    {33801, 26, 1},
+    {36744, 4, 1},
+    {42724, 7, 1},
+    {97958, 11, 2},
+    {87044, 20, 1},
+    {100148, 24, 1},
+    {105260, 14, 1},
+    {21165, 8, 1},
+    {73123, 7, 1},
+    {27463, 11, 1},
+    {0, 0, 0},
+    {25837, 6, 1},
+    {47524, 12, 1},
+    {0, 0, 0},
+    {80929, 4, 1},
+    {84707, 16, 1},
+    {63680, 23, 1},
+    {47037, 20, 1},
+    {0, 0, 0},
+    {15963, 6, 1},
+    {0, 0, 0},
+    {71010, 7, 1},
+    {0, 0, 0},
+    {47842, 11, 1},
+    {96968, 5, 1},
+    {101253, 17, 1},
+    {8982, 14, 1},
+    {52255, 10, 1},
+    {61372, 6, 1},
+    {92831, 5, 1},
+    {12013, 10, 1},
+    {0, 0, 0},
+    {94232, 13, 1},
+    {31917, 8, 1},
+    {11132, 15, 1},
+    {68495, 6, 1},
+    {84922, 8, 1},
+    {0, 0, 0},
+    {102159, 11, 1},
+    {0, 0, 0},
+    {14361, 2, 2},
+    {64393, 6, 1},
+    {108710, 11, 2},
+    {79642, 12, 1},
+    {108592, 9, 1},
+    {14692, 16, 1},
+    {29133, 14, 1},
+    {46298, 19, 1},
+    {0, 0, 0},
+    {41775, 8, 1},
+    {420, 4, 1},
+    {95608, 10, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {111506, 9, 1},
+    {58985, 9, 1},
+    {0, 0, 0},
+    {8625, 8, 1},
+    {57076, 5, 1},
+    {23179, 6, 1},
+    {60641, 7, 1},
+    {88293, 14, 1},
+    {12418, 8, 1},
+    {15218, 5, 1},
+    {54181, 18, 1},
+    {99064, 45, 1},
+    {0, 0, 0},
+    {2464, 18, 1},
+    {22232, 6, 1},
+    {62403, 6, 1},
+    {24851, 8, 1},
+    {92879, 3, 1},
+    {69573, 9, 1},
+    {30253, 6, 1},
+    {71158, 12, 1},
+    {97887, 6, 1},
+    {43246, 9, 1},
+    {5722, 10, 1},
+    {48704, 19, 1},
+    {76393, 27, 1},
+    {20834, 18, 1},
+    {29414, 6, 1},
+    {0, 0, 0},
+    {70671, 10, 1},
+    {7504, 2, 1},
+    {108193, 15, 1},
+    {35187, 17, 1},
+    {71351, 12, 1},
+    {12923, 2, 1},
+    {81973, 18, 1},
+    {73878, 8, 1},
+    {54123, 8, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {50030, 9, 1},
+    {67639, 5, 1},
+    {31466, 18, 1},
+    {50166, 5, 1},
+    {42928, 9, 1},
+    {47738, 12, 1},
+    {65505, 8, 1},
+    {69836, 15, 1},
+    {0, 0, 0},
+    {63886, 2, 1},
+    {65848, 5, 1},
+    {0, 0, 0},
+    {54093, 10, 1},
+    {62936, 2, 1},
+    {2749, 7, 1},
+    {0, 0, 0},
+    {82708, 14, 1},
+    {7838, 9, 1},
+    {2552, 8, 1},
+    {1144, 2, 1},
+    {106075, 18, 1},
+    {0, 0, 0},
+    {109897, 9, 1},
+    {24754, 5, 1},
+    {92615, 5, 1},
+    {895, 5, 1},
+    {40944, 5, 1},
+    {109510, 15, 1},
+    {50271, 10, 1},
+    {57501, 15, 1},
+    {106150, 18, 1},
+    {58287, 10, 1},
+    {47824, 18, 1},
+    {31035, 6, 1},
+    {83481, 2, 1},
+    {71363, 9, 1},
+    {71083, 7, 1},
+    {71863, 11, 1},
+    {39934, 15, 1},
+    {41586, 18, 1},
+    {80821, 4, 1},
+    {107617, 5, 1},
+    {109858, 9, 1},
+    {38204, 6, 1},
+    {82068, 20, 1},
+    {254, 7, 1},
+    {101156, 16, 1},
+    {92936, 18, 1},
+    {34441, 25, 1},
+    {70252, 12, 1},
+    {71907, 5, 1},
+    {30396, 10, 1},
+    {59132, 15, 1},
+    {62697, 6, 1},
+    {20606, 4, 1},
+    {13735, 16, 1},
+    {0, 0, 0},
+    {86301, 9, 1},
+    {0, 0, 0},
+    {2650, 8, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {9945, 10, 1},
+    {94143, 5, 1},
+    {31029, 6, 1},
+    {7078, 11, 1},
+    {12722, 5, 1},
+    {0, 0, 0},
+    {100009, 5, 1},
+    {28761, 13, 1},
+    {64023, 5, 1},
+    {72615, 5, 1},
+    {81653, 18, 1},
+    {95161, 15, 1},
+    {74649, 5, 1},
+    {62021, 6, 1},
+    {80424, 12, 1},
+    {0, 0, 0},
+    {93065, 11, 1},
+    {5841, 20, 1},
+    {91740, 11, 1},
+    {65280, 2, 1},
+    {0, 0, 0},
+    {60940, 16, 1},
+    {3884, 9, 1},
+    {71632, 10, 1},
+    {35772, 11, 1},
+    {0, 0, 0},
+    {30440, 16, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {91503, 21, 1},
+    {79776, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {16908, 24, 2},
+    {38678, 7, 1},
+    {0, 0, 0},
+    {5404, 16, 1},
+    {12567, 8, 1},
+    {95099, 15, 1},
+    {25777, 16, 1},
+    {42303, 19, 1},
+    {105592, 13, 1},
+    {30207, 7, 1},
+    {94734, 6, 1},
+    {20132, 4, 1},
+    {26661, 12, 1},
+    {6270, 19, 1},
+    {37766, 13, 1},
+    {59658, 4, 1},
+    {19418, 17, 2},
+    {0, 0, 0},
+    {83724, 14, 1},
+    {28245, 19, 1},
+    {93056, 9, 1},
+    {64872, 13, 1},
+    {104830, 14, 1},
+    {0, 0, 0},
+    {71581, 6, 1},
+    {87826, 17, 1},
+    {100601, 22, 1},
+    {2067, 6, 1},
+    {0, 0, 0},
+    {104976, 18, 1},
+    {17138, 11, 1},
+    {20775, 12, 1},
+    {20040, 11, 1},
+    {0, 0, 0},
+    {75117, 9, 1},
+    {45037, 16, 1},
+    {71953, 5, 1},
+    {17568, 6, 1},
+    {83316, 8, 1},
+    {100172, 26, 1},
+    {70522, 9, 1},
+    {80102, 18, 1},
+    {0, 0, 0},
+    {95570, 8, 1},
+    {43761, 9, 1},
+    {0, 0, 0},
+    {40737, 20, 1},
+    {64499, 12, 1},
+    {90279, 16, 1},
+    {0, 0, 0},
+    {88752, 10, 1},
+    {99245, 14, 1},
+    {24980, 9, 1},
+    {83353, 12, 1},
+    {0, 0, 0},
+    {13173, 20, 1},
+    {30909, 6, 1},
+    {19120, 17, 1},
+    {61706, 15, 1},
+    {70797, 23, 1},
+    {0, 0, 0},
+    {28169, 18, 1},
+    {0, 0, 0},
+    {2947, 14, 1},
+    {63940, 5, 1},
+    {0, 0, 0},
+    {97258, 9, 1},
+    {81714, 21, 1},
+    {0, 0, 0},
+    {14901, 12, 1},
+    {0, 0, 0},
+    {92620, 5, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {93706, 18, 1},
+    {1716, 14, 1},
+    {10001, 14, 1},
+    {27078, 11, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {8413, 6, 1},
+    {7719, 9, 1},
+    {88644, 3, 1},
+    {105498, 13, 1},
+    {75231, 16, 1},
+    {80504, 15, 1},
+    {69797, 2, 1},
+    {87804, 11, 1},
+    {30047, 5, 1},
+    {36392, 11, 1},
+    {0, 0, 0},
+    {64980, 10, 1},
+    {1831, 15, 1},
+    {91876, 17, 1},
+    {0, 0, 0},
+    {111194, 12, 1},
+    {49573, 7, 1},
+    {51281, 5, 1},
+    {0, 0, 0},
+    {43315, 13, 1},
+    {81433, 10, 1},
+    {0, 0, 0},
+    {110196, 13, 1},
+    {0, 0, 0},
+    {107455, 3, 1},
+    {1655, 2, 1},
+    {39825, 18, 1},
+    {80803, 3, 1},
+    {20136, 6, 1},
+    {36519, 17, 1},
+    {0, 0, 0},
+    {23806, 10, 1},
+    {95394, 9, 1},
+    {0, 0, 0},
+    {2140, 18, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {43975, 18, 1},
+    {49566, 2, 1},
+    {37396, 15, 1},
+    {55165, 6, 1},
+    {18185, 12, 1},
+    {52352, 4, 1},
+    {33343, 13, 1},
+    {58373, 19, 1},
+    {50148, 6, 1},
+    {97917, 6, 1},
+    {29263, 9, 1},
+    {82620, 4, 1},
+    {57200, 6, 1},
+    {101099, 18, 1},
+    {64284, 7, 1},
+    {32197, 15, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {110243, 8, 1},
+    {14543, 23, 1},
+    {66889, 16, 1},
+    {39985, 18, 1},
+    {3178, 9, 1},
+    {51494, 19, 1},
+    {44218, 23, 1},
+    {0, 0, 0},
+    {69793, 4, 1},
+    {104502, 11, 1},
+    {53099, 6, 1},
+    {50668, 9, 1},
+    {0, 0, 0},
+    {78082, 8, 1},
+    {336, 7, 1},
+    {108227, 20, 1},
+    {40103, 15, 1},
+    {75114, 3, 1},
+    {4973, 19, 1},
+    {78542, 13, 1},
+    {104809, 12, 1},
+    {21694, 10, 1},
+    {78681, 21, 1},
+    {107994, 20, 1},
+    {63248, 9, 1},
+    {110344, 23, 1},
+    {0, 0, 0},
+    {61121, 18, 1},
+    {15575, 5, 1},
+    {1275, 6, 1},
+    {0, 0, 0},
+    {46107, 10, 1},
+    {54368, 9, 1},
+    {56116, 16, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {107655, 17, 1},
+    {60287, 17, 1},
+    {6380, 13, 1},
+    {102585, 13, 1},
+    {59314, 16, 1},
+    {62115, 6, 1},
+    {7189, 9, 1},
+    {66751, 10, 1},
+    {0, 0, 0},
+    {73566, 14, 1},
+    {69132, 12, 1},
+    {0, 0, 0},
+    {39794, 14, 1},
+    {0, 0, 0},
+    {3413, 8, 1},
+    {111636, 9, 1},
+    {55431, 11, 1},
+    {83780, 8, 1},
+    {1430, 9, 1},
+    {49900, 9, 1},
+    {0, 0, 0},
+    {42853, 9, 1},
+    {62253, 6, 1},
+    {72768, 10, 1},
+    {29726, 11, 1},
+    {3553, 5, 1},
+    {0, 0, 0},
+    {36121, 12, 1},
+    {18554, 6, 1},
+    {30663, 6, 1},
+    {50171, 7, 2},
+    {0, 0, 0},
+    {3106, 7, 1},
+    {97032, 15, 1},
+    {108014, 20, 1},
+    {70367, 26, 1},
+    {30609, 6, 1},
+    {0, 0, 0},
+    {96479, 2, 1},
+    {54837, 15, 1},
+    {25492, 9, 1},
+    {0, 0, 0},
+    {109070, 15, 1},
+    {42409, 16, 1},
+    {0, 0, 0},
+    {17756, 5, 1},
+    {85042, 11, 1},
+    {84614, 17, 1},
+    {55063, 6, 1},
+    {35204, 19, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {53069, 14, 1},
+    {46568, 17, 1},
+    {2977, 15, 1},
+    {105526, 15, 1},
+    {29923, 10, 1},
+    {16053, 6, 1},
+    {24201, 14, 2},
+    {105723, 12, 1},
+    {21861, 6, 1},
+    {0, 0, 0},
+    {95265, 8, 1},
+    {0, 0, 0},
+    {100082, 13, 1},
+    {54609, 5, 1},
+    {67721, 6, 1},
+    {54467, 3, 1},
+    {20803, 18, 1},
+    {84314, 8, 1},
+    {48549, 16, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {7824, 14, 1},
+    {10951, 10, 1},
+    {0, 0, 0},
+    {8011, 2, 1},
+    {110637, 12, 1},
+    {10266, 11, 1},
+    {59470, 15, 1},
+    {0, 0, 0},
+    {77996, 11, 1},
+    {8765, 12, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {16065, 6, 1},
+    {20870, 15, 1},
+    {96552, 10, 1},
+    {88940, 5, 1},
+    {58677, 2, 1},
+    {104061, 12, 1},
+    {69930, 16, 1},
+    {0, 0, 0},
+    {93571, 3, 1},
+    {52427, 9, 1},
+    {55538, 17, 1},
+    {55057, 6, 1},
+    {0, 0, 0},
+    {7939, 6, 1},
+    {0, 0, 0},
+    {16203, 6, 1},
+    {0, 0, 0},
+    {33683, 8, 1},
+    {0, 0, 0},
+    {54999, 18, 1},
+    {47644, 18, 1},
+    {12559, 8, 1},
+    {0, 0, 0},
+    {91524, 20, 1},
+    {58781, 11, 1},
+    {30078, 6, 1},
+    {79610, 15, 1},
+    {62427, 6, 1},
+    {51551, 5, 1},
+    {84696, 11, 1},
+    {12330, 8, 1},
+    {10669, 12, 1},
+    {88114, 18, 1},
+    {110070, 6, 1},
+    {14252, 14, 4},
+    {12402, 8, 1},
+    {86428, 12, 1},
+    {64710, 16, 1},
+    {15302, 9, 1},
+    {90172, 4, 1},
+    {76055, 34, 1},
+    {62565, 6, 1},
+    {60586, 10, 1},
+    {68165, 6, 1},
+    {25244, 14, 1},
+    {65832, 16, 1},
+    {89111, 10, 1},
+    {15555, 5, 1},
+    {0, 0, 0},
+    {111425, 12, 1},
+    {37698, 6, 1},
+    {93463, 7, 1},
+    {82893, 10, 1},
+    {66243, 16, 1},
+    {63181, 16, 1},
+    {90295, 18, 1},
+    {108574, 2, 1},
+    {81499, 19, 1},
+    {100829, 14, 1},
+    {79371, 7, 1},
+    {66081, 17, 1},
+    {42105, 12, 1},
+    {18984, 15, 1},
+    {2224, 12, 1},
+    {82281, 19, 1},
+    {111152, 15, 1},
+    {77449, 22, 1},
+    {21406, 11, 1},
+    {91197, 18, 1},
+    {69774, 15, 1},
+    {95675, 3, 1},
+    {45920, 15, 1},
+    {0, 0, 0},
+    {22316, 6, 1},
+    {1261, 8, 1},
+    {22214, 6, 1},
+    {82208, 17, 1},
+    {70508, 5, 1},
+    {67811, 6, 1},
+    {77551, 10, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {89203, 19, 1},
+    {67704, 5, 1},
+    {58068, 3, 1},
+    {9555, 11, 1},
+    {3962, 9, 1},
+    {58193, 18, 1},
+    {27452, 11, 1},
+    {45788, 11, 2},
+    {38608, 7, 1},
+    {88156, 10, 1},
+    {0, 0, 0},
+    {49375, 8, 1},
+    {0, 0, 0},
+    {27496, 11, 1},
+    {102195, 14, 1},
+    {77741, 16, 1},
+    {1920, 15, 1},
+    {23763, 6, 1},
+    {62888, 17, 1},
+    {86531, 3, 1},
+    {0, 0, 0},
+    {22519, 16, 1},
+    {0, 0, 0},
+    {84456, 10, 1},
+    {48278, 5, 1},
+    {22190, 6, 1},
+    {39873, 16, 1},
+    {64485, 14, 1},
+    {11209, 13, 1},
+    {42346, 3, 1},
+    {85325, 10, 1},
+    {0, 0, 0},
+    {77046, 36, 1},
+    {0, 0, 0},
+    {57880, 4, 1},
+    {0, 0, 0},
+    {33654, 11, 1},
+    {19397, 15, 1},
+    {6163, 17, 1},
+    {781, 5, 1},
+    {64275, 9, 1},
+    {0, 0, 0},
+    {67198, 16, 1},
+    {73701, 7, 1},
+    {12906, 11, 1},
+    {0, 0, 0},
+    {54056, 6, 1},
+    {109286, 18, 1},
+    {105473, 13, 1},
+    {39141, 2, 1},
+    {2635, 6, 1},
+    {43018, 9, 1},
+    {29104, 3, 1},
+    {73872, 6, 1},
+    {25188, 6, 1},
+    {55297, 6, 1},
+    {0, 0, 0},
+    {6480, 14, 1},
+    {10277, 10, 1},
+    {36306, 3, 1},
+    {62763, 19, 1},
+    {85936, 14, 1},
+    {60174, 20, 1},
+    {0, 0, 0},
+    {31946, 7, 1},
+    {63528, 20, 1},
+    {46157, 9, 1},
+    {62956, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {69700, 11, 1},
+    {12833, 11, 1},
+    {93224, 11, 1},
+    {33146, 19, 1},
+    {7060, 8, 1},
+    {112577, 9, 1},
+    {78314, 16, 1},
+    {37851, 10, 1},
+    {0, 0, 0},
+    {30406, 6, 1},
+    {22426, 6, 1},
+    {75640, 27, 1},
+    {84681, 15, 1},
+    {38864, 14, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {85341, 13, 1},
+    {68147, 6, 1},
+    {43171, 6, 1},
+    {19137, 13, 1},
+    {31829, 8, 1},
+    {103197, 9, 1},
+    {53983, 5, 1},
+    {111964, 9, 1},
+    {39076, 11, 1},
+    {35905, 18, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {80825, 5, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {19934, 5, 1},
+    {67889, 6, 1},
+    {109553, 8, 1},
+    {93112, 16, 1},
+    {65089, 15, 1},
+    {1342, 7, 1},
+    {42973, 9, 1},
+    {23572, 5, 1},
+    {38846, 9, 1},
+    {11466, 6, 1},
+    {71070, 4, 1},
+    {98369, 46, 1},
+    {72373, 13, 1},
+    {31782, 8, 1},
+    {96845, 6, 1},
+    {84661, 9, 1},
+    {11054, 2, 1},
+    {100452, 26, 1},
+    {28389, 18, 1},
+    {77757, 18, 1},
+    {92829, 2, 1},
+    {111237, 28, 1},
+    {107529, 16, 1},
+    {0, 0, 0},
+    {14891, 10, 1},
+    {105150, 18, 1},
+    {82570, 17, 1},
+    {109232, 15, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {90920, 13, 1},
+    {2041, 26, 1},
+    {0, 0, 0},
+    {45557, 19, 1},
+    {67859, 6, 1},
+    {4206, 10, 1},
+    {13919, 6, 1},
+    {55369, 6, 1},
+    {70607, 8, 1},
+    {20238, 13, 1},
+    {0, 0, 0},
+    {65054, 5, 1},
+    {45409, 15, 1},
+    {79490, 20, 1},
+    {12088, 12, 1},
+    {33443, 5, 1},
+    {96667, 12, 1},
+    {9697, 4, 1},
+    {91681, 19, 1},
+    {83118, 17, 1},
+    {2073, 5, 1},
+    {16431, 6, 1},
+    {110843, 12, 1},
+    {0, 0, 0},
+    {111694, 6, 1},
+    {86061, 15, 1},
+    {81695, 19, 1},
+    {3573, 18, 1},
+    {83466, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {65230, 6, 1},
+    {12996, 6, 1},
+    {99998, 11, 1},
+    {41463, 19, 1},
+    {30633, 6, 1},
+    {63856, 5, 1},
+    {35398, 13, 1},
+    {57022, 2, 2},
+    {19962, 17, 1},
+    {28720, 16, 1},
+    {64321, 6, 1},
+    {9214, 11, 1},
+    {67937, 6, 1},
+    {28864, 5, 1},
+    {31152, 6, 1},
+    {64155, 26, 1},
+    {0, 0, 0},
+    {58679, 5, 1},
+    {54614, 5, 1},
+    {26274, 2, 1},
+    {0, 0, 0},
+    {107867, 20, 1},
+    {29084, 5, 1},
+    {31352, 6, 1},
+    {97193, 6, 1},
+    {44653, 10, 1},
+    {0, 0, 0},
+    {18161, 2, 1},
+    {92750, 10, 1},
+    {63999, 9, 1},
+    {80627, 16, 1},
+    {0, 0, 0},
+    {111392, 9, 1},
+    {0, 0, 0},
+    {105616, 15, 1},
+    {50938, 9, 1},
+    {111718, 6, 1},
+    {70760, 15, 1},
+    {33068, 10, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {55261, 6, 1},
+    {37600, 19, 1},
+    {90545, 9, 1},
+    {30729, 6, 1},
+    {57687, 17, 1},
+    {21107, 10, 1},
+    {52856, 13, 1},
+    {424, 5, 1},
+    {7089, 8, 1},
+    {109833, 9, 1},
+    {80001, 6, 1},
+    {9970, 11, 1},
+    {5600, 6, 1},
+    {6591, 11, 1},
+    {96487, 2, 1},
+    {31559, 5, 1},
+    {110407, 10, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {55129, 6, 1},
+    {59942, 19, 1},
+    {79088, 6, 1},
+    {5352, 7, 1},
+    {14223, 14, 4},
+    {0, 0, 0},
+    {24609, 20, 1},
+    {53843, 9, 1},
+    {737, 5, 1},
+    {49231, 16, 1},
+    {0, 0, 0},
+    {102620, 26, 1},
+    {1770, 24, 1},
+    {0, 0, 0},
+    {48825, 19, 1},
+    {72828, 3, 1},
+    {99679, 11, 1},
+    {0, 0, 0},
+    {36112, 9, 1},
+    {17368, 8, 1},
+    {40083, 20, 1},
+    {2662, 15, 1},
+    {110310, 13, 1},
+    {22856, 14, 1},
+    {84291, 11, 1},
+    {0, 0, 0},
+    {103341, 16, 1},
+    {86359, 10, 1},
+    {96206, 34, 1},
+    {0, 0, 0},
+    {95915, 35, 1},
+    {103503, 11, 1},
+    {33423, 5, 1},
+    {12700, 13, 1},
+    {93154, 9, 1},
+    {19, 8, 2},
+    {97343, 5, 1},
+    {0, 0, 0},
+    {43580, 19, 1},
+    {855, 5, 1},
+    {0, 0, 0},
+    {90507, 4, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {99981, 11, 1},
+    {50126, 3, 1},
+    {71405, 6, 1},
+    {97935, 6, 1},
+    {52064, 3, 1},
+    {85516, 12, 1},
+    {49333, 11, 1},
+    {7052, 8, 1},
+    {54580, 7, 1},
+    {28840, 3, 1},
+    {33827, 18, 1},
+    {0, 0, 0},
+    {111386, 6, 1},
+    {20696, 14, 1},
+    {2204, 20, 1},
+    {70917, 6, 1},
+    {92732, 9, 1},
+    {91826, 5, 1},
+    {0, 0, 0},
+    {67007, 16, 1},
+    {16991, 6, 1},
+    {16539, 6, 1},
+    {0, 0, 0},
+    {18548, 6, 1},
+    {91972, 18, 1},
+    {16659, 6, 1},
+    {67793, 6, 1},
+    {0, 0, 0},
+    {15580, 5, 1},
+    {9826, 7, 1},
+    {19766, 8, 1},
+    {16029, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {801, 5, 1},
+    {20464, 7, 1},
+    {53468, 18, 1},
+    {84083, 11, 1},
+    {86122, 11, 1},
+    {88183, 5, 1},
+    {16347, 6, 1},
+    {29089, 6, 1},
+    {0, 0, 0},
+    {60087, 16, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {21825, 6, 1},
+    {91831, 12, 1},
+    {62163, 6, 1},
+    {51475, 10, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {97199, 16, 2},
+    {103690, 12, 1},
+    {2297, 13, 1},
+    {109711, 17, 1},
+    {33397, 13, 1},
+    {46420, 21, 1},
+    {102458, 11, 1},
+    {92774, 4, 1},
+    {80272, 17, 1},
+    {63718, 23, 1},
+    {85828, 8, 1},
+    {295, 9, 1},
+    {10468, 16, 1},
+    {111346, 22, 1},
+    {0, 0, 0},
+    {65040, 9, 1},
+    {89176, 13, 1},
+    {0, 0, 0},
+    {68549, 6, 1},
+    {37074, 3, 1},
+    {86644, 11, 1},
+    {18274, 7, 1},
+    {25843, 9, 1},
+    {41642, 20, 1},
+    {0, 0, 0},
+    {16629, 6, 1},
+    {108780, 17, 1},
+    {0, 0, 0},
+    {12314, 8, 1},
+    {46766, 16, 1},
+    {42625, 6, 1},
+    {39148, 5, 1},
+    {0, 0, 0},
+    {73746, 8, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {64345, 6, 1},
+    {0, 0, 0},
+    {35676, 11, 1},
+    {66066, 15, 1},
+    {9984, 6, 1},
+    {0, 0, 0},
+    {14913, 10, 1},
+    {0, 0, 0},
+    {74251, 6, 1},
+    {101718, 21, 1},
+    {0, 0, 0},
+    {72390, 15, 1},
+    {0, 0, 0},
+    {79035, 5, 1},
+    {57704, 18, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {33250, 19, 1},
+    {0, 0, 0},
+    {46336, 20, 1},
+    {22094, 6, 1},
+    {25920, 7, 1},
+    {62241, 6, 1},
+    {56581, 17, 1},
+    {48673, 11, 1},
+    {16455, 6, 1},
+    {35706, 17, 1},
+    {44030, 20, 1},
+    {42117, 10, 1},
+    {29841, 10, 1},
+    {0, 0, 0},
+    {37861, 10, 1},
+    {92440, 2, 1},
+    {16059, 6, 1},
+    {71613, 7, 1},
+    {68435, 6, 1},
+    {0, 0, 0},
+    {31745, 8, 1},
+    {96536, 6, 1},
+    {94590, 21, 1},
+    {64533, 28, 1},
+    {82868, 6, 1},
+    {28651, 19, 1},
+    {112538, 6, 1},
+    {20356, 5, 1},
+    {16437, 6, 1},
+    {41505, 16, 1},
+    {0, 0, 0},
+    {25215, 14, 1},
+    {83226, 6, 1},
+    {8431, 6, 1},
+    {742, 5, 1},
+    {16227, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {24803, 8, 1},
+    {103470, 22, 1},
+    {95327, 2, 1},
+    {87783, 21, 1},
+    {44303, 16, 1},
+    {18281, 4, 1},
+    {0, 0, 0},
+    {26204, 8, 1},
+    {67997, 6, 1},
+    {0, 0, 0},
+    {84513, 5, 1},
+    {111533, 9, 1},
+    {14018, 6, 1},
+    {102005, 15, 1},
+    {49014, 20, 1},
+    {51852, 18, 1},
+    {0, 0, 0},
+    {57101, 15, 1},
+    {25384, 19, 1},
+    {0, 0, 0},
+    {29175, 15, 1},
+    {73623, 7, 1},
+    {25734, 9, 1},
+    {1253, 3, 1},
+    {57256, 7, 1},
+    {79154, 6, 1},
+    {0, 0, 0},
+    {21603, 15, 1},
+    {0, 0, 0},
+    {84279, 12, 1},
+    {68567, 6, 1},
+    {46068, 3, 1},
+    {0, 0, 0},
+    {20351, 5, 1},
+    {21660, 21, 1},
+    {37210, 4, 1},
+    {105317, 14, 1},
+    {36441, 6, 1},
+    {7965, 18, 1},
+    {41521, 15, 1},
+    {91078, 20, 1},
+    {77234, 26, 1},
+    {0, 0, 0},
+    {109193, 19, 1},
+    {109887, 10, 1},
+    {109817, 8, 1},
+    {111700, 6, 1},
+    {62343, 6, 1},
+    {64823, 17, 1},
+    {0, 0, 0},
+    {30879, 6, 1},
+    {0, 0, 0},
+    {68870, 26, 1},
+    {37989, 13, 1},
+    {68351, 6, 1},
+    {93810, 6, 1},
+    {0, 0, 0},
+    {108438, 22, 1},
+    {0, 0, 0},
+    {39615, 13, 1},
+    {75754, 30, 1},
+    {88524, 9, 1},
+    {58117, 5, 1},
+    {0, 0, 0},
+    {37323, 19, 1},
+    {33516, 8, 1},
+    {0, 0, 0},
+    {17213, 14, 1},
+    {15404, 5, 1},
+    {36169, 20, 1},
+    {835, 5, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {24364, 4, 1},
+    {16119, 6, 1},
+    {78859, 8, 1},
+    {38993, 6, 1},
+    {93076, 12, 1},
+    {53559, 19, 1},
+    {51019, 9, 1},
+    {3245, 9, 1},
+    {44699, 21, 1},
+    {74445, 9, 1},
+    {0, 0, 0},
+    {43958, 17, 1},
+    {60048, 9, 2},
+    {3670, 8, 1},
+    {92548, 7, 1},
+    {94831, 9, 1},
+    {64511, 12, 1},
+    {11426, 4, 1},
+    {59147, 20, 1},
+    {43090, 9, 1},
+    {6753, 10, 1},
+    {37533, 13, 1},
+    {81812, 17, 1},
+    {30057, 5, 1},
+    {96679, 3, 1},
+    {76366, 27, 1},
+    {37512, 6, 1},
+    {111946, 9, 1},
+    {35761, 11, 1},
+    {111596, 13, 1},
+    {0, 0, 0},
+    {22340, 6, 1},
+    {0, 0, 0},
+    {86990, 17, 1},
+    {71411, 8, 1},
+    {17596, 5, 1},
+    {64697, 13, 1},
+    {68015, 6, 1},
+    {0, 0, 0},
+    {7506, 3, 1},
+    {71587, 6, 1},
+    {0, 0, 0},
+    {14031, 7, 1},
+    {63309, 20, 1},
+    {62415, 6, 1},
+    {0, 0, 0},
+    {52607, 10, 1},
+    {85102, 9, 1},
+    {64770, 15, 1},
+    {7936, 3, 1},
+    {0, 0, 0},
+    {7168, 12, 1},
+    {46216, 4, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {94680, 10, 1},
+    {67402, 12, 1},
+    {61889, 6, 1},
+    {30456, 3, 1},
+    {82464, 16, 1},
+    {39011, 19, 1},
+    {56296, 17, 1},
+    {65962, 16, 1},
+    {86750, 17, 1},
+    {5171, 8, 1},
+    {0, 0, 0},
+    {106055, 20, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {58976, 9, 1},
+    {0, 0, 0},
+    {2018, 23, 1},
+    {22627, 9, 1},
+    {0, 0, 0},
+    {7180, 9, 1},
+    {53988, 5, 1},
+    {0, 0, 0},
+    {26726, 13, 1},
+    {106183, 18, 1},
+    {86226, 10, 1},
+    {74693, 9, 1},
+    {10572, 13, 1},
+    {97804, 6, 1},
+    {80135, 12, 1},
+    {1662, 19, 1},
+    {0, 0, 0},
+    {42492, 14, 1},
+    {96588, 6, 1},
+    {44855, 19, 1},
+    {9500, 11, 1},
+    {0, 0, 0},
+    {50992, 9, 1},
+    {58083, 2, 1},
+    {21753, 6, 1},
+    {0, 0, 0},
+    {51556, 7, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {22033, 6, 1},
+    {69435, 13, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {47308, 7, 2},
+    {6557, 5, 1},
+    {108721, 24, 1},
+    {50092, 6, 1},
+    {39481, 12, 1},
+    {37193, 6, 1},
+    {86927, 15, 1},
+    {0, 0, 0},
+    {22160, 6, 1},
+    {96917, 11, 1},
+    {29946, 5, 1},
+    {74001, 6, 1},
+    {0, 0, 0},
+    {99467, 7, 1},
+    {105229, 11, 1},
+    {50205, 3, 1},
+    {0, 0, 0},
+    {57271, 3, 1},
+    {0, 0, 0},
+    {93886, 17, 1},
+    {15469, 5, 1},
+    {64298, 5, 1},
+    {0, 0, 0},
+    {60797, 18, 1},
+    {34594, 7, 1},
+    {72035, 15, 1},
+    {11889, 10, 1},
+    {0, 0, 0},
+    {21388, 18, 1},
+    {0, 0, 0},
+    {17430, 7, 1},
+    {72933, 5, 1},
+    {0, 0, 0},
+    {72727, 9, 1},
+    {66444, 18, 1},
+    {99421, 4, 1},
+    {15987, 6, 1},
+    {13797, 15, 1},
+    {59105, 11, 1},
+    {81480, 19, 1},
+    {50463, 9, 1},
+    {95085, 14, 1},
+    {109628, 5, 1},
+    {19463, 23, 1},
+    {42506, 12, 1},
+    {53655, 16, 1},
+    {25325, 20, 1},
+    {77521, 13, 1},
+    {0, 0, 0},
+    {79698, 2, 1},
+    {96812, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {83932, 14, 1},
+    {70556, 9, 1},
+    {109085, 19, 1},
+    {26995, 3, 1},
+    {19370, 21, 2},
+    {35662, 14, 1},
+    {63741, 18, 1},
+    {23301, 15, 1},
+    {89817, 13, 1},
+    {18480, 4, 1},
+    {34417, 24, 1},
+    {12301, 5, 1},
+    {0, 0, 0},
+    {46231, 7, 1},
+    {64899, 11, 1},
+    {24697, 9, 1},
+    {0, 0, 0},
+    {72893, 4, 1},
+    {28875, 8, 1},
+    {31606, 14, 1},
+    {49429, 11, 1},
+    {21955, 6, 1},
+    {0, 0, 0},
+    {45239, 15, 1},
+    {97863, 6, 1},
+    {89017, 9, 1},
+    {89955, 13, 1},
+    {40135, 19, 1},
+    {0, 0, 0},
+    {107184, 14, 1},
+    {107353, 23, 1},
+    {31298, 6, 1},
+    {0, 0, 0},
+    {23473, 2, 2},
+    {15688, 12, 1},
+    {90867, 10, 1},
+    {31805, 8, 1},
+    {8159, 13, 1},
+    {61674, 5, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {51826, 26, 1},
+    {37830, 12, 1},
+    {62247, 6, 1},
+    {112355, 9, 1},
+    {79106, 6, 1},
+    {112125, 9, 1},
+    {103748, 14, 1},
+    {58668, 9, 1},
+    {95203, 8, 1},
+    {72416, 4, 1},
+    {94164, 14, 1},
+    {12766, 13, 1},
+    {63593, 21, 1},
+    {0, 0, 0},
+    {58160, 17, 1},
+    {0, 0, 0},
+    {50821, 9, 1},
+    {9236, 11, 1},
+    {10036, 6, 1},
+    {69363, 13, 1},
+    {63294, 15, 1},
+    {24099, 6, 1},
+    {95316, 5, 1},
+    {2756, 14, 1},
+    {53902, 8, 1},
+    {0, 0, 0},
+    {90960, 6, 1},
+    {15459, 5, 1},
+    {13466, 15, 1},
+    {14363, 5, 1},
+    {84505, 6, 1},
+    {46750, 16, 1},
+    {74307, 11, 1},
+    {102962, 22, 1},
+    {16653, 6, 1},
+    {64726, 16, 1},
+    {107126, 16, 1},
+    {110190, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {71435, 4, 1},
+    {73175, 9, 1},
+    {88328, 11, 2},
+    {112306, 9, 1},
+    {33845, 10, 1},
+    {24528, 14, 1},
+    {84969, 12, 1},
+    {73350, 7, 1},
+    {56148, 4, 1},
+    {26238, 10, 1},
+    {31304, 6, 1},
+    {51444, 6, 1},
+    {0, 0, 0},
+    {78619, 6, 1},
+    {12439, 8, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {95544, 9, 1},
+    {2484, 9, 1},
+    {0, 0, 0},
+    {7814, 10, 1},
+    {99332, 2, 1},
+    {106339, 16, 1},
+    {70503, 5, 1},
+    {12261, 8, 1},
+    {38923, 10, 1},
+    {12936, 5, 1},
+    {111020, 12, 1},
+    {109371, 17, 1},
+    {16726, 8, 1},
+    {72796, 5, 1},
+    {100121, 16, 1},
+    {63386, 22, 1},
+    {28274, 19, 1},
+    {104944, 14, 1},
+    {52744, 6, 1},
+    {58994, 16, 1},
+    {31017, 6, 1},
+    {79405, 22, 1},
+    {74199, 17, 1},
+    {34925, 21, 1},
+    {85918, 18, 1},
+    {16997, 21, 1},
+    {28850, 14, 1},
+    {84547, 5, 1},
+    {68261, 6, 1},
+    {21771, 6, 1},
+    {52653, 13, 1},
+    {23015, 6, 1},
+    {17651, 6, 1},
+    {44580, 19, 1},
+    {96851, 10, 1},
+    {27630, 12, 1},
+    {0, 0, 0},
+    {76974, 36, 1},
+    {41229, 10, 1},
+    {27309, 11, 1},
+    {62355, 6, 1},
+    {9810, 5, 1},
+    {0, 0, 0},
+    {37636, 2, 1},
+    {12177, 3, 1},
+    {63082, 6, 1},
+    {84518, 27, 1},
+    {47209, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {80090, 12, 1},
+    {104582, 21, 1},
+    {112257, 9, 1},
+    {40828, 7, 1},
+    {110270, 15, 1},
+    {43117, 9, 1},
+    {58737, 9, 1},
+    {15053, 30, 1},
+    {0, 0, 0},
+    {32169, 5, 1},
+    {0, 0, 0},
+    {78585, 11, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {12354, 8, 1},
+    {89297, 17, 1},
+    {97413, 15, 1},
+    {82624, 15, 1},
+    {93456, 7, 1},
+    {79398, 7, 1},
+    {0, 0, 0},
+    {24590, 4, 1},
+    {60212, 21, 1},
+    {44183, 16, 1},
+    {46287, 11, 1},
+    {0, 0, 0},
+    {37219, 3, 1},
+    {5334, 11, 1},
+    {88021, 19, 1},
+    {70086, 13, 1},
+    {33339, 4, 1},
+    {111925, 6, 1},
+    {70692, 2, 2},
+    {30927, 6, 1},
+    {3783, 31, 1},
+    {53993, 5, 1},
+    {46712, 18, 1},
+    {31436, 5, 1},
+    {39030, 18, 1},
+    {13083, 17, 1},
+    {0, 0, 0},
+    {44199, 19, 1},
+    {12108, 13, 1},
+    {40454, 16, 1},
+    {15166, 14, 2},
+    {0, 0, 0},
+    {53820, 12, 1},
+    {55375, 6, 1},
+    {47478, 13, 1},
+    {0, 0, 0},
+    {53542, 17, 1},
+    {99821, 15, 1},
+    {86088, 6, 1},
+    {61991, 6, 1},
+    {109991, 4, 1},
+    {68069, 6, 1},
+    {24128, 11, 1},
+    {29705, 5, 1},
+    {0, 0, 0},
+    {77402, 11, 1},
+    {76706, 41, 1},
+    {0, 0, 0},
+    {52586, 16, 1},
+    {0, 0, 0},
+    {16521, 6, 1},
+    {29795, 12, 1},
+    {51712, 3, 1},
+    {52145, 6, 1},
+    {99890, 16, 1},
+    {84132, 12, 1},
+    {10704, 6, 1},
+    {11185, 10, 1},
+    {31328, 6, 1},
+    {0, 0, 0},
+    {92841, 16, 1},
+    {42590, 5, 1},
+    {84025, 11, 1},
+    {14177, 16, 4},
+    {89455, 17, 1},
+    {53255, 18, 1},
+    {71175, 2, 1},
+    {75296, 11, 1},
+    {45106, 17, 1},
+    {74149, 18, 1},
+    {34649, 17, 1},
+    {46238, 7, 1},
+    {60103, 17, 1},
+    {42322, 19, 1},
+    {17267, 7, 1},
+    {0, 0, 0},
+    {1313, 6, 1},
+    {349, 6, 1},
+    {15502, 5, 1},
+    {40256, 17, 1},
+    {94840, 7, 1},
+    {0, 0, 0},
+    {73477, 10, 1},
+    {42535, 15, 1},
+    {41424, 17, 1},
+    {76123, 39, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {42201, 13, 1},
+    {0, 0, 0},
+    {15424, 5, 1},
+    {10258, 8, 1},
+    {21223, 4, 1},
+    {10174, 3, 1},
+    {0, 0, 0},
+    {61863, 9, 1},
+    {5542, 6, 1},
+    {25817, 20, 1},
+    {93370, 11, 1},
+    {12941, 5, 1},
+    {27320, 11, 1},
+    {51563, 11, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {9855, 7, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {51251, 7, 1},
+    {82565, 5, 1},
+    {0, 0, 0},
+    {21891, 6, 1},
+    {75060, 6, 1},
+    {12920, 3, 1},
+    {20457, 7, 1},
+    {27056, 11, 1},
+    {79465, 25, 1},
+    {69278, 14, 1},
+    {93534, 3, 1},
+    {73308, 11, 1},
+    {55696, 22, 1},
+    {53436, 17, 1},
+    {11956, 17, 1},
+    {50830, 9, 1},
+    {0, 0, 0},
+    {109671, 14, 1},
+    {107142, 11, 1},
+    {0, 0, 0},
+    {102086, 11, 1},
+    {49113, 17, 1},
+    {0, 0, 0},
+    {6858, 8, 1},
+    {85641, 7, 1},
+    {112550, 9, 1},
+    {50650, 9, 1},
+    {42877, 9, 1},
+    {57091, 10, 1},
+    {22039, 6, 1},
+    {83984, 4, 1},
+    {29648, 17, 1},
+    {70836, 7, 1},
+    {92451, 3, 1},
+    {24930, 5, 1},
+    {107241, 11, 1},
+    {48436, 13, 1},
+    {49383, 13, 1},
+    {14058, 6, 1},
+    {109140, 3, 1},
+    {102020, 16, 1},
+    {3974, 18, 1},
+    {4128, 14, 1},
+    {11793, 3, 1},
+    {88399, 15, 1},
+    {47447, 16, 1},
+    {78647, 4, 1},
+    {94958, 14, 1},
+    {102209, 10, 1},
+    {8633, 5, 1},
+    {592, 6, 1},
+    {56539, 10, 1},
+    {73765, 6, 1},
+    {97556, 15, 1},
+    {11930, 8, 1},
+    {109921, 14, 1},
+    {107737, 17, 1},
+    {74682, 2, 1},
+    {68944, 19, 1},
+    {14237, 15, 4},
+    {39857, 16, 1},
+    {870, 5, 1},
+    {84072, 11, 1},
+    {12180, 4, 1},
+    {59610, 18, 1},
+    {55799, 22, 1},
+    {35803, 10, 1},
+    {0, 0, 0},
+    {62127, 6, 1},
+    {110041, 15, 1},
+    {111521, 6, 1},
+    {75324, 10, 1},
+    {68393, 6, 1},
+    {92206, 17, 1},
+    {33488, 9, 1},
+    {0, 0, 0},
+    {13298, 19, 1},
+    {72620, 3, 1},
+    {0, 0, 0},
+    {15517, 5, 1},
+    {4688, 4, 1},
+    {0, 0, 0},
+    {28365, 21, 1},
+    {80676, 13, 1},
+    {24501, 20, 1},
+    {0, 0, 0},
+    {52344, 8, 1},
+    {105706, 17, 1},
+    {24935, 6, 1},
+    {5969, 10, 1},
+    {9782, 14, 1},
+    {70571, 6, 1},
+    {174, 14, 1},
+    {88775, 11, 1},
+    {9313, 11, 1},
+    {74539, 3, 1},
+    {43153, 9, 1},
+    {73522, 2, 1},
+    {14649, 21, 1},
+    {74983, 9, 1},
+    {0, 0, 0},
+    {83423, 2, 1},
+    {1114, 10, 1},
+    {18154, 5, 1},
+    {12917, 3, 1},
+    {0, 0, 0},
+    {106600, 16, 1},
+    {99929, 18, 1},
+    {0, 0, 0},
+    {91772, 14, 1},
+    {102145, 14, 1},
+    {90650, 8, 1},
+    {3849, 35, 1},
+    {73159, 8, 1},
+    {89416, 12, 1},
+    {92585, 5, 1},
+    {79531, 21, 1},
+    {0, 0, 0},
+    {110627, 10, 1},
+    {88175, 3, 1},
+    {97186, 5, 1},
+    {30300, 16, 1},
+    {0, 0, 0},
+    {13201, 14, 1},
+    {88091, 17, 1},
+    {96137, 35, 1},
+    {45517, 14, 1},
+    {0, 0, 0},
+    {21967, 6, 1},
+    {47583, 7, 1},
+    {62760, 3, 1},
+    {79378, 14, 1},
+    {0, 0, 0},
+    {66990, 17, 1},
+    {14389, 8, 1},
+    {62039, 6, 1},
+    {90977, 20, 1},
+    {84094, 11, 1},
+    {63232, 16, 1},
+    {811, 5, 1},
+    {50929, 9, 1},
+    {72333, 6, 1},
+    {72742, 9, 1},
+    {104243, 17, 1},
+    {37924, 15, 2},
+    {94437, 15, 1},
+    {0, 0, 0},
+    {25489, 3, 1},
+    {22962, 6, 1},
+    {7929, 7, 1},
+    {51169, 12, 1},
+    {37638, 5, 1},
+    {57210, 10, 1},
+    {23660, 19, 1},
+    {67533, 17, 1},
+    {38552, 7, 1},
+    {4617, 10, 1},
+    {673, 7, 1},
+    {38758, 6, 1},
+    {0, 0, 0},
+    {19573, 9, 1},
+    {0, 0, 0},
+    {97893, 6, 1},
+    {11867, 5, 1},
+    {30855, 6, 1},
+    {52528, 4, 1},
+    {2374, 14, 1},
+    {26493, 16, 1},
+    {25199, 7, 1},
+    {94972, 16, 1},
+    {0, 0, 0},
+    {2628, 7, 1},
+    {0, 0, 0},
+    {54143, 13, 1},
+    {51636, 14, 1},
+    {41488, 12, 1},
+    {12596, 8, 1},
+    {63783, 6, 1},
+    {12580, 8, 1},
+    {40541, 12, 1},
+    {15522, 5, 1},
+    {31572, 11, 1},
+    {59719, 25, 1},
+    {40633, 19, 1},
+    {17376, 18, 1},
+    {52480, 10, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {79770, 6, 1},
+    {51010, 9, 1},
+    {59639, 10, 1},
+    {40688, 14, 1},
+    {67217, 6, 1},
+    {2698, 21, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {48310, 11, 1},
+    {44630, 15, 1},
+    {0, 0, 0},
+    {51932, 12, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {103080, 19, 1},
+    {22208, 6, 1},
+    {108686, 16, 1},
+    {75030, 9, 2},
+    {54156, 14, 1},
+    {9445, 11, 1},
+    {23586, 16, 1},
+    {108941, 11, 1},
+    {43617, 18, 1},
+    {37915, 9, 1},
+    {66161, 15, 1},
+    {85275, 12, 1},
+    {71642, 12, 1},
+    {54755, 10, 1},
+    {62723, 11, 1},
+    {0, 0, 0},
+    {58413, 9, 1},
+    {0, 0, 0},
+    {55135, 6, 1},
+    {44161, 22, 1},
+    {0, 0, 0},
+    {23799, 7, 1},
+    {38538, 7, 1},
+    {88838, 5, 1},
+    {55416, 15, 1},
+    {0, 0, 0},
+    {108253, 15, 1},
+    {74070, 24, 1},
+    {49827, 9, 1},
+    {25508, 2, 1},
+    {0, 0, 0},
+    {24360, 4, 1},
+    {8473, 6, 1},
+    {50069, 11, 1},
+    {74411, 22, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {32928, 16, 1},
+    {68675, 6, 1},
+    {0, 0, 0},
+    {30316, 3, 1},
+    {26366, 5, 1},
+    {0, 0, 0},
+    {47550, 18, 1},
+    {0, 0, 0},
+    {32944, 7, 1},
+    {34234, 22, 1},
+    {0, 0, 0},
+    {17508, 7, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {16263, 6, 1},
+    {0, 0, 0},
+    {42341, 2, 2},
+    {23334, 11, 1},
+    {89907, 17, 1},
+    {51580, 13, 1},
+    {26882, 17, 1},
+    {0, 0, 0},
+    {112089, 6, 1},
+    {96505, 16, 1},
+    {67949, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {2860, 14, 1},
+    {54031, 6, 1},
+    {29295, 16, 1},
+    {91388, 21, 1},
+    {50722, 9, 1},
+    {107849, 18, 1},
+    {62947, 3, 1},
+    {105988, 16, 1},
+    {29944, 2, 1},
+    {92721, 11, 1},
+    {77137, 26, 1},
+    {13390, 17, 1},
+    {81315, 20, 1},
+    {82983, 17, 1},
+    {1963, 14, 1},
+    {16827, 16, 1},
+    {11163, 11, 1},
+    {69505, 12, 1},
+    {0, 0, 0},
+    {85166, 23, 1},
+    {12139, 15, 1},
+    {0, 0, 0},
+    {61183, 19, 1},
+    {36921, 18, 1},
+    {43886, 13, 1},
+    {100044, 4, 1},
+    {97869, 6, 1},
+    {105690, 16, 1},
+    {0, 0, 0},
+    {2260, 16, 1},
+    {96750, 14, 1},
+    {16764, 21, 1},
+    {89447, 8, 1},
+    {88991, 2, 1},
+    {57493, 8, 1},
+    {0, 0, 0},
+    {51453, 3, 1},
+    {0, 0, 0},
+    {7366, 12, 1},
+    {0, 0, 0},
+    {78899, 20, 1},
+    {88414, 14, 1},
+    {102179, 16, 1},
+    {17496, 12, 1},
+    {0, 0, 0},
+    {930, 5, 1},
+    {5986, 15, 1},
+    {78466, 6, 1},
+    {95578, 12, 1},
+    {79264, 13, 1},
+    {85236, 8, 1},
+    {38601, 7, 1},
+    {8443, 6, 1},
+    {241, 13, 1},
+    {83801, 10, 1},
+    {110509, 14, 1},
+    {0, 0, 0},
+    {107972, 22, 1},
+    {0, 0, 0},
+    {38933, 6, 1},
+    {108492, 19, 1},
+    {73677, 6, 1},
+    {55655, 19, 1},
+    {51360, 11, 1},
+    {16503, 6, 1},
+    {0, 0, 0},
+    {11430, 9, 1},
+    {68297, 6, 1},
+    {85197, 10, 1},
+    {101975, 17, 1},
+    {86834, 15, 1},
+    {80219, 15, 1},
+    {46030, 15, 1},
+    {24728, 5, 1},
+    {5438, 8, 1},
+    {30292, 8, 1},
+    {111575, 6, 1},
+    {44791, 15, 1},
+    {15213, 5, 1},
+    {43144, 9, 1},
+    {76271, 34, 1},
+    {60669, 7, 1},
+    {0, 0, 0},
+    {105212, 9, 1},
+    {94768, 11, 1},
+    {50749, 9, 1},
+    {95329, 5, 1},
+    {19448, 15, 1},
+    {22687, 10, 1},
+    {110178, 12, 1},
+    {104453, 12, 1},
+    {28996, 3, 1},
+    {0, 0, 0},
+    {21551, 11, 1},
+    {78788, 18, 1},
+    {55913, 24, 1},
+    {68750, 9, 1},
+    {667, 6, 1},
+    {0, 0, 0},
+    {64375, 6, 1},
+    {36554, 8, 1},
+    {83026, 4, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {50659, 9, 1},
+    {47273, 14, 1},
+    {0, 0, 0},
+    {83145, 5, 1},
+    {31901, 8, 1},
+    {607, 14, 1},
+    {0, 0, 0},
+    {31047, 6, 1},
+    {0, 0, 0},
+    {15945, 6, 1},
+    {10015, 10, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {21915, 10, 1},
+    {21843, 6, 1},
+    {68591, 6, 1},
+    {63635, 20, 1},
+    {25578, 12, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {110739, 10, 1},
+    {103514, 10, 1},
+    {84930, 12, 1},
+    {74264, 10, 1},
+    {68129, 6, 1},
+    {66583, 18, 1},
+    {81844, 18, 1},
+    {24998, 8, 1},
+    {110523, 14, 1},
+    {69992, 24, 1},
+    {845, 5, 1},
+    {50965, 9, 1},
+    {850, 5, 1},
+    {60758, 19, 1},
+    {76902, 36, 1},
+    {97979, 11, 1},
+    {84919, 3, 1},
+    {91278, 21, 1},
+    {0, 0, 0},
+    {82840, 9, 1},
+    {65495, 10, 1},
+    {69548, 19, 1},
+    {57120, 7, 1},
+    {55093, 6, 1},
+    {18886, 10, 1},
+    {1072, 11, 1},
+    {31346, 6, 1},
+    {9038, 15, 1},
+    {0, 0, 0},
+    {16641, 6, 1},
+    {103492, 11, 1},
+    {112409, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {72975, 6, 1},
+    {65724, 8, 1},
+    {36189, 5, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {49484, 12, 1},
+    {80689, 17, 1},
+    {74798, 18, 1},
+    {41946, 18, 1},
+    {89045, 5, 1},
+    {32951, 15, 1},
+    {67463, 9, 1},
+    {0, 0, 0},
+    {43255, 20, 1},
+    {79667, 5, 1},
+    {32848, 19, 1},
+    {28101, 7, 1},
+    {94158, 6, 1},
+    {88146, 2, 1},
+    {21358, 13, 1},
+    {0, 0, 0},
+    {67214, 3, 1},
+    {9467, 11, 1},
+    {89770, 21, 1},
+    {36576, 12, 1},
+    {0, 0, 0},
+    {20251, 13, 1},
+    {8843, 11, 1},
+    {87894, 8, 1},
+    {80657, 11, 1},
+    {102598, 22, 1},
+    {0, 0, 0},
+    {84670, 7, 1},
+    {64785, 11, 1},
+    {48463, 5, 1},
+    {82805, 8, 1},
+    {0, 0, 0},
+    {16131, 6, 1},
+    {0, 0, 0},
+    {99653, 12, 1},
+    {17452, 10, 1},
+    {0, 0, 0},
+    {17770, 7, 1},
+    {10096, 20, 1},
+    {0, 0, 0},
+    {16269, 6, 1},
+    {0, 0, 0},
+    {25182, 6, 1},
+    {65717, 7, 1},
+    {68483, 6, 1},
+    {32630, 17, 1},
+    {22762, 20, 1},
+    {52020, 11, 1},
+    {61102, 7, 1},
+    {23629, 12, 1},
+    {12277, 8, 1},
+    {0, 0, 0},
+    {39705, 19, 1},
+    {2078, 19, 1},
+    {95024, 15, 1},
+    {0, 0, 0},
+    {85189, 8, 1},
+    {100884, 23, 1},
+    {12171, 6, 1},
+    {83704, 6, 1},
+    {12069, 3, 1},
+    {32294, 18, 1},
+    {61838, 15, 1},
+    {75170, 20, 1},
+    {0, 0, 0},
+    {68779, 8, 1},
+    {57453, 16, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {55111, 6, 1},
+    {0, 0, 0},
+    {71477, 10, 1},
+    {71828, 35, 1},
+    {68057, 6, 1},
+    {18656, 3, 1},
+    {0, 0, 0},
+    {43372, 15, 1},
+    {107707, 22, 1},
+    {0, 0, 0},
+    {12338, 8, 1},
+    {7904, 11, 1},
+    {57362, 5, 1},
+    {35001, 19, 1},
+    {94283, 23, 1},
+    {62103, 6, 1},
+    {52958, 5, 1},
+    {57206, 4, 1},
+    {0, 0, 0},
+    {43210, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {78979, 5, 1},
+    {32998, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {88632, 2, 1},
+    {17845, 10, 1},
+    {44937, 17, 1},
+    {30062, 5, 1},
+    {110799, 12, 1},
+    {19486, 9, 1},
+    {0, 0, 0},
+    {82545, 20, 1},
+    {0, 0, 0},
+    {91299, 22, 1},
+    {41263, 18, 1},
+    {0, 0, 0},
+    {73945, 4, 1},
+    {0, 0, 0},
+    {59554, 8, 1},
+    {52157, 6, 1},
+    {11050, 4, 1},
+    {6942, 8, 1},
+    {7847, 15, 1},
+    {58130, 15, 1},
+    {68681, 6, 1},
+    {28821, 2, 1},
+    {96999, 10, 1},
+    {75415, 27, 1},
+    {16071, 6, 1},
+    {103370, 15, 1},
+    {0, 0, 0},
+    {14026, 5, 1},
+    {0, 0, 0},
+    {79196, 18, 1},
+    {64434, 16, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {56563, 18, 1},
+    {17678, 10, 1},
+    {20442, 9, 1},
+    {58016, 2, 1},
+    {0, 0, 0},
+    {29810, 10, 1},
+    {0, 0, 0},
+    {48249, 12, 1},
+    {110104, 13, 1},
+    {62883, 5, 1},
+    {2168, 22, 1},
+    {0, 0, 0},
+    {27831, 19, 1},
+    {97247, 11, 1},
+    {8401, 6, 1},
+    {14752, 19, 1},
+    {7997, 14, 1},
+    {31774, 8, 1},
+    {0, 0, 0},
+    {55075, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {67428, 13, 1},
+    {39690, 15, 1},
+    {24368, 4, 1},
+    {36613, 7, 1},
+    {52949, 9, 1},
+    {72441, 11, 1},
+    {4256, 2, 1},
+    {19101, 19, 1},
+    {20103, 14, 1},
+    {68201, 6, 1},
+    {48017, 13, 1},
+    {12221, 8, 1},
+    {0, 0, 0},
+    {57243, 13, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {59070, 16, 1},
+    {55514, 24, 1},
+    {75667, 35, 1},
+    {5320, 7, 1},
+    {62319, 6, 1},
+    {21154, 11, 1},
+    {32336, 19, 1},
+    {48607, 15, 1},
+    {95517, 18, 1},
+    {69808, 9, 1},
+    {8013, 2, 1},
+    {47155, 15, 1},
+    {0, 0, 0},
+    {7925, 4, 1},
+    {52356, 17, 1},
+    {0, 0, 0},
+    {78997, 9, 1},
+    {0, 0, 0},
+    {52502, 13, 1},
+    {16593, 6, 1},
+    {0, 0, 0},
+    {68429, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {18784, 10, 1},
+    {44241, 17, 1},
+    {75220, 11, 1},
+    {325, 4, 1},
+    {48263, 6, 1},
+    {53671, 23, 1},
+    {93406, 15, 1},
+    {44409, 20, 1},
+    {0, 0, 0},
+    {97138, 13, 2},
+    {41746, 6, 1},
+    {83853, 10, 1},
+    {56637, 17, 1},
+    {60627, 7, 1},
+    {22075, 7, 1},
+    {107690, 17, 1},
+    {65606, 13, 1},
+    {50920, 9, 1},
+    {73552, 14, 1},
+    {24685, 12, 1},
+    {95535, 9, 1},
+    {27573, 11, 1},
+    {92984, 12, 1},
+    {20198, 7, 1},
+    {0, 0, 0},
+    {26553, 14, 1},
+    {86655, 17, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {6339, 16, 1},
+    {15180, 6, 1},
+    {15784, 7, 1},
+    {111119, 33, 1},
+    {0, 0, 0},
+    {24521, 7, 1},
+    {31484, 8, 1},
+    {0, 0, 0},
+    {50244, 12, 1},
+    {23157, 10, 1},
+    {90450, 20, 1},
+    {27397, 11, 1},
+    {18821, 5, 1},
+    {61745, 18, 1},
+    {54824, 13, 2},
+    {84560, 21, 1},
+    {43653, 16, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {103560, 20, 1},
+    {84897, 12, 1},
+    {0, 0, 0},
+    {110417, 19, 1},
+    {0, 0, 0},
+    {101659, 13, 1},
+    {0, 0, 0},
+    {29163, 12, 1},
+    {71874, 10, 1},
+    {11504, 16, 1},
+    {67182, 3, 1},
+    {13009, 15, 1},
+    {0, 0, 0},
+    {26934, 23, 1},
+    {55477, 17, 1},
+    {0, 0, 0},
+    {10585, 13, 1},
+    {88132, 3, 1},
+    {90997, 19, 1},
+    {56188, 11, 1},
+    {25973, 12, 1},
+    {30606, 3, 1},
+    {108327, 16, 1},
+    {85591, 14, 1},
+    {2725, 12, 1},
+    {8425, 6, 1},
+    {29832, 9, 1},
+    {47140, 15, 1},
+    {96928, 7, 1},
+    {50115, 11, 1},
+    {51513, 19, 1},
+    {35923, 9, 1},
+    {112233, 9, 1},
+    {70862, 5, 1},
+    {50105, 10, 1},
+    {0, 0, 0},
+    {60432, 24, 1},
+    {0, 0, 0},
+    {59296, 18, 1},
+    {4573, 7, 1},
+    {5313, 7, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {68105, 6, 1},
+    {28108, 24, 1},
+    {22876, 17, 1},
+    {37955, 5, 1},
+    {0, 0, 0},
+    {97312, 4, 1},
+    {54725, 15, 1},
+    {24956, 19, 1},
+    {69448, 12, 1},
+    {19351, 19, 1},
+    {0, 0, 0},
+    {79427, 14, 1},
+    {92959, 11, 1},
+    {68627, 6, 1},
+    {73524, 5, 1},
+    {102073, 13, 1},
+    {20624, 10, 1},
+    {19626, 15, 1},
+    {7915, 10, 1},
+    {30038, 9, 1},
+    {0, 0, 0},
+    {30651, 6, 1},
+    {64927, 11, 1},
+    {5715, 7, 1},
+    {85804, 12, 1},
+    {38969, 6, 1},
+    {0, 0, 0},
+    {100865, 19, 1},
+    {31753, 8, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {30615, 6, 1},
+    {0, 0, 0},
+    {47237, 2, 1},
+    {74784, 8, 1},
+    {53128, 9, 1},
+    {6146, 17, 1},
+    {79847, 17, 1},
+    {0, 0, 0},
+    {69711, 13, 1},
+    {0, 0, 0},
+    {81263, 19, 1},
+    {82130, 18, 1},
+    {97795, 9, 1},
+    {19210, 7, 1},
+    {97571, 7, 1},
+    {14438, 16, 1},
+    {0, 0, 0},
+    {107729, 8, 1},
+    {99187, 19, 1},
+    {15083, 34, 1},
+    {88890, 6, 1},
+    {52111, 5, 1},
+    {64028, 19, 1},
+    {97923, 6, 1},
+    {4992, 22, 1},
+    {23509, 10, 1},
+    {10720, 2, 1},
+    {59980, 16, 1},
+    {35567, 11, 1},
+    {71216, 17, 1},
+    {111621, 6, 1},
+    {0, 0, 0},
+    {70121, 9, 1},
+    {0, 0, 0},
+    {52617, 6, 1},
+    {31871, 8, 1},
+    {14346, 15, 1},
+    {30723, 6, 1},
+    {85083, 19, 1},
+    {57006, 3, 1},
+    {67871, 6, 1},
+    {13075, 8, 1},
+    {51240, 7, 1},
+    {61000, 19, 1},
+    {86705, 17, 1},
+    {98657, 46, 1},
+    {0, 0, 0},
+    {11109, 5, 1},
+    {0, 0, 0},
+    {70317, 8, 1},
+    {50947, 9, 1},
+    {0, 0, 0},
+    {73184, 18, 1},
+    {14290, 18, 1},
+    {26248, 17, 1},
+    {77354, 14, 1},
+    {61610, 4, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {998, 13, 1},
+    {68333, 6, 1},
+    {22945, 17, 1},
+    {4350, 16, 1},
+    {47800, 11, 1},
+    {70276, 13, 1},
+    {44367, 17, 1},
+    {46356, 13, 1},
+    {0, 0, 0},
+    {21562, 5, 1},
+    {46376, 7, 1},
+    {108343, 13, 1},
+    {37970, 5, 1},
+    {50362, 4, 1},
+    {46005, 11, 1},
+    {0, 0, 0},
+    {31737, 8, 1},
+    {87605, 4, 1},
+    {104344, 19, 1},
+    {70473, 5, 1},
+    {109162, 2, 1},
+    {0, 0, 0},
+    {8592, 10, 1},
+    {65478, 17, 1},
+    {69144, 18, 1},
+    {86508, 12, 1},
+    {8720, 11, 1},
+    {49568, 5, 1},
+    {15464, 5, 1},
+    {19822, 15, 1},
+    {12187, 2, 1},
+    {69745, 17, 1},
+    {67243, 15, 1},
+    {90109, 12, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {111401, 12, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {99750, 8, 1},
+    {89527, 21, 1},
+    {112463, 6, 1},
+    {12713, 9, 1},
+    {16185, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {112, 13, 1},
+    {26567, 13, 1},
+    {106226, 21, 1},
+    {55758, 21, 1},
+    {1319, 3, 1},
+    {1743, 6, 1},
+    {63408, 18, 1},
+    {0, 0, 0},
+    {60841, 13, 1},
+    {0, 0, 0},
+    {65684, 14, 1},
+    {111664, 9, 1},
+    {19715, 14, 1},
+    {18702, 8, 1},
+    {32452, 13, 1},
+    {16341, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {99676, 3, 1},
+    {43237, 9, 1},
+    {0, 0, 0},
+    {58492, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {70704, 10, 1},
+    {0, 0, 0},
+    {22202, 6, 1},
+    {36210, 8, 1},
+    {0, 0, 0},
+    {60072, 15, 1},
+    {110601, 14, 1},
+    {29272, 4, 1},
+    {25949, 12, 1},
+    {62027, 6, 1},
+    {67238, 5, 1},
+    {0, 0, 0},
+    {70615, 15, 1},
+    {93292, 10, 1},
+    {0, 0, 0},
+    {104666, 17, 1},
+    {0, 0, 0},
+    {5515, 5, 1},
+    {37172, 6, 1},
+    {101327, 21, 1},
+    {37261, 16, 1},
+    {109401, 6, 1},
+    {29499, 12, 1},
+    {4004, 12, 1},
+    {0, 0, 0},
+    {17836, 9, 1},
+    {25158, 7, 1},
+    {83401, 10, 1},
+    {31837, 8, 1},
+    {0, 0, 0},
+    {11899, 16, 1},
+    {101348, 22, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {6891, 16, 1},
+    {7105, 8, 1},
+    {23577, 9, 1},
+    {0, 0, 0},
+    {21117, 9, 1},
+    {80860, 2, 1},
+    {68543, 6, 1},
+    {52335, 9, 1},
+    {0, 0, 0},
+    {23277, 7, 1},
+    {0, 0, 0},
+    {110367, 21, 1},
+    {55779, 20, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {91622, 20, 1},
+    {36372, 5, 1},
+    {83772, 8, 1},
+    {26763, 18, 1},
+    {17855, 15, 1},
+    {64303, 6, 1},
+    {76866, 36, 1},
+    {74654, 5, 1},
+    {17797, 5, 1},
+    {4559, 10, 1},
+    {25428, 7, 1},
+    {80806, 3, 1},
+    {13899, 6, 1},
+    {80738, 17, 1},
+    {67669, 5, 1},
+    {71784, 17, 1},
+    {69080, 13, 1},
+    {15142, 5, 1},
+    {68905, 7, 1},
+    {72944, 10, 1},
+    {48952, 12, 1},
+    {0, 0, 0},
+    {24115, 10, 1},
+    {84165, 12, 1},
+    {0, 0, 0},
+    {43186, 9, 1},
+    {0, 0, 0},
+    {61388, 21, 1},
+    {61084, 9, 1},
+    {71454, 3, 1},
+    {66034, 16, 1},
+    {111368, 9, 1},
+    {0, 0, 0},
+    {76420, 34, 1},
+    {0, 0, 0},
+    {10156, 8, 1},
+    {65068, 6, 1},
+    {66050, 16, 1},
+    {104896, 15, 1},
+    {49130, 18, 1},
+    {87084, 17, 1},
+    {7334, 9, 1},
+    {16509, 6, 1},
+    {0, 0, 0},
+    {52976, 17, 1},
+    {0, 0, 0},
+    {54782, 6, 1},
+    {27768, 20, 1},
+    {0, 0, 0},
+    {26979, 16, 1},
+    {90933, 9, 1},
+    {24673, 12, 1},
+    {0, 0, 0},
+    {11261, 9, 1},
+    {97491, 20, 1},
+    {106645, 13, 1},
+    {109699, 5, 1},
+    {101853, 11, 1},
+    {70453, 5, 1},
+    {73167, 8, 1},
+    {5696, 11, 1},
+    {56999, 5, 1},
+    {10030, 6, 1},
+    {29767, 10, 1},
+    {86590, 20, 1},
+    {35387, 11, 1},
+    {83150, 9, 1},
+    {85071, 12, 1},
+    {36447, 7, 1},
+    {62301, 6, 1},
+    {0, 0, 0},
+    {17201, 12, 1},
+    {55844, 23, 1},
+    {103357, 13, 1},
+    {37797, 12, 1},
+    {4532, 13, 1},
+    {111979, 9, 1},
+    {82494, 20, 1},
+    {86294, 7, 1},
+    {8252, 11, 1},
+    {31071, 6, 1},
+    {22334, 6, 1},
+    {11001, 6, 1},
+    {93044, 10, 1},
+    {12946, 21, 1},
+    {95712, 12, 1},
+    {38393, 19, 1},
+    {7775, 12, 1},
+    {0, 0, 0},
+    {33713, 15, 1},
+    {13245, 9, 1},
+    {0, 0, 0},
+    {24266, 8, 1},
+    {0, 0, 0},
+    {94020, 34, 1},
+    {61488, 24, 1},
+    {39100, 16, 1},
+    {0, 0, 0},
+    {1062, 10, 1},
+    {105462, 11, 1},
+    {26865, 17, 1},
+    {27668, 9, 1},
+    {0, 0, 0},
+    {20006, 12, 1},
+    {20852, 18, 1},
+    {94740, 2, 1},
+    {0, 0, 0},
+    {92156, 18, 1},
+    {28883, 17, 1},
+    {4082, 12, 1},
+    {62855, 14, 1},
+    {7728, 6, 1},
+    {0, 0, 0},
+    {16425, 6, 1},
+    {26704, 7, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {26739, 9, 1},
+    {108107, 22, 1},
+    {5069, 21, 1},
+    {0, 0, 0},
+    {110615, 12, 1},
+    {2839, 9, 1},
+    {0, 0, 0},
+    {40438, 16, 1},
+    {0, 0, 0},
+    {77939, 8, 1},
+    {0, 0, 0},
+    {8290, 6, 1},
+    {103620, 16, 1},
+    {15454, 5, 1},
+    {29820, 12, 1},
+    {14854, 14, 1},
+    {88888, 2, 1},
+    {45478, 20, 1},
+    {16671, 6, 1},
+    {21252, 18, 1},
+    {97647, 11, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {3678, 35, 1},
+    {0, 0, 0},
+    {18695, 7, 1},
+    {30102, 6, 1},
+    {50983, 9, 1},
+    {28044, 17, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {70413, 12, 2},
+    {29052, 10, 1},
+    {87915, 13, 1},
+    {0, 0, 0},
+    {38151, 16, 1},
+    {74584, 8, 1},
+    {46166, 2, 1},
+    {0, 0, 0},
+    {47417, 15, 1},
+    {74668, 5, 1},
+    {91948, 6, 1},
+    {69799, 9, 1},
+    {19911, 9, 1},
+    {16569, 6, 1},
+    {45123, 15, 1},
+    {12487, 8, 1},
+    {47939, 20, 1},
+    {61937, 6, 1},
+    {21729, 6, 1},
+    {27100, 11, 1},
+    {0, 0, 0},
+    {91447, 17, 1},
+    {56842, 18, 1},
+    {0, 0, 0},
+    {23222, 13, 1},
+    {62995, 5, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {88904, 2, 1},
+    {112101, 6, 1},
+    {0, 0, 0},
+    {64450, 20, 1},
+    {720, 2, 1},
+    {0, 0, 0},
+    {97544, 12, 1},
+    {37214, 5, 1},
+    {102469, 22, 1},
+    {62649, 6, 1},
+    {100442, 10, 1},
+    {32743, 24, 1},
+    {96935, 17, 1},
+    {56598, 16, 1},
+    {92499, 6, 1},
+    {80933, 5, 1},
+    {64938, 6, 1},
+    {62087, 6, 1},
+    {14193, 18, 4},
+    {24901, 10, 1},
+    {663, 4, 1},
+    {8865, 11, 1},
+    {74230, 13, 1},
+    {33734, 13, 1},
+    {87390, 17, 1},
+    {38580, 7, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {60683, 7, 1},
+    {90121, 10, 1},
+    {8602, 11, 1},
+    {78371, 19, 1},
+    {83506, 23, 1},
+    {23345, 18, 1},
+    {95684, 14, 1},
+    {54412, 18, 1},
+    {6981, 22, 1},
+    {39724, 15, 1},
+    {47432, 15, 1},
+    {104314, 14, 1},
+    {103671, 19, 1},
+    {9143, 15, 1},
+    {109625, 3, 1},
+    {28011, 16, 1},
+    {6289, 17, 1},
+    {38524, 7, 1},
+    {52714, 7, 1},
+    {102229, 10, 1},
+    {23531, 18, 1},
+    {41795, 4, 1},
+    {50803, 9, 1},
+    {43745, 16, 1},
+    {6039, 2, 1},
+    {8336, 11, 1},
+    {0, 0, 0},
+    {25043, 16, 1},
+    {78606, 3, 1},
+    {7327, 7, 1},
+    {19196, 8, 1},
+    {49850, 8, 1},
+    {0, 0, 0},
+    {51489, 5, 1},
+    {65732, 9, 1},
+    {0, 0, 0},
+    {48030, 13, 1},
+    {67289, 15, 1},
+    {0, 0, 0},
+    {108581, 5, 1},
+    {52557, 9, 1},
+    {62631, 6, 1},
+    {102556, 15, 1},
+    {32096, 2, 1},
+    {30592, 7, 1},
+    {11729, 14, 1},
+    {49933, 13, 1},
+    {61827, 11, 1},
+    {72153, 11, 1},
+    {39460, 21, 1},
+    {77978, 10, 1},
+    {89346, 14, 1},
+    {0, 0, 0},
+    {16125, 6, 1},
+    {0, 0, 0},
+    {32263, 5, 1},
+    {31158, 6, 1},
+    {0, 0, 0},
+    {72110, 9, 1},
+    {22828, 13, 1},
+    {52079, 17, 1},
+    {48352, 3, 1},
+    {0, 0, 0},
+    {65899, 18, 1},
+    {100528, 12, 1},
+    {68117, 6, 1},
+    {81461, 19, 1},
+    {13353, 19, 1},
+    {10887, 16, 1},
+    {111587, 9, 1},
+    {110721, 10, 1},
+    {101480, 24, 1},
+    {0, 0, 0},
+    {54567, 13, 1},
+    {12269, 8, 1},
+    {42713, 11, 1},
+    {48655, 18, 1},
+    {8479, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {14880, 11, 1},
+    {0, 0, 0},
+    {43275, 20, 1},
+    {86722, 15, 1},
+    {62421, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {13947, 13, 1},
+    {82587, 18, 1},
+    {19258, 4, 1},
+    {10681, 16, 1},
+    {6371, 9, 1},
+    {65776, 6, 1},
+    {0, 0, 0},
+    {1914, 6, 1},
+    {65304, 12, 1},
+    {90593, 12, 1},
+    {0, 0, 0},
+    {7149, 10, 1},
+    {79304, 12, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {51461, 5, 1},
+    {22346, 6, 1},
+    {0, 0, 0},
+    {75307, 9, 1},
+    {71893, 9, 1},
+    {61640, 2, 1},
+    {38002, 14, 1},
+    {40565, 17, 1},
+    {85474, 5, 1},
+    {18628, 15, 1},
+    {0, 0, 0},
+    {18588, 14, 1},
+    {73949, 7, 1},
+    {68387, 6, 1},
+    {0, 0, 0},
+    {22870, 6, 1},
+    {39775, 19, 1},
+    {94406, 31, 1},
+    {107027, 9, 1},
+    {107672, 18, 1},
+    {96808, 4, 1},
+    {52379, 13, 1},
+    {37036, 19, 1},
+    {58892, 7, 1},
+    {88204, 4, 1},
+    {99917, 12, 1},
+    {10747, 9, 2},
+    {76557, 30, 1},
+    {0, 0, 0},
+    {111615, 6, 1},
+    {0, 0, 0},
+    {51913, 11, 1},
+    {53119, 9, 1},
+    {0, 0, 0},
+    {24787, 16, 1},
+    {70247, 5, 1},
+    {51876, 24, 1},
+    {67498, 17, 1},
+    {50635, 6, 1},
+    {18484, 15, 1},
+    {67550, 15, 1},
+    {0, 0, 0},
+    {54430, 4, 1},
+    {34770, 17, 1},
+    {29043, 9, 1},
+    {36471, 2, 1},
+    {62313, 6, 1},
+    {110682, 13, 1},
+    {0, 0, 0},
+    {78984, 3, 1},
+    {100358, 12, 1},
+    {111973, 6, 1},
+    {0, 0, 0},
+    {3971, 3, 1},
+    {87949, 6, 1},
+    {31232, 6, 1},
+    {53486, 21, 1},
+    {51393, 6, 1},
+    {74999, 9, 1},
+    {16023, 6, 1},
+    {54103, 8, 1},
+    {10727, 5, 1},
+    {26085, 14, 1},
+    {55141, 6, 1},
+    {106967, 14, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {9522, 11, 1},
+    {68699, 6, 1},
+    {86273, 11, 1},
+    {24372, 9, 1},
+    {0, 0, 0},
+    {20575, 6, 1},
+    {52468, 12, 1},
+    {0, 0, 0},
+    {21879, 6, 1},
+    {104380, 12, 1},
+    {36626, 10, 1},
+    {38664, 7, 1},
+    {91911, 12, 1},
+    {71509, 11, 1},
+    {47887, 17, 1},
+    {104406, 12, 1},
+    {59562, 12, 1},
+    {83365, 3, 1},
+    {108129, 20, 1},
+    {45576, 18, 1},
+    {82435, 14, 1},
+    {12620, 8, 1},
+    {67985, 6, 1},
+    {13497, 22, 1},
+    {33524, 14, 1},
+    {48984, 21, 1},
+    {25515, 9, 1},
+    {0, 0, 0},
+    {104285, 14, 1},
+    {100740, 13, 1},
+    {0, 0, 0},
+    {38775, 3, 1},
+    {0, 0, 0},
+    {4511, 21, 1},
+    {0, 0, 0},
+    {64315, 6, 2},
+    {53925, 2, 1},
+    {49883, 17, 1},
+    {0, 0, 0},
+    {5979, 7, 1},
+    {101228, 25, 1},
+    {18262, 8, 1},
+    {6907, 11, 1},
+    {0, 0, 0},
+    {38028, 16, 1},
+    {94779, 4, 1},
+    {0, 0, 0},
+    {37518, 15, 1},
+    {55363, 6, 1},
+    {35260, 12, 1},
+    {109267, 3, 1},
+    {65771, 5, 1},
+    {30114, 6, 1},
+    {25719, 7, 1},
+    {70170, 8, 1},
+    {41880, 13, 1},
+    {5197, 9, 1},
+    {109525, 6, 1},
+    {87269, 18, 1},
+    {52175, 4, 1},
+    {59674, 5, 1},
+    {0, 0, 0},
+    {71074, 9, 1},
+    {6469, 11, 1},
+    {0, 0, 0},
+    {84581, 5, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {38216, 25, 1},
+    {84381, 13, 1},
+    {57981, 15, 1},
+    {27850, 18, 1},
+    {13481, 16, 1},
+    {30132, 6, 1},
+    {112427, 9, 1},
+    {97191, 2, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {110222, 11, 1},
+    {4718, 17, 1},
+    {2737, 6, 1},
+    {28293, 17, 1},
+    {93191, 17, 1},
+    {24706, 9, 1},
+    {19979, 3, 1},
+    {0, 0, 0},
+    {56475, 15, 1},
+    {40994, 20, 1},
+    {0, 0, 0},
+    {42585, 5, 1},
+    {61669, 5, 1},
+    {100554, 11, 1},
+    {0, 0, 0},
+    {104556, 12, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {88244, 10, 1},
+    {70932, 5, 1},
+    {38531, 7, 1},
+    {17330, 7, 1},
+    {37086, 2, 1},
+    {40018, 16, 1},
+    {18469, 11, 2},
+    {6180, 2, 1},
+    {42937, 9, 1},
+    {93787, 15, 1},
+    {53917, 8, 1},
+    {0, 0, 0},
+    {35640, 8, 1},
+    {67597, 9, 1},
+    {15662, 8, 2},
+    {48125, 20, 1},
+    {24641, 14, 1},
+    {10661, 8, 1},
+    {36663, 12, 1},
+    {77111, 26, 1},
+    {28938, 5, 1},
+    {22372, 6, 1},
+    {9173, 15, 1},
+    {32057, 4, 1},
+    {0, 0, 0},
+    {112185, 9, 1},
+    {110076, 13, 1},
+    {0, 0, 0},
+    {24948, 6, 1},
+    {0, 0, 0},
+    {69520, 13, 1},
+    {21867, 6, 1},
+    {48145, 19, 1},
+    {17561, 7, 1},
+    {70489, 5, 1},
+    {42844, 9, 1},
+    {21704, 16, 1},
+    {93648, 8, 1},
+    {0, 0, 0},
+    {21038, 15, 1},
+    {64411, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {92138, 18, 1},
+    {5883, 11, 1},
+    {17263, 4, 1},
+    {92901, 15, 1},
+    {92533, 10, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {89671, 16, 1},
+    {63027, 6, 1},
+    {104752, 10, 1},
+    {104775, 22, 1},
+    {0, 0, 0},
+    {112337, 9, 1},
+    {109143, 12, 1},
+    {25545, 11, 1},
+    {23785, 6, 1},
+    {46073, 5, 1},
+    {83960, 12, 1},
+    {61591, 8, 1},
+    {20338, 8, 1},
+    {67057, 16, 2},
+    {50430, 6, 1},
+    {86350, 9, 1},
+    {15873, 6, 1},
+    {92642, 2, 1},
+    {21096, 11, 1},
+    {1331, 4, 1},
+    {6645, 15, 1},
+    {7248, 8, 1},
+    {62709, 7, 1},
+    {41298, 18, 1},
+    {63921, 5, 1},
+    {51083, 6, 1},
+    {9665, 12, 1},
+    {42690, 17, 1},
+    {89010, 5, 1},
+    {54043, 6, 1},
+    {49418, 11, 1},
+    {51229, 11, 1},
+    {19737, 15, 1},
+    {0, 0, 0},
+    {5679, 5, 1},
+    {74491, 6, 1},
+    {13254, 21, 1},
+    {19907, 2, 1},
+    {4841, 16, 1},
+    {70975, 3, 1},
+    {74880, 7, 1},
+    {0, 0, 0},
+    {9994, 7, 1},
+    {0, 0, 0},
+    {1439, 3, 1},
+    {19939, 17, 1},
+    {70236, 11, 1},
+    {71697, 4, 1},
+    {48964, 20, 1},
+    {13647, 24, 1},
+    {11450, 13, 1},
+    {9749, 3, 1},
+    {53932, 5, 1},
+    {31599, 7, 1},
+    {52993, 15, 1},
+    {33575, 13, 1},
+    {94650, 9, 1},
+    {7256, 15, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {6583, 8, 1},
+    {31937, 2, 1},
+    {46530, 11, 1},
+    {54474, 10, 1},
+    {7235, 13, 1},
+    {1038, 24, 1},
+    {29879, 21, 1},
+    {21909, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {96172, 34, 1},
+    {79808, 19, 1},
+    {20346, 5, 1},
+    {28578, 21, 1},
+    {63059, 19, 1},
+    {0, 0, 0},
+    {54434, 8, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {15311, 12, 1},
+    {16233, 6, 1},
+    {28132, 20, 1},
+    {53320, 8, 1},
+    {0, 0, 0},
+    {69068, 12, 1},
+    {45460, 18, 1},
+    {15358, 5, 1},
+    {47191, 8, 1},
+    {13586, 8, 1},
+    {0, 0, 0},
+    {15570, 5, 1},
+    {18643, 13, 1},
+    {81556, 20, 1},
+    {25010, 6, 1},
+    {0, 0, 0},
+    {73968, 6, 1},
+    {44825, 10, 1},
+    {32086, 5, 1},
+    {15595, 5, 1},
+    {0, 0, 0},
+    {64748, 11, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {21777, 6, 1},
+    {74390, 21, 1},
+    {21801, 6, 1},
+    {95599, 9, 1},
+    {58239, 19, 1},
+    {62938, 9, 1},
+    {107803, 16, 1},
+    {55285, 6, 1},
+    {0, 0, 0},
+    {51750, 6, 1},
+    {108535, 9, 1},
+    {20821, 13, 1},
+    {0, 0, 0},
+    {88945, 5, 1},
+    {38479, 6, 1},
+    {0, 0, 0},
+    {36588, 8, 1},
+    {0, 0, 0},
+    {8081, 6, 1},
+    {0, 0, 0},
+    {49496, 10, 1},
+    {0, 0, 0},
+    {4172, 23, 1},
+    {90347, 15, 1},
+    {91464, 20, 1},
+    {17234, 14, 1},
+    {95729, 35, 1},
+    {15620, 11, 1},
+    {109685, 9, 1},
+    {0, 0, 0},
+    {37886, 9, 1},
+    {53968, 5, 1},
+    {69021, 11, 1},
+    {30090, 6, 1},
+    {41156, 19, 1},
+    {102752, 11, 1},
+    {79286, 9, 1},
+    {80491, 13, 1},
+    {15275, 5, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {21747, 6, 1},
+    {455, 4, 1},
+    {104299, 15, 1},
+    {49869, 5, 1},
+    {62523, 6, 1},
+    {13767, 16, 1},
+    {74721, 7, 1},
+    {54259, 15, 1},
+    {11988, 21, 1},
+    {8037, 6, 1},
+    {106616, 16, 1},
+    {19873, 15, 1},
+    {10772, 8, 1},
+    {0, 0, 0},
+    {16149, 6, 1},
+    {0, 0, 0},
+    {8613, 12, 1},
+    {31492, 10, 1},
+    {73898, 3, 1},
+    {28187, 20, 1},
+    {0, 0, 0},
+    {39421, 13, 1},
+    {53881, 5, 1},
+    {79160, 10, 1},
+    {0, 0, 0},
+    {83838, 15, 1},
+    {18317, 15, 1},
+    {105240, 20, 1},
+    {83425, 8, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {8377, 12, 1},
+    {31688, 10, 1},
+    {63961, 8, 1},
+    {0, 0, 0},
+    {97445, 11, 1},
+    {0, 0, 0},
+    {106025, 15, 1},
+    {36019, 11, 1},
+    {92442, 5, 1},
+    {84330, 9, 1},
+    {51412, 20, 1},
+    {56415, 15, 1},
+    {64840, 11, 1},
+    {58856, 13, 1},
+    {55189, 6, 1},
+    {69191, 16, 1},
+    {30831, 6, 1},
+    {52417, 10, 1},
+    {112376, 6, 1},
+    {104797, 12, 1},
+    {97711, 14, 1},
+    {15870, 3, 1},
+    {99966, 5, 1},
+    {0, 0, 0},
+    {10756, 16, 2},
+    {0, 0, 0},
+    {0, 0, 0},
+    {101992, 13, 1},
+    {90834, 11, 2},
+    {87305, 17, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {15439, 5, 1},
+    {74919, 9, 1},
+    {86796, 17, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {95379, 9, 1},
+    {54274, 13, 1},
+    {38594, 7, 1},
+    {112418, 9, 1},
+    {0, 0, 0},
+    {73665, 6, 1},
+    {56549, 14, 1},
+    {112448, 9, 1},
+    {88148, 5, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {68639, 6, 1},
+    {20686, 10, 1},
+    {0, 0, 0},
+    {101214, 14, 1},
+    {506, 16, 1},
+    {73093, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {25463, 7, 1},
+    {92778, 17, 1},
+    {4258, 6, 1},
+    {37944, 6, 1},
+    {99995, 3, 1},
+    {14433, 5, 1},
+    {94574, 5, 1},
+    {108052, 19, 1},
+    {90776, 14, 1},
+    {31431, 5, 1},
+    {112469, 6, 1},
+    {20327, 3, 1},
+    {81914, 18, 1},
+    {94204, 11, 1},
+    {0, 0, 0},
+    {70577, 6, 1},
+    {10922, 15, 1},
+    {7794, 13, 1},
+    {47634, 10, 1},
+    {7429, 10, 1},
+    {96973, 8, 1},
+    {0, 0, 0},
+    {696, 16, 1},
+    {0, 0, 0},
+    {93146, 2, 1},
+    {82357, 19, 1},
+    {75349, 4, 1},
+    {41626, 16, 1},
+    {88173, 2, 1},
+    {3101, 5, 1},
+    {92916, 20, 1},
+    {6508, 14, 1},
+    {47218, 2, 1},
+    {0, 0, 0},
+    {65917, 14, 1},
+    {97746, 22, 1},
+    {78625, 11, 1},
+    {67073, 9, 2},
+    {14157, 4, 1},
+    {80719, 19, 1},
+    {60120, 15, 1},
+    {19729, 8, 1},
+    {34946, 16, 1},
+    {49612, 18, 1},
+    {0, 0, 0},
+    {75442, 31, 1},
+    {0, 0, 0},
+    {11099, 8, 1},
+    {94732, 2, 1},
+    {9269, 11, 1},
+    {36833, 10, 1},
+    {52636, 17, 1},
+    {0, 0, 0},
+    {33241, 9, 1},
+    {30478, 10, 1},
+    {20587, 6, 1},
+    {93429, 11, 1},
+    {50677, 9, 1},
+    {0, 0, 0},
+    {30368, 6, 1},
+    {80755, 15, 1},
+    {36653, 10, 1},
+    {70358, 9, 1},
+    {16713, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {925, 5, 1},
+    {16101, 6, 1},
+    {4461, 10, 1},
+    {8503, 6, 1},
+    {104821, 9, 1},
+    {0, 0, 0},
+    {2783, 12, 1},
+    {58018, 5, 1},
+    {42377, 6, 1},
+    {93128, 18, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {93724, 16, 1},
+    {30621, 6, 1},
+    {46949, 19, 1},
+    {0, 0, 0},
+    {73500, 11, 1},
+    {110731, 8, 1},
+    {67907, 6, 1},
+    {1570, 8, 1},
+    {10319, 8, 1},
+    {0, 0, 0},
+    {55333, 6, 1},
+    {0, 0, 0},
+    {107322, 18, 1},
+    {64399, 6, 1},
+    {76788, 39, 1},
+    {1408, 22, 1},
+    {73847, 6, 1},
+    {0, 0, 0},
+    {47724, 14, 1},
+    {49660, 14, 1},
+    {5732, 17, 1},
+    {17535, 13, 1},
+    {31414, 2, 1},
+    {109583, 8, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {70540, 8, 1},
+    {59116, 7, 1},
+    {63548, 20, 1},
+    {71992, 6, 1},
+    {75562, 26, 1},
+    {102800, 16, 1},
+    {57168, 19, 1},
+    {0, 0, 0},
+    {24767, 20, 1},
+    {75196, 14, 1},
+    {9401, 11, 1},
+    {68555, 6, 1},
+    {0, 0, 0},
+    {5109, 17, 1},
+    {62673, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {60888, 16, 1},
+    {107466, 5, 1},
+    {70478, 9, 1},
+    {3948, 14, 1},
+    {111044, 12, 1},
+    {105735, 11, 1},
+    {17131, 7, 1},
+    {65978, 17, 1},
+    {5221, 6, 1},
+    {0, 0, 0},
+    {42566, 8, 1},
+    {108208, 19, 1},
+    {54981, 18, 1},
+    {64614, 14, 1},
+    {108809, 8, 1},
+    {73487, 13, 1},
+    {45594, 16, 1},
+    {105631, 16, 1},
+    {0, 0, 0},
+    {42447, 9, 1},
+    {66647, 16, 1},
+    {67865, 6, 1},
+    {29430, 2, 1},
+    {52490, 12, 1},
+    {0, 0, 0},
+    {83030, 11, 1},
+    {50731, 9, 1},
+    {72652, 7, 1},
+    {44720, 13, 1},
+    {49034, 17, 1},
+    {39236, 9, 1},
+    {69517, 3, 1},
+    {105005, 19, 1},
+    {83756, 16, 1},
+    {37704, 13, 1},
+    {88876, 3, 1},
+    {51532, 13, 1},
+    {102738, 14, 1},
+    {0, 0, 0},
+    {31716, 6, 1},
+    {95441, 11, 1},
+    {67579, 10, 1},
+    {78596, 10, 1},
+    {11081, 10, 1},
+    {30669, 6, 1},
+    {28533, 9, 1},
+    {16563, 6, 1},
+    {87955, 10, 1},
+    {30538, 16, 1},
+    {7862, 11, 1},
+    {29585, 8, 1},
+    {111898, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {93235, 15, 1},
+    {109013, 19, 1},
+    {0, 0, 0},
+    {5014, 16, 1},
+    {106721, 17, 1},
+    {86942, 13, 1},
+    {90041, 7, 1},
+    {65246, 11, 1},
+    {16215, 6, 1},
+    {24186, 15, 2},
+    {42273, 3, 1},
+    {71188, 5, 1},
+    {14368, 2, 1},
+    {85960, 16, 1},
+    {27342, 11, 1},
+    {54624, 5, 1},
+    {53937, 2, 1},
+    {52683, 11, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {53459, 9, 1},
+    {24739, 15, 1},
+    {78947, 17, 1},
+    {66747, 4, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {32727, 16, 1},
+    {93318, 9, 1},
+    {31140, 6, 1},
+    {107376, 14, 1},
+    {0, 0, 0},
+    {8181, 10, 1},
+    {88254, 17, 1},
+    {45531, 13, 1},
+    {29981, 5, 1},
+    {63019, 2, 1},
+    {23919, 30, 1},
+    {13426, 21, 1},
+    {73853, 4, 1},
+    {14723, 12, 1},
+    {0, 0, 0},
+    {50352, 10, 1},
+    {24486, 4, 1},
+    {54007, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {81949, 24, 1},
+    {24064, 14, 1},
+    {37975, 14, 1},
+    {44954, 18, 1},
+    {48330, 10, 1},
+    {18677, 5, 1},
+    {78361, 10, 1},
+    {73636, 17, 1},
+    {61599, 11, 1},
+    {0, 0, 0},
+    {16011, 6, 1},
+    {40949, 6, 1},
+    {0, 0, 0},
+    {88573, 13, 1},
+    {0, 0, 0},
+    {5652, 9, 1},
+    {86369, 9, 1},
+    {0, 0, 0},
+    {80360, 13, 1},
+    {7378, 12, 1},
+    {51485, 4, 1},
+    {2388, 8, 1},
+    {0, 0, 0},
+    {88833, 5, 1},
+    {30735, 6, 1},
+    {25695, 14, 1},
+    {46171, 19, 1},
+    {70989, 11, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {66708, 14, 1},
+    {81152, 12, 1},
+    {97325, 9, 1},
+    {87480, 19, 1},
+    {30903, 6, 1},
+    {74464, 12, 1},
+    {28708, 12, 2},
+    {105138, 12, 1},
+    {0, 0, 0},
+    {26199, 5, 1},
+    {64691, 6, 1},
+    {0, 0, 0},
+    {16581, 6, 1},
+    {2107, 16, 1},
+    {98703, 45, 1},
+    {85528, 17, 1},
+    {57670, 17, 1},
+    {108247, 6, 1},
+    {77963, 10, 1},
+    {63088, 13, 1},
+    {52408, 7, 1},
+    {11876, 6, 1},
+    {93341, 6, 1},
+    {53867, 5, 1},
+    {22154, 6, 1},
+    {72807, 6, 1},
+    {786, 5, 1},
+    {45053, 18, 1},
+    {16173, 6, 1},
+    {34713, 14, 1},
+    {0, 0, 0},
+    {75264, 10, 1},
+    {82813, 19, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {25599, 14, 1},
+    {37871, 15, 1},
+    {0, 0, 0},
+    {72580, 11, 1},
+    {11293, 6, 1},
+    {0, 0, 0},
+    {71980, 6, 1},
+    {0, 0, 0},
+    {68369, 6, 1},
+    {37565, 9, 1},
+    {73143, 8, 1},
+    {40851, 7, 1},
+    {52309, 9, 1},
+    {55243, 6, 1},
+    {0, 0, 0},
+    {79672, 5, 1},
+    {69120, 12, 1},
+    {24308, 7, 1},
+    {0, 0, 0},
+    {27970, 19, 1},
+    {68045, 6, 1},
+    {32867, 19, 1},
+    {16041, 6, 1},
+    {19268, 11, 1},
+    {1846, 17, 1},
+    {61093, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {82241, 21, 1},
+    {81774, 22, 1},
+    {8569, 16, 1},
+    {80549, 12, 1},
+    {0, 0, 0},
+    {69851, 18, 1},
+    {36194, 9, 1},
+    {95492, 8, 1},
+    {67644, 5, 1},
+    {99566, 7, 1},
+    {4274, 4, 1},
+    {0, 0, 0},
+    {14454, 15, 1},
+    {43993, 20, 1},
+    {65388, 16, 1},
+    {35411, 2, 1},
+    {54552, 15, 1},
+    {94215, 17, 1},
+    {31053, 6, 1},
+    {58726, 11, 1},
+    {24402, 6, 1},
+    {72778, 7, 1},
+    {87849, 12, 1},
+    {81064, 16, 1},
+    {50704, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {23185, 7, 1},
+    {17316, 7, 1},
+    {0, 0, 0},
+    {51061, 13, 1},
+    {61895, 6, 1},
+    {12197, 8, 1},
+    {13372, 18, 1},
+    {108601, 4, 1},
+    {67332, 12, 1},
+    {59778, 9, 1},
+    {85734, 20, 1},
+    {60739, 19, 1},
+    {35443, 8, 1},
+    {47672, 13, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {62169, 6, 1},
+    {112394, 9, 1},
+    {2929, 6, 1},
+    {36473, 6, 1},
+    {0, 0, 0},
+    {103915, 16, 1},
+    {12811, 4, 1},
+    {103051, 11, 1},
+    {0, 0, 0},
+    {82920, 11, 1},
+    {85605, 21, 1},
+    {0, 0, 0},
+    {105392, 15, 1},
+    {0, 0, 0},
+    {96585, 3, 1},
+    {67961, 6, 1},
+    {103457, 13, 1},
+    {76938, 36, 1},
+    {3713, 35, 1},
+    {88586, 7, 1},
+    {23120, 17, 1},
+    {4692, 7, 1},
+    {8533, 6, 1},
+    {24989, 5, 1},
+    {0, 0, 0},
+    {26268, 6, 1},
+    {87565, 15, 1},
+    {25676, 8, 1},
+    {0, 0, 0},
+    {76197, 37, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {104274, 11, 1},
+    {75836, 39, 1},
+    {38467, 6, 1},
+    {34906, 19, 1},
+    {67817, 6, 1},
+    {62205, 6, 1},
+    {52124, 9, 1},
+    {96102, 35, 1},
+    {17613, 13, 1},
+    {104167, 15, 1},
+    {0, 0, 0},
+    {62045, 6, 1},
+    {68489, 6, 1},
+    {58575, 12, 1},
+    {0, 0, 0},
+    {89791, 15, 1},
+    {0, 0, 0},
+    {36571, 5, 1},
+    {66115, 5, 1},
+    {38813, 18, 1},
+    {58666, 2, 1},
+    {0, 0, 0},
+    {99857, 14, 1},
+    {86378, 9, 1},
+    {89946, 9, 1},
+    {66761, 2, 1},
+    {0, 0, 0},
+    {111206, 9, 1},
+    {0, 0, 0},
+    {102036, 15, 1},
+    {56461, 14, 1},
+    {51618, 18, 1},
+    {49198, 16, 1},
+    {0, 0, 0},
+    {62397, 6, 1},
+    {27276, 11, 1},
+    {62873, 10, 1},
+    {0, 0, 0},
+    {42835, 9, 1},
+    {0, 0, 0},
+    {45630, 21, 1},
+    {88793, 18, 1},
+    {73151, 8, 1},
+    {15605, 5, 1},
+    {22480, 6, 1},
+    {86175, 2, 1},
+    {0, 0, 0},
+    {41063, 14, 1},
+    {17709, 9, 1},
+    {10552, 20, 1},
+    {81796, 16, 1},
+    {54019, 6, 1},
+    {45396, 13, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {54629, 15, 1},
+    {80323, 12, 1},
+    {21567, 5, 1},
+    {101419, 17, 1},
+    {0, 0, 0},
+    {11500, 4, 1},
+    {107638, 17, 1},
+    {72513, 10, 1},
+    {6866, 8, 1},
+    {14680, 12, 1},
+    {68465, 6, 1},
+    {15540, 5, 1},
+    {1645, 5, 1},
+    {35655, 7, 1},
+    {62271, 6, 1},
+    {52373, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {84421, 12, 1},
+    {33356, 21, 1},
+    {88985, 6, 1},
+    {2641, 9, 1},
+    {5510, 5, 1},
+    {17764, 6, 1},
+    {71958, 9, 1},
+    {90393, 17, 1},
+    {60697, 7, 1},
+    {30386, 10, 1},
+    {0, 0, 0},
+    {31095, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {20084, 10, 1},
+    {72751, 9, 1},
+    {80264, 8, 1},
+    {54339, 20, 1},
+    {29905, 9, 1},
+    {21849, 6, 1},
+    {100113, 3, 1},
+    {10795, 17, 1},
+    {57298, 8, 1},
+    {69392, 6, 1},
+    {0, 0, 0},
+    {880, 5, 1},
+    {0, 0, 0},
+    {23529, 2, 1},
+    {50491, 18, 1},
+    {21371, 14, 1},
+    {73389, 17, 1},
+    {42777, 4, 1},
+    {59530, 13, 1},
+    {0, 0, 0},
+    {27133, 11, 1},
+    {1311, 2, 1},
+    {0, 0, 0},
+    {14771, 19, 1},
+    {98415, 50, 1},
+    {63449, 18, 1},
+    {78403, 16, 1},
+    {112116, 9, 1},
+    {62511, 6, 1},
+    {88428, 12, 1},
+    {93173, 6, 1},
+    {88829, 4, 1},
+    {77220, 14, 1},
+    {103654, 17, 1},
+    {25770, 7, 1},
+    {103114, 11, 1},
+    {97830, 5, 1},
+    {46585, 18, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {75094, 13, 1},
+    {85412, 16, 1},
+    {38987, 6, 1},
+    {90048, 16, 1},
+    {5917, 17, 1},
+    {22106, 6, 1},
+    {106040, 15, 1},
+    {53953, 5, 1},
+    {88950, 5, 1},
+    {41761, 14, 1},
+    {103142, 10, 1},
+    {51762, 12, 1},
+    {24249, 17, 1},
+    {72852, 8, 1},
+    {9754, 5, 1},
+    {112194, 12, 1},
+    {72466, 5, 1},
+    {0, 0, 0},
+    {71487, 11, 1},
+    {0, 0, 0},
+    {31268, 6, 1},
+    {0, 0, 0},
+    {747, 5, 1},
+    {55321, 6, 1},
+    {0, 0, 0},
+    {27144, 11, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {727, 5, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {68423, 6, 1},
+    {0, 0, 0},
+    {66676, 6, 1},
+    {39213, 8, 1},
+    {63127, 18, 1},
+    {104524, 19, 1},
+    {85976, 16, 1},
+    {70393, 9, 1},
+    {830, 5, 1},
+    {105676, 14, 1},
+    {0, 0, 0},
+    {67048, 9, 2},
+    {0, 0, 0},
+    {67781, 6, 1},
+    {0, 0, 0},
+    {72471, 10, 1},
+    {16497, 6, 1},
+    {109654, 17, 1},
+    {110251, 19, 1},
+    {112083, 6, 1},
+    {109943, 12, 1},
+    {49517, 12, 1},
+    {85244, 8, 1},
+    {7807, 7, 1},
+    {7027, 25, 1},
+    {0, 0, 0},
+    {60655, 7, 1},
+    {5813, 16, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {86767, 17, 1},
+    {48246, 3, 1},
+    {0, 0, 0},
+    {85836, 6, 1},
+    {67034, 14, 1},
+    {19245, 6, 1},
+    {14370, 5, 1},
+    {61973, 6, 1},
+    {5345, 7, 1},
+    {6926, 8, 1},
+    {0, 0, 0},
+    {39532, 17, 1},
+    {28223, 14, 1},
+    {65030, 5, 1},
+    {12779, 29, 1},
+    {20634, 9, 2},
+    {58128, 2, 1},
+    {57318, 11, 1},
+    {91178, 19, 1},
+    {40529, 12, 1},
+    {0, 0, 0},
+    {107819, 19, 1},
+    {0, 0, 0},
+    {12636, 8, 1},
+    {4195, 11, 1},
+    {26800, 18, 1},
+    {85545, 17, 1},
+    {56930, 16, 1},
+    {0, 0, 0},
+    {2619, 9, 1},
+    {0, 0, 0},
+    {93656, 11, 1},
+    {27788, 9, 1},
+    {54078, 10, 1},
+    {47018, 19, 1},
+    {21478, 16, 1},
+    {0, 0, 0},
+    {875, 5, 1},
+    {0, 0, 0},
+    {26357, 9, 1},
+    {70410, 3, 1},
+    {36636, 17, 1},
+    {24421, 12, 1},
+    {77182, 19, 1},
+    {37145, 10, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {49396, 17, 1},
+    {40874, 20, 1},
+    {100236, 12, 1},
+    {77951, 12, 1},
+    {915, 5, 1},
+    {43027, 9, 1},
+    {62601, 6, 1},
+    {18775, 9, 1},
+    {38831, 15, 1},
+    {108925, 16, 1},
+    {24994, 4, 1},
+    {12463, 8, 1},
+    {80971, 17, 1},
+    {0, 0, 0},
+    {15049, 2, 1},
+    {16485, 6, 1},
+    {108605, 18, 1},
+    {32254, 4, 1},
+    {52817, 14, 1},
+    {42620, 5, 1},
+    {14420, 13, 1},
+    {36545, 9, 1},
+    {73922, 11, 1},
+    {37201, 9, 1},
+    {89189, 14, 1},
+    {100198, 27, 1},
+    {17067, 12, 1},
+    {57367, 8, 1},
+    {31532, 6, 1},
+    {73339, 11, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {59485, 15, 1},
+    {35468, 2, 1},
+    {90538, 5, 1},
+    {92600, 5, 1},
+    {101696, 22, 1},
+    {0, 0, 0},
+    {56911, 19, 1},
+    {60956, 16, 1},
+    {14977, 10, 1},
+    {0, 0, 0},
+    {67689, 5, 1},
+    {40598, 6, 1},
+    {47064, 11, 1},
+    {0, 0, 0},
+    {59840, 19, 1},
+    {30033, 5, 1},
+    {33645, 9, 1},
+    {21315, 16, 1},
+    {85458, 16, 1},
+    {0, 0, 0},
+    {72534, 10, 1},
+    {61066, 18, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {50776, 9, 1},
+    {72826, 2, 1},
+    {23641, 19, 1},
+    {0, 0, 0},
+    {54131, 12, 1},
+    {0, 0, 0},
+    {50083, 9, 1},
+    {29686, 9, 1},
+    {15005, 17, 1},
+    {65014, 6, 1},
+    {52181, 9, 1},
+    {75039, 4, 1},
+    {14406, 14, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {20070, 14, 1},
+    {22504, 6, 1},
+    {83250, 11, 1},
+    {26617, 11, 1},
+    {11222, 9, 1},
+    {15269, 6, 1},
+    {83542, 12, 1},
+    {12479, 8, 1},
+    {0, 0, 0},
+    {88387, 12, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {64207, 13, 1},
+    {9632, 11, 1},
+    {34740, 15, 1},
+    {42616, 4, 1},
+    {0, 0, 0},
+    {78895, 4, 1},
+    {74297, 5, 1},
+    {110759, 10, 1},
+    {89982, 10, 1},
+    {66850, 5, 1},
+    {0, 0, 0},
+    {83604, 9, 1},
+    {20029, 11, 1},
+    {98465, 50, 1},
+    {69955, 8, 1},
+    {9280, 11, 1},
+    {47170, 13, 1},
+    {31322, 6, 1},
+    {71769, 15, 1},
+    {93937, 23, 1},
+    {22142, 6, 1},
+    {26025, 15, 1},
+    {16251, 6, 1},
+    {93667, 3, 1},
+    {48288, 12, 1},
+    {52458, 10, 1},
+    {22069, 6, 1},
+    {41705, 19, 1},
+    {59593, 2, 1},
+    {59207, 16, 1},
+    {12293, 8, 1},
+    {64381, 6, 1},
+    {0, 0, 0},
+    {111551, 9, 1},
+    {25709, 10, 1},
+    {0, 0, 0},
+    {16605, 6, 1},
+    {48449, 14, 1},
+    {74476, 12, 1},
+    {67694, 5, 1},
+    {37746, 10, 1},
+    {0, 0, 0},
+    {70209, 16, 1},
+    {112224, 9, 1},
+    {0, 0, 0},
+    {65513, 12, 1},
+    {63117, 10, 1},
+    {27210, 11, 1},
+    {71439, 2, 1},
+    {0, 0, 0},
+    {109431, 8, 1},
+    {102097, 14, 1},
+    {33431, 4, 1},
+    {83613, 13, 1},
+    {19314, 14, 1},
+    {0, 0, 0},
+    {15290, 12, 1},
+    {6793, 4, 1},
+    {10598, 14, 1},
+    {101630, 19, 1},
+    {107309, 13, 1},
+    {22378, 6, 1},
+    {80830, 3, 1},
+    {38167, 3, 1},
+    {62716, 7, 1},
+    {94804, 10, 1},
+    {15670, 13, 1},
+    {105802, 16, 1},
+    {99634, 11, 1},
+    {47811, 13, 1},
+    {34039, 24, 1},
+    {0, 0, 0},
+    {85389, 12, 1},
+    {15909, 6, 1},
+    {0, 0, 0},
+    {15999, 6, 1},
+    {0, 0, 0},
+    {22462, 6, 1},
+    {14381, 8, 1},
+    {112499, 12, 1},
+    {0, 0, 0},
+    {89376, 20, 1},
+    {4016, 24, 1},
+    {8235, 4, 1},
+    {40337, 11, 1},
+    {9577, 11, 1},
+    {22468, 6, 1},
+    {12612, 8, 1},
+    {8050, 13, 1},
+    {68573, 6, 1},
+    {0, 0, 0},
+    {43352, 20, 1},
+    {37795, 2, 1},
+    {97768, 20, 1},
+    {99259, 30, 1},
+    {71922, 6, 1},
+    {31707, 9, 1},
+    {0, 0, 0},
+    {67082, 13, 1},
+    {0, 0, 0},
+    {75247, 9, 1},
+    {110975, 15, 1},
+    {38734, 7, 1},
+    {68345, 6, 1},
+    {0, 0, 0},
+    {63916, 5, 1},
+    {54788, 9, 1},
+    {3814, 35, 1},
+    {0, 0, 0},
+    {26055, 15, 1},
+    {0, 0, 0},
+    {52566, 9, 1},
+    {89876, 13, 1},
+    {93610, 20, 1},
+    {112382, 6, 1},
+    {16317, 6, 1},
+    {62553, 6, 1},
+    {0, 0, 0},
+    {33377, 20, 1},
+    {2610, 9, 1},
+    {95649, 12, 1},
+    {72906, 10, 1},
+    {0, 0, 0},
+    {92174, 15, 1},
+    {84240, 5, 1},
+    {0, 0, 0},
+    {62625, 6, 1},
+    {78164, 24, 1},
+    {50129, 7, 1},
+    {48529, 20, 1},
+    {97856, 7, 1},
+    {85950, 10, 1},
+    {29758, 9, 1},
+    {40679, 9, 1},
+    {0, 0, 0},
+    {59086, 10, 1},
+    {63950, 2, 1},
+    {0, 0, 0},
+    {105879, 15, 1},
+    {79700, 9, 1},
+    {92625, 14, 1},
+    {0, 0, 0},
+    {2310, 15, 1},
+    {52318, 8, 1},
+    {19641, 6, 1},
+    {61378, 10, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {30144, 6, 1},
+    {67304, 12, 1},
+    {9862, 22, 1},
+    {67674, 5, 1},
+    {110338, 6, 1},
+    {0, 0, 0},
+    {4232, 15, 1},
+    {60576, 10, 1},
+    {61724, 14, 1},
+    {47904, 15, 1},
+    {29695, 10, 1},
+    {10635, 16, 1},
+    {88600, 4, 1},
+    {4142, 12, 1},
+    {6331, 4, 1},
+    {3434, 15, 1},
+    {0, 0, 0},
+    {100026, 5, 1},
+    {84394, 5, 1},
+    {12527, 8, 1},
+    {33592, 8, 1},
+    {111751, 15, 1},
+    {11195, 14, 1},
+    {6779, 14, 1},
+    {20556, 3, 1},
+    {0, 0, 0},
+    {66544, 18, 1},
+    {73723, 3, 1},
+    {88862, 6, 1},
+    {23475, 5, 1},
+    {0, 0, 0},
+    {15492, 5, 1},
+    {25767, 3, 1},
+    {38899, 6, 1},
+    {57292, 6, 1},
+    {30693, 6, 1},
+    {3031, 18, 1},
+    {49005, 9, 1},
+    {27111, 11, 1},
+    {900, 5, 1},
+    {11677, 10, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {57606, 9, 1},
+    {0, 0, 0},
+    {60326, 17, 1},
+    {42946, 9, 1},
+    {97156, 5, 1},
+    {93835, 16, 1},
+    {66925, 18, 1},
+    {62139, 6, 1},
+    {51247, 4, 1},
+    {1689, 6, 1},
+    {10859, 19, 1},
+    {106738, 10, 1},
+    {98174, 45, 1},
+    {0, 0, 0},
+    {1730, 13, 1},
+    {46968, 25, 1},
+    {0, 0, 0},
+    {97658, 19, 1},
+    {10780, 15, 1},
+    {63145, 16, 1},
+    {67979, 6, 1},
+    {91037, 20, 1},
+    {54359, 9, 1},
+    {43328, 7, 1},
+    {81756, 18, 1},
+    {0, 0, 0},
+    {72321, 6, 1},
+    {0, 0, 0},
+    {81375, 19, 1},
+    {49148, 18, 1},
+    {56806, 16, 1},
+    {29448, 14, 1},
+    {59223, 13, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {8638, 5, 1},
+    {106201, 25, 1},
+    {30018, 5, 1},
+    {29288, 7, 1},
+    {0, 0, 0},
+    {10732, 10, 1},
+    {0, 0, 0},
+    {16785, 9, 1},
+    {74792, 6, 1},
+    {59595, 15, 1},
+    {34613, 19, 1},
+    {86813, 6, 1},
+    {35932, 12, 1},
+    {86784, 12, 1},
+    {0, 0, 0},
+    {4753, 7, 1},
+    {90223, 18, 1},
+    {111032, 12, 1},
+    {14094, 8, 1},
+    {12815, 18, 1},
+    {94538, 8, 1},
+    {21723, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {84257, 5, 1},
+    {24975, 5, 1},
+    {94620, 15, 1},
+    {69789, 4, 1},
+    {108420, 18, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {112170, 6, 1},
+    {66763, 16, 1},
+    {0, 0, 0},
+    {50599, 9, 1},
+    {4410, 14, 1},
+    {23816, 2, 1},
+    {0, 0, 0},
+    {1166, 11, 1},
+    {19306, 8, 1},
+    {85297, 19, 1},
+    {0, 0, 0},
+    {7873, 12, 1},
+    {93023, 21, 1},
+    {70333, 5, 1},
+    {109825, 8, 1},
+    {83661, 19, 1},
+    {47463, 15, 1},
+    {43099, 9, 1},
+    {107899, 20, 1},
+    {14836, 18, 1},
+    {1521, 18, 1},
+    {22577, 9, 1},
+    {36748, 7, 1},
+    {109614, 11, 1},
+    {57141, 7, 1},
+    {11301, 33, 1},
+    {73933, 12, 1},
+    {37088, 5, 1},
+    {42248, 25, 1},
+    {0, 0, 0},
+    {26428, 14, 1},
+    {89268, 13, 1},
+    {28964, 9, 1},
+    {105331, 9, 1},
+    {102391, 15, 1},
+    {0, 0, 0},
+    {89036, 9, 1},
+    {16083, 6, 1},
+    {957, 11, 1},
+    {82639, 7, 1},
+    {75384, 31, 1},
+    {0, 0, 0},
+    {101810, 43, 1},
+    {70458, 4, 1},
+    {50319, 7, 1},
+    {58616, 15, 1},
+    {49807, 13, 1},
+    {4808, 5, 1},
+    {100431, 11, 1},
+    {0, 0, 0},
+    {34256, 27, 1},
+    {111685, 9, 1},
+    {67164, 18, 1},
+    {109419, 12, 1},
+    {10298, 2, 1},
+    {34466, 21, 1},
+    {67139, 25, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {3220, 17, 1},
+    {0, 0, 0},
+    {18332, 11, 1},
+    {42609, 7, 1},
+    {30843, 6, 1},
+    {62003, 6, 1},
+    {110453, 6, 1},
+    {88918, 2, 1},
+    {51606, 12, 1},
+    {24301, 7, 1},
+    {0, 0, 0},
+    {109339, 16, 1},
+    {24811, 8, 1},
+    {111814, 9, 1},
+    {65227, 3, 1},
+    {22614, 2, 1},
+    {0, 0, 0},
+    {100675, 14, 1},
+    {23852, 17, 1},
+    {40652, 17, 1},
+    {53360, 19, 1},
+    {36389, 3, 1},
+    {62433, 6, 1},
+    {65148, 5, 1},
+    {66693, 15, 1},
+    {112364, 12, 1},
+    {16383, 6, 1},
+    {41192, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {94324, 7, 2},
+    {14126, 14, 1},
+    {104208, 17, 1},
+    {0, 0, 0},
+    {55219, 6, 1},
+    {100843, 12, 1},
+    {8272, 4, 1},
+    {73327, 12, 1},
+    {81227, 19, 1},
+    {86076, 12, 1},
+    {28774, 11, 1},
+    {111880, 9, 1},
+    {31164, 6, 1},
+    {11060, 12, 1},
+    {100921, 13, 1},
+    {106996, 17, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {97588, 7, 1},
+    {97476, 15, 1},
+    {69349, 14, 1},
+    {58510, 9, 1},
+    {5934, 5, 1},
+    {42707, 6, 1},
+    {15123, 9, 1},
+    {80573, 13, 1},
+    {73671, 6, 1},
+    {0, 0, 0},
+    {77534, 17, 1},
+    {88786, 7, 1},
+    {89622, 14, 1},
+    {22736, 16, 1},
+    {0, 0, 0},
+    {47315, 13, 1},
+    {31987, 4, 1},
+    {31364, 6, 1},
+    {0, 0, 0},
+    {9981, 3, 1},
+    {12362, 8, 1},
+    {32250, 4, 1},
+    {77790, 20, 1},
+    {0, 0, 0},
+    {30276, 10, 1},
+    {3938, 10, 1},
+    {38374, 19, 1},
+    {87499, 11, 1},
+    {57009, 10, 1},
+    {4794, 12, 1},
+    {55345, 6, 1},
+    {102699, 19, 1},
+    {8887, 11, 1},
+    {40289, 20, 1},
+    {3254, 10, 1},
+    {0, 0, 0},
+    {101937, 17, 1},
+    {68, 16, 1},
+    {0, 0, 0},
+    {60135, 20, 1},
+    {111215, 22, 1},
+    {78867, 11, 1},
+    {53186, 6, 1},
+    {102682, 17, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {62193, 6, 1},
+    {51312, 17, 1},
+    {15373, 5, 1},
+    {33559, 16, 1},
+    {8209, 8, 1},
+    {85872, 7, 1},
+    {102838, 24, 1},
+    {51298, 10, 1},
+    {0, 0, 0},
+    {74868, 4, 1},
+    {38044, 14, 1},
+    {96562, 10, 1},
+    {0, 0, 0},
+    {18247, 5, 1},
+    {101739, 10, 1},
+    {87965, 10, 1},
+    {54242, 13, 1},
+    {104363, 17, 1},
+    {79011, 5, 1},
+    {18054, 21, 1},
+    {4760, 7, 1},
+    {0, 0, 0},
+    {99407, 5, 1},
+    {45173, 22, 1},
+    {15353, 5, 1},
+    {105340, 8, 1},
+    {67699, 5, 1},
+    {11058, 2, 1},
+    {57963, 5, 1},
+    {47685, 16, 1},
+    {53862, 3, 1},
+    {14397, 9, 1},
+    {9511, 11, 1},
+    {65931, 16, 1},
+    {45355, 17, 1},
+    {92288, 23, 1},
+    {103297, 19, 1},
+    {65084, 5, 1},
+    {104073, 14, 1},
+    {49647, 5, 1},
+    {100100, 7, 1},
+    {77705, 14, 1},
+    {63952, 9, 1},
+    {73659, 6, 1},
+    {29466, 5, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {52403, 5, 1},
+    {0, 0, 0},
+    {22015, 6, 1},
+    {66943, 16, 1},
+    {32688, 21, 1},
+    {9621, 11, 1},
+    {0, 0, 0},
+    {8322, 14, 1},
+    {20421, 16, 1},
+    {6832, 4, 1},
+    {85111, 16, 1},
+    {45771, 17, 1},
+    {27155, 11, 1},
+    {61955, 6, 1},
+    {6335, 4, 1},
+    {64093, 13, 1},
+    {33695, 18, 1},
+    {0, 0, 0},
+    {100500, 14, 1},
+    {110919, 8, 1},
+    {64759, 11, 1},
+    {41095, 4, 1},
+    {31146, 6, 1},
+    {18743, 12, 1},
+    {0, 0, 0},
+    {85029, 13, 1},
+    {67709, 12, 1},
+    {107340, 13, 1},
+    {18910, 21, 1},
+    {0, 0, 0},
+    {712, 8, 1},
+    {71040, 12, 1},
+    {0, 0, 0},
+    {3285, 12, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {72839, 13, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {38455, 12, 1},
+    {55589, 20, 1},
+    {13100, 12, 1},
+    {52963, 13, 1},
+    {3907, 9, 1},
+    {57615, 18, 1},
+    {0, 0, 0},
+    {3120, 14, 1},
+    {51343, 17, 2},
+    {0, 0, 0},
+    {0, 0, 0},
+    {20451, 6, 1},
+    {60732, 7, 1},
+    {106355, 27, 1},
+    {74561, 23, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {95224, 11, 1},
+    {53008, 14, 1},
+    {7570, 2, 1},
+    {83396, 5, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {79067, 3, 1},
+    {0, 0, 0},
+    {67895, 6, 1},
+    {80474, 17, 1},
+    {25534, 5, 1},
+    {41077, 18, 1},
+    {42982, 9, 1},
+    {67823, 6, 1},
+    {63980, 10, 1},
+    {71939, 5, 1},
+    {85428, 15, 1},
+    {44890, 16, 1},
+    {0, 0, 0},
+    {56443, 3, 1},
+    {56347, 15, 1},
+    {27518, 11, 1},
+    {16155, 6, 1},
+    {18511, 4, 1},
+    {61162, 21, 1},
+    {0, 0, 0},
+    {92120, 18, 1},
+    {17106, 10, 1},
+    {88307, 11, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {22196, 6, 1},
+    {69740, 5, 1},
+    {21227, 6, 1},
+    {73279, 15, 1},
+    {83626, 10, 1},
+    {62661, 6, 1},
+    {112176, 9, 1},
+    {38911, 6, 1},
+    {64857, 6, 1},
+    {106258, 9, 1},
+    {13556, 7, 1},
+    {99595, 14, 1},
+    {112297, 9, 1},
+    {99529, 11, 1},
+    {100716, 13, 1},
+    {62905, 2, 1},
+    {11010, 10, 1},
+    {63945, 5, 1},
+    {56760, 11, 1},
+    {50390, 10, 1},
+    {60613, 7, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {90554, 5, 1},
+    {81829, 15, 1},
+    {49919, 14, 1},
+    {106658, 22, 1},
+    {13852, 17, 1},
+    {88955, 5, 1},
+    {0, 0, 0},
+    {20060, 10, 1},
+    {18152, 2, 1},
+    {98102, 14, 1},
+    {22752, 10, 1},
+    {85127, 9, 1},
+    {27232, 11, 1},
+    {99992, 3, 1},
+    {65853, 5, 1},
+    {96377, 34, 1},
+    {62571, 6, 1},
+    {136, 15, 1},
+    {22003, 6, 1},
+    {17657, 15, 1},
+    {14803, 19, 1},
+    {125, 11, 1},
+    {95618, 16, 1},
+    {35994, 20, 1},
+    {106307, 18, 1},
+    {12875, 14, 1},
+    {19533, 12, 1},
+    {23741, 2, 1},
+    {74216, 4, 1},
+    {0, 0, 0},
+    {57306, 9, 1},
+    {21023, 15, 1},
+    {52575, 11, 1},
+    {90911, 9, 1},
+    {39332, 18, 1},
+    {106111, 22, 1},
+    {25129, 14, 1},
+    {29630, 9, 1},
+    {84411, 10, 1},
+    {8150, 9, 1},
+    {14038, 10, 1},
+    {48937, 15, 1},
+    {0, 0, 0},
+    {38963, 6, 1},
+    {22292, 6, 1},
+    {59761, 17, 1},
+    {110436, 17, 1},
+    {0, 0, 0},
+    {44501, 14, 1},
+    {99463, 4, 1},
+    {62679, 6, 1},
+    {53328, 13, 1},
+    {29403, 2, 1},
+    {62069, 6, 1},
+    {0, 0, 0},
+    {92272, 16, 1},
+    {90141, 10, 1},
+    {22124, 6, 1},
+    {108071, 18, 1},
+    {43528, 18, 1},
+    {96613, 8, 1},
+    {23488, 17, 1},
+    {51900, 13, 1},
+    {111627, 9, 1},
+    {8407, 6, 1},
+    {53910, 7, 1},
+    {72760, 8, 1},
+    {102529, 16, 1},
+    {11007, 3, 1},
+    {7159, 9, 1},
+    {35470, 5, 1},
+    {0, 0, 0},
+    {19611, 15, 2},
+    {36707, 12, 1},
+    {103035, 16, 1},
+    {38587, 7, 1},
+    {791, 5, 1},
+    {22045, 6, 1},
+    {0, 0, 0},
+    {100408, 11, 1},
+    {0, 0, 0},
+    {31122, 6, 1},
+    {93010, 13, 1},
+    {0, 0, 0},
+    {48485, 22, 1},
+    {104102, 18, 1},
+    {79334, 6, 1},
+    {81026, 20, 1},
+    {0, 0, 0},
+    {80448, 13, 1},
+    {15393, 6, 1},
+    {0, 0, 0},
+    {3449, 15, 1},
+    {22819, 9, 1},
+    {84586, 12, 1},
+    {0, 0, 0},
+    {42214, 16, 1},
+    {51684, 9, 1},
+    {0, 0, 0},
+    {35371, 3, 1},
+    {0, 0, 0},
+    {1235, 18, 1},
+    {112607, 6, 1},
+    {93670, 19, 1},
+    {17737, 9, 1},
+    {55225, 6, 1},
+    {46386, 18, 1},
+    {42808, 9, 1},
+    {29208, 6, 1},
+    {62481, 6, 1},
+    {0, 0, 0},
+    {68770, 9, 1},
+    {0, 0, 0},
+    {6918, 8, 1},
+    {70343, 15, 1},
+    {41662, 21, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {35738, 14, 1},
+    {18170, 9, 1},
+    {29126, 7, 1},
+    {0, 0, 0},
+    {27166, 11, 1},
+    {61875, 14, 1},
+    {53958, 5, 1},
+    {0, 0, 0},
+    {22352, 8, 1},
+    {41568, 18, 1},
+    {84446, 10, 1},
+    {0, 0, 0},
+    {103417, 14, 1},
+    {0, 0, 0},
+    {71131, 17, 1},
+    {30197, 10, 1},
+    {51442, 2, 1},
+    {0, 0, 0},
+    {92575, 5, 1},
+    {31200, 6, 1},
+    {0, 0, 0},
+    {37077, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {776, 5, 1},
+    {33923, 15, 1},
+    {18941, 8, 1},
+    {0, 0, 0},
+    {87140, 18, 1},
+    {94084, 30, 1},
+    {24433, 12, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {80205, 9, 2},
+    {70297, 16, 1},
+    {111862, 9, 1},
+    {67805, 6, 1},
+    {55249, 6, 1},
+    {31939, 2, 1},
+    {111658, 6, 1},
+    {0, 0, 0},
+    {52750, 16, 1},
+    {2961, 16, 1},
+    {27677, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {30564, 7, 1},
+    {90488, 19, 1},
+    {95798, 39, 1},
+    {28353, 12, 1},
+    {22444, 6, 1},
+    {60648, 7, 1},
+    {1457, 10, 1},
+    {42760, 13, 1},
+    {0, 0, 0},
+    {102170, 9, 1},
+    {90586, 7, 1},
+    {0, 0, 0},
+    {90250, 16, 1},
+    {103062, 18, 1},
+    {37307, 16, 1},
+    {37960, 5, 1},
+    {105185, 16, 1},
+    {92708, 13, 1},
+    {41851, 20, 1},
+    {31262, 6, 1},
+    {58049, 5, 1},
+    {21949, 6, 1},
+    {63789, 11, 1},
+    {0, 0, 0},
+    {63197, 16, 1},
+    {111080, 21, 1},
+    {68363, 6, 1},
+    {65264, 16, 1},
+    {36415, 2, 1},
+    {41455, 8, 1},
+    {109906, 15, 1},
+    {5483, 2, 1},
+    {80147, 17, 1},
+    {67617, 12, 1},
+    {9722, 6, 1},
+    {21795, 6, 1},
+    {48321, 9, 1},
+    {81006, 20, 1},
+    {24020, 16, 1},
+    {79142, 6, 2},
+    {61475, 13, 1},
+    {62559, 6, 1},
+    {47225, 12, 1},
+    {10492, 12, 1},
+    {390, 8, 1},
+    {31761, 5, 1},
+    {0, 0, 0},
+    {86479, 9, 1},
+    {0, 0, 0},
+    {89237, 19, 1},
+    {103246, 9, 1},
+    {41316, 20, 1},
+    {53639, 16, 1},
+    {97527, 12, 1},
+    {0, 0, 0},
+    {50213, 12, 1},
+    {101749, 12, 1},
+    {15022, 4, 1},
+    {5327, 7, 1},
+    {0, 0, 0},
+    {110167, 11, 1},
+    {12394, 8, 1},
+    {0, 0, 0},
+    {29235, 6, 1},
+    {68039, 6, 1},
+    {71967, 8, 1},
+    {83488, 13, 1},
+    {62033, 6, 1},
+    {0, 0, 0},
+    {109972, 15, 1},
+    {22510, 9, 1},
+    {93637, 11, 1},
+    {54442, 15, 1},
+    {86416, 12, 1},
+    {13613, 34, 1},
+    {32113, 2, 1},
+    {29214, 9, 1},
+    {0, 0, 0},
+    {70161, 9, 1},
+    {37842, 9, 1},
+    {61237, 23, 1},
+    {62517, 6, 1},
+    {0, 0, 0},
+    {96954, 5, 1},
+    {86955, 16, 1},
+    {0, 0, 0},
+    {65540, 20, 1},
+    {3464, 16, 1},
+    {6182, 5, 1},
+    {10699, 5, 1},
+    {4605, 6, 1},
+    {93100, 12, 1},
+    {4916, 21, 1},
+    {0, 0, 0},
+    {74094, 27, 1},
+    {97151, 5, 1},
+    {26528, 14, 1},
+    {15791, 27, 1},
+    {0, 0, 0},
+    {12674, 26, 1},
+    {0, 0, 0},
+    {73630, 6, 1},
+    {63655, 25, 1},
+    {4269, 5, 1},
+    {0, 0, 0},
+    {22322, 6, 1},
+    {32150, 19, 1},
+    {31909, 8, 1},
+    {35864, 17, 1},
+    {2874, 18, 1},
+    {0, 0, 0},
+    {106947, 20, 1},
+    {0, 0, 0},
+    {40955, 9, 1},
+    {108968, 12, 1},
+    {97638, 9, 1},
+    {21145, 9, 1},
+    {79747, 6, 1},
+    {22304, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {22566, 9, 1},
+    {4223, 9, 1},
+    {90529, 9, 1},
+    {59096, 9, 1},
+    {23214, 8, 1},
+    {65404, 14, 1},
+    {64977, 3, 1},
+    {54013, 6, 1},
+    {20223, 15, 1},
+    {0, 0, 0},
+    {24105, 10, 1},
+    {77630, 14, 1},
+    {13070, 5, 1},
+    {8024, 5, 1},
+    {44906, 14, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {85370, 11, 1},
+    {50080, 3, 1},
+    {110672, 10, 1},
+    {0, 0, 0},
+    {20205, 10, 1},
+    {100095, 5, 1},
+    {58407, 6, 1},
+    {55201, 6, 1},
+    {81246, 17, 1},
+    {69225, 7, 2},
+    {50514, 10, 1},
+    {22492, 6, 1},
+    {84036, 11, 1},
+    {88108, 6, 1},
+    {62367, 6, 1},
+    {77973, 5, 1},
+    {48, 4, 1},
+    {104049, 12, 1},
+    {14509, 8, 1},
+    {62475, 6, 1},
+    {58023, 10, 1},
+    {12844, 15, 1},
+    {10521, 10, 1},
+    {16599, 6, 1},
+    {0, 0, 0},
+    {112613, 6, 1},
+    {85287, 10, 1},
+    {39161, 9, 1},
+    {14735, 17, 1},
+    {31941, 5, 1},
+    {111907, 9, 1},
+    {39261, 16, 1},
+    {66259, 11, 1},
+    {10129, 12, 1},
+    {68153, 6, 1},
+    {30963, 6, 1},
+    {68712, 7, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {16843, 7, 1},
+    {57004, 2, 1},
+    {52275, 11, 1},
+    {107754, 15, 1},
+    {61154, 8, 1},
+    {55494, 20, 1},
+    {13671, 15, 1},
+    {25539, 6, 1},
+    {23722, 6, 1},
+    {1401, 5, 1},
+    {83449, 6, 1},
+    {37358, 17, 1},
+    {15363, 5, 1},
+    {1474, 14, 1},
+    {62691, 6, 1},
+    {77675, 14, 1},
+    {69376, 16, 1},
+    {67629, 5, 1},
+    {22893, 10, 1},
+    {36259, 17, 2},
+    {78977, 2, 1},
+    {24460, 4, 1},
+    {70338, 5, 1},
+    {1322, 9, 1},
+    {66722, 7, 1},
+    {36719, 13, 1},
+    {75274, 12, 1},
+    {30777, 6, 1},
+    {0, 0, 0},
+    {68651, 6, 1},
+    {40858, 16, 1},
+    {74623, 8, 1},
+    {20437, 5, 1},
+    {100767, 15, 1},
+    {0, 0, 0},
+    {23549, 5, 1},
+    {54895, 18, 1},
+    {91860, 16, 1},
+    {0, 0, 0},
+    {24337, 19, 1},
+    {4699, 19, 1},
+    {0, 0, 0},
+    {100782, 24, 1},
+    {47183, 8, 1},
+    {0, 0, 0},
+    {40034, 16, 1},
+    {3501, 13, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {104868, 11, 1},
+    {15497, 5, 1},
+    {61943, 6, 1},
+    {101012, 20, 1},
+    {0, 0, 0},
+    {106516, 26, 1},
+    {7466, 12, 1},
+    {0, 0, 0},
+    {64888, 11, 1},
+    {83443, 6, 1},
+    {96641, 3, 1},
+    {11882, 7, 1},
+    {35459, 9, 1},
+    {17515, 20, 1},
+    {7198, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {58528, 19, 1},
+    {10240, 18, 1},
+    {90131, 10, 1},
+    {63039, 20, 1},
+    {20648, 13, 1},
+    {68603, 6, 1},
+    {81172, 18, 1},
+    {0, 0, 0},
+    {37779, 16, 1},
+    {95422, 11, 1},
+    {0, 0, 0},
+    {24876, 7, 1},
+    {49529, 13, 1},
+    {50608, 9, 1},
+    {68417, 6, 1},
+    {29593, 8, 1},
+    {41604, 22, 1},
+    {64309, 6, 1},
+    {84197, 16, 1},
+    {94349, 14, 1},
+    {58922, 12, 1},
+    {108149, 22, 1},
+    {0, 0, 0},
+    {39094, 6, 1},
+    {65358, 4, 1},
+    {12245, 8, 1},
+    {60155, 19, 1},
+    {104465, 12, 1},
+    {49413, 5, 1},
+    {64327, 6, 1},
+    {108371, 17, 1},
+    {0, 0, 0},
+    {92976, 8, 1},
+    {0, 0, 0},
+    {109439, 11, 1},
+    {100116, 5, 1},
+    {42065, 9, 1},
+    {652, 11, 1},
+    {0, 0, 0},
+    {67967, 6, 1},
+    {56248, 15, 1},
+    {48473, 12, 1},
+    {3656, 14, 1},
+    {21509, 6, 1},
+    {75353, 31, 1},
+    {55213, 6, 1},
+    {111413, 12, 1},
+    {12511, 8, 1},
+    {50290, 13, 1},
+    {103327, 14, 1},
+    {0, 0, 0},
+    {73912, 10, 1},
+    {78117, 22, 1},
+    {97082, 6, 1},
+    {54395, 8, 1},
+    {45851, 18, 1},
+    {33728, 6, 1},
+    {21210, 9, 1},
+    {57516, 16, 1},
+    {17149, 19, 1},
+    {74185, 14, 1},
+    {15507, 5, 1},
+    {816, 9, 1},
+    {0, 0, 0},
+    {30885, 6, 1},
+    {60304, 22, 1},
+    {98072, 7, 1},
+    {0, 0, 0},
+    {14822, 14, 1},
+    {0, 0, 0},
+    {11285, 4, 1},
+    {0, 0, 0},
+    {34140, 23, 1},
+    {0, 0, 0},
+    {68213, 6, 1},
+    {55267, 6, 1},
+    {0, 0, 0},
+    {68597, 6, 1},
+    {42862, 9, 1},
+    {968, 7, 1},
+    {34377, 19, 1},
+    {2825, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {47328, 8, 1},
+    {2482, 2, 1},
+    {92817, 12, 1},
+    {22708, 12, 1},
+    {50740, 9, 1},
+    {104762, 13, 1},
+    {77010, 36, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {53927, 5, 1},
+    {36500, 19, 1},
+    {86156, 14, 1},
+    {20943, 17, 1},
+    {104477, 11, 1},
+    {7734, 8, 1},
+    {86971, 19, 1},
+    {5126, 15, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {73369, 20, 1},
+    {8104, 5, 1},
+    {105557, 18, 1},
+    {0, 0, 0},
+    {62469, 6, 1},
+    {67606, 11, 1},
+    {0, 0, 0},
+    {42349, 2, 1},
+    {17724, 6, 1},
+    {76501, 27, 1},
+    {0, 0, 0},
+    {25482, 7, 1},
+    {33180, 21, 1},
+    {111796, 9, 1},
+    {75144, 8, 1},
+    {0, 0, 0},
+    {35533, 6, 1},
+    {13519, 11, 1},
+    {100248, 14, 1},
+    {47590, 19, 1},
+    {7451, 15, 1},
+    {9357, 11, 1},
+    {45958, 13, 1},
+    {105378, 14, 1},
+    {69207, 18, 1},
+    {0, 0, 0},
+    {57884, 17, 1},
+    {28794, 4, 1},
+    {15746, 17, 1},
+    {84466, 11, 1},
+    {54607, 2, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {88135, 4, 1},
+    {0, 0, 0},
+    {109496, 14, 1},
+    {32372, 20, 1},
+    {0, 0, 0},
+    {493, 9, 1},
+    {57854, 9, 1},
+    {104120, 14, 1},
+    {0, 0, 0},
+    {87656, 17, 1},
+    {0, 0, 0},
+    {83972, 12, 1},
+    {111940, 6, 1},
+    {1695, 3, 1},
+    {8954, 14, 1},
+    {0, 0, 0},
+    {26130, 7, 1},
+    {104017, 15, 1},
+    {0, 0, 0},
+    {92691, 8, 1},
+    {25028, 15, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {65140, 8, 1},
+    {104994, 11, 1},
+    {32013, 12, 1},
+    {33053, 15, 1},
+    {22432, 6, 1},
+    {0, 0, 0},
+    {37727, 15, 1},
+    {37717, 6, 1},
+    {77413, 7, 1},
+    {81611, 21, 1},
+    {55183, 6, 1},
+    {27, 21, 1},
+    {59649, 9, 1},
+    {19589, 22, 2},
+    {55609, 26, 1},
+    {61034, 15, 1},
+    {0, 0, 0},
+    {4068, 14, 1},
+    {82832, 6, 1},
+    {99360, 20, 1},
+    {52666, 17, 2},
+    {69328, 21, 1},
+    {70402, 8, 1},
+    {36309, 8, 1},
+    {25267, 10, 1},
+    {62445, 6, 1},
+    {30459, 9, 1},
+    {67829, 6, 1},
+    {0, 0, 0},
+    {95114, 13, 1},
+    {35433, 5, 1},
+    {15399, 5, 1},
+    {41939, 7, 1},
+    {21476, 2, 1},
+    {1749, 21, 1},
+    {48684, 20, 1},
+    {85491, 6, 1},
+    {35578, 19, 1},
+    {54947, 19, 1},
+    {0, 0, 0},
+    {6934, 8, 1},
+    {58014, 2, 1},
+    {73754, 11, 1},
+    {0, 0, 0},
+    {53237, 18, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {35091, 19, 1},
+    {94363, 13, 1},
+    {0, 0, 0},
+    {103964, 15, 1},
+    {87861, 17, 1},
+    {6848, 3, 1},
+    {29095, 9, 1},
+    {0, 0, 0},
+    {13541, 15, 1},
+    {30801, 6, 1},
+    {7068, 10, 1},
+    {102862, 24, 1},
+    {67847, 6, 1},
+    {44774, 17, 1},
+    {67589, 8, 1},
+    {22636, 15, 1},
+    {107231, 10, 1},
+    {33677, 6, 1},
+    {7787, 7, 1},
+    {29405, 5, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {3064, 14, 1},
+    {110713, 8, 1},
+    {107511, 18, 1},
+    {71471, 6, 1},
+    {52879, 9, 1},
+    {14170, 7, 1},
+    {100565, 10, 1},
+    {68963, 19, 1},
+    {103255, 11, 1},
+    {30235, 18, 1},
+    {19328, 3, 1},
+    {50154, 8, 1},
+    {99954, 10, 1},
+    {88271, 13, 1},
+    {8799, 11, 1},
+    {433, 6, 1},
+    {1622, 7, 1},
+    {57918, 11, 1},
+    {102361, 15, 1},
+    {43781, 11, 1},
+    {0, 0, 0},
+    {89121, 18, 1},
+    {110817, 14, 1},
+    {0, 0, 0},
+    {95211, 13, 1},
+    {58145, 15, 1},
+    {87712, 17, 1},
+    {18896, 7, 1},
+    {41687, 18, 1},
+    {95192, 4, 1},
+    {26453, 16, 1},
+    {80668, 8, 1},
+    {82646, 7, 1},
+    {72916, 5, 1},
+    {11231, 15, 1},
+    {0, 0, 0},
+    {29951, 4, 1},
+    {0, 0, 0},
+    {70448, 5, 1},
+    {22414, 6, 1},
+    {20481, 11, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {67519, 14, 1},
+    {50136, 6, 1},
+    {79911, 14, 1},
+    {0, 0, 0},
+    {20492, 10, 1},
+    {44688, 11, 1},
+    {28386, 3, 1},
+    {0, 0, 0},
+    {110123, 6, 1},
+    {52265, 10, 1},
+    {0, 0, 0},
+    {25800, 2, 1},
+    {110037, 4, 1},
+    {0, 0, 0},
+    {104603, 14, 1},
+    {8563, 6, 1},
+    {30921, 6, 1},
+    {24819, 6, 1},
+    {68441, 6, 1},
+    {77878, 21, 1},
+    {13193, 8, 1},
+    {99690, 9, 1},
+    {101557, 19, 1},
+    {83137, 6, 1},
+    {4094, 17, 1},
+    {47287, 21, 1},
+    {42343, 3, 1},
+    {51258, 14, 1},
+    {111889, 9, 1},
+    {88704, 8, 1},
+    {7321, 6, 1},
+    {68459, 6, 1},
+    {64921, 6, 1},
+    {33231, 10, 1},
+    {0, 0, 0},
+    {92590, 5, 1},
+    {102545, 11, 1},
+    {62547, 6, 1},
+    {22486, 6, 1},
+    {30897, 6, 1},
+    {65316, 19, 1},
+    {65366, 22, 1},
+    {45287, 11, 1},
+    {0, 0, 0},
+    {80531, 18, 1},
+    {57571, 13, 1},
+    {0, 0, 0},
+    {14576, 27, 1},
+    {101761, 22, 1},
+    {83870, 5, 1},
+    {68982, 13, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {26917, 17, 1},
+    {0, 0, 0},
+    {67515, 4, 1},
+    {99183, 4, 1},
+    {0, 0, 0},
+    {85709, 18, 1},
+    {94114, 5, 1},
+    {20388, 11, 1},
+    {58007, 2, 1},
+    {11034, 16, 1},
+    {0, 0, 0},
+    {52139, 6, 1},
+    {1935, 14, 1},
+    {8124, 16, 1},
+    {0, 0, 0},
+    {69896, 20, 1},
+    {90675, 24, 1},
+    {92954, 5, 1},
+    {25059, 14, 1},
+    {0, 0, 0},
+    {46860, 17, 1},
+    {61961, 6, 1},
+    {4827, 14, 1},
+    {0, 0, 0},
+    {32232, 18, 1},
+    {0, 0, 0},
+    {72981, 15, 1},
+    {0, 0, 0},
+    {71812, 16, 1},
+    {65766, 5, 1},
+    {46799, 20, 1},
+    {52169, 6, 1},
+    {0, 0, 0},
+    {86182, 2, 1},
+    {0, 0, 0},
+    {27408, 11, 1},
+    {19904, 3, 1},
+    {57019, 3, 1},
+    {8777, 11, 1},
+    {52133, 6, 1},
+    {80643, 14, 1},
+    {36426, 10, 1},
+    {62499, 6, 1},
+    {88604, 12, 1},
+    {25532, 2, 2},
+    {13905, 14, 1},
+    {78669, 12, 1},
+    {43899, 14, 1},
+    {13719, 16, 1},
+    {106280, 15, 1},
+    {96577, 8, 1},
+    {0, 0, 0},
+    {40065, 18, 1},
+    {32900, 14, 1},
+    {22172, 6, 1},
+    {93266, 13, 1},
+    {96832, 9, 1},
+    {94579, 11, 1},
+    {83819, 4, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {79214, 14, 1},
+    {48753, 19, 1},
+    {19251, 7, 1},
+    {95273, 9, 1},
+    {84433, 13, 1},
+    {107458, 5, 1},
+    {29349, 6, 1},
+    {80950, 17, 1},
+    {27430, 11, 1},
+    {112559, 12, 1},
+    {30627, 6, 1},
+    {11687, 13, 1},
+    {6678, 19, 1},
+    {15208, 5, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {61260, 6, 1},
+    {72705, 12, 1},
+    {49858, 11, 1},
+    {54216, 26, 1},
+    {23284, 6, 1},
+    {55087, 6, 1},
+    {52067, 12, 1},
+    {0, 0, 0},
+    {32138, 12, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {88515, 9, 1},
+    {68171, 6, 1},
+    {26403, 12, 1},
+    {50413, 7, 1},
+    {10287, 11, 1},
+    {0, 0, 0},
+    {80862, 5, 1},
+    {61931, 6, 1},
+    {11107, 2, 1},
+    {80561, 12, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {13530, 11, 1},
+    {93851, 16, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {70130, 18, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {73511, 5, 1},
+    {100907, 14, 1},
+    {64252, 16, 1},
+    {110485, 12, 1},
+    {47959, 21, 1},
+    {78007, 19, 1},
+    {104736, 16, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {35482, 14, 1},
+    {59424, 15, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {53852, 5, 1},
+    {0, 0, 0},
+    {3648, 8, 1},
+    {18978, 6, 1},
+    {93591, 14, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {88965, 5, 1},
+    {74361, 8, 1},
+    {5090, 19, 1},
+    {42074, 7, 1},
+    {0, 0, 0},
+    {54966, 15, 1},
+    {51725, 12, 1},
+    {25306, 10, 1},
+    {58044, 5, 1},
+    {90362, 15, 1},
+    {39279, 18, 1},
+    {70630, 10, 1},
+    {83041, 7, 1},
+    {72309, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {106632, 13, 1},
+    {35451, 8, 1},
+    {90064, 12, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {87510, 20, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {87928, 21, 1},
+    {34526, 22, 1},
+    {31182, 6, 1},
+    {102255, 11, 1},
+    {15717, 9, 1},
+    {3608, 16, 1},
+    {89548, 5, 1},
+    {12904, 2, 1},
+    {0, 0, 0},
+    {48844, 19, 1},
+    {27888, 21, 1},
+    {48043, 13, 1},
+    {5788, 12, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {52888, 22, 1},
+    {39755, 20, 1},
+    {58701, 13, 1},
+    {0, 0, 0},
+    {63861, 25, 1},
+    {32966, 16, 1},
+    {97810, 15, 1},
+    {10710, 10, 1},
+    {0, 0, 0},
+    {90658, 8, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {111437, 6, 1},
+    {0, 0, 0},
+    {50098, 7, 1},
+    {19391, 6, 1},
+    {37439, 14, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {111871, 9, 1},
+    {41047, 16, 1},
+    {58307, 19, 1},
+    {70714, 9, 1},
+    {52031, 9, 1},
+    {52392, 2, 1},
+    {17079, 12, 1},
+    {25667, 9, 1},
+    {0, 0, 0},
+    {24042, 16, 1},
+    {29118, 5, 1},
+    {83565, 5, 1},
+    {58755, 5, 1},
+    {4735, 7, 1},
+    {70896, 6, 1},
+    {0, 0, 0},
+    {111609, 6, 1},
+    {38073, 17, 1},
+    {0, 0, 0},
+    {103385, 17, 1},
+    {79709, 9, 1},
+    {0, 0, 0},
+    {74509, 19, 1},
+    {50020, 10, 1},
+    {64333, 6, 1},
+    {61804, 15, 1},
+    {51545, 6, 1},
+    {36488, 6, 1},
+    {5256, 6, 1},
+    {7097, 8, 1},
+    {15590, 5, 1},
+    {35279, 18, 1},
+    {0, 0, 0},
+    {40524, 5, 1},
+    {24356, 4, 1},
+    {19166, 14, 1},
+    {79800, 8, 1},
+    {109121, 19, 1},
+    {43081, 9, 1},
+    {15259, 5, 1},
+    {12650, 2, 1},
+    {68009, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {19932, 2, 1},
+    {62187, 6, 1},
+    {0, 0, 0},
+    {27353, 11, 1},
+    {7131, 8, 1},
+    {16143, 6, 1},
+    {414, 6, 1},
+    {93148, 6, 1},
+    {0, 0, 0},
+    {54882, 13, 1},
+    {25165, 11, 1},
+    {48863, 16, 1},
+    {100946, 20, 1},
+    {74007, 10, 1},
+    {74220, 10, 1},
+    {107960, 12, 1},
+    {6103, 3, 1},
+    {0, 0, 0},
+    {55357, 6, 1},
+    {32355, 17, 1},
+    {95462, 10, 1},
+    {0, 0, 0},
+    {71107, 7, 1},
+    {75017, 13, 1},
+    {61312, 23, 1},
+    {5262, 18, 1},
+    {53022, 15, 1},
+    {85664, 15, 1},
+    {88593, 7, 1},
+    {13052, 18, 1},
+    {28542, 16, 1},
+    {51001, 9, 1},
+    {7544, 16, 1},
+    {0, 0, 0},
+    {56263, 16, 1},
+    {55045, 6, 1},
+    {95876, 39, 1},
+    {0, 0, 0},
+    {73294, 14, 1},
+    {0, 0, 0},
+    {6066, 24, 1},
+    {50524, 5, 1},
+    {0, 0, 0},
+    {10990, 11, 1},
+    {0, 0, 0},
+    {37821, 9, 1},
+    {22082, 6, 1},
+    {100225, 11, 1},
+    {10484, 8, 1},
+    {30571, 7, 1},
+    {23398, 32, 1},
+    {31370, 6, 1},
+    {94847, 8, 1},
+    {6816, 16, 1},
+    {0, 0, 0},
+    {14483, 14, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {5241, 15, 1},
+    {40897, 8, 1},
+    {69032, 14, 1},
+    {6537, 11, 1},
+    {90790, 15, 1},
+    {0, 0, 0},
+    {109795, 11, 1},
+    {34283, 27, 1},
+    {6117, 15, 1},
+    {52728, 16, 1},
+    {100588, 13, 1},
+    {0, 0, 0},
+    {62277, 6, 1},
+    {33747, 13, 1},
+    {0, 0, 0},
+    {41740, 6, 1},
+    {68207, 6, 1},
+    {0, 0, 0},
+    {44874, 16, 1},
+    {108871, 19, 1},
+    {0, 0, 0},
+    {102266, 13, 1},
+    {53507, 19, 1},
+    {87643, 13, 1},
+    {0, 0, 0},
+    {343, 6, 1},
+    {0, 0, 0},
+    {64070, 10, 1},
+    {54037, 6, 1},
+    {71724, 12, 1},
+    {9990, 4, 1},
+    {29190, 18, 1},
+    {98019, 13, 1},
+    {73857, 9, 1},
+    {107089, 20, 1},
+    {71736, 13, 1},
+    {35881, 5, 1},
+    {47100, 20, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {72499, 11, 1},
+    {92762, 12, 1},
+    {0, 0, 0},
+    {112595, 12, 1},
+    {29276, 12, 1},
+    {41799, 11, 1},
+    {65947, 15, 1},
+    {6232, 5, 1},
+    {0, 0, 0},
+    {82300, 21, 1},
+    {6020, 10, 1},
+    {60194, 18, 1},
+    {63356, 16, 1},
+    {26329, 28, 1},
+    {30807, 6, 1},
+    {50794, 9, 1},
+    {84177, 20, 1},
+    {15383, 5, 1},
+    {53220, 8, 1},
+    {76628, 41, 1},
+    {0, 0, 0},
+    {3008, 23, 1},
+    {0, 0, 0},
+    {18799, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {62950, 6, 1},
+    {2521, 5, 1},
+    {0, 0, 0},
+    {63284, 5, 1},
+    {92996, 14, 1},
+    {19331, 20, 2},
+    {93756, 16, 1},
+    {31879, 14, 1},
+    {96481, 6, 1},
+    {0, 0, 0},
+    {16197, 6, 1},
+    {43295, 20, 1},
+    {56216, 15, 1},
+    {55969, 15, 1},
+    {101649, 10, 1},
+    {0, 0, 0},
+    {11743, 17, 1},
+    {80015, 6, 1},
+    {16419, 6, 1},
+    {16377, 6, 1},
+    {90805, 16, 1},
+    {67973, 6, 1},
+    {12979, 17, 1},
+    {90543, 2, 1},
+    {0, 0, 0},
+    {56199, 17, 1},
+    {8437, 6, 1},
+    {7742, 8, 1},
+    {0, 0, 0},
+    {96521, 15, 1},
+    {2834, 5, 1},
+    {51432, 10, 1},
+    {91135, 22, 1},
+    {66434, 10, 1},
+    {30939, 6, 1},
+    {16857, 7, 1},
+    {100419, 12, 1},
+    {42658, 14, 1},
+    {59187, 20, 1},
+    {7390, 12, 1},
+    {9247, 11, 1},
+    {15969, 6, 1},
+    {0, 0, 0},
+    {39386, 16, 1},
+    {12306, 8, 1},
+    {19569, 4, 1},
+    {0, 0, 0},
+    {19435, 13, 2},
+    {95413, 9, 1},
+    {0, 0, 0},
+    {109842, 6, 1},
+    {64796, 16, 1},
+    {0, 0, 0},
+    {31256, 6, 1},
+    {15388, 5, 1},
+    {29851, 6, 1},
+    {39005, 6, 1},
+    {106694, 14, 1},
+    {53162, 15, 1},
+    {82854, 14, 1},
+    {0, 0, 0},
+    {69916, 14, 1},
+    {29601, 17, 1},
+    {12967, 12, 1},
+    {2428, 12, 1},
+    {85145, 14, 1},
+    {81164, 8, 1},
+    {0, 0, 0},
+    {13812, 15, 1},
+    {0, 0, 0},
+    {74528, 11, 1},
+    {111706, 12, 1},
+    {17829, 5, 1},
+    {1363, 13, 1},
+    {42400, 9, 1},
+    {0, 0, 0},
+    {63033, 6, 1},
+    {74850, 8, 1},
+    {88533, 8, 1},
+    {7343, 8, 1},
+    {90330, 17, 1},
+    {3297, 8, 1},
+    {40407, 15, 1},
+    {0, 0, 0},
+    {91719, 10, 1},
+    {29966, 3, 1},
+    {71259, 15, 2},
+    {767, 9, 1},
+    {45750, 21, 1},
+    {91117, 18, 1},
+    {105768, 16, 1},
+    {0, 0, 0},
+    {95361, 5, 1},
+    {0, 0, 0},
+    {50572, 9, 1},
+    {18862, 4, 1},
+    {74059, 11, 1},
+    {41141, 15, 1},
+    {54644, 9, 1},
+    {22051, 6, 1},
+    {0, 0, 0},
+    {20299, 10, 1},
+    {82911, 9, 1},
+    {16365, 6, 1},
+    {89256, 12, 1},
+    {100647, 14, 1},
+    {0, 0, 0},
+    {42370, 7, 1},
+    {0, 0, 0},
+    {49874, 9, 1},
+    {78434, 17, 1},
+    {54542, 10, 1},
+    {35125, 17, 1},
+    {15732, 14, 1},
+    {112457, 6, 1},
+    {106490, 26, 1},
+    {111916, 9, 1},
+    {27298, 11, 1},
+    {69693, 7, 1},
+    {96682, 18, 1},
+    {31244, 6, 1},
+    {53939, 9, 1},
+    {47120, 20, 1},
+    {0, 0, 0},
+    {50911, 9, 1},
+    {0, 0, 0},
+    {98611, 46, 1},
+    {0, 0, 0},
+    {66405, 14, 1},
+    {32982, 16, 1},
+    {0, 0, 0},
+    {329, 7, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {53379, 18, 1},
+    {0, 0, 0},
+    {84, 14, 1},
+    {4366, 21, 1},
+    {67654, 5, 1},
+    {102763, 13, 1},
+    {10969, 13, 1},
+    {6408, 11, 1},
+    {24036, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {34163, 23, 1},
+    {72897, 2, 1},
+    {10396, 11, 1},
+    {2935, 12, 1},
+    {3533, 15, 1},
+    {4218, 5, 1},
+    {6253, 17, 2},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {51674, 10, 1},
+    {54025, 6, 1},
+    {17554, 7, 1},
+    {24558, 10, 1},
+    {62451, 6, 1},
+    {10177, 10, 1},
+    {99526, 3, 1},
+    {94611, 9, 1},
+    {55017, 13, 1},
+    {38650, 7, 1},
+    {101053, 10, 1},
+    {47998, 19, 1},
+    {35838, 13, 1},
+    {41198, 3, 1},
+    {8876, 11, 1},
+    {0, 0, 0},
+    {21789, 6, 1},
+    {0, 0, 0},
+    {66562, 21, 1},
+    {0, 0, 0},
+    {27067, 11, 1},
+    {31065, 6, 1},
+    {109181, 12, 1},
+    {15264, 5, 1},
+    {36014, 5, 1},
+    {109767, 10, 1},
+    {46668, 13, 1},
+    {32419, 18, 1},
+    {6215, 17, 1},
+    {85159, 7, 1},
+    {43546, 18, 1},
+    {70439, 9, 1},
+    {95472, 11, 1},
+    {39589, 13, 1},
+    {79076, 6, 1},
+    {9053, 15, 1},
+    {0, 0, 0},
+    {106844, 22, 1},
+    {4040, 28, 1},
+    {111265, 28, 1},
+    {6366, 5, 1},
+    {61647, 5, 1},
+    {97825, 5, 1},
+    {20186, 12, 1},
+    {3992, 6, 1},
+    {73456, 10, 1},
+    {2770, 13, 1},
+    {33637, 8, 1},
+    {81538, 18, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {14469, 6, 1},
+    {93208, 16, 1},
+    {41246, 17, 1},
+    {0, 0, 0},
+    {60456, 21, 1},
+    {49972, 11, 1},
+    {82773, 14, 1},
+    {0, 0, 0},
+    {37965, 5, 1},
+    {30771, 6, 1},
+    {90767, 9, 1},
+    {11411, 15, 1},
+    {108890, 20, 1},
+    {46117, 10, 1},
+    {8075, 6, 1},
+    {94855, 9, 1},
+    {104697, 16, 1},
+    {49097, 16, 1},
+    {23167, 6, 1},
+    {53405, 16, 1},
+    {38285, 20, 1},
+    {65698, 19, 1},
+    {0, 0, 0},
+    {81632, 21, 1},
+    {78390, 13, 1},
+    {83875, 14, 1},
+    {36403, 12, 1},
+    {43770, 11, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {37643, 16, 1},
+    {13842, 10, 1},
+    {106168, 15, 1},
+    {84646, 15, 1},
+    {102776, 24, 1},
+    {1139, 5, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {37579, 8, 1},
+    {67441, 22, 1},
+    {95452, 10, 1},
+    {47772, 13, 1},
+    {87902, 13, 1},
+    {18560, 14, 1},
+    {69093, 10, 1},
+    {83710, 8, 1},
+    {3591, 14, 1},
+    {49630, 17, 1},
+    {32003, 10, 1},
+    {0, 0, 0},
+    {27551, 11, 1},
+    {37895, 10, 1},
+    {90511, 18, 1},
+    {79124, 6, 1},
+    {87673, 17, 1},
+    {84119, 13, 1},
+    {71449, 5, 1},
+    {51041, 7, 1},
+    {9796, 14, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {71170, 5, 1},
+    {65418, 17, 1},
+    {13123, 12, 1},
+    {38058, 15, 1},
+    {41724, 16, 1},
+    {112571, 6, 1},
+    {105844, 17, 1},
+    {27009, 7, 1},
+    {82874, 10, 1},
+    {3237, 8, 1},
+    {0, 0, 0},
+    {86456, 11, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {10311, 8, 1},
+    {87120, 20, 1},
+    {0, 0, 0},
+    {54327, 12, 1},
+    {79170, 19, 1},
+    {76021, 34, 1},
+    {4545, 14, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {67344, 16, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {26998, 11, 1},
+    {0, 0, 0},
+    {63013, 6, 1},
+    {0, 0, 0},
+    {67126, 13, 1},
+    {98884, 45, 1},
+    {58570, 5, 1},
+    {29018, 11, 2},
+    {90966, 11, 1},
+    {85754, 7, 1},
+    {86215, 11, 1},
+    {35142, 24, 1},
+    {23769, 16, 1},
+    {0, 0, 0},
+    {71593, 9, 1},
+    {43689, 20, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {2123, 17, 1},
+    {0, 0, 0},
+    {37055, 19, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {92099, 21, 1},
+    {77489, 14, 1},
+    {23063, 13, 1},
+    {51205, 15, 1},
+    {91814, 12, 1},
+    {83368, 14, 1},
+    {21587, 5, 1},
+    {65077, 2, 1},
+    {68501, 6, 1},
+    {53963, 5, 1},
+    {40348, 20, 1},
+    {41368, 21, 1},
+    {81080, 23, 1},
+    {35956, 12, 1},
+    {0, 0, 0},
+    {35438, 5, 1},
+    {56017, 13, 1},
+    {0, 0, 0},
+    {7983, 14, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {48300, 10, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {56102, 14, 1},
+    {0, 0, 0},
+    {52179, 2, 1},
+    {110010, 6, 1},
+    {20183, 3, 1},
+    {0, 0, 0},
+    {84488, 5, 1},
+    {72139, 14, 1},
+    {93740, 16, 1},
+    {99573, 11, 1},
+    {16293, 6, 1},
+    {0, 0, 0},
+    {71372, 6, 1},
+    {74609, 14, 1},
+    {102376, 15, 1},
+    {36878, 4, 1},
+    {1469, 5, 1},
+    {34837, 18, 1},
+    {60042, 6, 1},
+    {67023, 11, 2},
+    {52841, 15, 1},
+    {57315, 3, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {25510, 5, 1},
+    {0, 0, 0},
+    {49706, 2, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {4953, 20, 1},
+    {0, 0, 0},
+    {97126, 12, 1},
+    {7207, 8, 1},
+    {73789, 16, 1},
+    {58714, 12, 1},
+    {18999, 8, 1},
+    {57063, 13, 1},
+    {30969, 6, 1},
+    {0, 0, 0},
+    {29317, 14, 1},
+    {110769, 8, 1},
+    {5668, 4, 1},
+    {97267, 17, 1},
+    {27707, 18, 1},
+    {46055, 13, 1},
+    {85020, 9, 1},
+    {94783, 4, 1},
+    {18117, 24, 1},
+    {0, 0, 0},
+    {47383, 5, 1},
+    {6950, 7, 1},
+    {0, 0, 0},
+    {77323, 9, 1},
+    {102419, 16, 1},
+    {92741, 9, 1},
+    {0, 0, 0},
+    {84598, 16, 1},
+    {0, 0, 0},
+    {93163, 5, 1},
+    {24148, 6, 1},
+    {84407, 4, 1},
+    {890, 5, 1},
+    {14956, 11, 1},
+    {39564, 25, 1},
+    {12628, 8, 1},
+    {88768, 7, 1},
+    {49554, 12, 1},
+    {93088, 12, 1},
+    {56231, 17, 1},
+    {0, 0, 0},
+    {78153, 11, 1},
+    {0, 0, 0},
+    {18075, 16, 2},
+    {83143, 2, 1},
+    {2276, 21, 1},
+    {12072, 6, 1},
+    {43195, 9, 1},
+    {101084, 15, 1},
+    {62151, 6, 1},
+    {56362, 20, 1},
+    {0, 0, 0},
+    {54740, 15, 1},
+    {100381, 10, 1},
+    {36325, 8, 1},
+    {72481, 8, 1},
+    {31925, 6, 1},
+    {16946, 8, 1},
+    {30717, 6, 1},
+    {49995, 11, 1},
+    {58211, 13, 1},
+    {46097, 10, 1},
+    {14375, 6, 1},
+    {32522, 20, 1},
+    {51048, 9, 1},
+    {46835, 25, 1},
+    {15280, 5, 1},
+    {0, 0, 0},
+    {27622, 8, 1},
+    {62289, 6, 1},
+    {103017, 18, 1},
+    {552, 5, 1},
+    {0, 0, 0},
+    {78919, 9, 1},
+    {87356, 18, 1},
+    {10407, 11, 1},
+    {58033, 2, 1},
+    {25421, 7, 1},
+    {75190, 6, 1},
+    {62175, 6, 1},
+    {94635, 15, 1},
+    {38263, 22, 1},
+    {12575, 5, 1},
+    {51466, 9, 1},
+    {79733, 14, 1},
+    {30657, 6, 1},
+    {14166, 4, 1},
+    {71378, 6, 1},
+    {3264, 12, 1},
+    {64047, 23, 1},
+    {0, 0, 0},
+    {69762, 12, 1},
+    {0, 0, 0},
+    {9566, 11, 1},
+    {111730, 6, 1},
+    {0, 0, 0},
+    {110703, 10, 1},
+    {33201, 17, 1},
+    {0, 0, 0},
+    {71620, 12, 1},
+    {35634, 6, 1},
+    {80080, 10, 1},
+    {42913, 9, 1},
+    {52206, 8, 1},
+    {2502, 5, 1},
+    {0, 0, 0},
+    {62982, 13, 1},
+    {11020, 14, 1},
+    {78609, 10, 2},
+    {109758, 9, 1},
+    {0, 0, 0},
+    {64357, 6, 1},
+    {41919, 4, 1},
+    {0, 0, 0},
+    {90313, 17, 1},
+    {0, 0, 0},
+    {106866, 15, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {4, 10, 1},
+    {15042, 7, 1},
+    {7402, 14, 1},
+    {108034, 18, 1},
+    {3397, 7, 1},
+    {6327, 4, 1},
+    {38433, 12, 1},
+    {0, 0, 0},
+    {83261, 4, 1},
+    {8912, 14, 1},
+    {65858, 12, 1},
+    {0, 0, 0},
+    {37498, 14, 1},
+    {37679, 19, 1},
+    {0, 0, 0},
+    {8539, 6, 1},
+    {11343, 5, 1},
+    {107285, 10, 1},
+    {51074, 9, 1},
+    {38878, 6, 1},
+    {10374, 12, 1},
+    {66855, 7, 1},
+    {93347, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {9335, 11, 1},
+    {86898, 15, 1},
+    {45004, 18, 1},
+    {58684, 2, 1},
+    {96764, 16, 1},
+    {96621, 14, 1},
+    {94119, 6, 1},
+    {21885, 6, 1},
+    {0, 0, 0},
+    {8172, 9, 1},
+    {0, 0, 0},
+    {18659, 18, 1},
+    {97009, 10, 1},
+    {30813, 6, 1},
+    {36807, 10, 1},
+    {5030, 15, 1},
+    {86555, 16, 1},
+    {68249, 6, 1},
+    {34666, 15, 1},
+    {31128, 6, 1},
+    {0, 0, 0},
+    {105575, 17, 1},
+    {0, 0, 0},
+    {23047, 5, 1},
+    {64812, 11, 1},
+    {34787, 18, 1},
+    {23979, 30, 1},
+    {78529, 13, 1},
+    {25449, 7, 1},
+    {55195, 6, 1},
+    {28785, 9, 1},
+    {0, 0, 0},
+    {73692, 9, 1},
+    {42904, 9, 1},
+    {44489, 12, 1},
+    {99773, 17, 1},
+    {27016, 8, 1},
+    {48074, 18, 1},
+    {0, 0, 0},
+    {86011, 2, 1},
+    {33893, 12, 1},
+    {0, 0, 0},
+    {106981, 15, 1},
+    {103833, 16, 1},
+    {54287, 13, 1},
+    {71330, 21, 1},
+    {10822, 18, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {36203, 7, 1},
+    {64673, 18, 1},
+    {36858, 3, 1},
+    {21592, 11, 1},
+    {58686, 15, 1},
+    {0, 0, 0},
+    {69967, 16, 1},
+    {57127, 7, 1},
+    {30891, 6, 1},
+    {52241, 14, 1},
+    {79677, 10, 1},
+    {35615, 19, 1},
+    {80289, 22, 1},
+    {3305, 24, 1},
+    {51975, 8, 1},
+    {8706, 7, 1},
+    {0, 0, 0},
+    {21417, 18, 1},
+    {73099, 12, 1},
+    {12009, 4, 1},
+    {1804, 6, 1},
+    {94758, 10, 1},
+    {0, 0, 0},
+    {31564, 8, 1},
+    {12346, 8, 1},
+    {50902, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {31280, 6, 1},
+    {53865, 2, 1},
+    {0, 0, 0},
+    {83411, 12, 1},
+    {0, 0, 0},
+    {44124, 16, 1},
+    {77689, 16, 1},
+    {11270, 4, 1},
+    {61925, 6, 1},
+    {31459, 7, 1},
+    {101288, 21, 1},
+    {0, 0, 0},
+    {10545, 7, 1},
+    {86500, 4, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {9128, 15, 1},
+    {52098, 2, 1},
+    {54088, 5, 1},
+    {19513, 17, 1},
+    {0, 0, 0},
+    {102886, 38, 1},
+    {82838, 2, 1},
+    {5501, 9, 1},
+    {45195, 17, 1},
+    {108745, 20, 1},
+    {45991, 6, 1},
+    {0, 0, 0},
+    {17699, 10, 1},
+    {10446, 22, 1},
+    {3187, 19, 1},
+    {43491, 22, 1},
+    {0, 0, 0},
+    {62199, 6, 1},
+    {49068, 9, 1},
+    {0, 0, 0},
+    {87007, 17, 1},
+    {0, 0, 0},
+    {89061, 13, 1},
+    {9958, 8, 1},
+    {56691, 17, 1},
+    {89737, 17, 1},
+    {29062, 3, 1},
+    {104634, 17, 1},
+    {0, 0, 0},
+    {32576, 17, 1},
+    {61919, 6, 1},
+    {109789, 6, 1},
+    {83240, 10, 1},
+    {35424, 6, 1},
+    {0, 0, 0},
+    {56055, 16, 1},
+    {12189, 8, 1},
+    {17190, 11, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {107475, 4, 1},
+    {11091, 8, 1},
+    {69963, 4, 1},
+    {25613, 11, 1},
+    {46045, 10, 1},
+    {29420, 2, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {80031, 10, 1},
+    {0, 0, 0},
+    {53047, 11, 1},
+    {19790, 4, 1},
+    {50347, 5, 1},
+    {49459, 12, 1},
+    {1124, 15, 1},
+    {61679, 5, 1},
+    {17437, 15, 1},
+    {11463, 3, 1},
+    {68339, 6, 1},
+    {0, 0, 0},
+    {7643, 5, 1},
+    {34001, 20, 1},
+    {62093, 10, 1},
+    {80600, 11, 1},
+    {5485, 16, 1},
+    {77314, 9, 1},
+    {85481, 10, 1},
+    {82849, 5, 1},
+    {16209, 6, 1},
+    {97578, 6, 1},
+    {0, 0, 0},
+    {20264, 13, 1},
+    {15414, 5, 1},
+    {92668, 10, 1},
+    {53598, 22, 1},
+    {99507, 19, 1},
+    {910, 5, 1},
+    {98269, 50, 1},
+    {111500, 6, 1},
+    {86236, 23, 1},
+    {975, 14, 1},
+    {12736, 11, 1},
+    {78230, 31, 1},
+    {0, 0, 0},
+    {5944, 5, 1},
+    {28264, 10, 1},
+    {0, 0, 0},
+    {46203, 13, 1},
+    {38917, 6, 1},
+    {97539, 5, 1},
+    {33983, 18, 1},
+    {34487, 19, 1},
+    {0, 0, 0},
+    {6697, 19, 1},
+    {2743, 6, 1},
+    {37277, 14, 1},
+    {74167, 18, 1},
+    {49724, 11, 1},
+    {39202, 11, 1},
+    {96445, 34, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {89590, 18, 1},
+    {18857, 5, 1},
+    {13317, 18, 1},
+    {55890, 23, 1},
+    {57355, 7, 1},
+    {66629, 18, 1},
+    {50142, 6, 1},
+    {23869, 17, 1},
+    {0, 0, 0},
+    {37411, 14, 1},
+    {79982, 19, 1},
+    {37587, 13, 1},
+    {80898, 9, 1},
+    {0, 0, 0},
+    {25258, 9, 1},
+    {57553, 6, 1},
+    {14967, 10, 1},
+    {0, 0, 0},
+    {71304, 11, 1},
+    {58271, 7, 1},
+    {41336, 16, 1},
+    {61213, 9, 1},
+    {0, 0, 0},
+    {82660, 7, 1},
+    {27651, 8, 1},
+    {102305, 22, 1},
+    {71289, 15, 1},
+    {41118, 15, 1},
+    {30975, 6, 1},
+    {59364, 15, 1},
+    {0, 0, 0},
+    {59281, 15, 1},
+    {112529, 9, 1},
+    {28332, 21, 1},
+    {10903, 19, 1},
+    {0, 0, 0},
+    {459, 4, 1},
+    {0, 0, 0},
+    {54806, 18, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {51371, 5, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {38629, 7, 1},
+    {0, 0, 0},
+    {81415, 18, 1},
+    {50617, 9, 1},
+    {52121, 3, 1},
+    {0, 0, 0},
+    {50785, 9, 1},
+    {35020, 15, 1},
+    {84302, 6, 1},
+    {0, 0, 0},
+    {85407, 5, 1},
+    {84959, 10, 1},
+    {85212, 8, 1},
+    {0, 0, 0},
+    {91709, 10, 1},
+    {28900, 4, 1},
+    {0, 0, 0},
+    {16161, 6, 1},
+    {3893, 9, 1},
+    {1698, 18, 1},
+    {85771, 11, 1},
+    {29082, 2, 1},
+    {91893, 9, 1},
+    {0, 0, 0},
+    {112107, 9, 1},
+    {45939, 2, 1},
+    {0, 0, 0},
+    {111461, 18, 1},
+    {0, 0, 0},
+    {22130, 6, 1},
+    {5905, 12, 1},
+    {93250, 16, 1},
+    {0, 0, 0},
+    {41352, 16, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {57263, 8, 1},
+    {0, 0, 0},
+    {15585, 5, 1},
+    {31274, 6, 1},
+    {18794, 3, 1},
+    {75728, 26, 1},
+    {0, 0, 0},
+    {75210, 10, 1},
+    {72558, 6, 1},
+    {38109, 19, 1},
+    {0, 0, 0},
+    {23835, 17, 1},
+    {70178, 15, 1},
+    {11768, 7, 1},
+    {82033, 15, 1},
+    {0, 0, 0},
+    {6763, 9, 1},
+    {10840, 19, 1},
+    {22616, 11, 1},
+    {17018, 6, 1},
+    {99481, 15, 1},
+    {8263, 9, 1},
+    {8045, 5, 1},
+    {0, 0, 0},
+    {10612, 8, 1},
+    {6397, 11, 1},
+    {0, 0, 0},
+    {99149, 20, 1},
+    {106133, 17, 1},
+    {25571, 7, 1},
+    {17589, 2, 1},
+    {3495, 6, 1},
+    {61553, 11, 1},
+    {42281, 3, 1},
+    {0, 0, 0},
+    {20051, 9, 1},
+    {50581, 9, 1},
+    {12431, 8, 1},
+    {88868, 8, 1},
+    {32108, 5, 1},
+    {32410, 9, 1},
+    {27584, 11, 1},
+    {33665, 12, 1},
+    {7515, 3, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {31845, 10, 1},
+    {40309, 17, 1},
+    {93327, 14, 1},
+    {71177, 2, 1},
+    {97835, 7, 1},
+    {0, 0, 0},
+    {55177, 6, 1},
+    {110936, 9, 1},
+    {10531, 14, 1},
+    {91954, 8, 2},
+    {70016, 20, 1},
+    {50480, 11, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {30765, 6, 1},
+    {31698, 9, 1},
+    {0, 0, 0},
+    {12229, 8, 1},
+    {112021, 13, 1},
+    {7113, 10, 1},
+    {88188, 16, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {13043, 5, 1},
+    {86177, 5, 1},
+    {27364, 11, 1},
+    {50225, 14, 1},
+    {32501, 4, 1},
+    {13407, 19, 1},
+    {15933, 6, 1},
+    {17942, 21, 1},
+    {840, 5, 1},
+    {72646, 6, 1},
+    {6797, 19, 1},
+    {36675, 6, 1},
+    {885, 5, 1},
+    {106823, 21, 1},
+    {2818, 2, 1},
+    {9908, 10, 1},
+    {80924, 5, 1},
+    {0, 0, 0},
+    {27868, 20, 1},
+    {45154, 19, 1},
+    {21081, 15, 1},
+    {47057, 7, 1},
+    {16401, 6, 1},
+    {97094, 10, 1},
+    {0, 0, 0},
+    {66371, 18, 1},
+    {112242, 6, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {94452, 17, 1},
+    {77392, 4, 1},
+    {40209, 8, 1},
+    {70878, 18, 1},
+    {10363, 11, 1},
+    {0, 0, 0},
+    {52233, 8, 1},
+    {35374, 13, 1},
+    {36817, 16, 1},
+    {86043, 8, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {12455, 8, 1},
+    {94194, 10, 1},
+    {0, 0, 0},
+    {46517, 13, 1},
+    {61819, 8, 1},
+    {17116, 15, 1},
+    {62613, 6, 1},
+    {14102, 6, 1},
+    {79040, 5, 1},
+    {66610, 19, 1},
+    {68273, 6, 1},
+    {108652, 19, 1},
+    {55937, 17, 1},
+    {57349, 6, 1},
+    {0, 0, 0},
+    {68471, 6, 1},
+    {31292, 6, 1},
+    {42081, 9, 1},
+    {18931, 10, 1},
+    {36695, 12, 1},
+    {60027, 15, 1},
+    {64339, 6, 1},
+    {51138, 14, 1},
+    {34356, 21, 1},
+    {0, 0, 0},
+    {29914, 9, 1},
+    {29432, 16, 1},
+    {0, 0, 0},
+    {91098, 19, 1},
+    {0, 0, 0},
+    {46554, 14, 1},
+    {0, 0, 0},
+    {22226, 6, 1},
+    {33022, 14, 1},
+    {0, 0, 0},
+    {66838, 12, 1},
+    {92384, 20, 1},
+    {76234, 37, 1},
+    {67913, 6, 1},
+    {0, 0, 0},
+    {860, 5, 1},
+    {4278, 16, 1},
+    {35886, 19, 1},
+    {44599, 14, 1},
+    {472, 4, 1},
+    {0, 0, 0},
+    {65788, 17, 1},
+    {81138, 14, 1},
+    {76528, 29, 1},
+    {59266, 15, 1},
+    {71713, 11, 1},
+    {68822, 5, 1},
+    {90377, 16, 1},
+    {0, 0, 0},
+    {72971, 4, 1},
+    {6874, 8, 1},
+    {72119, 9, 1},
+    {103402, 15, 1},
+    {0, 0, 0},
+    {104151, 16, 1},
+    {87729, 14, 1},
+    {0, 0, 0},
+    {88970, 5, 1},
+    {11576, 15, 1},
+    {54668, 15, 1},
+    {30412, 12, 1},
+    {40380, 12, 1},
+    {65362, 4, 1},
+    {93480, 17, 1},
+    {39061, 15, 1},
+    {88178, 5, 1},
+    {95661, 14, 1},
+    {66496, 17, 1},
+    {32831, 17, 1},
+    {60395, 17, 1},
+    {0, 0, 0},
+    {31683, 5, 1},
+    {29255, 8, 1},
+    {9113, 15, 1},
+    {18455, 5, 1},
+    {48107, 18, 1},
+    {92350, 17, 1},
+    {76339, 27, 1},
+    {110659, 13, 1},
+    {53789, 6, 1},
+    {33869, 9, 1},
+    {19982, 12, 1},
+    {81394, 21, 1},
+    {0, 0, 0},
+    {36417, 9, 1},
+    {25414, 7, 1},
+    {0, 0, 0},
+    {96572, 5, 1},
+    {26442, 11, 1},
+    {61222, 15, 1},
+    {105407, 18, 1},
+    {64742, 6, 1},
+    {63329, 21, 1},
+    {60609, 4, 1},
+    {16275, 6, 1},
+    {29379, 11, 1},
+    {8121, 3, 1},
+    {22841, 15, 1},
+    {72285, 6, 1},
+    {66419, 15, 1},
+    {31041, 6, 1},
+    {49322, 11, 1},
+    {86203, 12, 1},
+    {74592, 8, 1},
+    {24575, 15, 1},
+    {62057, 6, 1},
+    {4774, 20, 1},
+    {93960, 30, 1},
+    {37391, 5, 1},
+    {82653, 7, 1},
+    {27089, 11, 1},
+    {90887, 6, 1},
+    {108639, 13, 1},
+    {68111, 6, 1},
+    {46655, 13, 1},
+    {99348, 12, 1},
+    {55387, 6, 1},
+    {0, 0, 0},
+    {97456, 20, 1},
+    {79295, 9, 1},
+    {45254, 18, 1},
+    {43177, 9, 1},
+    {110016, 13, 1},
+    {31224, 8, 1},
+    {40003, 15, 1},
+    {41031, 16, 1},
+    {89031, 5, 1},
+    {25863, 17, 1},
+    {111829, 9, 1},
+    {54068, 10, 1},
+    {108405, 15, 1},
+    {57037, 2, 1},
+    {0, 0, 0},
+    {69620, 13, 1},
+    {94178, 16, 1},
+    {112158, 6, 1},
+    {101898, 11, 1},
+    {0, 0, 0},
+    {15223, 5, 1},
+    {65435, 21, 1},
+    {103444, 13, 1},
+    {9434, 11, 1},
+    {53228, 9, 1},
+    {7634, 9, 1},
+    {43871, 15, 1},
+    {16850, 7, 1},
+    {31449, 10, 1},
+    {49674, 17, 1},
+    {22286, 6, 1},
+    {24139, 9, 1},
+    {0, 0, 0},
+    {103931, 19, 1},
+    {33691, 4, 1},
+    {97584, 4, 1},
+    {1448, 9, 1},
+    {42817, 9, 1},
+    {21819, 6, 1},
+    {36104, 8, 1},
+    {93920, 17, 1},
+    {0, 0, 0},
+    {68477, 6, 1},
+    {56152, 12, 1},
+    {6306, 12, 1},
+    {101610, 20, 1},
+    {47388, 12, 1},
+    {30753, 6, 1},
+    {31620, 15, 1},
+    {77298, 5, 1},
+    {96952, 2, 1},
+    {30687, 6, 1},
+    {18307, 10, 1},
+    {0, 0, 0},
+    {73270, 9, 1},
+    {0, 0, 0},
+    {33855, 4, 1},
+    {89093, 18, 1},
+    {45272, 15, 1},
+    {0, 0, 0},
+    {19794, 14, 1},
+    {62307, 6, 1},
+    {36562, 9, 1},
+    {71466, 5, 1},
+    {103849, 16, 1},
+    {20536, 11, 1},
+    {84493, 9, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {18223, 9, 1},
+    {36479, 9, 1},
+    {64910, 11, 1},
+    {29073, 4, 1},
+    {29807, 3, 1},
+    {32187, 10, 1},
+    {94267, 16, 1},
+    {82048, 20, 1},
+    {18252, 10, 1},
+    {92505, 8, 1},
+    {112475, 9, 1},
+    {84883, 14, 1},
+    {19888, 16, 1},
+    {87216, 19, 1},
+    {84062, 10, 1},
+    {0, 0, 0},
+    {24911, 5, 1},
+    {49356, 19, 1},
+    {0, 0, 0},
+    {37115, 15, 1},
+    {86488, 12, 1},
+    {62974, 8, 1},
+    {73653, 6, 1},
+    {0, 0, 0},
+    {29857, 22, 1},
+    {26276, 25, 1},
+    {34021, 18, 1},
+    {74031, 13, 1},
+    {82015, 18, 1},
+    {0, 0, 0},
+    {36234, 7, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {29537, 18, 1},
+    {25115, 14, 1},
+    {0, 0, 0},
+    {62283, 6, 1},
+    {48269, 9, 1},
+    {82755, 18, 1},
+    {0, 0, 0},
+    {11483, 17, 1},
+    {39642, 13, 1},
+    {1146, 5, 1},
+    {365, 7, 1},
+    {16611, 6, 1},
+    {14923, 10, 1},
+    {55291, 6, 1},
+    {0, 0, 0},
+    {111772, 9, 1},
+    {28986, 10, 1},
+    {33600, 15, 1},
+    {0, 0, 0},
+    {26509, 19, 1},
+    {77260, 6, 2},
+    {0, 0, 0},
+    {0, 0, 0},
+    {65213, 7, 1},
+    {74728, 6, 1},
+    {0, 0, 0},
+    {21873, 6, 1},
+    {109877, 10, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {112012, 9, 1},
+    {88674, 7, 1},
+    {97969, 10, 1},
+    {32774, 14, 1},
+    {54001, 6, 1},
+    {14497, 12, 1},
+    {69611, 9, 1},
+    {100287, 14, 1},
+    {0, 0, 0},
+    {88681, 10, 1},
+    {20610, 3, 1},
+    {14522, 21, 1},
+    {111931, 9, 1},
+    {82787, 18, 1},
+    {21219, 4, 1},
+    {110304, 6, 1},
+    {21572, 5, 1},
+    {111853, 9, 1},
+    {30951, 6, 1},
+    {429, 4, 1},
+    {0, 0, 0},
+    {73592, 10, 1},
+    {34696, 17, 1},
+    {18836, 21, 1},
+    {90431, 19, 1},
+    {75045, 6, 1},
+    {55570, 19, 1},
+    {110239, 4, 1},
+    {14211, 12, 4},
+    {7527, 14, 1},
+    {0, 0, 0},
+    {28904, 13, 1},
+    {22244, 6, 1},
+    {16077, 6, 1},
+    {40623, 10, 1},
+    {104683, 14, 1},
+    {7699, 7, 1},
+    {50590, 9, 1},
+    {8551, 6, 1},
+    {13686, 14, 1},
+    {0, 0, 0},
+    {0, 0, 0},
+    {63888, 28, 1},
+    {93802, 8, 1},
+};
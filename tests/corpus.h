@@ -0,0 +1,52 @@
+// Tab-separated corpora shared by the omnibox tests and benchmark. Each line
+// is "expected<TAB>input"; blank lines and lines starting with '#' are skipped.
+#ifndef ROCKET_TESTS_CORPUS_H
+#define ROCKET_TESTS_CORPUS_H
+
+#include <stdio.h>
+#include <glib.h>
+
+typedef struct {
+    gchar* expected;
+    gchar* input;
+} CorpusEntry;
+
+static void corpus_entry_free(gpointer data) {
+    CorpusEntry* entry = (CorpusEntry*)data;
+    g_free(entry->expected);
+    g_free(entry->input);
+    g_free(entry);
+}
+
+// NULL if the file can't be read
+static GPtrArray* corpus_load(const char* path) {
+    gchar* contents = NULL;
+    GError* error = NULL;
+
+    if (!g_file_get_contents(path, &contents, NULL, &error)) {
+        fprintf(stderr, "Failed to read %s: %s\n", path, error->message);
+        g_error_free(error);
+        return NULL;
+    }
+
+    GPtrArray* entries = g_ptr_array_new_with_free_func(corpus_entry_free);
+    gchar** lines = g_strsplit(contents, "\n", -1);
+    for (gchar** line = lines; *line; line++) {
+        if (**line == '\0' || **line == '#') continue;
+
+        gchar* tab = strchr(*line, '\t');
+        if (!tab) {
+            fprintf(stderr, "%s: no tab in \"%s\"\n", path, *line);
+            continue;
+        }
+        CorpusEntry* entry = g_new0(CorpusEntry, 1);
+        entry->expected = g_strndup(*line, tab - *line);
+        entry->input = g_strdup(tab + 1);
+        g_ptr_array_add(entries, entry);
+    }
+    g_strfreev(lines);
+    g_free(contents);
+    return entries;
+}
+
+#endif
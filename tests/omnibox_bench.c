@@ -0,0 +1,82 @@
+// Corpus-driven benchmark for omnibox.h: URL-entry classifications and
+// registrable-domain lookups per second over the test corpora. Needs only
+// GLib; from the repository root:
+//
+//   cc -O2 -I. tests/omnibox_bench.c $(pkg-config --cflags --libs glib-2.0) -o omnibox_bench
+//   ./omnibox_bench [tests] [rounds]
+
+#include <stdlib.h>
+#include "omnibox.h"
+#include "corpus.h"
+
+#define BENCH_DEFAULT_ROUNDS 200000
+
+static volatile gsize bench_sink;   // Keeps the calls from being optimized out
+
+static void bench_omnibox(GPtrArray* corpus, guint rounds) {
+    gint64 start = g_get_monotonic_time();
+    for (guint r = 0; r < rounds; r++) {
+        for (guint i = 0; i < corpus->len; i++) {
+            CorpusEntry* entry = g_ptr_array_index(corpus, i);
+            OmniboxInput input;
+            bench_sink += omnibox_classify(entry->input, &input) + input.host_len;
+        }
+    }
+    gint64 elapsed = g_get_monotonic_time() - start;
+
+    gdouble calls = (gdouble)rounds * corpus->len;
+    printf("omnibox_classify: %.0f calls in %.2f s, %.1f M/s, %.0f ns/call\n",
+           calls, elapsed / 1e6, calls / elapsed, 1e3 * elapsed / calls);
+}
+
+static void bench_psl(GPtrArray* corpus, guint rounds) {
+    gint64 start = g_get_monotonic_time();
+    for (guint r = 0; r < rounds; r++) {
+        for (guint i = 0; i < corpus->len; i++) {
+            CorpusEntry* entry = g_ptr_array_index(corpus, i);
+            bench_sink += (gsize)psl_registrable_domain(entry->input);
+        }
+    }
+    gint64 elapsed = g_get_monotonic_time() - start;
+
+    gdouble calls = (gdouble)rounds * corpus->len;
+    printf("psl_registrable_domain: %.0f calls in %.2f s, %.1f M/s, %.0f ns/call\n",
+           calls, elapsed / 1e6, calls / elapsed, 1e3 * elapsed / calls);
+}
+
+// The suffix walk alone, without registrable_domain's IP-literal check
+static void bench_psl_suffix(GPtrArray* corpus, guint rounds) {
+    gint64 start = g_get_monotonic_time();
+    for (guint r = 0; r < rounds; r++) {
+        for (guint i = 0; i < corpus->len; i++) {
+            CorpusEntry* entry = g_ptr_array_index(corpus, i);
+            bench_sink += (gsize)psl_public_suffix(entry->input, strlen(entry->input), NULL);
+        }
+    }
+    gint64 elapsed = g_get_monotonic_time() - start;
+
+    gdouble calls = (gdouble)rounds * corpus->len;
+    printf("psl_public_suffix: %.0f calls in %.2f s, %.1f M/s, %.0f ns/call\n",
+           calls, elapsed / 1e6, calls / elapsed, 1e3 * elapsed / calls);
+}
+
+int main(int argc, char** argv) {
+    const char* dir = argc > 1 ? argv[1] : "tests";
+    guint rounds = argc > 2 ? (guint)strtoul(argv[2], NULL, 10) : BENCH_DEFAULT_ROUNDS;
+
+    gchar* omnibox_path = g_build_filename(dir, "omnibox_corpus.tsv", NULL);
+    gchar* psl_path = g_build_filename(dir, "psl_corpus.tsv", NULL);
+    GPtrArray* omnibox = corpus_load(omnibox_path);
+    GPtrArray* psl = corpus_load(psl_path);
+    g_free(omnibox_path);
+    g_free(psl_path);
+    if (!omnibox || !psl) return 1;
+
+    bench_omnibox(omnibox, rounds);
+    bench_psl(psl, rounds);
+    bench_psl_suffix(psl, rounds);
+
+    g_ptr_array_unref(omnibox);
+    g_ptr_array_unref(psl);
+    return 0;
+}
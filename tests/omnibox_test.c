@@ -0,0 +1,94 @@
+// Correctness tests for omnibox.h. Every line of omnibox_corpus.tsv must
+// classify as listed and every line of psl_corpus.tsv must give the listed
+// registrable domain. Needs only GLib; from the repository root:
+//
+//   cc -O2 -I. tests/omnibox_test.c $(pkg-config --cflags --libs glib-2.0) -o omnibox_test
+//   ./omnibox_test [tests]
+
+#include "omnibox.h"
+#include "corpus.h"
+
+static const char* const OMNIBOX_TYPE_NAMES[] = {
+    [OMNIBOX_SEARCH] = "search",
+    [OMNIBOX_URL] = "url",
+    [OMNIBOX_HOST] = "host",
+    [OMNIBOX_HOST_PORT] = "host_port",
+    [OMNIBOX_IP] = "ip",
+    [OMNIBOX_LOCAL_PATH] = "local_path",
+};
+
+static int test_omnibox(const char* dir) {
+    gchar* path = g_build_filename(dir, "omnibox_corpus.tsv", NULL);
+    GPtrArray* corpus = corpus_load(path);
+    g_free(path);
+    if (!corpus) return 1;
+
+    int failures = 0;
+    for (guint i = 0; i < corpus->len; i++) {
+        CorpusEntry* entry = g_ptr_array_index(corpus, i);
+        OmniboxInput input;
+        const char* got = OMNIBOX_TYPE_NAMES[omnibox_classify(entry->input, &input)];
+
+        if (g_strcmp0(got, entry->expected) != 0) {
+            fprintf(stderr, "omnibox: \"%s\" is %s, expected %s\n", entry->input, got, entry->expected);
+            failures++;
+        }
+    }
+    printf("omnibox: %u inputs, %d failures\n", corpus->len, failures);
+    g_ptr_array_unref(corpus);
+    return failures;
+}
+
+// The host span must cover exactly the host, without port or path
+static int test_omnibox_host_span(void) {
+    static const char* const CASES[][2] = {
+        { "example.com:8080/x", "example.com" },
+        { "  www.example.co.uk/path", "www.example.co.uk" },
+        { "localhost:3000", "localhost" },
+        { "192.168.1.1:8080", "192.168.1.1" },
+        { "[::1]:8080", "[::1]" },
+        { "example.com.", "example.com." },
+    };
+    int failures = 0;
+
+    for (gsize i = 0; i < G_N_ELEMENTS(CASES); i++) {
+        OmniboxInput input;
+        omnibox_classify(CASES[i][0], &input);
+        gchar* host = input.host ? g_strndup(input.host, input.host_len) : NULL;
+        if (g_strcmp0(host, CASES[i][1]) != 0) {
+            fprintf(stderr, "omnibox: host of \"%s\" is \"%s\", expected \"%s\"\n",
+                    CASES[i][0], host ? host : "(null)", CASES[i][1]);
+            failures++;
+        }
+        g_free(host);
+    }
+    printf("omnibox host spans: %d failures\n", failures);
+    return failures;
+}
+
+static int test_psl(const char* dir) {
+    gchar* path = g_build_filename(dir, "psl_corpus.tsv", NULL);
+    GPtrArray* corpus = corpus_load(path);
+    g_free(path);
+    if (!corpus) return 1;
+
+    int failures = 0;
+    for (guint i = 0; i < corpus->len; i++) {
+        CorpusEntry* entry = g_ptr_array_index(corpus, i);
+        const char* got = psl_registrable_domain(entry->input);
+
+        if (g_strcmp0(got, entry->expected) != 0) {
+            fprintf(stderr, "psl: \"%s\" gives \"%s\", expected \"%s\"\n", entry->input, got, entry->expected);
+            failures++;
+        }
+    }
+    printf("psl: %u hosts, %d failures\n", corpus->len, failures);
+    g_ptr_array_unref(corpus);
+    return failures;
+}
+
+int main(int argc, char** argv) {
+    const char* dir = argc > 1 ? argv[1] : "tests";
+    int failures = test_omnibox(dir) + test_omnibox_host_span() + test_psl(dir);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,52 @@
+// Generated by tools/gen_theme_css.py from tools/themes.json. Do not edit.
+
+#define THEME_CSS_COUNT 3
+
+typedef struct {
+    const char* gtk_css;    // Browser chrome
+    const char* page_css;   // User stylesheet for every frame
+} ThemeCss;
+
+static const ThemeCss THEME_CSS[THEME_CSS_COUNT] = {
+    // light
+    {
+        "* { background-color: #fafafa; color: #333333; }\n"
+        "window { font-family: Inter, system-ui, -apple-system, sans-serif; font-size: 14px; }\n"
+        "*:selected { background-color: #0078d6; color: #fafafa; }\n"
+        "button:hover { background-color: #0085e3; color: #fafafa; }\n",
+        "body { background-color: #fafafa !important; color: #333333 !important; }\n"
+        "img, video, iframe { filter: none !important; }\n"
+        "a { color: #0078d6 !important; }\n"
+        "a:hover { color: #0085e3 !important; }\n"
+    },
+    // dark
+    {
+        "* { background-color: #212121; color: #e6e6e6; }\n"
+        "window { font-family: Inter, system-ui, -apple-system, sans-serif; font-size: 14px; }\n"
+        "*:selected { background-color: #0099ff; color: #212121; }\n"
+        "button:hover { background-color: #00b3ff; color: #212121; }\n",
+        "body { background-color: #212121 !important; color: #e6e6e6 !important; }\n"
+        "img, video, iframe { filter: brightness(0.9) !important; }\n"
+        "a { color: #0099ff !important; }\n"
+        "a:hover { color: #00b3ff !important; }\n"
+    },
+    // matrix
+    {
+        "* { background-color: #000000; color: #00ff00; }\n"
+        "window { font-family: monospace; font-size: 14px; }\n"
+        "*:selected { background-color: #00ff00; color: #000000; }\n"
+        "entry, button { background-color: #002200; border-color: #00ff00; }\n"
+        "button:hover { background-color: #003300; }\n",
+        "body { background-color: #000000 !important; color: #00ff00 !important; }\n"
+        "img, video, iframe { filter: brightness(1) !important; }\n"
+        "a { color: #00ff00 !important; }\n"
+        "a:hover { color: #00ff00 !important; }\n"
+        "img, video, iframe, .ytp-cued-thumbnail-overlay, .ytp-thumbnail { opacity: 1 !important; }\n"
+        "a { text-decoration: none !important; }\n"
+        "a:hover { text-shadow: 0 0 8px #00ff00 !important; }\n"
+        "pre, code { background: #001100 !important; color: #00ff00 !important; }\n"
+        "input, textarea, select { background: #001100 !important; color: #00ff00 !important; border: 1px solid #00ff00 !important; }\n"
+        "button { background: #002200 !important; color: #00ff00 !important; border: 1px solid #00ff00 !important; }\n"
+        "button:hover { background: #003300 !important; }\n"
+    },
+};
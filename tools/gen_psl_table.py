@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+"""Generate psl_table.h from the Public Suffix List.
+
+The table is a hash-and-displace perfect hash over every rule (ICANN and
+private sections), so a suffix lookup is two FNV-1a passes over the label
+bytes and one string compare, with no allocation.
+
+Usage: tools/gen_psl_table.py [public_suffix_list.dat] > psl_table.h
+"""
+
+import sys
+
+PSL_RULE = 1       # "example" is a public suffix
+PSL_WILDCARD = 2   # "*.example": every child of example is a public suffix
+PSL_EXCEPTION = 4  # "!www.example": not a public suffix despite a wildcard
+
+DEFAULT_PATH = "/usr/share/publicsuffix/public_suffix_list.dat"
+
+
+def fnv1a(data, seed):
+    h = (2166136261 ^ seed) & 0xFFFFFFFF
+    for b in data:
+        h ^= b
+        h = (h * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def ascii_forms(rule):
+    """The rule as written and, for IDN rules, its punycode form."""
+    forms = {rule}
+    try:
+        forms.add(".".join(label.encode("idna").decode("ascii") for label in rule.split(".")))
+    except UnicodeError:
+        pass
+    return forms
+
+
+def load_rules(path):
+    rules = {}
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            line = line.strip().split()[0] if line.strip() else ""
+            if not line or line.startswith("//"):
+                continue
+            flag = PSL_RULE
+            if line.startswith("!"):
+                flag, line = PSL_EXCEPTION, line[1:]
+            elif line.startswith("*."):
+                flag, line = PSL_WILDCARD, line[2:]
+            for form in ascii_forms(line.lower()):
+                key = form.encode("utf-8")
+                rules[key] = rules.get(key, 0) | flag
+    return rules
+
+
+def build(keys):
+    n_slots = len(keys) * 5 // 4 + 1
+    n_buckets = len(keys) // 4 + 1
+
+    buckets = [[] for _ in range(n_buckets)]
+    for key in keys:
+        buckets[fnv1a(key, 0) % n_buckets].append(key)
+
+    slots = [None] * n_slots
+    seeds = [0] * n_buckets
+    for index in sorted(range(n_buckets), key=lambda i: -len(buckets[i])):
+        bucket = buckets[index]
+        if not bucket:
+            continue
+        for seed in range(1, 65536):
+            positions = [fnv1a(key, seed) % n_slots for key in bucket]
+            if len(set(positions)) == len(positions) and all(slots[p] is None for p in positions):
+                break
+        else:
+            sys.exit("gen_psl_table: no seed found; grow the slot table")
+        seeds[index] = seed
+        for key, position in zip(bucket, positions):
+            slots[position] = key
+    return seeds, slots
+
+
+def c_string(data):
+    out = []
+    for b in data:
+        c = chr(b)
+        if b < 0x80 and (c.isalnum() or c in ".-_"):
+            out.append(c)
+        else:
+            out.append("\\%03o" % b)
+    return "".join(out)
+
+
+def main():
+    path = sys.argv[1] if len(sys.argv) > 1 else DEFAULT_PATH
+    rules = load_rules(path)
+    seeds, slots = build(sorted(rules))
+
+    offsets = {}
+    pool = []
+    size = 0
+    for key in sorted(rules):
+        offsets[key] = size
+        pool.append(key)
+        size += len(key)
+
+    w = sys.stdout.write
+    w("// Generated by tools/gen_psl_table.py from the Public Suffix List. Do not edit.\n")
+    w("// %d rules, %d slots, %d buckets.\n\n" % (len(rules), len(slots), len(seeds)))
+    w("#define PSL_RULE %d\n#define PSL_WILDCARD %d\n#define PSL_EXCEPTION %d\n\n"
+      % (PSL_RULE, PSL_WILDCARD, PSL_EXCEPTION))
+    w("#define PSL_BUCKETS %d\n#define PSL_SLOTS %d\n\n" % (len(seeds), len(slots)))
+    w("typedef struct {\n    unsigned int offset;\n    unsigned char length;   // 0 marks an empty slot\n"
+      "    unsigned char flags;\n} PslSlot;\n\n")
+
+    w("static const char psl_strings[] =\n")
+    for key in pool:
+        w('    "%s"\n' % c_string(key))
+    w(";\n\n")
+
+    w("static const unsigned short psl_seeds[PSL_BUCKETS] = {\n")
+    for i in range(0, len(seeds), 12):
+        w("    " + ", ".join(str(s) for s in seeds[i:i + 12]) + ",\n")
+    w("};\n\n")
+
+    w("static const PslSlot psl_slots[PSL_SLOTS] = {\n")
+    for key in slots:
+        if key is None:
+            w("    {0, 0, 0},\n")
+        else:
+            w("    {%d, %d, %d},\n" % (offsets[key], len(key), rules[key]))
+    w("};\n")
+
+
+if __name__ == "__main__":
+    main()
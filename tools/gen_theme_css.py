@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+"""Generate theme_css.h from the theme definitions in tools/themes.json.
+
+Each theme gives its colors and font once; this script expands them into
+the GTK stylesheet for the browser chrome and the user stylesheet injected
+into pages, so the browser installs constant strings and never formats CSS
+at runtime. Themes are emitted in BrowserMode order.
+
+Usage: tools/gen_theme_css.py [tools/themes.json] > theme_css.h
+"""
+
+import json
+import os
+import sys
+
+MODES = ["light", "dark", "matrix"]   # BrowserMode order
+REQUIRED = ["bg", "fg", "accent", "hover", "font_family", "font_size", "image_filter"]
+
+DEFAULT_PATH = os.path.join(os.path.dirname(os.path.abspath(__file__)), "themes.json")
+
+
+def gtk_css(t):
+    rules = [
+        "* { background-color: %(bg)s; color: %(fg)s; }",
+        "window { font-family: %(font_family)s; font-size: %(font_size)dpx; }",
+        "*:selected { background-color: %(accent)s; color: %(bg)s; }",
+    ]
+    if "control" in t:
+        rules += [
+            "entry, button { background-color: %(control)s; border-color: %(fg)s; }",
+            "button:hover { background-color: %(control_hover)s; }",
+        ]
+    else:
+        rules.append("button:hover { background-color: %(hover)s; color: %(bg)s; }")
+    return [r % t for r in rules]
+
+
+def page_css(t):
+    rules = [
+        "body { background-color: %(bg)s !important; color: %(fg)s !important; }",
+        "img, video, iframe { filter: %(image_filter)s !important; }",
+        "a { color: %(accent)s !important; }",
+        "a:hover { color: %(hover)s !important; }",
+    ]
+    if t.get("glow"):
+        rules += [
+            "img, video, iframe, .ytp-cued-thumbnail-overlay, .ytp-thumbnail { opacity: 1 !important; }",
+            "a { text-decoration: none !important; }",
+            "a:hover { text-shadow: 0 0 8px %(hover)s !important; }",
+        ]
+    if "surface" in t:
+        rules += [
+            "pre, code { background: %(surface)s !important; color: %(fg)s !important; }",
+            "input, textarea, select { background: %(surface)s !important; color: %(fg)s !important;"
+            " border: 1px solid %(fg)s !important; }",
+        ]
+    if "control" in t:
+        rules += [
+            "button { background: %(control)s !important; color: %(fg)s !important;"
+            " border: 1px solid %(fg)s !important; }",
+            "button:hover { background: %(control_hover)s !important; }",
+        ]
+    return [r % t for r in rules]
+
+
+def c_lines(rules):
+    return "".join('        "%s\\n"\n' % r.replace("\\", "\\\\").replace('"', '\\"') for r in rules)
+
+
+def main():
+    path = sys.argv[1] if len(sys.argv) > 1 else DEFAULT_PATH
+    with open(path, encoding="utf-8") as f:
+        themes = json.load(f)
+
+    for mode in MODES:
+        if mode not in themes:
+            sys.exit("gen_theme_css: %s has no \"%s\" theme" % (path, mode))
+        missing = [key for key in REQUIRED if key not in themes[mode]]
+        if missing:
+            sys.exit("gen_theme_css: theme \"%s\" lacks %s" % (mode, ", ".join(missing)))
+
+    w = sys.stdout.write
+    w("// Generated by tools/gen_theme_css.py from tools/themes.json. Do not edit.\n\n")
+    w("#define THEME_CSS_COUNT %d\n\n" % len(MODES))
+    w("typedef struct {\n    const char* gtk_css;    // Browser chrome\n"
+      "    const char* page_css;   // User stylesheet for every frame\n} ThemeCss;\n\n")
+    w("static const ThemeCss THEME_CSS[THEME_CSS_COUNT] = {\n")
+    for mode in MODES:
+        t = themes[mode]
+        w("    // %s\n    {\n" % mode)
+        w(c_lines(gtk_css(t)).rstrip("\n") + ",\n")
+        w(c_lines(page_css(t)))
+        w("    },\n")
+    w("};\n")
+
+
+if __name__ == "__main__":
+    main()